@@ -1,2 +1,3 @@
 #options = developer-build
 #options += static-lib
+#options += schema-codec
@@ -0,0 +1,206 @@
+/*
+   Copyright (C) 2014-2015 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include "CGZipInflater.hpp"
+
+#include <QDebug>
+#include <QtEndian>
+
+#include <zlib.h>
+
+static const quint32 s_maxPreallocatedSize = 8 * 1024 * 1024; // 8 MB; the size hint is not trusted above the value.
+
+CGZipInflater::CGZipInflater() :
+    m_stream(new z_stream),
+    m_initialized(false),
+    m_finished(true)
+{
+}
+
+CGZipInflater::~CGZipInflater()
+{
+    if (m_initialized) {
+        inflateEnd(m_stream);
+    }
+
+    delete m_stream;
+}
+
+QByteArray CGZipInflater::inflate(const QByteArray &data)
+{
+    if (!start(data)) {
+        return QByteArray();
+    }
+
+    quint32 expectedSize = sizeHint(data);
+
+    if (!expectedSize) {
+        expectedSize = data.size() * 4;
+    } else if (expectedSize > s_maxPreallocatedSize) {
+        expectedSize = s_maxPreallocatedSize;
+    }
+
+    QByteArray result;
+    result.resize(expectedSize);
+
+    int totalSize = 0;
+
+    while (!m_finished) {
+        if (totalSize == result.size()) {
+            result.resize(result.size() * 2);
+        }
+
+        const qint64 inflatedSize = inflateNext(result.data() + totalSize, result.size() - totalSize);
+
+        if (inflatedSize < 0) {
+            return QByteArray();
+        }
+
+        totalSize += inflatedSize;
+    }
+
+    result.resize(totalSize);
+
+    return result;
+}
+
+bool CGZipInflater::start(const QByteArray &data)
+{
+    if (data.size() <= 4) {
+        qDebug() << Q_FUNC_INFO << "Input data is too small to be gzip package";
+        return false;
+    }
+
+    if (m_initialized) {
+        if (inflateReset(m_stream) != Z_OK) {
+            return false;
+        }
+    } else {
+        m_stream->zalloc = Z_NULL;
+        m_stream->zfree = Z_NULL;
+        m_stream->opaque = Z_NULL;
+        m_stream->avail_in = 0;
+        m_stream->next_in = Z_NULL;
+
+        if (inflateInit2(m_stream, 15 + 32) != Z_OK) { // gzip decoding
+            return false;
+        }
+
+        m_initialized = true;
+    }
+
+    m_input = data; // Keep the (shared) data alive during inflating
+    m_stream->avail_in = m_input.size();
+    m_stream->next_in = (Bytef*)(m_input.constData());
+    m_finished = false;
+
+    return true;
+}
+
+qint64 CGZipInflater::inflateNext(char *output, qint64 maxSize)
+{
+    if (m_finished) {
+        return 0;
+    }
+
+    m_stream->avail_out = maxSize;
+    m_stream->next_out = (Bytef*)(output);
+
+    const int inflateResult = ::inflate(m_stream, Z_NO_FLUSH);
+    const qint64 inflatedSize = maxSize - m_stream->avail_out;
+
+    switch (inflateResult) {
+    case Z_OK:
+        break;
+    case Z_STREAM_END:
+        m_finished = true;
+        m_input.clear();
+        break;
+    case Z_BUF_ERROR: // No progress is possible
+        qDebug() << Q_FUNC_INFO << "Unexpected end of the gzip package";
+        m_finished = true;
+        m_input.clear();
+        return -1;
+    default:
+        qDebug() << Q_FUNC_INFO << "Inflate error" << inflateResult;
+        m_finished = true;
+        m_input.clear();
+        return -1;
+    }
+
+    return inflatedSize;
+}
+
+quint32 CGZipInflater::sizeHint(const QByteArray &data)
+{
+    if (data.size() < 4) {
+        return 0;
+    }
+
+    // ISIZE: the size of the original input modulo 2^32
+    return qFromLittleEndian<quint32>(reinterpret_cast<const uchar*>(data.constData() + data.size() - 4));
+}
+
+CGZipInflaterDevice::CGZipInflaterDevice(CGZipInflater *inflater, const QByteArray &data, QObject *parent) :
+    QIODevice(parent),
+    m_inflater(inflater),
+    m_size(0),
+    m_inflatedSize(0)
+{
+    if (m_inflater->start(data)) {
+        m_size = CGZipInflater::sizeHint(data);
+        open(QIODevice::ReadOnly);
+    }
+}
+
+bool CGZipInflaterDevice::isSequential() const
+{
+    return true;
+}
+
+qint64 CGZipInflaterDevice::bytesAvailable() const
+{
+    // The size hint comes from the sender, so it is capped to not cause a huge preallocation in a reader.
+    return QIODevice::bytesAvailable() + qBound(qint64(0), m_size - m_inflatedSize, qint64(s_maxPreallocatedSize));
+}
+
+qint64 CGZipInflaterDevice::readData(char *data, qint64 maxSize)
+{
+    qint64 totalSize = 0;
+
+    while ((totalSize < maxSize) && !m_inflater->atEnd()) {
+        const qint64 inflatedSize = m_inflater->inflateNext(data + totalSize, maxSize - totalSize);
+
+        if (inflatedSize < 0) {
+            return -1;
+        }
+
+        totalSize += inflatedSize;
+    }
+
+    m_inflatedSize += totalSize;
+
+    return totalSize;
+}
+
+qint64 CGZipInflaterDevice::writeData(const char *data, qint64 maxSize)
+{
+    Q_UNUSED(data)
+    Q_UNUSED(maxSize)
+
+    return -1;
+}
@@ -0,0 +1,71 @@
+/*
+   Copyright (C) 2014-2015 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef CGZIPINFLATER_HPP
+#define CGZIPINFLATER_HPP
+
+#include <QByteArray>
+#include <QIODevice>
+
+struct z_stream_s;
+
+class CGZipInflater
+{
+public:
+    CGZipInflater();
+    ~CGZipInflater();
+
+    QByteArray inflate(const QByteArray &data);
+
+    // Streaming mode
+    bool start(const QByteArray &data);
+    qint64 inflateNext(char *output, qint64 maxSize); // Returns -1 on error
+    bool atEnd() const { return m_finished; }
+
+    static quint32 sizeHint(const QByteArray &data); // Uncompressed size from the gzip trailer
+
+protected:
+    z_stream_s *m_stream;
+    QByteArray m_input;
+    bool m_initialized;
+    bool m_finished;
+
+private:
+    Q_DISABLE_COPY(CGZipInflater)
+
+};
+
+// Sequential device to read the uncompressed data on demand (e.g. via CTelegramStream).
+class CGZipInflaterDevice : public QIODevice
+{
+public:
+    explicit CGZipInflaterDevice(CGZipInflater *inflater, const QByteArray &data, QObject *parent = 0);
+
+    bool isSequential() const;
+    qint64 bytesAvailable() const;
+
+protected:
+    qint64 readData(char *data, qint64 maxSize);
+    qint64 writeData(const char *data, qint64 maxSize);
+
+    CGZipInflater *m_inflater;
+    qint64 m_size;
+    qint64 m_inflatedSize;
+
+};
+
+#endif // CGZIPINFLATER_HPP
@@ -19,6 +19,9 @@
 
 #include <QIODevice>
 #include <QBuffer>
+#include <QtEndian>
+
+#include <limits.h>
 
 template CRawStream &CRawStream::operator>>(TLNumber128 &v);
 template CRawStream &CRawStream::operator>>(TLNumber256 &v);
@@ -29,7 +32,10 @@ template CRawStream &CRawStream::operator<<(const TLNumber256 &v);
 CRawStream::CRawStream(QByteArray *data, bool write) :
     m_device(new QBuffer(data)),
     m_ownDevice(true),
-    m_error(false)
+    m_error(false),
+    m_spanBegin(0),
+    m_spanSize(0),
+    m_spanPosition(0)
 {
     if (write) {
         m_device->open(QIODevice::Append);
@@ -40,20 +46,22 @@ CRawStream::CRawStream(QByteArray *data, bool write) :
 
 CRawStream::CRawStream(const QByteArray &data) :
     m_device(0),
-    m_ownDevice(true),
-    m_error(false)
+    m_ownDevice(false),
+    m_error(false),
+    m_spanData(data),
+    m_spanBegin(m_spanData.constData()),
+    m_spanSize(m_spanData.size()),
+    m_spanPosition(0)
 {
-    QBuffer *buffer = new QBuffer();
-    buffer->setData(data);
-    m_device = buffer;
-
-    m_device->open(QIODevice::ReadOnly);
 }
 
 CRawStream::CRawStream(QIODevice *d) :
     m_device(d),
     m_ownDevice(false),
-    m_error(false)
+    m_error(false),
+    m_spanBegin(0),
+    m_spanSize(0),
+    m_spanPosition(0)
 {
 }
 
@@ -73,6 +81,12 @@ void CRawStream::setDevice(QIODevice *newDevice)
     }
 
     m_device = newDevice;
+    m_ownDevice = false;
+
+    m_spanData.clear();
+    m_spanBegin = 0;
+    m_spanSize = 0;
+    m_spanPosition = 0;
 }
 
 void CRawStream::unsetDevice()
@@ -82,15 +96,32 @@ void CRawStream::unsetDevice()
 
 bool CRawStream::atEnd() const
 {
-    return m_device ? m_device->atEnd() : true;
+    if (m_device) {
+        return m_device->atEnd();
+    }
+
+    return m_spanPosition >= m_spanSize;
 }
 
 int CRawStream::bytesRemaining() const
 {
-    return m_device->bytesAvailable();
+    if (m_device) {
+        return int(qMin(m_device->bytesAvailable(), qint64(INT_MAX)));
+    }
+
+    return m_spanSize - m_spanPosition;
+}
+
+int CRawStream::position() const
+{
+    if (m_device) {
+        return m_device->pos();
+    }
+
+    return m_spanPosition;
 }
 
-bool CRawStream::read(void *data, qint64 size)
+bool CRawStream::readFromDevice(void *data, qint64 size)
 {
     m_error = m_error || m_device->read((char *) data, size) != size;
     return m_error;
@@ -98,26 +129,179 @@ bool CRawStream::read(void *data, qint64 size)
 
 bool CRawStream::write(const void *data, qint64 size)
 {
+    if (!m_device) {
+        // Span mode is read-only
+        m_error = true;
+        return m_error;
+    }
+
     m_error = m_error || m_device->write((const char *) data, size) != size;
     return m_error;
 }
 
 QByteArray CRawStream::readBytes(int count)
 {
+    if (!m_device) {
+        const int available = m_spanSize - m_spanPosition;
+        const int size = qMin(count, available);
+        QByteArray result(m_spanBegin + m_spanPosition, size);
+        m_spanPosition += size;
+        m_error = m_error || size != count;
+        return result;
+    }
+
     QByteArray result = m_device->read(count);
     m_error = m_error || result.size() != count;
     return result;
 }
 
+/* In span mode returns a slice of the stream data without copying (QByteArray::fromRawData).
+ * The slice is valid only while the QByteArray passed to the constructor is alive and not modified;
+ * call detach() on the result to keep it longer. In device mode it is the same as readBytes(). */
+QByteArray CRawStream::readSharedBytes(int count)
+{
+    if (m_device) {
+        return readBytes(count);
+    }
+
+    const int available = m_spanSize - m_spanPosition;
+    const int size = qMin(count, available);
+    const QByteArray result = QByteArray::fromRawData(m_spanBegin + m_spanPosition, size);
+    m_spanPosition += size;
+    m_error = m_error || size != count;
+    return result;
+}
+
+void CRawStream::skipBytes(int count)
+{
+    if (m_device) {
+        char buffer[256];
+
+        while ((count > 0) && !m_error) {
+            const int chunkSize = qMin(count, int(sizeof(buffer)));
+            readFromDevice(buffer, chunkSize);
+            count -= chunkSize;
+        }
+
+        return;
+    }
+
+    if (count > m_spanSize - m_spanPosition) {
+        m_spanPosition = m_spanSize;
+        m_error = true;
+        return;
+    }
+
+    m_spanPosition += count;
+}
+
+QByteArray CRawStream::bytesAt(int position, int count)
+{
+    if ((position < 0) || (count < 0)) {
+        m_error = true;
+        return QByteArray();
+    }
+
+    if (m_device) {
+        if (m_device->isSequential()) {
+            // Passed data of a sequential device is lost
+            m_error = true;
+            return QByteArray();
+        }
+
+        const qint64 currentPosition = m_device->pos();
+        QByteArray data;
+
+        if (m_device->seek(position)) {
+            data = m_device->read(count);
+        }
+
+        m_device->seek(currentPosition);
+
+        if (data.size() != count) {
+            m_error = true;
+            return QByteArray();
+        }
+
+        return data;
+    }
+
+    if (position + count > m_spanSize) {
+        m_error = true;
+        return QByteArray();
+    }
+
+    return m_spanData.mid(position, count);
+}
+
+bool CRawStream::peekData(void *data, int size, int offset)
+{
+    if (m_device) {
+        const QByteArray peekedData = m_device->peek(offset + size);
+
+        if (peekedData.size() != offset + size) {
+            return false;
+        }
+
+        memcpy(data, peekedData.constData() + offset, size);
+        return true;
+    }
+
+    if (m_spanPosition + offset + size > m_spanSize) {
+        return false;
+    }
+
+    memcpy(data, m_spanBegin + m_spanPosition + offset, size);
+    return true;
+}
+
+bool CRawStream::peek(quint32 &value, int offset)
+{
+    quint32 data;
+
+    if (!peekData(&data, sizeof(data), offset)) {
+        return false;
+    }
+
+    value = qFromLittleEndian(data);
+    return true;
+}
+
+bool CRawStream::peek(quint64 &value, int offset)
+{
+    quint64 data;
+
+    if (!peekData(&data, sizeof(data), offset)) {
+        return false;
+    }
+
+    value = qFromLittleEndian(data);
+    return true;
+}
+
+bool CRawStream::peek(TLValue &value, int offset)
+{
+    quint32 data;
+
+    if (!peek(data, offset)) {
+        return false;
+    }
+
+    value = TLValue(data);
+    return true;
+}
+
 CRawStream &CRawStream::operator>>(qint32 &i)
 {
     read(&i, 4);
+    i = qFromLittleEndian(i);
     return *this;
 }
 
 CRawStream &CRawStream::operator>>(qint64 &i)
 {
     read(&i, 8);
+    i = qFromLittleEndian(i);
     return *this;
 }
 
@@ -129,12 +313,14 @@ CRawStream &CRawStream::operator>>(double &d)
 
 CRawStream &CRawStream::operator<<(qint32 i)
 {
+    i = qToLittleEndian(i);
     write(&i, 4);
     return *this;
 }
 
 CRawStream &CRawStream::operator<<(qint64 i)
 {
+    i = qToLittleEndian(i);
     write(&i, 8);
     return *this;
 }
@@ -147,6 +333,11 @@ CRawStream &CRawStream::operator<<(const double &d)
 
 CRawStream &CRawStream::operator<<(const QByteArray &data)
 {
+    if (!m_device) {
+        m_error = true;
+        return *this;
+    }
+
     m_error = m_error || m_device->write(data) != data.size();
 
     return *this;
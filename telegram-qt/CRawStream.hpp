@@ -22,6 +22,8 @@
 
 #include <QByteArray>
 
+#include <string.h>
+
 #include "TLNumbers.hpp"
 #include "TLValues.hpp"
 
@@ -48,10 +50,23 @@ public:
 
     bool atEnd() const;
     int bytesRemaining() const;
+    int position() const;
 
     QByteArray readBytes(int count);
+    QByteArray readSharedBytes(int count);
 
     QByteArray readRemainingBytes();
+    QByteArray readRemainingSharedBytes();
+
+    void skipBytes(int count);
+
+    // Read already passed (or not yet read) data without the stream position change.
+    QByteArray bytesAt(int position, int count);
+
+    // Read a value without the stream position change. Returns false if there is not enough data.
+    bool peek(quint32 &value, int offset = 0);
+    bool peek(quint64 &value, int offset = 0);
+    bool peek(TLValue &value, int offset = 0);
 
     CRawStream &operator>>(qint32 &i);
     CRawStream &operator>>(quint32 &i);
@@ -80,14 +95,23 @@ public:
     CRawStream &operator<<(const QByteArray &data);
 
 protected:
-    bool read(void *data, qint64 size);
+    inline bool read(void *data, qint64 size);
     bool write(const void *data, qint64 size);
 
 private:
+    bool readFromDevice(void *data, qint64 size);
+    bool peekData(void *data, int size, int offset);
+
     QIODevice *m_device;
     bool m_ownDevice;
     bool m_error;
 
+    // Span mode (no device): read directly from the memory of m_spanData.
+    QByteArray m_spanData;
+    const char *m_spanBegin;
+    int m_spanSize;
+    int m_spanPosition;
+
 };
 
 inline void CRawStream::resetError()
@@ -95,11 +119,36 @@ inline void CRawStream::resetError()
     m_error = false;
 }
 
+inline bool CRawStream::read(void *data, qint64 size)
+{
+    if (m_device) {
+        return readFromDevice(data, size);
+    }
+
+    const int available = m_spanSize - m_spanPosition;
+
+    if (size > available) {
+        memcpy(data, m_spanBegin + m_spanPosition, available);
+        m_spanPosition = m_spanSize;
+        m_error = true;
+        return m_error;
+    }
+
+    memcpy(data, m_spanBegin + m_spanPosition, size);
+    m_spanPosition += size;
+    return m_error;
+}
+
 inline QByteArray CRawStream::readRemainingBytes()
 {
     return readBytes(bytesRemaining());
 }
 
+inline QByteArray CRawStream::readRemainingSharedBytes()
+{
+    return readSharedBytes(bytesRemaining());
+}
+
 inline CRawStream &CRawStream::operator>>(quint32 &i)
 {
     return *this >> reinterpret_cast<qint32&>(i);
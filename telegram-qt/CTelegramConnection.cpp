@@ -47,6 +47,12 @@ QString formatTLValue(const TLValue &val)
 using namespace TelegramUtils;
 
 static const quint32 s_defaultAuthInterval = 15000; // 15 sec
+static const quint32 s_futureSaltsRequestCount = 32; // Server limit is 64
+static const int s_futureSaltsMinimumCount = 4; // Request new salts, if there are less known salts
+static const int s_clockSamplesCount = 8;
+static const int s_packingThreshold = 1024; // Smaller packages are sent as is
+static const int s_packingSampleSize = 256;
+static const int s_packingMaxSampleDistinctBytes = 128; // Random (compressed or encrypted) data has about 160 distinct values per 256 bytes
 
 CTelegramConnection::CTelegramConnection(const CAppInformation *appInfo, QObject *parent) :
     QObject(parent),
@@ -59,7 +65,9 @@ CTelegramConnection::CTelegramConnection(const CAppInformation *appInfo, QObject
     m_authState(AuthStateNone),
     m_authId(0),
     m_authKeyAuxHash(0),
+    m_keyAuthorized(true),
     m_serverSalt(0),
+    m_futureSaltsRequestId(0),
     m_sessionId(0),
     m_lastMessageId(0),
     m_lastSentPingId(0),
@@ -68,8 +76,13 @@ CTelegramConnection::CTelegramConnection(const CAppInformation *appInfo, QObject
     m_pingInterval(0),
     m_serverDisconnectionExtraTime(0),
     m_deltaTime(0),
-    m_deltaTimeHeuristicState(DeltaTimeIsOk),
-    m_serverPublicFingersprint(0)
+    m_clockOffset(0),
+    m_plainPackageSentTime(0),
+    m_receivedMessageId(0),
+    m_serverPublicFingersprint(0),
+    m_packingSavedBytes(0),
+    m_stringPool(0),
+    m_updatesDifferenceVisitor(0)
   #ifdef NETWORK_LOGGING
   , m_logFile(0)
   #endif
@@ -102,6 +115,7 @@ void CTelegramConnection::connectToDc()
 
     setStatus(ConnectionStatusConnecting);
     setAuthState(AuthStateNone);
+    m_futureSaltsRequestId = 0;
     m_transport->connectToHost(m_dcInfo.ipAddress, m_dcInfo.port);
 }
 
@@ -124,6 +138,7 @@ void CTelegramConnection::setAuthKey(const QByteArray &newAuthKey)
 void CTelegramConnection::setDeltaTime(const qint32 newDt)
 {
     m_deltaTime = newDt;
+    m_clockOffset = qint64(newDt) * 1000;
 
     // Message id depends on time, so if we fix time, we need to reset message id.
     m_lastMessageId = 0;
@@ -284,6 +299,7 @@ quint64 CTelegramConnection::sendMedia(const TLInputPeer &peer, const TLInputMed
 quint64 CTelegramConnection::accountChangePhone(const QString &phoneNumber, const QString &phoneCodeHash, const QString &phoneCode)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(phoneNumber) + CTelegramStream::serializedSize(phoneCodeHash) + CTelegramStream::serializedSize(phoneCode));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AccountChangePhone;
@@ -297,6 +313,7 @@ quint64 CTelegramConnection::accountChangePhone(const QString &phoneNumber, cons
 quint64 CTelegramConnection::accountCheckUsername(const QString &username)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(username));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AccountCheckUsername;
@@ -308,6 +325,7 @@ quint64 CTelegramConnection::accountCheckUsername(const QString &username)
 quint64 CTelegramConnection::accountDeleteAccount(const QString &reason)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(reason));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AccountDeleteAccount;
@@ -319,6 +337,7 @@ quint64 CTelegramConnection::accountDeleteAccount(const QString &reason)
 quint64 CTelegramConnection::accountGetAccountTTL()
 {
     QByteArray output;
+    output.reserve(4);
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AccountGetAccountTTL;
@@ -329,6 +348,7 @@ quint64 CTelegramConnection::accountGetAccountTTL()
 quint64 CTelegramConnection::accountGetAuthorizations()
 {
     QByteArray output;
+    output.reserve(4);
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AccountGetAuthorizations;
@@ -339,6 +359,7 @@ quint64 CTelegramConnection::accountGetAuthorizations()
 quint64 CTelegramConnection::accountGetNotifySettings(const TLInputNotifyPeer &peer)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(peer));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AccountGetNotifySettings;
@@ -350,6 +371,7 @@ quint64 CTelegramConnection::accountGetNotifySettings(const TLInputNotifyPeer &p
 quint64 CTelegramConnection::accountGetPassword()
 {
     QByteArray output;
+    output.reserve(4);
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AccountGetPassword;
@@ -360,6 +382,7 @@ quint64 CTelegramConnection::accountGetPassword()
 quint64 CTelegramConnection::accountGetPasswordSettings(const QByteArray &currentPasswordHash)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(currentPasswordHash));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AccountGetPasswordSettings;
@@ -371,6 +394,7 @@ quint64 CTelegramConnection::accountGetPasswordSettings(const QByteArray &curren
 quint64 CTelegramConnection::accountGetPrivacy(const TLInputPrivacyKey &key)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(key));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AccountGetPrivacy;
@@ -382,6 +406,7 @@ quint64 CTelegramConnection::accountGetPrivacy(const TLInputPrivacyKey &key)
 quint64 CTelegramConnection::accountGetWallPapers()
 {
     QByteArray output;
+    output.reserve(4);
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AccountGetWallPapers;
@@ -392,6 +417,7 @@ quint64 CTelegramConnection::accountGetWallPapers()
 quint64 CTelegramConnection::accountRegisterDevice(quint32 tokenType, const QString &token, const QString &deviceModel, const QString &systemVersion, const QString &appVersion, bool appSandbox, const QString &langCode)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(tokenType) + CTelegramStream::serializedSize(token) + CTelegramStream::serializedSize(deviceModel) + CTelegramStream::serializedSize(systemVersion) + CTelegramStream::serializedSize(appVersion) + CTelegramStream::serializedSize(appSandbox) + CTelegramStream::serializedSize(langCode));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AccountRegisterDevice;
@@ -409,6 +435,7 @@ quint64 CTelegramConnection::accountRegisterDevice(quint32 tokenType, const QStr
 quint64 CTelegramConnection::accountResetAuthorization(quint64 hash)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(hash));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AccountResetAuthorization;
@@ -420,6 +447,7 @@ quint64 CTelegramConnection::accountResetAuthorization(quint64 hash)
 quint64 CTelegramConnection::accountResetNotifySettings()
 {
     QByteArray output;
+    output.reserve(4);
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AccountResetNotifySettings;
@@ -430,6 +458,7 @@ quint64 CTelegramConnection::accountResetNotifySettings()
 quint64 CTelegramConnection::accountSendChangePhoneCode(const QString &phoneNumber)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(phoneNumber));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AccountSendChangePhoneCode;
@@ -441,6 +470,7 @@ quint64 CTelegramConnection::accountSendChangePhoneCode(const QString &phoneNumb
 quint64 CTelegramConnection::accountSetAccountTTL(const TLAccountDaysTTL &ttl)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(ttl));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AccountSetAccountTTL;
@@ -452,6 +482,7 @@ quint64 CTelegramConnection::accountSetAccountTTL(const TLAccountDaysTTL &ttl)
 quint64 CTelegramConnection::accountSetPrivacy(const TLInputPrivacyKey &key, const TLVector<TLInputPrivacyRule> &rules)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(key) + CTelegramStream::serializedSize(rules));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AccountSetPrivacy;
@@ -464,6 +495,7 @@ quint64 CTelegramConnection::accountSetPrivacy(const TLInputPrivacyKey &key, con
 quint64 CTelegramConnection::accountUnregisterDevice(quint32 tokenType, const QString &token)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(tokenType) + CTelegramStream::serializedSize(token));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AccountUnregisterDevice;
@@ -476,6 +508,7 @@ quint64 CTelegramConnection::accountUnregisterDevice(quint32 tokenType, const QS
 quint64 CTelegramConnection::accountUpdateDeviceLocked(quint32 period)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(period));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AccountUpdateDeviceLocked;
@@ -487,6 +520,7 @@ quint64 CTelegramConnection::accountUpdateDeviceLocked(quint32 period)
 quint64 CTelegramConnection::accountUpdateNotifySettings(const TLInputNotifyPeer &peer, const TLInputPeerNotifySettings &settings)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(peer) + CTelegramStream::serializedSize(settings));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AccountUpdateNotifySettings;
@@ -499,6 +533,7 @@ quint64 CTelegramConnection::accountUpdateNotifySettings(const TLInputNotifyPeer
 quint64 CTelegramConnection::accountUpdatePasswordSettings(const QByteArray &currentPasswordHash, const TLAccountPasswordInputSettings &newSettings)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(currentPasswordHash) + CTelegramStream::serializedSize(newSettings));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AccountUpdatePasswordSettings;
@@ -511,6 +546,7 @@ quint64 CTelegramConnection::accountUpdatePasswordSettings(const QByteArray &cur
 quint64 CTelegramConnection::accountUpdateProfile(const QString &firstName, const QString &lastName)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(firstName) + CTelegramStream::serializedSize(lastName));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AccountUpdateProfile;
@@ -523,6 +559,7 @@ quint64 CTelegramConnection::accountUpdateProfile(const QString &firstName, cons
 quint64 CTelegramConnection::accountUpdateStatus(bool offline)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(offline));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AccountUpdateStatus;
@@ -534,6 +571,7 @@ quint64 CTelegramConnection::accountUpdateStatus(bool offline)
 quint64 CTelegramConnection::accountUpdateUsername(const QString &username)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(username));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AccountUpdateUsername;
@@ -545,6 +583,7 @@ quint64 CTelegramConnection::accountUpdateUsername(const QString &username)
 quint64 CTelegramConnection::authBindTempAuthKey(quint64 permAuthKeyId, quint64 nonce, quint32 expiresAt, const QByteArray &encryptedMessage)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(permAuthKeyId) + CTelegramStream::serializedSize(nonce) + CTelegramStream::serializedSize(expiresAt) + CTelegramStream::serializedSize(encryptedMessage));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AuthBindTempAuthKey;
@@ -559,6 +598,7 @@ quint64 CTelegramConnection::authBindTempAuthKey(quint64 permAuthKeyId, quint64
 quint64 CTelegramConnection::authCheckPassword(const QByteArray &passwordHash)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(passwordHash));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AuthCheckPassword;
@@ -570,6 +610,7 @@ quint64 CTelegramConnection::authCheckPassword(const QByteArray &passwordHash)
 quint64 CTelegramConnection::authCheckPhone(const QString &phoneNumber)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(phoneNumber));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AuthCheckPhone;
@@ -581,6 +622,7 @@ quint64 CTelegramConnection::authCheckPhone(const QString &phoneNumber)
 quint64 CTelegramConnection::authExportAuthorization(quint32 dcId)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(dcId));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AuthExportAuthorization;
@@ -592,6 +634,7 @@ quint64 CTelegramConnection::authExportAuthorization(quint32 dcId)
 quint64 CTelegramConnection::authImportAuthorization(quint32 id, const QByteArray &bytes)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(id) + CTelegramStream::serializedSize(bytes));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AuthImportAuthorization;
@@ -604,6 +647,7 @@ quint64 CTelegramConnection::authImportAuthorization(quint32 id, const QByteArra
 quint64 CTelegramConnection::authLogOut()
 {
     QByteArray output;
+    output.reserve(4);
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AuthLogOut;
@@ -614,6 +658,7 @@ quint64 CTelegramConnection::authLogOut()
 quint64 CTelegramConnection::authRecoverPassword(const QString &code)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(code));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AuthRecoverPassword;
@@ -625,6 +670,7 @@ quint64 CTelegramConnection::authRecoverPassword(const QString &code)
 quint64 CTelegramConnection::authRequestPasswordRecovery()
 {
     QByteArray output;
+    output.reserve(4);
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AuthRequestPasswordRecovery;
@@ -635,6 +681,7 @@ quint64 CTelegramConnection::authRequestPasswordRecovery()
 quint64 CTelegramConnection::authResetAuthorizations()
 {
     QByteArray output;
+    output.reserve(4);
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AuthResetAuthorizations;
@@ -645,6 +692,7 @@ quint64 CTelegramConnection::authResetAuthorizations()
 quint64 CTelegramConnection::authSendCall(const QString &phoneNumber, const QString &phoneCodeHash)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(phoneNumber) + CTelegramStream::serializedSize(phoneCodeHash));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AuthSendCall;
@@ -657,6 +705,7 @@ quint64 CTelegramConnection::authSendCall(const QString &phoneNumber, const QStr
 quint64 CTelegramConnection::authSendCode(const QString &phoneNumber, quint32 smsType, quint32 apiId, const QString &apiHash, const QString &langCode)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(phoneNumber) + CTelegramStream::serializedSize(smsType) + CTelegramStream::serializedSize(apiId) + CTelegramStream::serializedSize(apiHash) + CTelegramStream::serializedSize(langCode));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AuthSendCode;
@@ -672,6 +721,7 @@ quint64 CTelegramConnection::authSendCode(const QString &phoneNumber, quint32 sm
 quint64 CTelegramConnection::authSendInvites(const TLVector<QString> &phoneNumbers, const QString &message)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(phoneNumbers) + CTelegramStream::serializedSize(message));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AuthSendInvites;
@@ -684,6 +734,7 @@ quint64 CTelegramConnection::authSendInvites(const TLVector<QString> &phoneNumbe
 quint64 CTelegramConnection::authSendSms(const QString &phoneNumber, const QString &phoneCodeHash)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(phoneNumber) + CTelegramStream::serializedSize(phoneCodeHash));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AuthSendSms;
@@ -696,6 +747,7 @@ quint64 CTelegramConnection::authSendSms(const QString &phoneNumber, const QStri
 quint64 CTelegramConnection::authSignIn(const QString &phoneNumber, const QString &phoneCodeHash, const QString &phoneCode)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(phoneNumber) + CTelegramStream::serializedSize(phoneCodeHash) + CTelegramStream::serializedSize(phoneCode));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AuthSignIn;
@@ -709,6 +761,7 @@ quint64 CTelegramConnection::authSignIn(const QString &phoneNumber, const QStrin
 quint64 CTelegramConnection::authSignUp(const QString &phoneNumber, const QString &phoneCodeHash, const QString &phoneCode, const QString &firstName, const QString &lastName)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(phoneNumber) + CTelegramStream::serializedSize(phoneCodeHash) + CTelegramStream::serializedSize(phoneCode) + CTelegramStream::serializedSize(firstName) + CTelegramStream::serializedSize(lastName));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::AuthSignUp;
@@ -724,6 +777,7 @@ quint64 CTelegramConnection::authSignUp(const QString &phoneNumber, const QStrin
 quint64 CTelegramConnection::contactsBlock(const TLInputUser &id)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(id));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::ContactsBlock;
@@ -735,6 +789,7 @@ quint64 CTelegramConnection::contactsBlock(const TLInputUser &id)
 quint64 CTelegramConnection::contactsDeleteContact(const TLInputUser &id)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(id));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::ContactsDeleteContact;
@@ -746,6 +801,7 @@ quint64 CTelegramConnection::contactsDeleteContact(const TLInputUser &id)
 quint64 CTelegramConnection::contactsDeleteContacts(const TLVector<TLInputUser> &id)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(id));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::ContactsDeleteContacts;
@@ -757,6 +813,7 @@ quint64 CTelegramConnection::contactsDeleteContacts(const TLVector<TLInputUser>
 quint64 CTelegramConnection::contactsExportCard()
 {
     QByteArray output;
+    output.reserve(4);
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::ContactsExportCard;
@@ -767,6 +824,7 @@ quint64 CTelegramConnection::contactsExportCard()
 quint64 CTelegramConnection::contactsGetBlocked(quint32 offset, quint32 limit)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(offset) + CTelegramStream::serializedSize(limit));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::ContactsGetBlocked;
@@ -779,6 +837,7 @@ quint64 CTelegramConnection::contactsGetBlocked(quint32 offset, quint32 limit)
 quint64 CTelegramConnection::contactsGetContacts(const QString &hash)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(hash));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::ContactsGetContacts;
@@ -790,6 +849,7 @@ quint64 CTelegramConnection::contactsGetContacts(const QString &hash)
 quint64 CTelegramConnection::contactsGetStatuses()
 {
     QByteArray output;
+    output.reserve(4);
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::ContactsGetStatuses;
@@ -800,6 +860,7 @@ quint64 CTelegramConnection::contactsGetStatuses()
 quint64 CTelegramConnection::contactsGetSuggested(quint32 limit)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(limit));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::ContactsGetSuggested;
@@ -811,6 +872,7 @@ quint64 CTelegramConnection::contactsGetSuggested(quint32 limit)
 quint64 CTelegramConnection::contactsImportCard(const TLVector<quint32> &exportCard)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(exportCard));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::ContactsImportCard;
@@ -822,6 +884,7 @@ quint64 CTelegramConnection::contactsImportCard(const TLVector<quint32> &exportC
 quint64 CTelegramConnection::contactsImportContacts(const TLVector<TLInputContact> &contacts, bool replace)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(contacts) + CTelegramStream::serializedSize(replace));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::ContactsImportContacts;
@@ -834,6 +897,7 @@ quint64 CTelegramConnection::contactsImportContacts(const TLVector<TLInputContac
 quint64 CTelegramConnection::contactsResolveUsername(const QString &username)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(username));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::ContactsResolveUsername;
@@ -845,6 +909,7 @@ quint64 CTelegramConnection::contactsResolveUsername(const QString &username)
 quint64 CTelegramConnection::contactsSearch(const QString &q, quint32 limit)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(q) + CTelegramStream::serializedSize(limit));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::ContactsSearch;
@@ -857,6 +922,7 @@ quint64 CTelegramConnection::contactsSearch(const QString &q, quint32 limit)
 quint64 CTelegramConnection::contactsUnblock(const TLInputUser &id)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(id));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::ContactsUnblock;
@@ -868,6 +934,7 @@ quint64 CTelegramConnection::contactsUnblock(const TLInputUser &id)
 quint64 CTelegramConnection::messagesAcceptEncryption(const TLInputEncryptedChat &peer, const QByteArray &gB, quint64 keyFingerprint)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(peer) + CTelegramStream::serializedSize(gB) + CTelegramStream::serializedSize(keyFingerprint));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesAcceptEncryption;
@@ -881,6 +948,7 @@ quint64 CTelegramConnection::messagesAcceptEncryption(const TLInputEncryptedChat
 quint64 CTelegramConnection::messagesAddChatUser(quint32 chatId, const TLInputUser &userId, quint32 fwdLimit)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(chatId) + CTelegramStream::serializedSize(userId) + CTelegramStream::serializedSize(fwdLimit));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesAddChatUser;
@@ -894,6 +962,7 @@ quint64 CTelegramConnection::messagesAddChatUser(quint32 chatId, const TLInputUs
 quint64 CTelegramConnection::messagesCheckChatInvite(const QString &hash)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(hash));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesCheckChatInvite;
@@ -905,6 +974,7 @@ quint64 CTelegramConnection::messagesCheckChatInvite(const QString &hash)
 quint64 CTelegramConnection::messagesCreateChat(const TLVector<TLInputUser> &users, const QString &title)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(users) + CTelegramStream::serializedSize(title));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesCreateChat;
@@ -917,6 +987,7 @@ quint64 CTelegramConnection::messagesCreateChat(const TLVector<TLInputUser> &use
 quint64 CTelegramConnection::messagesDeleteChatUser(quint32 chatId, const TLInputUser &userId)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(chatId) + CTelegramStream::serializedSize(userId));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesDeleteChatUser;
@@ -929,6 +1000,7 @@ quint64 CTelegramConnection::messagesDeleteChatUser(quint32 chatId, const TLInpu
 quint64 CTelegramConnection::messagesDeleteHistory(const TLInputPeer &peer, quint32 offset)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(peer) + CTelegramStream::serializedSize(offset));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesDeleteHistory;
@@ -941,6 +1013,7 @@ quint64 CTelegramConnection::messagesDeleteHistory(const TLInputPeer &peer, quin
 quint64 CTelegramConnection::messagesDeleteMessages(const TLVector<quint32> &id)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(id));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesDeleteMessages;
@@ -952,6 +1025,7 @@ quint64 CTelegramConnection::messagesDeleteMessages(const TLVector<quint32> &id)
 quint64 CTelegramConnection::messagesDiscardEncryption(quint32 chatId)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(chatId));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesDiscardEncryption;
@@ -963,6 +1037,7 @@ quint64 CTelegramConnection::messagesDiscardEncryption(quint32 chatId)
 quint64 CTelegramConnection::messagesEditChatPhoto(quint32 chatId, const TLInputChatPhoto &photo)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(chatId) + CTelegramStream::serializedSize(photo));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesEditChatPhoto;
@@ -975,6 +1050,7 @@ quint64 CTelegramConnection::messagesEditChatPhoto(quint32 chatId, const TLInput
 quint64 CTelegramConnection::messagesEditChatTitle(quint32 chatId, const QString &title)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(chatId) + CTelegramStream::serializedSize(title));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesEditChatTitle;
@@ -987,6 +1063,7 @@ quint64 CTelegramConnection::messagesEditChatTitle(quint32 chatId, const QString
 quint64 CTelegramConnection::messagesExportChatInvite(quint32 chatId)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(chatId));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesExportChatInvite;
@@ -998,6 +1075,7 @@ quint64 CTelegramConnection::messagesExportChatInvite(quint32 chatId)
 quint64 CTelegramConnection::messagesForwardMessage(const TLInputPeer &peer, quint32 id, quint64 randomId)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(peer) + CTelegramStream::serializedSize(id) + CTelegramStream::serializedSize(randomId));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesForwardMessage;
@@ -1011,6 +1089,7 @@ quint64 CTelegramConnection::messagesForwardMessage(const TLInputPeer &peer, qui
 quint64 CTelegramConnection::messagesForwardMessages(const TLInputPeer &peer, const TLVector<quint32> &id, const TLVector<quint64> &randomId)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(peer) + CTelegramStream::serializedSize(id) + CTelegramStream::serializedSize(randomId));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesForwardMessages;
@@ -1024,6 +1103,7 @@ quint64 CTelegramConnection::messagesForwardMessages(const TLInputPeer &peer, co
 quint64 CTelegramConnection::messagesGetAllStickers(const QString &hash)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(hash));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesGetAllStickers;
@@ -1035,6 +1115,7 @@ quint64 CTelegramConnection::messagesGetAllStickers(const QString &hash)
 quint64 CTelegramConnection::messagesGetChats(const TLVector<quint32> &id)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(id));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesGetChats;
@@ -1046,6 +1127,7 @@ quint64 CTelegramConnection::messagesGetChats(const TLVector<quint32> &id)
 quint64 CTelegramConnection::messagesGetDhConfig(quint32 version, quint32 randomLength)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(version) + CTelegramStream::serializedSize(randomLength));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesGetDhConfig;
@@ -1058,6 +1140,7 @@ quint64 CTelegramConnection::messagesGetDhConfig(quint32 version, quint32 random
 quint64 CTelegramConnection::messagesGetDialogs(quint32 offset, quint32 maxId, quint32 limit)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(offset) + CTelegramStream::serializedSize(maxId) + CTelegramStream::serializedSize(limit));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesGetDialogs;
@@ -1071,6 +1154,7 @@ quint64 CTelegramConnection::messagesGetDialogs(quint32 offset, quint32 maxId, q
 quint64 CTelegramConnection::messagesGetFullChat(quint32 chatId)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(chatId));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesGetFullChat;
@@ -1082,6 +1166,7 @@ quint64 CTelegramConnection::messagesGetFullChat(quint32 chatId)
 quint64 CTelegramConnection::messagesGetHistory(const TLInputPeer &peer, quint32 offset, quint32 maxId, quint32 limit)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(peer) + CTelegramStream::serializedSize(offset) + CTelegramStream::serializedSize(maxId) + CTelegramStream::serializedSize(limit));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesGetHistory;
@@ -1096,6 +1181,7 @@ quint64 CTelegramConnection::messagesGetHistory(const TLInputPeer &peer, quint32
 quint64 CTelegramConnection::messagesGetMessages(const TLVector<quint32> &id)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(id));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesGetMessages;
@@ -1107,6 +1193,7 @@ quint64 CTelegramConnection::messagesGetMessages(const TLVector<quint32> &id)
 quint64 CTelegramConnection::messagesGetStickerSet(const TLInputStickerSet &stickerset)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(stickerset));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesGetStickerSet;
@@ -1118,6 +1205,7 @@ quint64 CTelegramConnection::messagesGetStickerSet(const TLInputStickerSet &stic
 quint64 CTelegramConnection::messagesGetStickers(const QString &emoticon, const QString &hash)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(emoticon) + CTelegramStream::serializedSize(hash));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesGetStickers;
@@ -1130,6 +1218,7 @@ quint64 CTelegramConnection::messagesGetStickers(const QString &emoticon, const
 quint64 CTelegramConnection::messagesGetWebPagePreview(const QString &message)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(message));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesGetWebPagePreview;
@@ -1141,6 +1230,7 @@ quint64 CTelegramConnection::messagesGetWebPagePreview(const QString &message)
 quint64 CTelegramConnection::messagesImportChatInvite(const QString &hash)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(hash));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesImportChatInvite;
@@ -1152,6 +1242,7 @@ quint64 CTelegramConnection::messagesImportChatInvite(const QString &hash)
 quint64 CTelegramConnection::messagesInstallStickerSet(const TLInputStickerSet &stickerset)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(stickerset));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesInstallStickerSet;
@@ -1163,6 +1254,7 @@ quint64 CTelegramConnection::messagesInstallStickerSet(const TLInputStickerSet &
 quint64 CTelegramConnection::messagesReadEncryptedHistory(const TLInputEncryptedChat &peer, quint32 maxDate)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(peer) + CTelegramStream::serializedSize(maxDate));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesReadEncryptedHistory;
@@ -1175,6 +1267,7 @@ quint64 CTelegramConnection::messagesReadEncryptedHistory(const TLInputEncrypted
 quint64 CTelegramConnection::messagesReadHistory(const TLInputPeer &peer, quint32 maxId, quint32 offset)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(peer) + CTelegramStream::serializedSize(maxId) + CTelegramStream::serializedSize(offset));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesReadHistory;
@@ -1188,6 +1281,7 @@ quint64 CTelegramConnection::messagesReadHistory(const TLInputPeer &peer, quint3
 quint64 CTelegramConnection::messagesReadMessageContents(const TLVector<quint32> &id)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(id));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesReadMessageContents;
@@ -1199,6 +1293,7 @@ quint64 CTelegramConnection::messagesReadMessageContents(const TLVector<quint32>
 quint64 CTelegramConnection::messagesReceivedMessages(quint32 maxId)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(maxId));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesReceivedMessages;
@@ -1210,6 +1305,7 @@ quint64 CTelegramConnection::messagesReceivedMessages(quint32 maxId)
 quint64 CTelegramConnection::messagesReceivedQueue(quint32 maxQts)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(maxQts));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesReceivedQueue;
@@ -1221,6 +1317,7 @@ quint64 CTelegramConnection::messagesReceivedQueue(quint32 maxQts)
 quint64 CTelegramConnection::messagesRequestEncryption(const TLInputUser &userId, quint32 randomId, const QByteArray &gA)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(userId) + CTelegramStream::serializedSize(randomId) + CTelegramStream::serializedSize(gA));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesRequestEncryption;
@@ -1234,6 +1331,7 @@ quint64 CTelegramConnection::messagesRequestEncryption(const TLInputUser &userId
 quint64 CTelegramConnection::messagesSearch(const TLInputPeer &peer, const QString &q, const TLMessagesFilter &filter, quint32 minDate, quint32 maxDate, quint32 offset, quint32 maxId, quint32 limit)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(peer) + CTelegramStream::serializedSize(q) + CTelegramStream::serializedSize(filter) + CTelegramStream::serializedSize(minDate) + CTelegramStream::serializedSize(maxDate) + CTelegramStream::serializedSize(offset) + CTelegramStream::serializedSize(maxId) + CTelegramStream::serializedSize(limit));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesSearch;
@@ -1252,6 +1350,7 @@ quint64 CTelegramConnection::messagesSearch(const TLInputPeer &peer, const QStri
 quint64 CTelegramConnection::messagesSendBroadcast(const TLVector<TLInputUser> &contacts, const TLVector<quint64> &randomId, const QString &message, const TLInputMedia &media)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(contacts) + CTelegramStream::serializedSize(randomId) + CTelegramStream::serializedSize(message) + CTelegramStream::serializedSize(media));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesSendBroadcast;
@@ -1266,6 +1365,7 @@ quint64 CTelegramConnection::messagesSendBroadcast(const TLVector<TLInputUser> &
 quint64 CTelegramConnection::messagesSendEncrypted(const TLInputEncryptedChat &peer, quint64 randomId, const QByteArray &data)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(peer) + CTelegramStream::serializedSize(randomId) + CTelegramStream::serializedSize(data));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesSendEncrypted;
@@ -1279,6 +1379,7 @@ quint64 CTelegramConnection::messagesSendEncrypted(const TLInputEncryptedChat &p
 quint64 CTelegramConnection::messagesSendEncryptedFile(const TLInputEncryptedChat &peer, quint64 randomId, const QByteArray &data, const TLInputEncryptedFile &file)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(peer) + CTelegramStream::serializedSize(randomId) + CTelegramStream::serializedSize(data) + CTelegramStream::serializedSize(file));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesSendEncryptedFile;
@@ -1293,6 +1394,7 @@ quint64 CTelegramConnection::messagesSendEncryptedFile(const TLInputEncryptedCha
 quint64 CTelegramConnection::messagesSendEncryptedService(const TLInputEncryptedChat &peer, quint64 randomId, const QByteArray &data)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(peer) + CTelegramStream::serializedSize(randomId) + CTelegramStream::serializedSize(data));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesSendEncryptedService;
@@ -1306,6 +1408,7 @@ quint64 CTelegramConnection::messagesSendEncryptedService(const TLInputEncrypted
 quint64 CTelegramConnection::messagesSendMedia(quint32 flags, const TLInputPeer &peer, quint32 replyToMsgId, const TLInputMedia &media, quint64 randomId)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(flags) + CTelegramStream::serializedSize(peer) + ((flags & 1 << 0) ? CTelegramStream::serializedSize(replyToMsgId) : 0) + CTelegramStream::serializedSize(media) + CTelegramStream::serializedSize(randomId));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesSendMedia;
@@ -1323,6 +1426,7 @@ quint64 CTelegramConnection::messagesSendMedia(quint32 flags, const TLInputPeer
 quint64 CTelegramConnection::messagesSendMessage(quint32 flags, const TLInputPeer &peer, quint32 replyToMsgId, const QString &message, quint64 randomId)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(flags) + CTelegramStream::serializedSize(peer) + ((flags & 1 << 0) ? CTelegramStream::serializedSize(replyToMsgId) : 0) + CTelegramStream::serializedSize(message) + CTelegramStream::serializedSize(randomId));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesSendMessage;
@@ -1340,6 +1444,7 @@ quint64 CTelegramConnection::messagesSendMessage(quint32 flags, const TLInputPee
 quint64 CTelegramConnection::messagesSetEncryptedTyping(const TLInputEncryptedChat &peer, bool typing)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(peer) + CTelegramStream::serializedSize(typing));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesSetEncryptedTyping;
@@ -1352,6 +1457,7 @@ quint64 CTelegramConnection::messagesSetEncryptedTyping(const TLInputEncryptedCh
 quint64 CTelegramConnection::messagesSetTyping(const TLInputPeer &peer, const TLSendMessageAction &action)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(peer) + CTelegramStream::serializedSize(action));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesSetTyping;
@@ -1364,6 +1470,7 @@ quint64 CTelegramConnection::messagesSetTyping(const TLInputPeer &peer, const TL
 quint64 CTelegramConnection::messagesUninstallStickerSet(const TLInputStickerSet &stickerset)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(stickerset));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::MessagesUninstallStickerSet;
@@ -1375,6 +1482,7 @@ quint64 CTelegramConnection::messagesUninstallStickerSet(const TLInputStickerSet
 quint64 CTelegramConnection::updatesGetDifference(quint32 pts, quint32 date, quint32 qts)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(pts) + CTelegramStream::serializedSize(date) + CTelegramStream::serializedSize(qts));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::UpdatesGetDifference;
@@ -1388,6 +1496,7 @@ quint64 CTelegramConnection::updatesGetDifference(quint32 pts, quint32 date, qui
 quint64 CTelegramConnection::updatesGetState()
 {
     QByteArray output;
+    output.reserve(4);
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::UpdatesGetState;
@@ -1398,6 +1507,7 @@ quint64 CTelegramConnection::updatesGetState()
 quint64 CTelegramConnection::uploadGetFile(const TLInputFileLocation &location, quint32 offset, quint32 limit)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(location) + CTelegramStream::serializedSize(offset) + CTelegramStream::serializedSize(limit));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::UploadGetFile;
@@ -1411,6 +1521,7 @@ quint64 CTelegramConnection::uploadGetFile(const TLInputFileLocation &location,
 quint64 CTelegramConnection::uploadSaveBigFilePart(quint64 fileId, quint32 filePart, quint32 fileTotalParts, const QByteArray &bytes)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(fileId) + CTelegramStream::serializedSize(filePart) + CTelegramStream::serializedSize(fileTotalParts) + CTelegramStream::serializedSize(bytes));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::UploadSaveBigFilePart;
@@ -1425,6 +1536,7 @@ quint64 CTelegramConnection::uploadSaveBigFilePart(quint64 fileId, quint32 fileP
 quint64 CTelegramConnection::uploadSaveFilePart(quint64 fileId, quint32 filePart, const QByteArray &bytes)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(fileId) + CTelegramStream::serializedSize(filePart) + CTelegramStream::serializedSize(bytes));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::UploadSaveFilePart;
@@ -1438,6 +1550,7 @@ quint64 CTelegramConnection::uploadSaveFilePart(quint64 fileId, quint32 filePart
 quint64 CTelegramConnection::usersGetFullUser(const TLInputUser &id)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(id));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::UsersGetFullUser;
@@ -1449,6 +1562,7 @@ quint64 CTelegramConnection::usersGetFullUser(const TLInputUser &id)
 quint64 CTelegramConnection::usersGetUsers(const TLVector<TLInputUser> &id)
 {
     QByteArray output;
+    output.reserve(4 + CTelegramStream::serializedSize(id));
     CTelegramStream outputStream(&output, /* write */ true);
 
     outputStream << TLValue::UsersGetUsers;
@@ -1484,6 +1598,17 @@ quint64 CTelegramConnection::pingDelayDisconnect(quint32 disconnectInSec)
     return sendEncryptedPackage(output);
 }
 
+quint64 CTelegramConnection::getFutureSalts(quint32 count)
+{
+    QByteArray output;
+    CTelegramStream outputStream(&output, /* write */ true);
+
+    outputStream << TLValue::GetFutureSalts;
+    outputStream << count;
+
+    return sendEncryptedPackage(output);
+}
+
 quint64 CTelegramConnection::acknowledgeMessages(const TLVector<quint64> &idsVector)
 {
 //    qDebug() << Q_FUNC_INFO << idsVector;
@@ -1720,8 +1845,10 @@ bool CTelegramConnection::answerDh(const QByteArray &payload)
 
     encryptedInputStream >> serverTime;
 
-    setDeltaTime(qint64(serverTime) - (QDateTime::currentMSecsSinceEpoch() / 1000));
-    m_deltaTimeHeuristicState = DeltaTimeIsOk;
+    if (m_clockSamples.isEmpty()) {
+        // Rough value; normally the offset is already estimated from the plain messages ids.
+        setDeltaTime(qint64(serverTime) - (QDateTime::currentMSecsSinceEpoch() / 1000));
+    }
 
     m_b.resize(256);
     Utils::randomBytes(&m_b);
@@ -1825,7 +1952,10 @@ bool CTelegramConnection::processServersDHAnswer(const QByteArray &payload)
         }
 
         setAuthKey(newAuthKey);
+        m_keyAuthorized = false;
         m_serverSalt = m_serverNonce.parts[0] ^ m_newNonce.parts[0];
+        m_futureSalts.clear(); // The salts of the previous key are not valid for the new one
+        m_futureSaltsRequestId = 0;
 
         setAuthState(AuthStateHaveAKey);
         return true;
@@ -1860,6 +1990,7 @@ void CTelegramConnection::processRedirectedPackage(const QByteArray &data)
 TLValue CTelegramConnection::processRpcQuery(const QByteArray &data)
 {
     CTelegramStream stream(data);
+    stream.setStringPool(m_stringPool);
 
     bool isUpdate;
     TLValue value = processUpdate(stream, &isUpdate, /* requestId */ 0); // Doubtfully that this approach will work in next time.
@@ -1891,16 +2022,14 @@ TLValue CTelegramConnection::processRpcQuery(const QByteArray &data)
     case TLValue::Pong:
         processPingPong(stream);
         break;
+    case TLValue::FutureSalts:
+        processFutureSalts(stream);
+        break;
     default:
         qDebug() << Q_FUNC_INFO << "value:" << value.toString();
         break;
     }
 
-    if ((value != TLValue::BadMsgNotification) && (m_deltaTimeHeuristicState != DeltaTimeIsOk)) {
-        // If we have no bad message notification, then time is synced.
-        m_deltaTimeHeuristicState = DeltaTimeIsOk;
-    }
-
     if (stream.error()) {
         qWarning() << Q_FUNC_INFO << "Read of RPC result caused error. RPC type:" << value.toString() << "(read from the package -> can be misleading)";
     }
@@ -1937,8 +2066,190 @@ void CTelegramConnection::processContainer(CTelegramStream &stream)
 
         stream >> size;
 
-        processRpcQuery(stream.readBytes(size));
+        // The item is a slice of the container data, which outlives the processing.
+        processRpcQuery(stream.readSharedBytes(size));
+    }
+}
+
+template <typename T>
+TLValue CTelegramConnection::processRpcResultOfType(CTelegramStream &stream, quint64 id)
+{
+    TLValue result;
+    stream.peek(result);
+
+    switch (result) {
+    case TLValue::RpcError:
+    case TLValue::GzipPacked:
+        stream >> result;
+        break;
+    default:
+        stream.skip<T>();
+        qDebug() << Q_FUNC_INFO << "Result" << result.toString() << "of the request" << id << "is not processed.";
+        break;
     }
+
+    return result;
+}
+
+template <>
+TLValue CTelegramConnection::processRpcResultOfType<TLUpdates>(CTelegramStream &stream, quint64 id)
+{
+    bool ok;
+    return processUpdate(stream, &ok, id);
+}
+
+template <>
+TLValue CTelegramConnection::processRpcResultOfType<TLAuthAuthorization>(CTelegramStream &stream, quint64 id)
+{
+    return processAuthSign(stream, id);
+}
+
+const CTelegramConnection::RpcResultHandlerEntry CTelegramConnection::s_rpcResultHandlers[] = {
+    // Generated RPC result handlers
+    { TLValue::AuthSendCall, &CTelegramConnection::processRpcResultOfType<bool> },
+    { TLValue::MessagesReceivedMessages, &CTelegramConnection::processMessagesReceivedMessages },
+    { TLValue::GeochatsSendMessage, &CTelegramConnection::processRpcResultOfType<TLGeochatsStatedMessage> },
+    { TLValue::MessagesSearch, &CTelegramConnection::processRpcResultOfType<TLMessagesMessages> },
+    { TLValue::GeochatsSetTyping, &CTelegramConnection::processRpcResultOfType<bool> },
+    { TLValue::AccountGetAccountTTL, &CTelegramConnection::processRpcResultOfType<TLAccountDaysTTL> },
+    { TLValue::MessagesCreateChat, &CTelegramConnection::processRpcResultOfType<TLUpdates> },
+    { TLValue::UpdatesGetDifference, &CTelegramConnection::processUpdatesGetDifference },
+    { TLValue::AuthCheckPassword, &CTelegramConnection::processRpcResultOfType<TLAuthAuthorization> },
+    { TLValue::ContactsResolveUsername, &CTelegramConnection::processContactsResolveUsername },
+    { TLValue::UsersGetUsers, &CTelegramConnection::processUsersGetUsers },
+    { TLValue::AuthSendSms, &CTelegramConnection::processAuthSendSms },
+    { TLValue::GeochatsCreateGeoChat, &CTelegramConnection::processRpcResultOfType<TLGeochatsStatedMessage> },
+    { TLValue::ContactsSearch, &CTelegramConnection::processRpcResultOfType<TLContactsFound> },
+    { TLValue::AccountGetNotifySettings, &CTelegramConnection::processRpcResultOfType<TLPeerNotifySettings> },
+    { TLValue::AuthSignUp, &CTelegramConnection::processRpcResultOfType<TLAuthAuthorization> },
+    { TLValue::HelpGetNearestDc, &CTelegramConnection::processRpcResultOfType<TLNearestDc> },
+    { TLValue::ContactsGetContacts, &CTelegramConnection::processContactsGetContacts },
+    { TLValue::AccountSetAccountTTL, &CTelegramConnection::processRpcResultOfType<bool> },
+    { TLValue::MessagesGetWebPagePreview, &CTelegramConnection::processRpcResultOfType<TLMessageMedia> },
+    { TLValue::MessagesGetStickerSet, &CTelegramConnection::processRpcResultOfType<TLMessagesStickerSet> },
+    { TLValue::MessagesGetDhConfig, &CTelegramConnection::processRpcResultOfType<TLMessagesDhConfig> },
+    { TLValue::AccountCheckUsername, &CTelegramConnection::processAccountCheckUsername },
+    { TLValue::MessagesSendMedia, &CTelegramConnection::processRpcResultOfType<TLUpdates> },
+    { TLValue::MessagesSendEncryptedService, &CTelegramConnection::processRpcResultOfType<TLMessagesSentEncryptedMessage> },
+    { TLValue::ContactsBlock, &CTelegramConnection::processRpcResultOfType<bool> },
+    { TLValue::MessagesForwardMessage, &CTelegramConnection::processRpcResultOfType<TLUpdates> },
+    { TLValue::GeochatsEditChatPhoto, &CTelegramConnection::processRpcResultOfType<TLGeochatsStatedMessage> },
+    { TLValue::MessagesReadMessageContents, &CTelegramConnection::processRpcResultOfType<TLMessagesAffectedMessages> },
+    { TLValue::AccountUpdateDeviceLocked, &CTelegramConnection::processRpcResultOfType<bool> },
+    { TLValue::MessagesGetFullChat, &CTelegramConnection::processMessagesGetFullChat },
+    { TLValue::MessagesGetChats, &CTelegramConnection::processMessagesGetChats },
+    { TLValue::MessagesAcceptEncryption, &CTelegramConnection::processRpcResultOfType<TLEncryptedChat> },
+    { TLValue::AccountUpdateUsername, &CTelegramConnection::processAccountUpdateUsername },
+    { TLValue::MessagesCheckChatInvite, &CTelegramConnection::processRpcResultOfType<TLChatInvite> },
+    { TLValue::AccountDeleteAccount, &CTelegramConnection::processRpcResultOfType<bool> },
+    { TLValue::MessagesGetMessages, &CTelegramConnection::processMessagesGetMessages },
+    { TLValue::AccountRegisterDevice, &CTelegramConnection::processRpcResultOfType<bool> },
+    { TLValue::GeochatsEditChatTitle, &CTelegramConnection::processRpcResultOfType<TLGeochatsStatedMessage> },
+    { TLValue::AuthRecoverPassword, &CTelegramConnection::processRpcResultOfType<TLAuthAuthorization> },
+    { TLValue::ContactsImportCard, &CTelegramConnection::processRpcResultOfType<TLUser> },
+    { TLValue::AccountGetPassword, &CTelegramConnection::processAccountGetPassword },
+    { TLValue::MessagesReceivedQueue, &CTelegramConnection::processRpcResultOfType<TLVector<quint64> > },
+    { TLValue::GeochatsCheckin, &CTelegramConnection::processRpcResultOfType<TLGeochatsStatedMessage> },
+    { TLValue::MessagesForwardMessages, &CTelegramConnection::processRpcResultOfType<TLUpdates> },
+    { TLValue::AuthLogOut, &CTelegramConnection::processAuthLogOut },
+    { TLValue::ContactsDeleteContacts, &CTelegramConnection::processContactsDeleteContacts },
+    { TLValue::AccountUnregisterDevice, &CTelegramConnection::processRpcResultOfType<bool> },
+    { TLValue::AccountUpdateStatus, &CTelegramConnection::processAccountUpdateStatus },
+    { TLValue::GeochatsGetFullChat, &CTelegramConnection::processRpcResultOfType<TLMessagesChatFull> },
+    { TLValue::MessagesImportChatInvite, &CTelegramConnection::processRpcResultOfType<TLUpdates> },
+    { TLValue::HelpSaveAppLog, &CTelegramConnection::processRpcResultOfType<bool> },
+    { TLValue::AuthCheckPhone, &CTelegramConnection::processAuthCheckPhone },
+    { TLValue::AccountChangePhone, &CTelegramConnection::processRpcResultOfType<TLUser> },
+    { TLValue::AuthSendCode, &CTelegramConnection::processAuthSendCode },
+    { TLValue::AuthSendInvites, &CTelegramConnection::processRpcResultOfType<bool> },
+    { TLValue::MessagesSetEncryptedTyping, &CTelegramConnection::processRpcResultOfType<bool> },
+    { TLValue::MessagesExportChatInvite, &CTelegramConnection::processRpcResultOfType<TLExportedChatInvite> },
+    { TLValue::GeochatsGetLocated, &CTelegramConnection::processRpcResultOfType<TLGeochatsLocated> },
+    { TLValue::MessagesReadEncryptedHistory, &CTelegramConnection::processRpcResultOfType<bool> },
+    { TLValue::AccountUpdateNotifySettings, &CTelegramConnection::processRpcResultOfType<bool> },
+    { TLValue::ContactsExportCard, &CTelegramConnection::processRpcResultOfType<TLVector<quint32> > },
+    { TLValue::PhotosDeletePhotos, &CTelegramConnection::processRpcResultOfType<TLVector<quint64> > },
+    { TLValue::ContactsDeleteContact, &CTelegramConnection::processRpcResultOfType<TLContactsLink> },
+    { TLValue::MessagesGetHistory, &CTelegramConnection::processMessagesGetHistory },
+    { TLValue::MessagesSendEncryptedFile, &CTelegramConnection::processRpcResultOfType<TLMessagesSentEncryptedMessage> },
+    { TLValue::MessagesSendMessage, &CTelegramConnection::processMessagesSendMessage },
+    { TLValue::HelpGetSupport, &CTelegramConnection::processRpcResultOfType<TLHelpSupport> },
+    { TLValue::AuthResetAuthorizations, &CTelegramConnection::processRpcResultOfType<bool> },
+    { TLValue::MessagesSetTyping, &CTelegramConnection::processMessagesSetTyping },
+    { TLValue::AccountSendChangePhoneCode, &CTelegramConnection::processRpcResultOfType<TLAccountSentChangePhoneCode> },
+    { TLValue::HelpGetInviteText, &CTelegramConnection::processRpcResultOfType<TLHelpInviteText> },
+    { TLValue::MessagesDeleteMessages, &CTelegramConnection::processRpcResultOfType<TLMessagesAffectedMessages> },
+    { TLValue::MessagesSendEncrypted, &CTelegramConnection::processRpcResultOfType<TLMessagesSentEncryptedMessage> },
+    { TLValue::MessagesGetAllStickers, &CTelegramConnection::processRpcResultOfType<TLMessagesAllStickers> },
+    { TLValue::MessagesGetStickers, &CTelegramConnection::processRpcResultOfType<TLMessagesStickers> },
+    { TLValue::MessagesReadHistory, &CTelegramConnection::processMessagesReadHistory },
+    { TLValue::UploadSaveFilePart, &CTelegramConnection::processUploadSaveFilePart },
+    { TLValue::GeochatsGetHistory, &CTelegramConnection::processRpcResultOfType<TLGeochatsMessages> },
+    { TLValue::PhotosGetUserPhotos, &CTelegramConnection::processRpcResultOfType<TLPhotosPhotos> },
+    { TLValue::GeochatsSendMedia, &CTelegramConnection::processRpcResultOfType<TLGeochatsStatedMessage> },
+    { TLValue::AccountGetPasswordSettings, &CTelegramConnection::processRpcResultOfType<TLAccountPasswordSettings> },
+    { TLValue::AuthSignIn, &CTelegramConnection::processRpcResultOfType<TLAuthAuthorization> },
+    { TLValue::MessagesSendBroadcast, &CTelegramConnection::processRpcResultOfType<TLUpdates> },
+    { TLValue::AccountGetWallPapers, &CTelegramConnection::processRpcResultOfType<TLVector<TLWallPaper> > },
+    { TLValue::ContactsGetStatuses, &CTelegramConnection::processRpcResultOfType<TLVector<TLContactStatus> > },
+    { TLValue::HelpGetConfig, &CTelegramConnection::processHelpGetConfig },
+    { TLValue::HelpGetAppUpdate, &CTelegramConnection::processRpcResultOfType<TLHelpAppUpdate> },
+    { TLValue::AccountSetPrivacy, &CTelegramConnection::processRpcResultOfType<TLAccountPrivacyRules> },
+    { TLValue::UsersGetFullUser, &CTelegramConnection::processUsersGetFullUser },
+    { TLValue::MessagesEditChatPhoto, &CTelegramConnection::processRpcResultOfType<TLUpdates> },
+    { TLValue::ContactsGetSuggested, &CTelegramConnection::processRpcResultOfType<TLContactsSuggested> },
+    { TLValue::AuthBindTempAuthKey, &CTelegramConnection::processRpcResultOfType<bool> },
+    { TLValue::GeochatsSearch, &CTelegramConnection::processRpcResultOfType<TLGeochatsMessages> },
+    { TLValue::PhotosUploadProfilePhoto, &CTelegramConnection::processRpcResultOfType<TLPhotosPhoto> },
+    { TLValue::AuthRequestPasswordRecovery, &CTelegramConnection::processRpcResultOfType<TLAuthPasswordRecovery> },
+    { TLValue::ContactsImportContacts, &CTelegramConnection::processContactsImportContacts },
+    { TLValue::AccountGetPrivacy, &CTelegramConnection::processRpcResultOfType<TLAccountPrivacyRules> },
+    { TLValue::AccountResetNotifySettings, &CTelegramConnection::processRpcResultOfType<bool> },
+    { TLValue::MessagesEditChatTitle, &CTelegramConnection::processRpcResultOfType<TLUpdates> },
+    { TLValue::UploadSaveBigFilePart, &CTelegramConnection::processUploadSaveFilePart },
+    { TLValue::AccountResetAuthorization, &CTelegramConnection::processRpcResultOfType<bool> },
+    { TLValue::MessagesDeleteChatUser, &CTelegramConnection::processRpcResultOfType<TLUpdates> },
+    { TLValue::GeochatsGetRecents, &CTelegramConnection::processRpcResultOfType<TLGeochatsMessages> },
+    { TLValue::AccountGetAuthorizations, &CTelegramConnection::processRpcResultOfType<TLAccountAuthorizations> },
+    { TLValue::UploadGetFile, &CTelegramConnection::processUploadGetFile },
+    { TLValue::AuthImportAuthorization, &CTelegramConnection::processRpcResultOfType<TLAuthAuthorization> },
+    { TLValue::ContactsUnblock, &CTelegramConnection::processRpcResultOfType<bool> },
+    { TLValue::AuthExportAuthorization, &CTelegramConnection::processAuthExportAuthorization },
+    { TLValue::MessagesGetDialogs, &CTelegramConnection::processMessagesGetDialogs },
+    { TLValue::UpdatesGetState, &CTelegramConnection::processUpdatesGetState },
+    { TLValue::MessagesDiscardEncryption, &CTelegramConnection::processRpcResultOfType<bool> },
+    { TLValue::PhotosUpdateProfilePhoto, &CTelegramConnection::processRpcResultOfType<TLUserProfilePhoto> },
+    { TLValue::MessagesInstallStickerSet, &CTelegramConnection::processRpcResultOfType<bool> },
+    { TLValue::AccountUpdateProfile, &CTelegramConnection::processRpcResultOfType<TLUser> },
+    { TLValue::MessagesDeleteHistory, &CTelegramConnection::processRpcResultOfType<TLMessagesAffectedHistory> },
+    { TLValue::ContactsGetBlocked, &CTelegramConnection::processRpcResultOfType<TLContactsBlocked> },
+    { TLValue::MessagesRequestEncryption, &CTelegramConnection::processRpcResultOfType<TLEncryptedChat> },
+    { TLValue::MessagesUninstallStickerSet, &CTelegramConnection::processRpcResultOfType<bool> },
+    { TLValue::MessagesAddChatUser, &CTelegramConnection::processRpcResultOfType<TLUpdates> },
+    { TLValue::AccountUpdatePasswordSettings, &CTelegramConnection::processRpcResultOfType<bool> },
+    // End of generated RPC result handlers
+};
+
+CTelegramConnection::RpcResultHandler CTelegramConnection::rpcResultHandler(TLValue request)
+{
+    // The handlers are sorted by the request value
+    int begin = 0;
+    int end = sizeof(s_rpcResultHandlers) / sizeof(s_rpcResultHandlers[0]);
+
+    while (begin < end) {
+        const int middle = (begin + end) / 2;
+        const quint32 value = s_rpcResultHandlers[middle].request;
+
+        if (value == request) {
+            return s_rpcResultHandlers[middle].handler;
+        } else if (value < request) {
+            begin = middle + 1;
+        } else {
+            end = middle;
+        }
+    }
+
+    return 0;
 }
 
 void CTelegramConnection::processRpcResult(CTelegramStream &stream, quint64 idHint)
@@ -1964,114 +2275,12 @@ void CTelegramConnection::processRpcResult(CTelegramStream &stream, quint64 idHi
             return;
         }
 
-        switch (request) {
-        case TLValue::ContactsGetContacts:
-            processingResult = processContactsGetContacts(stream, id);
-            break;
-        case TLValue::ContactsImportContacts:
-            processingResult = processContactsImportContacts(stream, id);
-            break;
-        case TLValue::ContactsDeleteContacts:
-            processingResult = processContactsDeleteContacts(stream, id);
-            break;
-        case TLValue::ContactsResolveUsername:
-            processingResult = processContactsResolveUsername(stream, id);
-            break;
-        case TLValue::UpdatesGetState:
-            processingResult = processUpdatesGetState(stream, id);
-            break;
-        case TLValue::UpdatesGetDifference:
-            processingResult = processUpdatesGetDifference(stream, id);
-            break;
-        case TLValue::UploadGetFile:
-            processingResult = processUploadGetFile(stream, id);
-            break;
-        case TLValue::UploadSaveFilePart:
-        case TLValue::UploadSaveBigFilePart:
-            processingResult = processUploadSaveFilePart(stream, id);
-            break;
-        case TLValue::UsersGetUsers:
-            processingResult = processUsersGetUsers(stream, id);
-            break;
-        case TLValue::UsersGetFullUser:
-            processingResult = processUsersGetFullUser(stream, id);
-            break;
-        case TLValue::AuthCheckPassword:
-        case TLValue::AuthImportAuthorization:
-        case TLValue::AuthSignIn:
-        case TLValue::AuthSignUp:
-            processingResult = processAuthSign(stream, id);
-            break;
-        case TLValue::AuthLogOut:
-            processingResult = processAuthLogOut(stream, id);
-            break;
-        case TLValue::HelpGetConfig:
-            processingResult = processHelpGetConfig(stream, id);
-            break;
-        case TLValue::AuthCheckPhone:
-            processingResult = processAuthCheckPhone(stream, id);
-            break;
-        case TLValue::AuthExportAuthorization:
-            processingResult = processAuthExportAuthorization(stream, id);
-            break;
-        case TLValue::AuthSendCode:
-            processingResult = processAuthSendCode(stream, id);
-            break;
-        case TLValue::AuthSendSms:
-            processingResult = processAuthSendSms(stream, id);
-            break;
-        case TLValue::MessagesSendMessage:
-            processingResult = processMessagesSendMessage(stream, id);
-            break;
-        case TLValue::MessagesSetTyping:
-            processingResult = processMessagesSetTyping(stream, id);
-            break;
-        case TLValue::MessagesReadHistory:
-            processingResult = processMessagesReadHistory(stream, id);
-            break;
-        case TLValue::MessagesReceivedMessages:
-            processingResult = processMessagesReceivedMessages(stream, id);
-            break;
-        case TLValue::MessagesGetHistory:
-            processingResult = processMessagesGetHistory(stream, id);
-            break;
-        case TLValue::MessagesGetDialogs:
-            processingResult = processMessagesGetDialogs(stream, id);
-            break;
-        case TLValue::MessagesGetChats:
-            processingResult = processMessagesGetChats(stream, id);
-            break;
-        case TLValue::MessagesGetFullChat:
-            processingResult = processMessagesGetFullChat(stream, id);
-            break;
-        case TLValue::AccountCheckUsername:
-            processingResult = processAccountCheckUsername(stream, id);
-            break;
-        case TLValue::AccountGetPassword:
-            processingResult = processAccountGetPassword(stream, id);
-            break;
-        case TLValue::AccountUpdateStatus:
-            processingResult = processAccountUpdateStatus(stream, id);
-            break;
-        case TLValue::AccountUpdateUsername:
-            processingResult = processAccountUpdateUsername(stream, id);
-            break;
-        case TLValue::MessagesEditChatTitle:
-        case TLValue::MessagesEditChatPhoto:
-        case TLValue::MessagesAddChatUser:
-        case TLValue::MessagesDeleteChatUser:
-        case TLValue::MessagesCreateChat:
-        case TLValue::MessagesSendMedia:
-        {
-            bool ok;
-            processingResult = processUpdate(stream, &ok, id);
-        }
-            break;
-        default:
+        const RpcResultHandler handler = rpcResultHandler(request);
+
+        if (handler) {
+            processingResult = (this->*handler)(stream, id);
+        } else if (request != TLValue::Ping) {
             qDebug() << "Unknown outgoing RPC type:" << request.toString();
-            break;
-        case TLValue::Ping:
-            break;
         }
 
         switch (processingResult) {
@@ -2101,7 +2310,7 @@ void CTelegramConnection::processGzipPackedRpcQuery(CTelegramStream &stream)
     QByteArray packedData;
     stream >> packedData;
 
-    const QByteArray data = Utils::unpackGZip(packedData);
+    const QByteArray data = m_inflater.inflate(packedData);
 
     if (!data.isEmpty()) {
         processRpcQuery(data);
@@ -2113,10 +2322,12 @@ void CTelegramConnection::processGzipPackedRpcResult(CTelegramStream &stream, qu
     QByteArray packedData;
     stream >> packedData;
 
-    const QByteArray data = Utils::unpackGZip(packedData);
+    // Decode the result right from the inflater, without an intermediate buffer.
+    CGZipInflaterDevice unpackedDevice(&m_inflater, packedData);
 
-    if (!data.isEmpty()) {
-        CTelegramStream unpackedStream(data);
+    if (unpackedDevice.isOpen()) {
+        CTelegramStream unpackedStream(&unpackedDevice);
+        unpackedStream.setStringPool(m_stringPool);
         processRpcResult(unpackedStream, id);
     }
 }
@@ -2217,6 +2428,10 @@ bool CTelegramConnection::processRpcError(CTelegramStream &stream, quint64 id, T
         break;
     }
 
+    if (request == TLValue::MessagesGetMessages) {
+        emit messagesNotReceived(messageIdsFromPackage(id));
+    }
+
     return false;
 }
 
@@ -2285,36 +2500,23 @@ void CTelegramConnection::processIgnoredMessageNotification(CTelegramStream &str
     }
     qDebug() << QString(QLatin1String("Bad message %1/%2: Code %3 (%4).")).arg(id).arg(seqNo).arg(errorCode).arg(errorText);
 
-    if (errorCode == 16) {
-        if (m_deltaTimeHeuristicState == DeltaTimeIsOk) {
-            m_deltaTimeHeuristicState = DeltaTimeCorrectionForward;
-        }
-
-        if (m_deltaTimeHeuristicState == DeltaTimeCorrectionForward) {
-            setDeltaTime(deltaTime() + 1000);
-        } else {
-            setDeltaTime(deltaTime() + 100);
-        }
-
-        sendEncryptedPackageAgain(id);
-        qDebug() << "DeltaTime factor increased to" << deltaTime();
-    } else if (errorCode == 17) {
-        if (m_deltaTimeHeuristicState == DeltaTimeIsOk) {
-            m_deltaTimeHeuristicState = DeltaTimeCorrectionBackward;
-        }
+    if ((errorCode == 16) || (errorCode == 17)) {
+        // Local clock is changed since the last estimation. The notification message id has the server time,
+        // and the id of the bad message has our send time, so the offset is corrected at once.
+        const qint64 requestTime = timeStampToMSecsSinceEpoch(id) - m_clockOffset;
 
-        if (m_deltaTimeHeuristicState == DeltaTimeCorrectionBackward) {
-            setDeltaTime(deltaTime() - 1000);
-        } else {
-            setDeltaTime(deltaTime() - 100);
-        }
+        m_clockSamples.clear();
+        addClockSample(m_receivedMessageId, requestTime, QDateTime::currentMSecsSinceEpoch());
+        m_lastMessageId = 0; // Message id might need to go back.
 
         sendEncryptedPackageAgain(id);
-        qDebug() << "DeltaTime factor reduced to" << deltaTime();
+        qDebug() << "DeltaTime factor fixed to" << clockOffset() << "ms";
     } else if (errorCode == 48) {
         m_serverSalt = m_receivedServerSalt;
+        m_futureSalts.clear(); // Known salts are out of sync with the server
         sendEncryptedPackageAgain(id);
         qDebug() << "Local serverSalt fixed to" << m_serverSalt;
+        ensureFutureSalts();
     }
 }
 
@@ -2328,9 +2530,51 @@ void CTelegramConnection::processPingPong(CTelegramStream &stream)
     m_lastReceivedPingId = pid;
     m_lastReceivedPingTime = QDateTime::currentMSecsSinceEpoch();
 
+    // Ping message id has our (corrected) send time.
+    addClockSample(m_receivedMessageId, timeStampToMSecsSinceEpoch(msgId) - m_clockOffset, m_lastReceivedPingTime);
+
 //    qDebug() << Q_FUNC_INFO << m_lastReceivedPingId << m_lastReceivedPingTime;
 }
 
+void CTelegramConnection::processFutureSalts(CTelegramStream &stream)
+{
+    // https://core.telegram.org/mtproto/service_messages#request-for-several-future-salts
+    // The answer is not wrapped into rpc_result.
+    quint64 requestId;
+    quint32 now;
+    quint32 count;
+
+    stream >> requestId;
+    stream >> now;
+    stream >> count; // Bare vector: no type id
+
+    QVector<SFutureSalt> salts;
+
+    for (quint32 i = 0; (i < count) && !stream.error(); ++i) {
+        SFutureSalt futureSalt;
+        stream >> futureSalt.validSince; // Bare future_salt: no type id
+        stream >> futureSalt.validUntil;
+        stream >> futureSalt.salt;
+        salts.append(futureSalt);
+    }
+
+    m_submittedPackages.remove(requestId);
+
+    if (requestId == m_futureSaltsRequestId) {
+        m_futureSaltsRequestId = 0;
+    }
+
+    if (stream.error()) {
+        qWarning() << Q_FUNC_INFO << "Unable to read future salts.";
+        return;
+    }
+
+    qDebug() << Q_FUNC_INFO << "Got" << salts.count() << "salts. Server time:" << now;
+
+    m_futureSalts = salts;
+    selectActualServerSalt();
+}
+
 TLValue CTelegramConnection::processHelpGetConfig(CTelegramStream &stream, quint64 id)
 {
     Q_UNUSED(id);
@@ -2448,7 +2692,12 @@ TLValue CTelegramConnection::processUpdatesGetDifference(CTelegramStream &stream
     Q_UNUSED(id);
 
     TLUpdatesDifference result;
+
+    // A catch-up difference can be huge; let the visitor process it item by item.
+    CTelegramStreamVisitor *previousVisitor = stream.visitor();
+    stream.setVisitor(m_updatesDifferenceVisitor);
     stream >> result;
+    stream.setVisitor(previousVisitor);
 
     switch (result.tlType) {
     case TLValue::UpdatesDifference:
@@ -2592,7 +2841,12 @@ TLValue CTelegramConnection::processAuthLogOut(CTelegramStream &stream, quint64
 TLValue CTelegramConnection::processUploadGetFile(CTelegramStream &stream, quint64 id)
 {
     TLUploadFile file;
+
+    // Take the file chunk as a slice of the packet buffer and make the only copy right before the emission.
+    const bool sharedBytesEnabled = stream.isSharedBytesEnabled();
+    stream.setSharedBytesEnabled(true);
     stream >> file;
+    stream.setSharedBytesEnabled(sharedBytesEnabled);
 
     if (file.tlType == TLValue::UploadFile) {
         const QByteArray data = m_submittedPackages.value(id);
@@ -2609,6 +2863,7 @@ TLValue CTelegramConnection::processUploadGetFile(CTelegramStream &stream, quint
             stream >> location;
             stream >> offset;
 
+            file.bytes.detach();
             emit fileDataReceived(file, m_requestedFilesIds.value(id), offset);
         }
     }
@@ -2799,6 +3054,34 @@ TLValue CTelegramConnection::processMessagesGetChats(CTelegramStream &stream, qu
     return result.tlType;
 }
 
+TLValue CTelegramConnection::processMessagesGetMessages(CTelegramStream &stream, quint64 id)
+{
+    TLMessagesMessages result;
+    stream >> result;
+
+    emit messagesReceived(result);
+
+    if ((result.tlType != TLValue::MessagesMessages) && (result.tlType != TLValue::MessagesMessagesSlice)) {
+        return result.tlType; // An error or a packed result
+    }
+
+    // The server omits the messages, which are not available (e.g. deleted).
+    TLVector<quint32> omittedIds = messageIdsFromPackage(id);
+
+    foreach (const TLMessage &message, result.messages) {
+        const int index = omittedIds.indexOf(message.id);
+        if (index >= 0) {
+            omittedIds.remove(index);
+        }
+    }
+
+    if (!omittedIds.isEmpty()) {
+        emit messagesNotReceived(omittedIds);
+    }
+
+    return result.tlType;
+}
+
 TLValue CTelegramConnection::processMessagesGetFullChat(CTelegramStream &stream, quint64 id)
 {
     Q_UNUSED(id);
@@ -2927,28 +3210,34 @@ bool CTelegramConnection::processErrorSeeOther(const QString errorMessage, quint
 
 TLValue CTelegramConnection::processUpdate(CTelegramStream &stream, bool *ok, quint64 id)
 {
-    TLUpdates updates;
-    stream >> updates;
+    TLValue updatesType;
+    stream.peek(updatesType);
 
-    if (stream.error()) {
-        qWarning() << Q_FUNC_INFO << "Read of an update caused an error.";
-    }
-
-    switch (updates.tlType) {
+    switch (updatesType) {
     case TLValue::UpdatesTooLong:
     case TLValue::UpdateShortMessage:
     case TLValue::UpdateShortChatMessage:
     case TLValue::UpdateShort:
     case TLValue::UpdatesCombined:
     case TLValue::Updates:
-        emit updatesReceived(updates, id);
-        *ok = true;
         break;
     default:
+        // Not an update; consume only the type, as the caller expects.
+        stream >> updatesType;
         *ok = false;
-        break;
+        return updatesType;
+    }
+
+    TLUpdates updates;
+    stream >> updates;
+
+    if (stream.error()) {
+        qWarning() << Q_FUNC_INFO << "Read of an update caused an error.";
     }
 
+    emit updatesReceived(updates, id);
+    *ok = true;
+
     return updates.tlType;
 }
 
@@ -2972,8 +3261,10 @@ void CTelegramConnection::whenTransportStateChanged()
 
         if (m_authKey.isEmpty()) {
             initAuth();
-        } else {
+        } else if (m_keyAuthorized) {
             setAuthState(AuthStateSignedIn);
+        } else {
+            setAuthState(AuthStateHaveAKey);
         }
 
         setStatus(ConnectionStatusConnected);
@@ -2995,6 +3286,7 @@ void CTelegramConnection::whenTransportReadyRead()
     quint64 timeStamp = 0;
     quint32 length = 0;
     QByteArray payload;
+    QByteArray decryptedData; // The payload of an encrypted message refers to this data.
 
     inputStream >> auth;
 
@@ -3012,6 +3304,11 @@ void CTelegramConnection::whenTransportReadyRead()
 
         payload = inputStream.readBytes(length);
 
+        if (m_plainPackageSentTime) {
+            addClockSample(timeStamp, m_plainPackageSentTime, QDateTime::currentMSecsSinceEpoch());
+            m_plainPackageSentTime = 0;
+        }
+
         switch (m_authState) {
         case AuthStatePqRequested:
             if (answerPqAuthorization(payload)) {
@@ -3049,11 +3346,12 @@ void CTelegramConnection::whenTransportReadyRead()
         }
         // Encrypted Message
         const QByteArray messageKey = inputStream.readBytes(16);
-        const QByteArray data = inputStream.readBytes(inputStream.bytesRemaining());
+        const QByteArray data = inputStream.readRemainingSharedBytes();
 
         const SAesKey key = generateServerToClientAesKey(messageKey);
 
-        QByteArray decryptedData = Utils::aesDecrypt(data, key).left(data.length());
+        decryptedData = Utils::aesDecrypt(data, key);
+        decryptedData.truncate(data.length());
         CRawStream decryptedStream(decryptedData);
 
         quint64 sessionId = 0;
@@ -3090,8 +3388,9 @@ void CTelegramConnection::whenTransportReadyRead()
             return;
         }
 
-        payload = decryptedStream.readRemainingBytes();
+        payload = decryptedStream.readRemainingSharedBytes();
 
+        m_receivedMessageId = messageId;
         processRpcQuery(payload);
     }
 
@@ -3131,6 +3430,8 @@ void CTelegramConnection::whenItsTimeToPing()
     m_lastSentPingTime = QDateTime::currentMSecsSinceEpoch();
 
     pingDelayDisconnect(m_pingInterval + m_serverDisconnectionExtraTime); // Server will close the connection after m_serverDisconnectionExtraTime ms more, than our ping interval.
+
+    ensureFutureSalts();
 }
 
 void CTelegramConnection::whenItsTimeToAckMessages()
@@ -3202,6 +3503,7 @@ quint64 CTelegramConnection::sendPlainPackage(const QByteArray &buffer)
     outputStream << buffer;
 
     m_transport->sendPackage(output);
+    m_plainPackageSentTime = QDateTime::currentMSecsSinceEpoch();
 
 #ifdef NETWORK_LOGGING
     CTelegramStream readBack(buffer);
@@ -3228,6 +3530,8 @@ quint64 CTelegramConnection::sendEncryptedPackage(const QByteArray &buffer, bool
     QByteArray messageKey;
     quint64 messageId;
     {
+        selectActualServerSalt();
+
         messageId = newMessageId();
 
         m_sequenceNumber = m_contentRelatedMessages * 2 + 1;
@@ -3238,21 +3542,42 @@ quint64 CTelegramConnection::sendEncryptedPackage(const QByteArray &buffer, bool
             m_submittedPackages.insert(messageId, buffer);
         }
 
+        QByteArray header;
+        if (m_sequenceNumber == 1) {
+            insertInitConnection(&header);
+        }
+
+        // Submitted package is saved unpacked, because it is used to process the answer.
+        QByteArray content = buffer;
+
+        if (isWorthToPack(buffer)) {
+            const QByteArray packedData = Utils::packGZip(buffer);
+
+            QByteArray packedContent;
+            CTelegramStream packedStream(&packedContent, /* write */ true);
+
+            packedStream << TLValue::GzipPacked;
+            packedStream << packedData;
+
+            // The packed data is empty if the packing failed.
+            if (!packedData.isEmpty() && (packedContent.size() < buffer.size())) {
+                m_packingSavedBytes += buffer.size() - packedContent.size();
+                content = packedContent;
+            }
+        }
+
+        // Salt, session id, message id, sequence number, length, the message and up to 15 bytes of the padding.
         QByteArray innerData;
+        innerData.reserve(32 + header.length() + content.length() + 15);
         CRawStream stream(&innerData, /* write */ true);
 
         stream << m_serverSalt;
         stream << m_sessionId;
         stream << messageId;
         stream << m_sequenceNumber;
-
-        QByteArray header;
-        if (m_sequenceNumber == 1) {
-            insertInitConnection(&header);
-        }
-
-        stream << quint32(header.length() + buffer.length());
-        stream << header + buffer;
+        stream << quint32(header.length() + content.length());
+        stream << header;
+        stream << content;
 
         messageKey = Utils::sha1(innerData).mid(4);
         const SAesKey key = generateClientToServerAesKey(messageKey);
@@ -3315,6 +3640,42 @@ quint64 CTelegramConnection::sendEncryptedPackageAgain(quint64 id)
     return sendEncryptedPackage(data);
 }
 
+bool CTelegramConnection::isWorthToPack(const QByteArray &buffer)
+{
+    if (buffer.size() < s_packingThreshold) {
+        return false;
+    }
+
+    const TLValue request = TLValue(qFromLittleEndian<quint32>(reinterpret_cast<const uchar*>(buffer.constData())));
+
+    switch (request) {
+    case TLValue::UploadSaveFilePart:
+    case TLValue::UploadSaveBigFilePart:
+    case TLValue::MessagesSendEncrypted:
+    case TLValue::MessagesSendEncryptedFile:
+    case TLValue::MessagesSendEncryptedService:
+    case TLValue::GzipPacked:
+        return false; // Already compressed or encrypted data
+    default:
+        break;
+    }
+
+    // Check the tail of the package, where the biggest arguments usually are.
+    bool seenBytes[256] = { false };
+    int distinctBytes = 0;
+
+    const uchar *sample = reinterpret_cast<const uchar*>(buffer.constData()) + buffer.size() - s_packingSampleSize;
+
+    for (int i = 0; i < s_packingSampleSize; ++i) {
+        if (!seenBytes[sample[i]]) {
+            seenBytes[sample[i]] = true;
+            ++distinctBytes;
+        }
+    }
+
+    return distinctBytes < s_packingMaxSampleDistinctBytes;
+}
+
 void CTelegramConnection::setStatus(ConnectionStatus status, ConnectionStatusReason reason)
 {
     if (m_status == status) {
@@ -3336,6 +3697,10 @@ void CTelegramConnection::setAuthState(CTelegramConnection::AuthState newState)
 
     m_authState = newState;
 
+    if (m_authState == AuthStateSignedIn) {
+        m_keyAuthorized = true;
+    }
+
     if ((m_authState >= AuthStateHaveAKey) && !m_sessionId) {
         Utils::randomBytes(&m_sessionId);
     }
@@ -3353,7 +3718,7 @@ void CTelegramConnection::setAuthState(CTelegramConnection::AuthState newState)
 
 quint64 CTelegramConnection::newMessageId()
 {
-    quint64 newLastMessageId = formatClientTimeStamp(QDateTime::currentMSecsSinceEpoch() + deltaTime() * 1000);
+    quint64 newLastMessageId = formatClientTimeStamp(QDateTime::currentMSecsSinceEpoch() + m_clockOffset);
 
     if (newLastMessageId <= m_lastMessageId) {
         newLastMessageId = m_lastMessageId + 4; // Client's outgoing message id should be divisible by 4 and be greater than previous message id.
@@ -3369,6 +3734,73 @@ quint64 CTelegramConnection::newMessageId()
     return m_lastMessageId;
 }
 
+void CTelegramConnection::addClockSample(quint64 serverMessageId, qint64 requestTime, qint64 responseTime)
+{
+    // NTP-like estimation: the server message is assumed to be created in the middle of the round trip.
+    const qint64 roundTripTime = responseTime - requestTime;
+
+    if (!serverMessageId || (roundTripTime < 0)) {
+        return;
+    }
+
+    const qint64 serverTime = timeStampToMSecsSinceEpoch(serverMessageId);
+
+    m_clockSamples.append(QPair<qint64, qint64>(roundTripTime, serverTime - requestTime - roundTripTime / 2));
+
+    if (m_clockSamples.count() > s_clockSamplesCount) {
+        m_clockSamples.remove(0);
+    }
+
+    // The sample with the shortest round trip has the least possible error.
+    int bestSample = 0;
+    for (int i = 1; i < m_clockSamples.count(); ++i) {
+        if (m_clockSamples.at(i).first < m_clockSamples.at(bestSample).first) {
+            bestSample = i;
+        }
+    }
+
+    setClockOffset(m_clockSamples.at(bestSample).second);
+}
+
+void CTelegramConnection::setClockOffset(qint64 offset)
+{
+    m_clockOffset = offset;
+    m_deltaTime = qint32((offset >= 0 ? offset + 500 : offset - 500) / 1000);
+}
+
+void CTelegramConnection::selectActualServerSalt()
+{
+    if (m_futureSalts.isEmpty()) {
+        return;
+    }
+
+    const quint32 serverTime = QDateTime::currentMSecsSinceEpoch() / 1000 + deltaTime();
+
+    int expiredSalts = 0;
+    while ((expiredSalts < m_futureSalts.count()) && (m_futureSalts.at(expiredSalts).validUntil <= serverTime)) {
+        ++expiredSalts;
+    }
+
+    m_futureSalts.remove(0, expiredSalts);
+
+    if (!m_futureSalts.isEmpty() && (m_futureSalts.first().validSince <= serverTime)) {
+        m_serverSalt = m_futureSalts.first().salt;
+    }
+}
+
+void CTelegramConnection::ensureFutureSalts()
+{
+    if ((m_authState < AuthStateHaveAKey) || m_futureSaltsRequestId) {
+        return;
+    }
+
+    if (m_futureSalts.count() >= s_futureSaltsMinimumCount) {
+        return;
+    }
+
+    m_futureSaltsRequestId = getFutureSalts(s_futureSaltsRequestCount);
+}
+
 QString CTelegramConnection::userNameFromPackage(quint64 id) const
 {
     const QByteArray data = m_submittedPackages.value(id);
@@ -3398,6 +3830,30 @@ QString CTelegramConnection::userNameFromPackage(quint64 id) const
     return name;
 }
 
+TLVector<quint32> CTelegramConnection::messageIdsFromPackage(quint64 id) const
+{
+    const QByteArray data = m_submittedPackages.value(id);
+
+    if (data.isEmpty()) {
+        return TLVector<quint32>();
+    }
+
+    CTelegramStream outputStream(data);
+
+    TLValue method;
+
+    outputStream >> method;
+
+    if (method != TLValue::MessagesGetMessages) {
+        return TLVector<quint32>();
+    }
+
+    TLVector<quint32> messageIds;
+    outputStream >> messageIds;
+
+    return messageIds;
+}
+
 void CTelegramConnection::startAuthTimer()
 {
     qDebug() << Q_FUNC_INFO;
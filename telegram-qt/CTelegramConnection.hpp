@@ -29,9 +29,12 @@
 #include "TLNumbers.hpp"
 #include "crypto-rsa.hpp"
 #include "crypto-aes.hpp"
+#include "CGZipInflater.hpp"
 
 class CAppInformation;
 class CTelegramStream;
+class CTelegramStreamVisitor;
+class CTelegramStringPool;
 class CTelegramTransport;
 
 #ifdef NETWORK_LOGGING
@@ -40,6 +43,17 @@ class QFile;
 
 class QTimer;
 
+struct SFutureSalt {
+    SFutureSalt() :
+        validSince(0),
+        validUntil(0),
+        salt(0) { }
+
+    quint32 validSince;
+    quint32 validUntil;
+    quint64 salt;
+};
+
 class CTelegramConnection : public QObject
 {
     Q_OBJECT
@@ -66,17 +80,10 @@ public:
         AuthStateSignedIn
     };
 
-    enum DeltaTimeHeuristicState {
-        DeltaTimeIsOk,
-        DeltaTimeCorrectionForward,
-        DeltaTimeCorrectionBackward,
-    };
-
 #if QT_VERSION >= QT_VERSION_CHECK(5, 5, 0)
     Q_ENUM(ConnectionStatus)
     Q_ENUM(ConnectionStatusReason)
     Q_ENUM(AuthState)
-    Q_ENUM(DeltaTimeHeuristicState)
 #endif
 
     explicit CTelegramConnection(const CAppInformation *appInfo, QObject *parent = 0);
@@ -205,6 +212,7 @@ public:
 
     quint64 ping();
     quint64 pingDelayDisconnect(quint32 disconnectInSec);
+    quint64 getFutureSalts(quint32 count);
 
     quint64 acknowledgeMessages(const TLVector<quint64> &idsVector);
 
@@ -218,7 +226,7 @@ public:
     quint64 sendMessage(const TLInputPeer &peer, const QString &message);
     quint64 sendMedia(const TLInputPeer &peer, const TLInputMedia &media);
 
-    AuthState authState() { return m_authState; }
+    AuthState authState() const { return m_authState; }
 
     void requestPqAuthorization();
     bool answerPqAuthorization(const QByteArray &payload);
@@ -240,14 +248,30 @@ public:
     void setAuthKey(const QByteArray &newAuthKey);
     quint64 authId() const { return m_authId; }
 
+    // False if the key is generated, but there was no sign in or authorization import with it yet.
+    bool isKeyAuthorized() const { return m_keyAuthorized; }
+    void setKeyAuthorized(bool authorized) { m_keyAuthorized = authorized; }
+
     quint64 serverSalt() const { return m_serverSalt; }
     void setServerSalt(const quint64 salt) { m_serverSalt = salt; }
     quint64 sessionId() const { return m_sessionId; }
 
+    QVector<SFutureSalt> futureSalts() const { return m_futureSalts; }
+    void setFutureSalts(const QVector<SFutureSalt> &salts) { m_futureSalts = salts; }
+
     QVector<TLDcOption> dcConfiguration() const { return m_dcConfiguration; }
 
     qint32 deltaTime() const { return m_deltaTime; }
     void setDeltaTime(const qint32 newDt);
+    qint64 clockOffset() const { return m_clockOffset; } // Precise deltaTime (ms)
+
+    quint64 packingSavedBytes() const { return m_packingSavedBytes; } // Outgoing traffic saved by gzip packing
+
+    // The pool for the low-cardinality strings of the received values (see CTelegramStream::setStringPool())
+    void setStringPool(CTelegramStringPool *pool) { m_stringPool = pool; }
+
+    // Consumes the items of the updates difference during the decoding; the emitted difference has only the rejected items.
+    void setUpdatesDifferenceVisitor(CTelegramStreamVisitor *visitor) { m_updatesDifferenceVisitor = visitor; }
 
     void processRedirectedPackage(const QByteArray &data);
 
@@ -277,6 +301,8 @@ signals:
 
     void fullUserReceived(const TLUserFull &userFull);
     void messagesHistoryReceived(const TLMessagesMessages &history, const TLInputPeer &peer);
+    void messagesReceived(const TLMessagesMessages &messages);
+    void messagesNotReceived(const QVector<quint32> &messageIds); // Failed messages.getMessages or the messages omitted in its result
     void messagesDialogsReceived(const TLMessagesDialogs &dialogs, quint32 offset, quint32 maxId, quint32 limit);
 
     void updatesReceived(const TLUpdates &update, quint64 id);
@@ -299,6 +325,7 @@ protected:
     void processMessageAck(CTelegramStream &stream);
     void processIgnoredMessageNotification(CTelegramStream &stream);
     void processPingPong(CTelegramStream &stream);
+    void processFutureSalts(CTelegramStream &stream);
 
     TLValue processHelpGetConfig(CTelegramStream &stream, quint64 id);
     TLValue processContactsGetContacts(CTelegramStream &stream, quint64 id);
@@ -324,12 +351,27 @@ protected:
     TLValue processMessagesGetHistory(CTelegramStream &stream, quint64 id);
     TLValue processMessagesGetDialogs(CTelegramStream &stream, quint64 id);
     TLValue processMessagesGetChats(CTelegramStream &stream, quint64 id);
+    TLValue processMessagesGetMessages(CTelegramStream &stream, quint64 id);
     TLValue processMessagesGetFullChat(CTelegramStream &stream, quint64 id);
     TLValue processAccountCheckUsername(CTelegramStream &stream, quint64 id);
     TLValue processAccountGetPassword(CTelegramStream &stream, quint64 id);
     TLValue processAccountUpdateStatus(CTelegramStream &stream, quint64 id);
     TLValue processAccountUpdateUsername(CTelegramStream &stream, quint64 id);
 
+    // Result of a request without a specific handler
+    template <typename T>
+    TLValue processRpcResultOfType(CTelegramStream &stream, quint64 id);
+
+    typedef TLValue (CTelegramConnection::*RpcResultHandler)(CTelegramStream &stream, quint64 id);
+    static RpcResultHandler rpcResultHandler(TLValue request);
+
+    struct RpcResultHandlerEntry {
+        quint32 request;
+        RpcResultHandler handler;
+    };
+
+    static const RpcResultHandlerEntry s_rpcResultHandlers[];
+
     bool processErrorSeeOther(const QString errorMessage, quint64 id);
 
     TLValue processUpdate(CTelegramStream &stream, bool *ok, quint64 id);
@@ -346,6 +388,8 @@ protected:
     quint64 sendEncryptedPackage(const QByteArray &buffer, bool savePackage = true);
     quint64 sendEncryptedPackageAgain(quint64 id);
 
+    static bool isWorthToPack(const QByteArray &buffer);
+
     void setTransport(CTelegramTransport *newTransport);
 
     void setStatus(ConnectionStatus status, ConnectionStatusReason reason = ConnectionStatusReasonNone);
@@ -353,7 +397,14 @@ protected:
 
     quint64 newMessageId();
 
+    void addClockSample(quint64 serverMessageId, qint64 requestTime, qint64 responseTime);
+    void setClockOffset(qint64 offset);
+
+    void selectActualServerSalt();
+    void ensureFutureSalts();
+
     QString userNameFromPackage(quint64 id) const;
+    TLVector<quint32> messageIdsFromPackage(quint64 id) const;
 
     void startAuthTimer();
     void stopAuthTimer();
@@ -387,8 +438,11 @@ protected:
     QByteArray m_authKey;
     quint64 m_authId;
     quint64 m_authKeyAuxHash;
+    bool m_keyAuthorized;
     quint64 m_serverSalt;
     quint64 m_receivedServerSalt;
+    QVector<SFutureSalt> m_futureSalts; // Sorted by validSince
+    quint64 m_futureSaltsRequestId;
     quint64 m_sessionId;
     quint64 m_lastMessageId;
     quint64 m_lastSentPingId;
@@ -402,8 +456,11 @@ protected:
 
     quint32 m_pingInterval;
     quint32 m_serverDisconnectionExtraTime;
-    qint32 m_deltaTime;
-    DeltaTimeHeuristicState m_deltaTimeHeuristicState;
+    qint32 m_deltaTime; // (sec)
+    qint64 m_clockOffset; // (ms)
+    QVector<QPair<qint64, qint64> > m_clockSamples; // <round trip time, clock offset> (ms)
+    qint64 m_plainPackageSentTime;
+    quint64 m_receivedMessageId;
 
     TLNumber128 m_clientNonce;
     TLNumber128 m_serverNonce;
@@ -428,6 +485,11 @@ protected:
 
     QVector<TLDcOption> m_dcConfiguration;
 
+    CGZipInflater m_inflater;
+    quint64 m_packingSavedBytes;
+    CTelegramStringPool *m_stringPool;
+    CTelegramStreamVisitor *m_updatesDifferenceVisitor;
+
     QString m_authCodeHash;
 
 #ifdef NETWORK_LOGGING
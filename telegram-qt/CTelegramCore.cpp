@@ -324,6 +324,16 @@ void CTelegramCore::setMediaDataBufferSize(quint32 size)
     m_dispatcher->setMediaDataBufferSize(size);
 }
 
+void CTelegramCore::setMediaMessagesCacheSize(quint32 size)
+{
+    m_dispatcher->setMediaMessagesCacheSize(size);
+}
+
+void CTelegramCore::setAuthKeysPregeneration(bool enable)
+{
+    m_dispatcher->setAuthKeysPregeneration(enable);
+}
+
 QString CTelegramCore::selfPhone() const
 {
     return m_dispatcher->selfPhone();
@@ -72,6 +72,12 @@ public Q_SLOTS:
     void setPingInterval(quint32 interval, quint32 serverDisconnectionAdditionTime = 10000);
     void setMediaDataBufferSize(quint32 size);
 
+    // Limit the memory (in bytes) used to remember the received media messages. The least recently used messages are forgotten first.
+    void setMediaMessagesCacheSize(quint32 size);
+
+    // Negotiate auth keys for all known DCs in background, once the main connection is ready. Disabled by default.
+    void setAuthKeysPregeneration(bool enable);
+
     bool initConnection(const QVector<TelegramNamespace::DcOption> &dcs = QVector<TelegramNamespace::DcOption>()); // Uses builtin dc options by default
     bool restoreConnection(const QByteArray &secret);
     void closeConnection();
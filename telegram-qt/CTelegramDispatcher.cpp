@@ -29,6 +29,7 @@ using namespace TelegramUtils;
 #include <QTimer>
 
 #include <QCryptographicHash>
+#include <QDateTime>
 #include <QDebug>
 #if QT_VERSION < 0x048000
 #include <algorithm>
@@ -47,17 +48,84 @@ static const QVector<TelegramNamespace::DcOption> s_builtInDcs = QVector<Telegra
 
 static const quint32 s_defaultPingInterval = 15000; // 15 sec
 
-const quint32 secretFormatVersion = 3;
+const quint32 secretFormatVersion = 4;
 const int s_userTypingActionPeriod = 6000; // 6 sec
 const int s_localTypingDuration = 5000; // 5 sec
 const int s_localTypingRecommendedRepeatInterval = 400; // (s_userTypingActionPeriod - s_localTypingDuration) / 2. Minus 100 ms for insurance.
 
+static const int s_peersResolvingInterval = 50; // 50 ms; unknown peers are collected during this interval and requested in one batch
+static const int s_delayedMessagesTimeout = 5000; // 5 sec; messages from unresolved peers are delivered anyway after the timeout
+static const int s_defaultMediaMessagesCacheSize = 2 * 1024 * 1024; // 2 MB
 static const int s_autoConnectionIndexInvalid = -1; // App logic rely on (s_autoConnectionIndexInvalid + 1 == 0)
 
 #ifndef Q_NULLPTR
 #define Q_NULLPTR NULL
 #endif
 
+static void writeFutureSalts(CTelegramStream &stream, const QVector<SFutureSalt> &salts)
+{
+    stream << quint32(salts.count());
+
+    foreach (const SFutureSalt &futureSalt, salts) {
+        stream << futureSalt.validSince;
+        stream << futureSalt.validUntil;
+        stream << futureSalt.salt;
+    }
+}
+
+static QVector<SFutureSalt> readFutureSalts(CTelegramStream &stream)
+{
+    QVector<SFutureSalt> salts;
+    quint32 count = 0;
+    stream >> count;
+
+    for (quint32 i = 0; (i < count) && !stream.error(); ++i) {
+        SFutureSalt futureSalt;
+        stream >> futureSalt.validSince;
+        stream >> futureSalt.validUntil;
+        stream >> futureSalt.salt;
+        salts.append(futureSalt);
+    }
+
+    return salts;
+}
+
+// The peer is asked again only if the previous request is not answered within the timeout.
+// The dialog of the message: the chat or the other user of a private message.
+static quint64 messagePeerKey(const TelegramNamespace::Message &message)
+{
+    if (message.chatId) {
+        return (quint64(1) << 32) | message.chatId;
+    }
+
+    return message.userId;
+}
+
+static bool isPeerAsked(const QHash<quint32, qint64> &askedIds, quint32 id, qint64 currentTime)
+{
+    const QHash<quint32, qint64>::const_iterator it = askedIds.constFind(id);
+    return (it != askedIds.constEnd()) && (currentTime - it.value() < s_delayedMessagesTimeout);
+}
+
+/* Processes the new messages, users and chats of an updates difference while it is decoded,
+ * so the (possibly huge) vectors of the difference are never held in memory. */
+class CUpdatesDifferenceVisitor : public CTelegramStreamVisitor
+{
+public:
+    explicit CUpdatesDifferenceVisitor(CTelegramDispatcher *dispatcher) :
+        m_dispatcher(dispatcher)
+    {
+    }
+
+    bool onMessage(const TLMessage &message) { m_dispatcher->processDifferenceMessage(message); return true; }
+    bool onUser(const TLUser &user) { m_dispatcher->processUser(user); return true; }
+    bool onChat(const TLChat &chat) { m_dispatcher->processChat(chat); return true; }
+
+private:
+    CTelegramDispatcher *m_dispatcher;
+
+};
+
 #if QT_VERSION < 0x050000
 const int s_timerMaxInterval = 500; // 0.5 sec. Needed to limit max possible typing time deviation in Qt4 by this value.
 #endif
@@ -70,6 +138,35 @@ enum TelegramMessageFlags {
     TelegramMessageFlagReply   = 1 << 3,
 };
 
+void SMediaMessageRecord::setMessage(const TLMessage &message)
+{
+    TLMessage trimmedMessage = message;
+    TLMessageMedia &media = trimmedMessage.media;
+
+    if (!media.photo.sizes.isEmpty()) {
+        TLPhotoSize size = media.photo.sizes.last();
+        size.bytes.clear();
+        media.photo.sizes = TLVector<TLPhotoSize>() << size;
+    }
+
+    media.video.thumb = TLPhotoSize();
+    media.document.thumb = TLPhotoSize();
+
+    // The text is not needed to download or describe the media.
+    trimmedMessage.message.clear();
+
+    QByteArray data;
+    CTelegramStream stream(&data, /* write */ true);
+    stream << trimmedMessage;
+
+    this->message = TLMessageView(data);
+}
+
+int SMediaMessageRecord::cost() const
+{
+    return sizeof(SMediaMessageRecord) + message.data().size();
+}
+
 FileRequestDescriptor FileRequestDescriptor::uploadRequest(const QByteArray &data, const QString &fileName, quint32 dc)
 {
     FileRequestDescriptor result;
@@ -89,9 +186,9 @@ FileRequestDescriptor FileRequestDescriptor::uploadRequest(const QByteArray &dat
     return result;
 }
 
-FileRequestDescriptor FileRequestDescriptor::avatarRequest(const TLUser *user)
+FileRequestDescriptor FileRequestDescriptor::avatarRequest(const SUserRecord *user)
 {
-    if (user->photo.photoSmall.tlType != TLValue::FileLocation) {
+    if (user->photoSmall.tlType != TLValue::FileLocation) {
         return FileRequestDescriptor();
     }
 
@@ -99,18 +196,30 @@ FileRequestDescriptor FileRequestDescriptor::avatarRequest(const TLUser *user)
 
     result.m_type = Avatar;
     result.m_userId = user->id;
-    result.setupLocation(user->photo.photoSmall);
+    result.setupLocation(user->photoSmall);
 
     return result;
 }
 
-FileRequestDescriptor FileRequestDescriptor::messageMediaDataRequest(const TLMessage &message)
+FileRequestDescriptor FileRequestDescriptor::messageMediaDataRequest(const SMediaMessageRecord *record)
 {
-    const TLMessageMedia &media = message.media;
+    const TLMessageView &message = record->message;
+    const TLMessageMedia media = message.media();
+    const TLPeer toId = message.toId();
 
     FileRequestDescriptor result;
     result.m_type = MessageMediaData;
-    result.m_messageId = message.id;
+    result.m_messageId = message.id();
+    result.m_messageType = telegramMessageTypeToPublicMessageType(media.tlType);
+
+    // The peer of an incoming private message is its sender.
+    if (toId.tlType == TLValue::PeerChat) {
+        result.m_peer = TelegramNamespace::Peer(toId.chatId, TelegramNamespace::Peer::Chat);
+    } else if (message.flags() & TelegramMessageFlagOut) {
+        result.m_peer = TelegramNamespace::Peer(toId.userId);
+    } else {
+        result.m_peer = TelegramNamespace::Peer(message.fromId());
+    }
 
     switch (media.tlType) {
     case TLValue::MessageMediaPhoto:
@@ -128,6 +237,7 @@ FileRequestDescriptor FileRequestDescriptor::messageMediaDataRequest(const TLMes
         result.m_inputLocation.id = media.audio.id;
         result.m_inputLocation.accessHash = media.audio.accessHash;
         result.m_size = media.audio.size;
+        result.m_mimeType = media.audio.mimeType;
         break;
     case TLValue::MessageMediaVideo:
         result.m_dcId = media.video.dcId;
@@ -142,6 +252,7 @@ FileRequestDescriptor FileRequestDescriptor::messageMediaDataRequest(const TLMes
         result.m_inputLocation.id = media.document.id;
         result.m_inputLocation.accessHash = media.document.accessHash;
         result.m_size = media.document.size;
+        result.m_mimeType = media.document.mimeType;
         break;
     default:
         return FileRequestDescriptor();
@@ -240,7 +351,8 @@ FileRequestDescriptor::FileRequestDescriptor() :
     m_size(0),
     m_offset(0),
     m_part(0),
-    m_hash(0)
+    m_hash(0),
+    m_messageType(TelegramNamespace::MessageTypeUnsupported)
 {
 }
 
@@ -254,6 +366,7 @@ CTelegramDispatcher::CTelegramDispatcher(QObject *parent) :
     m_autoReconnectionEnabled(false),
     m_pingInterval(s_defaultPingInterval),
     m_mediaDataBufferSize(128 * 256), // 128 KB
+    m_authKeysPregenerationEnabled(false),
     m_initializationState(0),
     m_requestedSteps(0),
     m_wantedActiveDc(0),
@@ -261,17 +374,31 @@ CTelegramDispatcher::CTelegramDispatcher(QObject *parent) :
     m_mainConnection(0),
     m_updateRequestId(0),
     m_updatesStateIsLocked(false),
+    m_peersResolvingTimer(new QTimer(this)),
+    m_delayedMessagesTimer(new QTimer(this)),
+    m_updatesDifferenceVisitor(new CUpdatesDifferenceVisitor(this)),
     m_selfUserId(0),
     m_fileRequestCounter(0),
     m_typingUpdateTimer(new QTimer(this))
 {
     m_typingUpdateTimer->setSingleShot(true);
     connect(m_typingUpdateTimer, SIGNAL(timeout()), SLOT(messageActionTimerTimeout()));
+
+    m_knownMediaMessages.setMaxCost(s_defaultMediaMessagesCacheSize);
+
+    m_peersResolvingTimer->setSingleShot(true);
+    m_peersResolvingTimer->setInterval(s_peersResolvingInterval);
+    connect(m_peersResolvingTimer, SIGNAL(timeout()), SLOT(resolvePendingPeers()));
+
+    m_delayedMessagesTimer->setSingleShot(true);
+    m_delayedMessagesTimer->setInterval(s_delayedMessagesTimeout);
+    connect(m_delayedMessagesTimer, SIGNAL(timeout()), SLOT(flushDelayedMessages()));
 }
 
 CTelegramDispatcher::~CTelegramDispatcher()
 {
     closeConnection();
+    delete m_updatesDifferenceVisitor;
 }
 
 QVector<TelegramNamespace::DcOption> CTelegramDispatcher::builtInDcs()
@@ -296,11 +423,13 @@ qint32 CTelegramDispatcher::localTypingRecommendedRepeatInterval()
 
 QString CTelegramDispatcher::selfPhone() const
 {
-    if (!m_selfUserId || !m_users.value(m_selfUserId)) {
+    const SUserRecord *selfUser = m_users.user(m_selfUserId);
+
+    if (!m_selfUserId || !selfUser) {
         return QString();
     }
 
-    return m_users.value(m_selfUserId)->phone;
+    return selfUser->phone;
 }
 
 quint32 CTelegramDispatcher::selfId() const
@@ -374,6 +503,41 @@ QByteArray CTelegramDispatcher::connectionSecretInfo() const
     outputStream << m_updatesState.date;
     outputStream << m_chatIds;
 
+    QVector<const CTelegramConnection*> extraConnections;
+    foreach (const CTelegramConnection *connection, m_extraConnections) {
+        if (connection->dcInfo().id == activeConnection()->dcInfo().id) {
+            continue;
+        }
+
+        if (connection->authKey().isEmpty()) {
+            continue;
+        }
+
+        extraConnections.append(connection);
+    }
+
+    outputStream << quint32(extraConnections.count());
+
+    foreach (const CTelegramConnection *connection, extraConnections) {
+        outputStream << connection->deltaTime();
+        outputStream << connection->dcInfo();
+        outputStream << connection->authKey();
+        outputStream << connection->authId();
+        outputStream << connection->serverSalt();
+        outputStream << connection->isKeyAuthorized();
+        writeFutureSalts(outputStream, connection->futureSalts());
+    }
+
+    outputStream << quint32(m_exportedAuthentications.count());
+
+    foreach (quint32 dc, m_exportedAuthentications.keys()) {
+        outputStream << dc;
+        outputStream << m_exportedAuthentications.value(dc).first;
+        outputStream << m_exportedAuthentications.value(dc).second;
+    }
+
+    writeFutureSalts(outputStream, activeConnection()->futureSalts());
+
     return output;
 }
 
@@ -415,6 +579,24 @@ void CTelegramDispatcher::setMediaDataBufferSize(quint32 size)
     m_mediaDataBufferSize = size;
 }
 
+void CTelegramDispatcher::setMediaMessagesCacheSize(quint32 size)
+{
+    if (!size) {
+        size = s_defaultMediaMessagesCacheSize;
+    }
+
+    m_knownMediaMessages.setMaxCost(size);
+}
+
+void CTelegramDispatcher::setAuthKeysPregeneration(bool enable)
+{
+    m_authKeysPregenerationEnabled = enable;
+
+    if (enable && (m_initializationState == StepDone)) {
+        pregenerateExtraConnections();
+    }
+}
+
 bool CTelegramDispatcher::initConnection(const QVector<TelegramNamespace::DcOption> &dcs)
 {
     if (!dcs.isEmpty()) {
@@ -525,6 +707,74 @@ bool CTelegramDispatcher::restoreConnection(const QByteArray &secret)
         return false;
     }
 
+    clearExtraConnections();
+    m_exportedAuthentications.clear();
+
+    if (format >= 4) {
+        quint32 extraConnectionsCount = 0;
+        inputStream >> extraConnectionsCount;
+
+        for (quint32 i = 0; i < extraConnectionsCount; ++i) {
+            inputStream >> deltaTime;
+            inputStream >> dcInfo;
+            inputStream >> authKey;
+            inputStream >> authId;
+            inputStream >> serverSalt;
+
+            bool keyAuthorized = false;
+            inputStream >> keyAuthorized;
+
+            const QVector<SFutureSalt> futureSalts = readFutureSalts(inputStream);
+
+            if (inputStream.error()) {
+                qDebug() << Q_FUNC_INFO << "Unable to read extra connections data.";
+                break;
+            }
+
+            // Extra connections are connected on demand (or by the keys pregeneration).
+            CTelegramConnection *connection = createConnection(dcInfo);
+            connection->setDeltaTime(deltaTime);
+            connection->setAuthKey(authKey);
+            connection->setServerSalt(serverSalt);
+            connection->setKeyAuthorized(keyAuthorized);
+            connection->setFutureSalts(futureSalts);
+
+            if (connection->authId() != authId) {
+                qDebug() << Q_FUNC_INFO << "Invalid auth data for dc" << dcInfo.id;
+                disconnect(connection, Q_NULLPTR, this, Q_NULLPTR);
+                connection->deleteLater();
+                continue;
+            }
+
+            m_extraConnections.append(connection);
+        }
+
+        quint32 exportedAuthenticationsCount = 0;
+        inputStream >> exportedAuthenticationsCount;
+
+        for (quint32 i = 0; i < exportedAuthenticationsCount; ++i) {
+            quint32 dc;
+            quint32 id;
+            QByteArray data;
+            inputStream >> dc;
+            inputStream >> id;
+            inputStream >> data;
+
+            if (inputStream.error()) {
+                qDebug() << Q_FUNC_INFO << "Unable to read exported authorizations.";
+                break;
+            }
+
+            m_exportedAuthentications.insert(dc, QPair<quint32, QByteArray>(id, data));
+        }
+
+        const QVector<SFutureSalt> futureSalts = readFutureSalts(inputStream);
+
+        if (!inputStream.error()) {
+            m_mainConnection->setFutureSalts(futureSalts);
+        }
+    }
+
     initConnectionSharedFinal();
 
     return true;
@@ -563,8 +813,16 @@ void CTelegramDispatcher::closeConnection()
 
     m_dcConfiguration.clear();
     m_delayedPackages.clear();
-    qDeleteAll(m_users);
     m_users.clear();
+    m_askedUserIds.clear();
+    m_askedChatIds.clear();
+    m_requestedMediaMessageIds.clear();
+    m_pendingUserIds.clear();
+    m_pendingChatIds.clear();
+    m_peersResolvingTimer->stop();
+    m_delayedMessages.clear();
+    m_delayedMessagesTimer->stop();
+    m_stringPool.clear();
     m_contactIdList.clear();
     m_requestedFileDescriptors.clear();
     m_fileRequestCounter = 0;
@@ -653,13 +911,13 @@ void CTelegramDispatcher::requestContactAvatar(quint32 userId)
 {
     qDebug() << Q_FUNC_INFO << userId;
 
-    const TLUser *user = m_users.value(userId);
+    const SUserRecord *user = m_users.user(userId);
     if (!user) {
         qDebug() << Q_FUNC_INFO << "Unknown user" << userId;
         return;
     }
 
-    if (user->photo.tlType == TLValue::UserProfilePhotoEmpty) {
+    if (user->photoType == TLValue::UserProfilePhotoEmpty) {
         qDebug() << Q_FUNC_INFO << "User" << userId << "have no avatar";
         return;
     }
@@ -673,27 +931,39 @@ void CTelegramDispatcher::requestContactAvatar(quint32 userId)
 
 bool CTelegramDispatcher::requestMessageMediaData(quint32 messageId)
 {
-    if (!m_knownMediaMessages.contains(messageId)) {
-        qDebug() << Q_FUNC_INFO << "Unknown media message" << messageId;
-        return false;
+    const SMediaMessageRecord *message = m_knownMediaMessages.object(messageId);
+
+    if (!message) {
+        if (!m_mediaMessageIds.contains(messageId) || !activeConnection()) {
+            qDebug() << Q_FUNC_INFO << "Unknown media message" << messageId;
+            return false;
+        }
+
+        // The message is evicted from the cache; get it again and request the data on arrival.
+        if (!m_requestedMediaMessageIds.contains(messageId)) {
+            m_requestedMediaMessageIds.insert(messageId);
+            activeConnection()->messagesGetMessages(TLVector<quint32>() << messageId);
+        }
+
+        return true;
     }
 
     // TODO: MessageMediaContact, MessageMediaGeo
 
-    return requestFile(FileRequestDescriptor::messageMediaDataRequest(m_knownMediaMessages.value(messageId)));
+    return requestFile(FileRequestDescriptor::messageMediaDataRequest(message));
 }
 
 bool CTelegramDispatcher::getMessageMediaInfo(TelegramNamespace::MessageMediaInfo *messageInfo, quint32 messageId) const
 {
-    if (!m_knownMediaMessages.contains(messageId)) {
+    const SMediaMessageRecord *message = m_knownMediaMessages.object(messageId);
+
+    if (!message) {
         qDebug() << Q_FUNC_INFO << "Unknown media message" << messageId;
         return false;
     }
 
-    const TLMessage &message = m_knownMediaMessages.value(messageId);
-    const TLMessageMedia &media = message.media;
     TLMessageMedia &info = *messageInfo->d;
-    info = media;
+    info = message->message.media();
     return true;
 }
 
@@ -721,9 +991,9 @@ quint32 CTelegramDispatcher::resolveUsername(const QString &userName)
         return 0;
     }
 
-    foreach (const TLUser *user, m_users) {
-        if (user->username == userName) {
-            return user->id;
+    foreach (const SUserRecord &user, m_users.records()) {
+        if (user.username == userName) {
+            return user.id;
         }
     }
 
@@ -1037,7 +1307,7 @@ void CTelegramDispatcher::setUserName(const QString &newUserName)
 
 QString CTelegramDispatcher::contactAvatarToken(quint32 userId) const
 {
-    const TLUser *user = m_users.value(userId);
+    const SUserRecord *user = m_users.user(userId);
 
     if (!user) {
         qDebug() << Q_FUNC_INFO << "Unknown identifier" << userId;
@@ -1062,14 +1332,15 @@ QString CTelegramDispatcher::chatTitle(quint32 chatId) const
 
 bool CTelegramDispatcher::getUserInfo(TelegramNamespace::UserInfo *userInfo, quint32 userId) const
 {
-    if (!m_users.contains(userId)) {
+    const SUserRecord *user = m_users.user(userId);
+
+    if (!user) {
         qDebug() << Q_FUNC_INFO << "Unknown user" << userId;
         return false;
     }
 
-    const TLUser *user = m_users.value(userId);
     TLUser &info = *userInfo->d;
-    info = *user;
+    info = user->toUser();
     return true;
 }
 
@@ -1155,37 +1426,38 @@ void CTelegramDispatcher::onUsersReceived(const QVector<TLUser> &users)
 {
     qDebug() << Q_FUNC_INFO << users.count();
     foreach (const TLUser &user, users) {
-        TLUser *existsUser = m_users.value(user.id);
+        processUser(user);
+    }
 
-        if (existsUser) {
-            *existsUser = user;
-        } else {
-            m_users.insert(user.id, new TLUser(user));
-        }
+    if (!m_delayedMessages.isEmpty()) {
+        deliverResolvedMessages();
+    }
+}
 
-        if (user.tlType == TLValue::UserSelf) {
-            if (m_selfUserId) {
-                if (m_selfUserId != user.id) {
-                    qDebug() << "Got self user with different id.";
+void CTelegramDispatcher::processUser(const TLUser &user)
+{
+    bool isNewUser = false;
+    internUserStrings(m_users.insert(user, &isNewUser));
+
+    if (user.tlType == TLValue::UserSelf) {
+        if (m_selfUserId) {
+            if (m_selfUserId != user.id) {
+                qDebug() << "Got self user with different id.";
 
-                    m_selfUserId = user.id;
-                    emit selfUserAvailable(user.id);
-                }
-            } else {
                 m_selfUserId = user.id;
                 emit selfUserAvailable(user.id);
-                continueInitialization(StepKnowSelf);
             }
+        } else {
+            m_selfUserId = user.id;
+            emit selfUserAvailable(user.id);
+            continueInitialization(StepKnowSelf);
         }
+    }
 
-        int indexOfRequest = m_askedUserIds.indexOf(user.id);
-        if (indexOfRequest >= 0) {
-            m_askedUserIds.remove(indexOfRequest);
-        }
+    m_askedUserIds.remove(user.id);
 
-        if (!existsUser) {
-            emit userInfoReceived(user.id);
-        }
+    if (isNewUser) {
+        emit userInfoReceived(user.id);
     }
 }
 
@@ -1299,6 +1571,40 @@ void CTelegramDispatcher::whenMessagesHistoryReceived(const TLMessagesMessages &
     }
 }
 
+void CTelegramDispatcher::whenMessagesReceived(const TLMessagesMessages &messages)
+{
+    foreach (const TLChat &chat, messages.chats) {
+        processChat(chat);
+    }
+
+    // Delivers the delayed messages of the received chats as well.
+    onUsersReceived(messages.users);
+
+    foreach (const TLMessage &message, messages.messages) {
+        if (!m_requestedMediaMessageIds.remove(message.id)) {
+            continue;
+        }
+
+        if (message.media.tlType == TLValue::MessageMediaEmpty) {
+            qDebug() << Q_FUNC_INFO << "Requested message" << message.id << "has no media";
+            continue;
+        }
+
+        FileRequestDescriptor descriptor;
+        cacheMediaMessage(message, &descriptor);
+        requestFile(descriptor);
+    }
+}
+
+void CTelegramDispatcher::whenMessagesNotReceived(const QVector<quint32> &messageIds)
+{
+    foreach (quint32 messageId, messageIds) {
+        if (m_requestedMediaMessageIds.remove(messageId)) {
+            qDebug() << Q_FUNC_INFO << "Requested media message" << messageId << "is not available";
+        }
+    }
+}
+
 void CTelegramDispatcher::onMessagesDialogsReceived(const TLMessagesDialogs &dialogs, quint32 offset, quint32 maxId, quint32 limit)
 {
 #ifdef DEVELOPER_BUILD
@@ -1351,6 +1657,13 @@ void CTelegramDispatcher::getInitialUsers()
     activeConnection()->usersGetUsers(QVector<TLInputUser>() << selfUser << telegramUser);
 }
 
+/* Many users have the same first or last name, so the stored users share the storage of the names. */
+void CTelegramDispatcher::internUserStrings(SUserRecord *user)
+{
+    // The last names (as well as the user names) are mostly unique, so they would only grow the pool.
+    user->firstName = m_stringPool.intern(user->firstName);
+}
+
 void CTelegramDispatcher::getContacts()
 {
     activeConnection()->contactsGetContacts(QString()); // Empty hash argument for now.
@@ -1389,18 +1702,25 @@ void CTelegramDispatcher::whenUpdatesDifferenceReceived(const TLUpdatesDifferenc
     switch (updatesDifference.tlType) {
     case TLValue::UpdatesDifference:
     case TLValue::UpdatesDifferenceSlice:
+        // The vectors are empty if the difference is processed by the visitor during the decoding.
         qDebug() << Q_FUNC_INFO << "UpdatesDifference" << updatesDifference.newMessages.count();
         foreach (const TLChat &chat, updatesDifference.chats) {
-            updateChat(chat);
+            processChat(chat);
+        }
+
+        foreach (const TLUser &user, updatesDifference.users) {
+            processUser(user);
         }
 
         foreach (const TLMessage &message, updatesDifference.newMessages) {
-            if ((message.tlType != TLValue::MessageService) && (filterReceivedMessage(getPublicMessageFlags(message.flags)))) {
-                continue;
-            }
+            processDifferenceMessage(message);
+        }
 
-            processMessageReceived(message);
+        // The messages are decoded before the users and chats of the difference.
+        if (!m_delayedMessages.isEmpty()) {
+            deliverResolvedMessages();
         }
+
         if (updatesDifference.tlType == TLValue::UpdatesDifference) {
             setUpdateState(updatesDifference.state.pts, updatesDifference.state.seq, updatesDifference.state.date);
         } else { // UpdatesDifferenceSlice
@@ -1433,20 +1753,164 @@ void CTelegramDispatcher::onChatsReceived(const QVector<TLChat> &chats)
     qDebug() << Q_FUNC_INFO << chats.count();
 
     foreach (const TLChat &chat, chats) {
-        updateChat(chat);
+        processChat(chat);
+    }
+
+    if (!m_delayedMessages.isEmpty()) {
+        deliverResolvedMessages();
+
+        // The participants are requested only for the chats, which still have messages from unknown senders.
+        const qint64 currentTime = QDateTime::currentMSecsSinceEpoch();
+
+        foreach (const TLChat &chat, chats) {
+            if (hasUnknownChatSenders(chat.id) && !m_pendingChatIds.contains(chat.id)) {
+                m_askedChatIds.insert(chat.id, currentTime);
+                m_pendingChatIds.append(chat.id);
+            }
+        }
+
+        if (!m_pendingChatIds.isEmpty() && !m_peersResolvingTimer->isActive()) {
+            m_peersResolvingTimer->start();
+        }
     }
 
     continueInitialization(StepChatInfo);
 }
 
+void CTelegramDispatcher::processChat(const TLChat &chat)
+{
+    updateChat(chat);
+    m_askedChatIds.remove(chat.id);
+}
+
 void CTelegramDispatcher::whenMessagesFullChatReceived(const TLChatFull &chat, const QVector<TLChat> &chats, const QVector<TLUser> &users)
 {
-    Q_UNUSED(chats);
+    foreach (const TLChat &fullChatChat, chats) {
+        processChat(fullChatChat);
+    }
+    m_askedChatIds.remove(chat.id);
 
+    // Delivers the delayed messages of the chat as well.
     onUsersReceived(users);
     updateFullChat(chat);
 }
 
+void CTelegramDispatcher::resolvePendingPeers()
+{
+    if (!activeConnection()) {
+        return;
+    }
+
+    if (!m_pendingUserIds.isEmpty()) {
+        TLVector<TLInputUser> contacts;
+
+        foreach (quint32 id, m_pendingUserIds) {
+            if (m_users.contains(id)) { // Received meanwhile (e.g. with the same updates difference)
+                continue;
+            }
+
+            // There is no access hash for the other users; their messages are delivered after the timeout.
+            if (!m_contactIdList.contains(id)) {
+                continue;
+            }
+
+            TLInputUser user;
+            user.tlType = TLValue::InputUserContact;
+            user.userId = id;
+            contacts.append(user);
+        }
+
+        if (!contacts.isEmpty()) {
+            activeConnection()->usersGetUsers(contacts);
+        }
+
+        m_pendingUserIds.clear();
+    }
+
+    TLVector<quint32> unknownChatIds;
+
+    foreach (quint32 chatId, m_pendingChatIds) {
+        if (!m_chatInfo.contains(chatId)) {
+            unknownChatIds.append(chatId);
+        } else if (hasUnknownChatSenders(chatId)) {
+            // The full chat has the users of the participants.
+            activeConnection()->messagesGetFullChat(chatId);
+        }
+    }
+    m_pendingChatIds.clear();
+
+    if (!unknownChatIds.isEmpty()) {
+        // The participants are requested on arrival of the chats, if their senders are still unknown.
+        activeConnection()->messagesGetChats(unknownChatIds);
+    }
+}
+
+bool CTelegramDispatcher::hasDelayedMessages(quint64 peerKey) const
+{
+    for (int i = 0; i < m_delayedMessages.count(); ++i) {
+        if (messagePeerKey(m_delayedMessages.at(i).second) == peerKey) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool CTelegramDispatcher::hasUnknownChatSenders(quint32 chatId) const
+{
+    for (int i = 0; i < m_delayedMessages.count(); ++i) {
+        const TelegramNamespace::Message &message = m_delayedMessages.at(i).second;
+        if ((message.chatId == chatId) && message.userId && !m_users.contains(message.userId)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void CTelegramDispatcher::flushDelayedMessages()
+{
+    const qint64 currentTime = QDateTime::currentMSecsSinceEpoch();
+
+    // The messages are in the order of their deadlines.
+    int expiredCount = 0;
+    while ((expiredCount < m_delayedMessages.count()) && (m_delayedMessages.at(expiredCount).first <= currentTime)) {
+        ++expiredCount;
+    }
+
+    qDebug() << Q_FUNC_INFO << "Deliver" << expiredCount << "messages from unresolved peers";
+
+    const QVector<QPair<qint64, TelegramNamespace::Message> > expiredMessages = m_delayedMessages.mid(0, expiredCount);
+    m_delayedMessages.remove(0, expiredCount);
+    startDelayedMessagesTimer();
+
+    // A peer, which is not received within the timeout, is asked again by its next message.
+    removeExpiredAskedIds(&m_askedUserIds, currentTime);
+    removeExpiredAskedIds(&m_askedChatIds, currentTime);
+
+    for (int i = 0; i < expiredMessages.count(); ++i) {
+        emit messageReceived(expiredMessages.at(i).second);
+    }
+
+    // The resolved messages, which waited for the expired ones of their dialogs.
+    if (!m_delayedMessages.isEmpty()) {
+        deliverResolvedMessages();
+    }
+}
+
+void CTelegramDispatcher::removeExpiredAskedIds(QHash<quint32, qint64> *askedIds, qint64 currentTime)
+{
+    QHash<quint32, qint64>::iterator it = askedIds->begin();
+
+    while (it != askedIds->end()) {
+        if (currentTime - it.value() < s_delayedMessagesTimeout) {
+            ++it;
+        } else {
+            it = askedIds->erase(it);
+        }
+    }
+}
+
 void CTelegramDispatcher::setConnectionState(TelegramNamespace::ConnectionState state)
 {
     qDebug() << Q_FUNC_INFO << state;
@@ -1618,7 +2082,7 @@ void CTelegramDispatcher::processUpdate(const TLUpdate &update)
             break;
         }
 
-        TLUser *user = m_users.value(update.userId);
+        SUserRecord *user = m_users.user(update.userId);
         if (user) {
             user->status = update.status;
             emit contactStatusChanged(update.userId, getApiContactStatus(user->status.tlType));
@@ -1626,13 +2090,14 @@ void CTelegramDispatcher::processUpdate(const TLUpdate &update)
         break;
     }
     case TLValue::UpdateUserName: {
-        TLUser *user = m_users.value(update.userId);
+        SUserRecord *user = m_users.user(update.userId);
         if (user) {
             bool changed = (user->firstName == update.firstName) && (user->lastName == update.lastName);
             if (changed) {
                 user->firstName = update.firstName;
                 user->lastName = update.lastName;
                 user->username = update.username;
+                internUserStrings(user);
                 emit contactProfileChanged(update.userId);
             }
         }
@@ -1739,6 +2204,15 @@ void CTelegramDispatcher::processUpdate(const TLUpdate &update)
     ensureUpdateState(newPts);
 }
 
+void CTelegramDispatcher::processDifferenceMessage(const TLMessage &message)
+{
+    if ((message.tlType != TLValue::MessageService) && (filterReceivedMessage(getPublicMessageFlags(message.flags)))) {
+        return;
+    }
+
+    processMessageReceived(message);
+}
+
 void CTelegramDispatcher::processMessageReceived(const TLMessage &message)
 {
 #ifdef DEVELOPER_BUILD
@@ -1819,7 +2293,7 @@ void CTelegramDispatcher::processMessageReceived(const TLMessage &message)
     }
 
     if (message.media.tlType != TLValue::MessageMediaEmpty) {
-        m_knownMediaMessages.insert(message.id, message);
+        cacheMediaMessage(message);
     }
 
     TelegramNamespace::Message apiMessage;
@@ -1845,13 +2319,106 @@ void CTelegramDispatcher::processMessageReceived(const TLMessage &message)
     apiMessage.timestamp = message.date;
     apiMessage.flags = messageFlags;
 
-    if (!m_users.contains(apiMessage.userId) && !m_askedUserIds.contains(apiMessage.userId)) {
-        m_askedUserIds.append(apiMessage.userId);
+    const qint64 currentTime = QDateTime::currentMSecsSinceEpoch();
+
+    if (apiMessage.chatId) {
+        // The sender of a chat message is not necessarily a contact, so it is resolved with the participants of the chat.
+        const bool isPeerUnknown = !m_chatInfo.contains(apiMessage.chatId) || (apiMessage.userId && !m_users.contains(apiMessage.userId));
+
+        if (isPeerUnknown && !isPeerAsked(m_askedChatIds, apiMessage.chatId, currentTime)) {
+            m_askedChatIds.insert(apiMessage.chatId, currentTime);
+            if (!m_pendingChatIds.contains(apiMessage.chatId)) {
+                m_pendingChatIds.append(apiMessage.chatId);
+            }
+        }
+    } else if (apiMessage.userId && !m_users.contains(apiMessage.userId) && !isPeerAsked(m_askedUserIds, apiMessage.userId, currentTime)) {
+        m_askedUserIds.insert(apiMessage.userId, currentTime);
+        if (!m_pendingUserIds.contains(apiMessage.userId)) {
+            m_pendingUserIds.append(apiMessage.userId);
+        }
+    }
+
+    // A message waits for the earlier delayed messages of its dialog to keep the order.
+    if (isMessagePeerKnown(apiMessage) && !hasDelayedMessages(messagePeerKey(apiMessage))) {
+        emit messageReceived(apiMessage);
+        return;
+    }
+
+    // The message is delivered as soon as its peer is resolved or after the timeout.
+    m_delayedMessages.append(qMakePair(currentTime + s_delayedMessagesTimeout, apiMessage));
+
+    if (!m_delayedMessagesTimer->isActive()) {
+        startDelayedMessagesTimer();
+    }
+
+    if ((!m_pendingUserIds.isEmpty() || !m_pendingChatIds.isEmpty()) && !m_peersResolvingTimer->isActive()) {
+        m_peersResolvingTimer->start();
+    }
+}
+
+void CTelegramDispatcher::cacheMediaMessage(const TLMessage &message, FileRequestDescriptor *dataRequest)
+{
+    SMediaMessageRecord *record = new SMediaMessageRecord();
+    record->setMessage(message);
+
+    // The cache deletes a record, which does not fit into it, so the request is made beforehand.
+    if (dataRequest) {
+        *dataRequest = FileRequestDescriptor::messageMediaDataRequest(record);
+    }
+
+    m_knownMediaMessages.insert(message.id, record, record->cost());
+    m_mediaMessageIds.insert(message.id);
+}
+
+bool CTelegramDispatcher::isMessagePeerKnown(const TelegramNamespace::Message &message) const
+{
+    if (message.userId && !m_users.contains(message.userId)) {
+        return false;
+    }
+
+    if (message.chatId && !m_chatInfo.contains(message.chatId)) {
+        return false;
+    }
+
+    return true;
+}
+
+void CTelegramDispatcher::deliverResolvedMessages()
+{
+    QVector<TelegramNamespace::Message> resolvedMessages;
+    QVector<QPair<qint64, TelegramNamespace::Message> > delayedMessages;
+    QSet<quint64> blockedPeers; // Dialogs with an unresolved message; the later messages of them wait for it
+
+    for (int i = 0; i < m_delayedMessages.count(); ++i) {
+        const TelegramNamespace::Message &message = m_delayedMessages.at(i).second;
+        const quint64 peerKey = messagePeerKey(message);
+
+        if (!blockedPeers.contains(peerKey) && isMessagePeerKnown(message)) {
+            resolvedMessages.append(message);
+        } else {
+            blockedPeers.insert(peerKey);
+            delayedMessages.append(m_delayedMessages.at(i));
+        }
+    }
+
+    m_delayedMessages = delayedMessages;
+    startDelayedMessagesTimer();
+
+    foreach (const TelegramNamespace::Message &message, resolvedMessages) {
+        emit messageReceived(message);
+    }
+}
 
-        activeConnection()->messagesGetDialogs(0, message.id + 1, 1);
+void CTelegramDispatcher::startDelayedMessagesTimer()
+{
+    if (m_delayedMessages.isEmpty()) {
+        m_delayedMessagesTimer->stop();
+        return;
     }
 
-    emit messageReceived(apiMessage);
+    // Wait for the oldest message only.
+    const qint64 remainingTime = m_delayedMessages.first().first - QDateTime::currentMSecsSinceEpoch();
+    m_delayedMessagesTimer->start(int(qMax<qint64>(0, remainingTime)));
 }
 
 void CTelegramDispatcher::emitChatChanged(quint32 id)
@@ -1905,7 +2472,7 @@ TLInputPeer CTelegramDispatcher::publicPeerToInputPeer(const TelegramNamespace::
         return inputPeer;
     }
 
-    const TLUser *user = m_users.value(peer.id);
+    const SUserRecord *user = m_users.user(peer.id);
 
     if (user) {
         if (user->tlType == TLValue::UserContact) {
@@ -1968,7 +2535,7 @@ TLInputUser CTelegramDispatcher::userIdToInputUser(quint32 id) const
         return inputUser;
     }
 
-    const TLUser *user = m_users.value(id);
+    const SUserRecord *user = m_users.user(id);
 
     if (user) {
         if (user->tlType == TLValue::UserContact) {
@@ -1992,9 +2559,9 @@ TLInputUser CTelegramDispatcher::userIdToInputUser(quint32 id) const
     return inputUser;
 }
 
-QString CTelegramDispatcher::userAvatarToken(const TLUser *user) const
+QString CTelegramDispatcher::userAvatarToken(const SUserRecord *user) const
 {
-    const TLFileLocation &avatar = user->photo.photoSmall;
+    const TLFileLocation &avatar = user->photoSmall;
 
     if (avatar.tlType == TLValue::FileLocationUnavailable) {
         return QString();
@@ -2064,12 +2631,17 @@ void CTelegramDispatcher::onConnectionAuthChanged(int newState, quint32 dc)
                     SLOT(whenMessageSentInfoReceived(quint64,TLMessagesSentMessage)));
             connect(connection, SIGNAL(messagesHistoryReceived(TLMessagesMessages,TLInputPeer)),
                     SLOT(whenMessagesHistoryReceived(TLMessagesMessages)));
+            connect(connection, SIGNAL(messagesReceived(TLMessagesMessages)),
+                    SLOT(whenMessagesReceived(TLMessagesMessages)));
+            connect(connection, SIGNAL(messagesNotReceived(QVector<quint32>)),
+                    SLOT(whenMessagesNotReceived(QVector<quint32>)));
             connect(connection, SIGNAL(messagesDialogsReceived(TLMessagesDialogs,quint32,quint32,quint32)),
                     SLOT(onMessagesDialogsReceived(TLMessagesDialogs,quint32,quint32,quint32)));
             connect(connection, SIGNAL(updatesStateReceived(TLUpdatesState)),
                     SLOT(whenUpdatesStateReceived(TLUpdatesState)));
             connect(connection, SIGNAL(updatesDifferenceReceived(TLUpdatesDifference)),
                     SLOT(whenUpdatesDifferenceReceived(TLUpdatesDifference)));
+            connection->setUpdatesDifferenceVisitor(m_updatesDifferenceVisitor);
             connect(connection, SIGNAL(authExportedAuthorizationReceived(quint32,quint32,QByteArray)),
                     SLOT(whenAuthExportedAuthorizationReceived(quint32,quint32,QByteArray)));
             connect(connection, SIGNAL(messagesChatsReceived(QVector<TLChat>)),
@@ -2274,7 +2846,7 @@ void CTelegramDispatcher::whenFileDataReceived(const TLUploadFile &file, quint32
     qDebug() << Q_FUNC_INFO << "File:" << file.tlType << file.type << file.mtime;
 #endif
 
-    QString mimeType = mimeTypeByStorageFileType(file.type.tlType);
+    QString mimeType = m_stringPool.intern(mimeTypeByStorageFileType(file.type.tlType));
 
     FileRequestDescriptor &descriptor = m_requestedFileDescriptors[requestId];
 
@@ -2283,38 +2855,21 @@ void CTelegramDispatcher::whenFileDataReceived(const TLUploadFile &file, quint32
     switch (descriptor.type()) {
     case FileRequestDescriptor::Avatar:
         if (m_users.contains(descriptor.userId())) {
-            emit avatarReceived(descriptor.userId(), file.bytes, mimeType, userAvatarToken(m_users.value(descriptor.userId())));
+            emit avatarReceived(descriptor.userId(), file.bytes, mimeType, userAvatarToken(m_users.user(descriptor.userId())));
         } else {
             qDebug() << Q_FUNC_INFO << "Unknown userId" << descriptor.userId();
         }
         break;
     case FileRequestDescriptor::MessageMediaData:
-        if (m_knownMediaMessages.contains(descriptor.messageId())) {
-            const TLMessage message = m_knownMediaMessages.value(descriptor.messageId());
-            const TelegramNamespace::MessageType messageType = telegramMessageTypeToPublicMessageType(message.media.tlType);
-
-            TelegramNamespace::Peer peer = peerToPublicPeer(message.toId);
-
-            // MimeType can not be resolved for some StorageFileType. Try to get the type from the message info in this case.
-            if (mimeType.isEmpty()) {
-                TelegramNamespace::MessageMediaInfo info;
-                getMessageMediaInfo(&info, message.id);
-                mimeType = info.mimeType();
-            }
-
-            if (!(message.flags & TelegramMessageFlagOut)) {
-                if (peer.type == TelegramNamespace::Peer::User) {
-                    peer = message.fromId;
-                }
-            }
+        // MimeType can not be resolved for some StorageFileType. Use the type from the message info in this case.
+        if (mimeType.isEmpty()) {
+            mimeType = descriptor.mimeType();
+        }
 
 #ifdef DEVELOPER_BUILD
-            qDebug() << Q_FUNC_INFO << "MessageMediaData:" << message.id << offset << "-" << offset + chunkSize << "/" << descriptor.size();
+        qDebug() << Q_FUNC_INFO << "MessageMediaData:" << descriptor.messageId() << offset << "-" << offset + chunkSize << "/" << descriptor.size();
 #endif
-            emit messageMediaDataReceived(peer, message.id, file.bytes, mimeType, messageType, offset, descriptor.size());
-        } else {
-            qDebug() << Q_FUNC_INFO << "Unknown media message data received" << descriptor.messageId();
-        }
+        emit messageMediaDataReceived(descriptor.peer(), descriptor.messageId(), file.bytes, mimeType, descriptor.messageType(), offset, descriptor.size());
 
         if (descriptor.offset() + chunkSize == descriptor.size()) {
 #ifdef DEVELOPER_BUILD
@@ -2331,6 +2886,7 @@ void CTelegramDispatcher::whenFileDataReceived(const TLUploadFile &file, quint32
                 qDebug() << Q_FUNC_INFO << "Invalid call. The method must be called only on CTelegramConnection signal.";
             }
         }
+        break;
     default:
         break;
     }
@@ -2561,6 +3117,10 @@ void CTelegramDispatcher::continueInitialization(CTelegramDispatcher::Initializa
     if (m_initializationState == StepDone) {
         setConnectionState(TelegramNamespace::ConnectionStateReady);
         m_passwordInfo.clear();
+
+        if (m_authKeysPregenerationEnabled) {
+            pregenerateExtraConnections();
+        }
         return;
     }
 
@@ -2652,6 +3212,7 @@ CTelegramConnection *CTelegramDispatcher::createConnection(const TLDcOption &dcI
     CTelegramConnection *connection = new CTelegramConnection(m_appInformation, this);
     connection->setDcInfo(dcInfo);
     connection->setDeltaTime(m_deltaTime);
+    connection->setStringPool(&m_stringPool);
 
     connect(connection, SIGNAL(authStateChanged(int,quint32)), SLOT(onConnectionAuthChanged(int,quint32)));
     connect(connection, SIGNAL(statusChanged(int,int,quint32)), SLOT(onConnectionStatusChanged(int,int,quint32)));
@@ -2703,6 +3264,26 @@ void CTelegramDispatcher::ensureSignedConnection(CTelegramConnection *connection
     }
 }
 
+void CTelegramDispatcher::pregenerateExtraConnections()
+{
+    QVector<quint32> processedDcs;
+    processedDcs.append(activeConnection()->dcInfo().id);
+
+    foreach (const TLDcOption &option, m_dcConfiguration) {
+        if (processedDcs.contains(option.id)) {
+            continue;
+        }
+
+        processedDcs.append(option.id);
+
+        CTelegramConnection *connection = getExtraConnection(option.id);
+
+        if (connection) {
+            ensureSignedConnection(connection);
+        }
+    }
+}
+
 void CTelegramDispatcher::clearMainConnection()
 {
     if (!m_mainConnection) {
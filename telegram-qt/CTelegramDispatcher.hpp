@@ -20,14 +20,21 @@
 
 #include <QObject>
 
+#include <QCache>
+#include <QHash>
+
 #include <QMap>
 #include <QMultiMap>
+#include <QSet>
 #include <QPair>
 #include <QStringList>
 #include <QVector>
 
 #include "TLTypes.hpp"
+#include "TLViews.hpp"
 #include "TelegramNamespace.hpp"
+#include "CTelegramStringPool.hpp"
+#include "CUserDirectory.hpp"
 
 class QTimer;
 class QCryptographicHash;
@@ -35,6 +42,16 @@ class QIODevice;
 
 class CAppInformation;
 class CTelegramConnection;
+class CTelegramStreamVisitor;
+
+/* A media message in the wire form; the members are decoded on request.
+ * Only the downloaded (last) photo size is kept and the thumbnails are dropped. */
+struct SMediaMessageRecord {
+    void setMessage(const TLMessage &message);
+    int cost() const;
+
+    TLMessageView message;
+};
 
 class FileRequestDescriptor
 {
@@ -49,8 +66,8 @@ public:
     FileRequestDescriptor();
 
     static FileRequestDescriptor uploadRequest(const QByteArray &data, const QString &fileName, quint32 dc);
-    static FileRequestDescriptor avatarRequest(const TLUser *user);
-    static FileRequestDescriptor messageMediaDataRequest(const TLMessage &message);
+    static FileRequestDescriptor avatarRequest(const SUserRecord *user);
+    static FileRequestDescriptor messageMediaDataRequest(const SMediaMessageRecord *record);
 
     Type type() const { return m_type; }
 
@@ -64,6 +81,11 @@ public:
     quint32 size() const { return m_size; }
     quint32 offset() const { return m_offset; }
 
+    /* Message media stuff; kept here, because the message can be evicted from the cache during the download */
+    TelegramNamespace::Peer peer() const { return m_peer; }
+    TelegramNamespace::MessageType messageType() const { return m_messageType; }
+    QString mimeType() const { return m_mimeType; }
+
     void setOffset(quint32 newOffset) { m_offset = newOffset; }
 
     /* Upload stuff */
@@ -95,6 +117,10 @@ protected:
     quint64 m_fileId;
     QCryptographicHash *m_hash;
 
+    TelegramNamespace::Peer m_peer;
+    TelegramNamespace::MessageType m_messageType;
+    QString m_mimeType;
+
     TLInputFileLocation m_inputLocation;
     quint32 m_dcId;
 
@@ -148,6 +174,8 @@ public:
     void setAutoReconnection(bool enable);
     void setPingInterval(quint32 ms, quint32 serverDisconnectionAdditionTime);
     void setMediaDataBufferSize(quint32 size);
+    void setMediaMessagesCacheSize(quint32 size);
+    void setAuthKeysPregeneration(bool enable);
 
     bool initConnection(const QVector<TelegramNamespace::DcOption> &dcs);
     bool restoreConnection(const QByteArray &secret);
@@ -253,6 +281,8 @@ protected slots:
 
     void whenMessageSentInfoReceived(quint64 randomId, TLMessagesSentMessage info);
     void whenMessagesHistoryReceived(const TLMessagesMessages &messages);
+    void whenMessagesReceived(const TLMessagesMessages &messages);
+    void whenMessagesNotReceived(const QVector<quint32> &messageIds);
     void onMessagesDialogsReceived(const TLMessagesDialogs &dialogs, quint32 offset, quint32 maxId, quint32 limit);
 
     void getDcConfiguration();
@@ -267,6 +297,9 @@ protected slots:
     void onChatsReceived(const QVector<TLChat> &chats);
     void whenMessagesFullChatReceived(const TLChatFull &chat, const QVector<TLChat> &chats, const QVector<TLUser> &users);
 
+    void resolvePendingPeers();
+    void flushDelayedMessages();
+
 protected:
     void setConnectionState(TelegramNamespace::ConnectionState state);
 
@@ -275,6 +308,16 @@ protected:
     void processUpdate(const TLUpdate &update);
 
     void processMessageReceived(const TLMessage &message);
+    void processDifferenceMessage(const TLMessage &message);
+    void processUser(const TLUser &user);
+    void processChat(const TLChat &chat);
+    void cacheMediaMessage(const TLMessage &message, FileRequestDescriptor *dataRequest = 0);
+    bool hasDelayedMessages(quint64 peerKey) const;
+    bool hasUnknownChatSenders(quint32 chatId) const;
+    static void removeExpiredAskedIds(QHash<quint32, qint64> *askedIds, qint64 currentTime);
+    bool isMessagePeerKnown(const TelegramNamespace::Message &message) const;
+    void deliverResolvedMessages();
+    void startDelayedMessagesTimer();
 
     void emitChatChanged(quint32 id);
     void updateChat(const TLChat &newChat);
@@ -285,6 +328,7 @@ protected:
 
     void getUser(quint32 id);
     void getInitialUsers();
+    void internUserStrings(SUserRecord *user);
 
     bool filterReceivedMessage(quint32 messageFlags) const;
 
@@ -293,13 +337,16 @@ protected:
     TelegramNamespace::Peer peerToPublicPeer(const TLPeer &peer) const;
     TLInputUser userIdToInputUser(quint32 id) const;
 
-    QString userAvatarToken(const TLUser *user) const;
+    QString userAvatarToken(const SUserRecord *user) const;
 
     CTelegramConnection *activeConnection() const { return m_mainConnection; }
     CTelegramConnection *getExtraConnection(quint32 dc);
 
     CTelegramConnection *createConnection(const TLDcOption &dcInfo);
     void ensureSignedConnection(CTelegramConnection *connection);
+
+    friend class CUpdatesDifferenceVisitor;
+    void pregenerateExtraConnections();
     void clearMainConnection();
     void clearExtraConnections();
     void ensureMainConnectToWantedDc();
@@ -365,6 +412,7 @@ protected:
     quint32 m_pingInterval;
     quint32 m_pingServerAdditionDisconnectionTime;
     quint32 m_mediaDataBufferSize;
+    bool m_authKeysPregenerationEnabled;
 
     quint32 m_initializationState; // InitializationStep flags
     quint32 m_requestedSteps; // InitializationStep flags
@@ -386,10 +434,20 @@ protected:
 
     QMap<quint32, QPair<quint32,QByteArray> > m_exportedAuthentications; // dc, <id, auth data>
     QMap<quint32, QByteArray> m_delayedPackages; // dc, package data
-    QMap<quint32, TLUser*> m_users;
-    QVector<quint32> m_askedUserIds;
-
-    QMap<quint32, TLMessage> m_knownMediaMessages; // message id, message
+    CUserDirectory m_users;
+    CTelegramStringPool m_stringPool; // Shared by the connections and the users
+    QHash<quint32, qint64> m_askedUserIds; // Pending or requested users; id, time of the request
+    QHash<quint32, qint64> m_askedChatIds; // Pending or requested chats; id, time of the request
+    TLVector<quint32> m_pendingUserIds; // Unknown users of the private messages to be requested with the next batch
+    TLVector<quint32> m_pendingChatIds; // Chats with the unknown senders or unknown themselves to be requested with the next batch
+    QTimer *m_peersResolvingTimer;
+    QVector<QPair<qint64, TelegramNamespace::Message> > m_delayedMessages; // Delivery deadline, message from the unknown peers
+    QTimer *m_delayedMessagesTimer;
+    CTelegramStreamVisitor *m_updatesDifferenceVisitor; // Consumes the difference items while it is decoded
+
+    mutable QCache<quint32, SMediaMessageRecord> m_knownMediaMessages; // message id, media message; the cost is the size in bytes
+    QSet<quint32> m_mediaMessageIds; // All the cached media messages, including the evicted ones
+    QSet<quint32> m_requestedMediaMessageIds; // Evicted media messages, which are requested to download the media
 
     quint32 m_selfUserId;
 
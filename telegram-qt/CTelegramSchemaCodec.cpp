@@ -0,0 +1,1872 @@
+/*
+   Copyright (C) 2014-2015 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include "CTelegramSchemaCodec.hpp"
+
+namespace {
+
+enum SchemaKind {
+    KindBool,
+    KindUInt32,
+    KindUInt64,
+    KindDouble,
+    KindString,
+    KindBytes,
+    KindObject,
+    KindVector
+};
+
+/* The types are not standard-layout (TLVector adds a member to QVector), so offsetof() can not be used for them.
+ * The members are accessed by the tiny functions, instantiated for the pointers to members instead. */
+struct SchemaMember {
+    void *(*value)(void *object);
+    quint8 kind;
+    qint8 flagBit; // -1 for a mandatory member
+    quint16 flagMember; // Index of the flags member
+    quint16 type; // Index of the object type or of the vector type
+};
+
+struct SchemaConstructor {
+    quint32 id;
+    quint16 firstMember;
+    quint16 membersCount;
+};
+
+struct SchemaType {
+    quint16 firstConstructor;
+    quint16 constructorsCount;
+    TLValue *(*tlType)(void *value);
+    void (*reset)(void *value);
+};
+
+struct SchemaVectorType {
+    quint8 elementKind;
+    quint16 elementType;
+    quint16 elementSize;
+    TLValue *(*tlType)(void *vector);
+    void *(*resize)(void *vector, int size);
+    const void *(*data)(const void *vector, int *size);
+};
+
+template <typename T, typename M, M T::*member>
+void *memberValue(void *object)
+{
+    return &(static_cast<T *>(object)->*member);
+}
+
+template <typename T>
+TLValue *typeValue(void *value)
+{
+    return &static_cast<T *>(value)->tlType;
+}
+
+template <typename T>
+void resetValue(void *value)
+{
+    *static_cast<T *>(value) = T();
+}
+
+template <typename T>
+void *resizeVector(void *vector, int size)
+{
+    TLVector<T> *v = static_cast<TLVector<T> *>(vector);
+    v->resize(size);
+    return v->data();
+}
+
+template <typename T>
+const void *vectorData(const void *vector, int *size)
+{
+    const TLVector<T> *v = static_cast<const TLVector<T> *>(vector);
+    *size = v->count();
+    return v->constData();
+}
+
+// Generated schema tables
+static const SchemaMember s_schemaMembers[] = {
+    // TLAccountDaysTTL
+    { &memberValue<TLAccountDaysTTL, quint32, &TLAccountDaysTTL::days>, KindUInt32, -1, 0, 0 },
+    // TLAccountPassword
+    { &memberValue<TLAccountPassword, QByteArray, &TLAccountPassword::newSalt>, KindBytes, -1, 0, 0 },
+    { &memberValue<TLAccountPassword, QString, &TLAccountPassword::emailUnconfirmedPattern>, KindString, -1, 0, 0 },
+    { &memberValue<TLAccountPassword, QByteArray, &TLAccountPassword::currentSalt>, KindBytes, -1, 0, 0 },
+    { &memberValue<TLAccountPassword, QByteArray, &TLAccountPassword::newSalt>, KindBytes, -1, 0, 0 },
+    { &memberValue<TLAccountPassword, QString, &TLAccountPassword::hint>, KindString, -1, 0, 0 },
+    { &memberValue<TLAccountPassword, bool, &TLAccountPassword::hasRecovery>, KindBool, -1, 0, 0 },
+    { &memberValue<TLAccountPassword, QString, &TLAccountPassword::emailUnconfirmedPattern>, KindString, -1, 0, 0 },
+    // TLAccountPasswordInputSettings
+    { &memberValue<TLAccountPasswordInputSettings, quint32, &TLAccountPasswordInputSettings::flags>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLAccountPasswordInputSettings, QByteArray, &TLAccountPasswordInputSettings::newSalt>, KindBytes, 0, 8, 0 },
+    { &memberValue<TLAccountPasswordInputSettings, QByteArray, &TLAccountPasswordInputSettings::newPasswordHash>, KindBytes, 0, 8, 0 },
+    { &memberValue<TLAccountPasswordInputSettings, QString, &TLAccountPasswordInputSettings::hint>, KindString, 0, 8, 0 },
+    { &memberValue<TLAccountPasswordInputSettings, QString, &TLAccountPasswordInputSettings::email>, KindString, 1, 8, 0 },
+    // TLAccountPasswordSettings
+    { &memberValue<TLAccountPasswordSettings, QString, &TLAccountPasswordSettings::email>, KindString, -1, 0, 0 },
+    // TLAccountSentChangePhoneCode
+    { &memberValue<TLAccountSentChangePhoneCode, QString, &TLAccountSentChangePhoneCode::phoneCodeHash>, KindString, -1, 0, 0 },
+    { &memberValue<TLAccountSentChangePhoneCode, quint32, &TLAccountSentChangePhoneCode::sendCallTimeout>, KindUInt32, -1, 0, 0 },
+    // TLAudio
+    { &memberValue<TLAudio, quint64, &TLAudio::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLAudio, quint64, &TLAudio::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLAudio, quint64, &TLAudio::accessHash>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLAudio, quint32, &TLAudio::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLAudio, quint32, &TLAudio::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLAudio, quint32, &TLAudio::duration>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLAudio, QString, &TLAudio::mimeType>, KindString, -1, 0, 0 },
+    { &memberValue<TLAudio, quint32, &TLAudio::size>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLAudio, quint32, &TLAudio::dcId>, KindUInt32, -1, 0, 0 },
+    // TLAuthCheckedPhone
+    { &memberValue<TLAuthCheckedPhone, bool, &TLAuthCheckedPhone::phoneRegistered>, KindBool, -1, 0, 0 },
+    // TLAuthExportedAuthorization
+    { &memberValue<TLAuthExportedAuthorization, quint32, &TLAuthExportedAuthorization::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLAuthExportedAuthorization, QByteArray, &TLAuthExportedAuthorization::bytes>, KindBytes, -1, 0, 0 },
+    // TLAuthPasswordRecovery
+    { &memberValue<TLAuthPasswordRecovery, QString, &TLAuthPasswordRecovery::emailPattern>, KindString, -1, 0, 0 },
+    // TLAuthSentCode
+    { &memberValue<TLAuthSentCode, bool, &TLAuthSentCode::phoneRegistered>, KindBool, -1, 0, 0 },
+    { &memberValue<TLAuthSentCode, QString, &TLAuthSentCode::phoneCodeHash>, KindString, -1, 0, 0 },
+    { &memberValue<TLAuthSentCode, quint32, &TLAuthSentCode::sendCallTimeout>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLAuthSentCode, bool, &TLAuthSentCode::isPassword>, KindBool, -1, 0, 0 },
+    { &memberValue<TLAuthSentCode, bool, &TLAuthSentCode::phoneRegistered>, KindBool, -1, 0, 0 },
+    { &memberValue<TLAuthSentCode, QString, &TLAuthSentCode::phoneCodeHash>, KindString, -1, 0, 0 },
+    { &memberValue<TLAuthSentCode, quint32, &TLAuthSentCode::sendCallTimeout>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLAuthSentCode, bool, &TLAuthSentCode::isPassword>, KindBool, -1, 0, 0 },
+    // TLAuthorization
+    { &memberValue<TLAuthorization, quint64, &TLAuthorization::hash>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLAuthorization, quint32, &TLAuthorization::flags>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLAuthorization, QString, &TLAuthorization::deviceModel>, KindString, -1, 0, 0 },
+    { &memberValue<TLAuthorization, QString, &TLAuthorization::platform>, KindString, -1, 0, 0 },
+    { &memberValue<TLAuthorization, QString, &TLAuthorization::systemVersion>, KindString, -1, 0, 0 },
+    { &memberValue<TLAuthorization, quint32, &TLAuthorization::apiId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLAuthorization, QString, &TLAuthorization::appName>, KindString, -1, 0, 0 },
+    { &memberValue<TLAuthorization, QString, &TLAuthorization::appVersion>, KindString, -1, 0, 0 },
+    { &memberValue<TLAuthorization, quint32, &TLAuthorization::dateCreated>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLAuthorization, quint32, &TLAuthorization::dateActive>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLAuthorization, QString, &TLAuthorization::ip>, KindString, -1, 0, 0 },
+    { &memberValue<TLAuthorization, QString, &TLAuthorization::country>, KindString, -1, 0, 0 },
+    { &memberValue<TLAuthorization, QString, &TLAuthorization::region>, KindString, -1, 0, 0 },
+    // TLChatLocated
+    { &memberValue<TLChatLocated, quint32, &TLChatLocated::chatId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLChatLocated, quint32, &TLChatLocated::distance>, KindUInt32, -1, 0, 0 },
+    // TLChatParticipant
+    { &memberValue<TLChatParticipant, quint32, &TLChatParticipant::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLChatParticipant, quint32, &TLChatParticipant::inviterId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLChatParticipant, quint32, &TLChatParticipant::date>, KindUInt32, -1, 0, 0 },
+    // TLChatParticipants
+    { &memberValue<TLChatParticipants, quint32, &TLChatParticipants::chatId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLChatParticipants, quint32, &TLChatParticipants::chatId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLChatParticipants, quint32, &TLChatParticipants::adminId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLChatParticipants, TLVector<TLChatParticipant>, &TLChatParticipants::participants>, KindVector, -1, 0, 0 },
+    { &memberValue<TLChatParticipants, quint32, &TLChatParticipants::version>, KindUInt32, -1, 0, 0 },
+    // TLContact
+    { &memberValue<TLContact, quint32, &TLContact::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLContact, bool, &TLContact::mutual>, KindBool, -1, 0, 0 },
+    // TLContactBlocked
+    { &memberValue<TLContactBlocked, quint32, &TLContactBlocked::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLContactBlocked, quint32, &TLContactBlocked::date>, KindUInt32, -1, 0, 0 },
+    // TLContactFound
+    { &memberValue<TLContactFound, quint32, &TLContactFound::userId>, KindUInt32, -1, 0, 0 },
+    // TLContactLink
+    // TLContactSuggested
+    { &memberValue<TLContactSuggested, quint32, &TLContactSuggested::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLContactSuggested, quint32, &TLContactSuggested::mutualContacts>, KindUInt32, -1, 0, 0 },
+    // TLDcOption
+    { &memberValue<TLDcOption, quint32, &TLDcOption::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLDcOption, QString, &TLDcOption::hostname>, KindString, -1, 0, 0 },
+    { &memberValue<TLDcOption, QString, &TLDcOption::ipAddress>, KindString, -1, 0, 0 },
+    { &memberValue<TLDcOption, quint32, &TLDcOption::port>, KindUInt32, -1, 0, 0 },
+    // TLDisabledFeature
+    { &memberValue<TLDisabledFeature, QString, &TLDisabledFeature::feature>, KindString, -1, 0, 0 },
+    { &memberValue<TLDisabledFeature, QString, &TLDisabledFeature::description>, KindString, -1, 0, 0 },
+    // TLEncryptedChat
+    { &memberValue<TLEncryptedChat, quint32, &TLEncryptedChat::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLEncryptedChat, quint32, &TLEncryptedChat::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLEncryptedChat, quint64, &TLEncryptedChat::accessHash>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLEncryptedChat, quint32, &TLEncryptedChat::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLEncryptedChat, quint32, &TLEncryptedChat::adminId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLEncryptedChat, quint32, &TLEncryptedChat::participantId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLEncryptedChat, quint32, &TLEncryptedChat::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLEncryptedChat, quint64, &TLEncryptedChat::accessHash>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLEncryptedChat, quint32, &TLEncryptedChat::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLEncryptedChat, quint32, &TLEncryptedChat::adminId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLEncryptedChat, quint32, &TLEncryptedChat::participantId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLEncryptedChat, QByteArray, &TLEncryptedChat::gA>, KindBytes, -1, 0, 0 },
+    { &memberValue<TLEncryptedChat, quint32, &TLEncryptedChat::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLEncryptedChat, quint64, &TLEncryptedChat::accessHash>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLEncryptedChat, quint32, &TLEncryptedChat::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLEncryptedChat, quint32, &TLEncryptedChat::adminId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLEncryptedChat, quint32, &TLEncryptedChat::participantId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLEncryptedChat, QByteArray, &TLEncryptedChat::gAOrB>, KindBytes, -1, 0, 0 },
+    { &memberValue<TLEncryptedChat, quint64, &TLEncryptedChat::keyFingerprint>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLEncryptedChat, quint32, &TLEncryptedChat::id>, KindUInt32, -1, 0, 0 },
+    // TLEncryptedFile
+    { &memberValue<TLEncryptedFile, quint64, &TLEncryptedFile::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLEncryptedFile, quint64, &TLEncryptedFile::accessHash>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLEncryptedFile, quint32, &TLEncryptedFile::size>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLEncryptedFile, quint32, &TLEncryptedFile::dcId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLEncryptedFile, quint32, &TLEncryptedFile::keyFingerprint>, KindUInt32, -1, 0, 0 },
+    // TLEncryptedMessage
+    { &memberValue<TLEncryptedMessage, quint64, &TLEncryptedMessage::randomId>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLEncryptedMessage, quint32, &TLEncryptedMessage::chatId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLEncryptedMessage, quint32, &TLEncryptedMessage::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLEncryptedMessage, QByteArray, &TLEncryptedMessage::bytes>, KindBytes, -1, 0, 0 },
+    { &memberValue<TLEncryptedMessage, TLEncryptedFile, &TLEncryptedMessage::file>, KindObject, -1, 0, 22 },
+    { &memberValue<TLEncryptedMessage, quint64, &TLEncryptedMessage::randomId>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLEncryptedMessage, quint32, &TLEncryptedMessage::chatId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLEncryptedMessage, quint32, &TLEncryptedMessage::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLEncryptedMessage, QByteArray, &TLEncryptedMessage::bytes>, KindBytes, -1, 0, 0 },
+    // TLError
+    { &memberValue<TLError, quint32, &TLError::code>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLError, QString, &TLError::text>, KindString, -1, 0, 0 },
+    // TLExportedChatInvite
+    { &memberValue<TLExportedChatInvite, QString, &TLExportedChatInvite::link>, KindString, -1, 0, 0 },
+    // TLFileLocation
+    { &memberValue<TLFileLocation, quint64, &TLFileLocation::volumeId>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLFileLocation, quint32, &TLFileLocation::localId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLFileLocation, quint64, &TLFileLocation::secret>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLFileLocation, quint32, &TLFileLocation::dcId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLFileLocation, quint64, &TLFileLocation::volumeId>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLFileLocation, quint32, &TLFileLocation::localId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLFileLocation, quint64, &TLFileLocation::secret>, KindUInt64, -1, 0, 0 },
+    // TLGeoPoint
+    { &memberValue<TLGeoPoint, double, &TLGeoPoint::longitude>, KindDouble, -1, 0, 0 },
+    { &memberValue<TLGeoPoint, double, &TLGeoPoint::latitude>, KindDouble, -1, 0, 0 },
+    // TLHelpAppUpdate
+    { &memberValue<TLHelpAppUpdate, quint32, &TLHelpAppUpdate::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLHelpAppUpdate, bool, &TLHelpAppUpdate::critical>, KindBool, -1, 0, 0 },
+    { &memberValue<TLHelpAppUpdate, QString, &TLHelpAppUpdate::url>, KindString, -1, 0, 0 },
+    { &memberValue<TLHelpAppUpdate, QString, &TLHelpAppUpdate::text>, KindString, -1, 0, 0 },
+    // TLHelpInviteText
+    { &memberValue<TLHelpInviteText, QString, &TLHelpInviteText::message>, KindString, -1, 0, 0 },
+    // TLImportedContact
+    { &memberValue<TLImportedContact, quint32, &TLImportedContact::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLImportedContact, quint64, &TLImportedContact::clientId>, KindUInt64, -1, 0, 0 },
+    // TLInputAppEvent
+    { &memberValue<TLInputAppEvent, double, &TLInputAppEvent::time>, KindDouble, -1, 0, 0 },
+    { &memberValue<TLInputAppEvent, QString, &TLInputAppEvent::type>, KindString, -1, 0, 0 },
+    { &memberValue<TLInputAppEvent, quint64, &TLInputAppEvent::peer>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputAppEvent, QString, &TLInputAppEvent::data>, KindString, -1, 0, 0 },
+    // TLInputAudio
+    { &memberValue<TLInputAudio, quint64, &TLInputAudio::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputAudio, quint64, &TLInputAudio::accessHash>, KindUInt64, -1, 0, 0 },
+    // TLInputContact
+    { &memberValue<TLInputContact, quint64, &TLInputContact::clientId>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputContact, QString, &TLInputContact::phone>, KindString, -1, 0, 0 },
+    { &memberValue<TLInputContact, QString, &TLInputContact::firstName>, KindString, -1, 0, 0 },
+    { &memberValue<TLInputContact, QString, &TLInputContact::lastName>, KindString, -1, 0, 0 },
+    // TLInputDocument
+    { &memberValue<TLInputDocument, quint64, &TLInputDocument::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputDocument, quint64, &TLInputDocument::accessHash>, KindUInt64, -1, 0, 0 },
+    // TLInputEncryptedChat
+    { &memberValue<TLInputEncryptedChat, quint32, &TLInputEncryptedChat::chatId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLInputEncryptedChat, quint64, &TLInputEncryptedChat::accessHash>, KindUInt64, -1, 0, 0 },
+    // TLInputEncryptedFile
+    { &memberValue<TLInputEncryptedFile, quint64, &TLInputEncryptedFile::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputEncryptedFile, quint32, &TLInputEncryptedFile::parts>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLInputEncryptedFile, QString, &TLInputEncryptedFile::md5Checksum>, KindString, -1, 0, 0 },
+    { &memberValue<TLInputEncryptedFile, quint32, &TLInputEncryptedFile::keyFingerprint>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLInputEncryptedFile, quint64, &TLInputEncryptedFile::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputEncryptedFile, quint64, &TLInputEncryptedFile::accessHash>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputEncryptedFile, quint64, &TLInputEncryptedFile::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputEncryptedFile, quint32, &TLInputEncryptedFile::parts>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLInputEncryptedFile, quint32, &TLInputEncryptedFile::keyFingerprint>, KindUInt32, -1, 0, 0 },
+    // TLInputFile
+    { &memberValue<TLInputFile, quint64, &TLInputFile::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputFile, quint32, &TLInputFile::parts>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLInputFile, QString, &TLInputFile::name>, KindString, -1, 0, 0 },
+    { &memberValue<TLInputFile, QString, &TLInputFile::md5Checksum>, KindString, -1, 0, 0 },
+    { &memberValue<TLInputFile, quint64, &TLInputFile::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputFile, quint32, &TLInputFile::parts>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLInputFile, QString, &TLInputFile::name>, KindString, -1, 0, 0 },
+    // TLInputFileLocation
+    { &memberValue<TLInputFileLocation, quint64, &TLInputFileLocation::volumeId>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputFileLocation, quint32, &TLInputFileLocation::localId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLInputFileLocation, quint64, &TLInputFileLocation::secret>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputFileLocation, quint64, &TLInputFileLocation::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputFileLocation, quint64, &TLInputFileLocation::accessHash>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputFileLocation, quint64, &TLInputFileLocation::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputFileLocation, quint64, &TLInputFileLocation::accessHash>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputFileLocation, quint64, &TLInputFileLocation::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputFileLocation, quint64, &TLInputFileLocation::accessHash>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputFileLocation, quint64, &TLInputFileLocation::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputFileLocation, quint64, &TLInputFileLocation::accessHash>, KindUInt64, -1, 0, 0 },
+    // TLInputGeoChat
+    { &memberValue<TLInputGeoChat, quint32, &TLInputGeoChat::chatId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLInputGeoChat, quint64, &TLInputGeoChat::accessHash>, KindUInt64, -1, 0, 0 },
+    // TLInputGeoPoint
+    { &memberValue<TLInputGeoPoint, double, &TLInputGeoPoint::latitude>, KindDouble, -1, 0, 0 },
+    { &memberValue<TLInputGeoPoint, double, &TLInputGeoPoint::longitude>, KindDouble, -1, 0, 0 },
+    // TLInputPeer
+    { &memberValue<TLInputPeer, quint32, &TLInputPeer::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLInputPeer, quint32, &TLInputPeer::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLInputPeer, quint64, &TLInputPeer::accessHash>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputPeer, quint32, &TLInputPeer::chatId>, KindUInt32, -1, 0, 0 },
+    // TLInputPeerNotifyEvents
+    // TLInputPeerNotifySettings
+    { &memberValue<TLInputPeerNotifySettings, quint32, &TLInputPeerNotifySettings::muteUntil>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLInputPeerNotifySettings, QString, &TLInputPeerNotifySettings::sound>, KindString, -1, 0, 0 },
+    { &memberValue<TLInputPeerNotifySettings, bool, &TLInputPeerNotifySettings::showPreviews>, KindBool, -1, 0, 0 },
+    { &memberValue<TLInputPeerNotifySettings, quint32, &TLInputPeerNotifySettings::eventsMask>, KindUInt32, -1, 0, 0 },
+    // TLInputPhoto
+    { &memberValue<TLInputPhoto, quint64, &TLInputPhoto::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputPhoto, quint64, &TLInputPhoto::accessHash>, KindUInt64, -1, 0, 0 },
+    // TLInputPhotoCrop
+    { &memberValue<TLInputPhotoCrop, double, &TLInputPhotoCrop::cropLeft>, KindDouble, -1, 0, 0 },
+    { &memberValue<TLInputPhotoCrop, double, &TLInputPhotoCrop::cropTop>, KindDouble, -1, 0, 0 },
+    { &memberValue<TLInputPhotoCrop, double, &TLInputPhotoCrop::cropWidth>, KindDouble, -1, 0, 0 },
+    // TLInputPrivacyKey
+    // TLInputStickerSet
+    { &memberValue<TLInputStickerSet, quint64, &TLInputStickerSet::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputStickerSet, quint64, &TLInputStickerSet::accessHash>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputStickerSet, QString, &TLInputStickerSet::shortName>, KindString, -1, 0, 0 },
+    // TLInputUser
+    { &memberValue<TLInputUser, quint32, &TLInputUser::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLInputUser, quint32, &TLInputUser::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLInputUser, quint64, &TLInputUser::accessHash>, KindUInt64, -1, 0, 0 },
+    // TLInputVideo
+    { &memberValue<TLInputVideo, quint64, &TLInputVideo::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLInputVideo, quint64, &TLInputVideo::accessHash>, KindUInt64, -1, 0, 0 },
+    // TLMessagesAffectedHistory
+    { &memberValue<TLMessagesAffectedHistory, quint32, &TLMessagesAffectedHistory::pts>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessagesAffectedHistory, quint32, &TLMessagesAffectedHistory::ptsCount>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessagesAffectedHistory, quint32, &TLMessagesAffectedHistory::offset>, KindUInt32, -1, 0, 0 },
+    // TLMessagesAffectedMessages
+    { &memberValue<TLMessagesAffectedMessages, quint32, &TLMessagesAffectedMessages::pts>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessagesAffectedMessages, quint32, &TLMessagesAffectedMessages::ptsCount>, KindUInt32, -1, 0, 0 },
+    // TLMessagesDhConfig
+    { &memberValue<TLMessagesDhConfig, QByteArray, &TLMessagesDhConfig::random>, KindBytes, -1, 0, 0 },
+    { &memberValue<TLMessagesDhConfig, quint32, &TLMessagesDhConfig::g>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessagesDhConfig, QByteArray, &TLMessagesDhConfig::p>, KindBytes, -1, 0, 0 },
+    { &memberValue<TLMessagesDhConfig, quint32, &TLMessagesDhConfig::version>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessagesDhConfig, QByteArray, &TLMessagesDhConfig::random>, KindBytes, -1, 0, 0 },
+    // TLMessagesFilter
+    // TLMessagesSentEncryptedMessage
+    { &memberValue<TLMessagesSentEncryptedMessage, quint32, &TLMessagesSentEncryptedMessage::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessagesSentEncryptedMessage, quint32, &TLMessagesSentEncryptedMessage::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessagesSentEncryptedMessage, TLEncryptedFile, &TLMessagesSentEncryptedMessage::file>, KindObject, -1, 0, 22 },
+    // TLNearestDc
+    { &memberValue<TLNearestDc, QString, &TLNearestDc::country>, KindString, -1, 0, 0 },
+    { &memberValue<TLNearestDc, quint32, &TLNearestDc::thisDc>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLNearestDc, quint32, &TLNearestDc::nearestDc>, KindUInt32, -1, 0, 0 },
+    // TLPeer
+    { &memberValue<TLPeer, quint32, &TLPeer::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLPeer, quint32, &TLPeer::chatId>, KindUInt32, -1, 0, 0 },
+    // TLPeerNotifyEvents
+    // TLPeerNotifySettings
+    { &memberValue<TLPeerNotifySettings, quint32, &TLPeerNotifySettings::muteUntil>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLPeerNotifySettings, QString, &TLPeerNotifySettings::sound>, KindString, -1, 0, 0 },
+    { &memberValue<TLPeerNotifySettings, bool, &TLPeerNotifySettings::showPreviews>, KindBool, -1, 0, 0 },
+    { &memberValue<TLPeerNotifySettings, quint32, &TLPeerNotifySettings::eventsMask>, KindUInt32, -1, 0, 0 },
+    // TLPhotoSize
+    { &memberValue<TLPhotoSize, QString, &TLPhotoSize::type>, KindString, -1, 0, 0 },
+    { &memberValue<TLPhotoSize, QString, &TLPhotoSize::type>, KindString, -1, 0, 0 },
+    { &memberValue<TLPhotoSize, TLFileLocation, &TLPhotoSize::location>, KindObject, -1, 0, 26 },
+    { &memberValue<TLPhotoSize, quint32, &TLPhotoSize::w>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLPhotoSize, quint32, &TLPhotoSize::h>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLPhotoSize, quint32, &TLPhotoSize::size>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLPhotoSize, QString, &TLPhotoSize::type>, KindString, -1, 0, 0 },
+    { &memberValue<TLPhotoSize, TLFileLocation, &TLPhotoSize::location>, KindObject, -1, 0, 26 },
+    { &memberValue<TLPhotoSize, quint32, &TLPhotoSize::w>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLPhotoSize, quint32, &TLPhotoSize::h>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLPhotoSize, QByteArray, &TLPhotoSize::bytes>, KindBytes, -1, 0, 0 },
+    // TLPrivacyKey
+    // TLPrivacyRule
+    { &memberValue<TLPrivacyRule, TLVector<quint32>, &TLPrivacyRule::users>, KindVector, -1, 0, 1 },
+    { &memberValue<TLPrivacyRule, TLVector<quint32>, &TLPrivacyRule::users>, KindVector, -1, 0, 1 },
+    // TLReceivedNotifyMessage
+    { &memberValue<TLReceivedNotifyMessage, quint32, &TLReceivedNotifyMessage::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLReceivedNotifyMessage, quint32, &TLReceivedNotifyMessage::flags>, KindUInt32, -1, 0, 0 },
+    // TLSendMessageAction
+    { &memberValue<TLSendMessageAction, quint32, &TLSendMessageAction::progress>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLSendMessageAction, quint32, &TLSendMessageAction::progress>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLSendMessageAction, quint32, &TLSendMessageAction::progress>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLSendMessageAction, quint32, &TLSendMessageAction::progress>, KindUInt32, -1, 0, 0 },
+    // TLStickerPack
+    { &memberValue<TLStickerPack, QString, &TLStickerPack::emoticon>, KindString, -1, 0, 0 },
+    { &memberValue<TLStickerPack, TLVector<quint64>, &TLStickerPack::documents>, KindVector, -1, 0, 2 },
+    // TLStickerSet
+    { &memberValue<TLStickerSet, quint64, &TLStickerSet::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLStickerSet, quint64, &TLStickerSet::accessHash>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLStickerSet, QString, &TLStickerSet::title>, KindString, -1, 0, 0 },
+    { &memberValue<TLStickerSet, QString, &TLStickerSet::shortName>, KindString, -1, 0, 0 },
+    // TLStorageFileType
+    // TLUpdatesState
+    { &memberValue<TLUpdatesState, quint32, &TLUpdatesState::pts>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdatesState, quint32, &TLUpdatesState::qts>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdatesState, quint32, &TLUpdatesState::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdatesState, quint32, &TLUpdatesState::seq>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdatesState, quint32, &TLUpdatesState::unreadCount>, KindUInt32, -1, 0, 0 },
+    // TLUploadFile
+    { &memberValue<TLUploadFile, TLStorageFileType, &TLUploadFile::type>, KindObject, -1, 0, 66 },
+    { &memberValue<TLUploadFile, quint32, &TLUploadFile::mtime>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUploadFile, QByteArray, &TLUploadFile::bytes>, KindBytes, -1, 0, 0 },
+    // TLUserProfilePhoto
+    { &memberValue<TLUserProfilePhoto, quint64, &TLUserProfilePhoto::photoId>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLUserProfilePhoto, TLFileLocation, &TLUserProfilePhoto::photoSmall>, KindObject, -1, 0, 26 },
+    { &memberValue<TLUserProfilePhoto, TLFileLocation, &TLUserProfilePhoto::photoBig>, KindObject, -1, 0, 26 },
+    // TLUserStatus
+    { &memberValue<TLUserStatus, quint32, &TLUserStatus::expires>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUserStatus, quint32, &TLUserStatus::wasOnline>, KindUInt32, -1, 0, 0 },
+    // TLVideo
+    { &memberValue<TLVideo, quint64, &TLVideo::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLVideo, quint64, &TLVideo::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLVideo, quint64, &TLVideo::accessHash>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLVideo, quint32, &TLVideo::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLVideo, quint32, &TLVideo::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLVideo, quint32, &TLVideo::duration>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLVideo, quint32, &TLVideo::size>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLVideo, TLPhotoSize, &TLVideo::thumb>, KindObject, -1, 0, 59 },
+    { &memberValue<TLVideo, quint32, &TLVideo::dcId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLVideo, quint32, &TLVideo::w>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLVideo, quint32, &TLVideo::h>, KindUInt32, -1, 0, 0 },
+    // TLWallPaper
+    { &memberValue<TLWallPaper, quint32, &TLWallPaper::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLWallPaper, QString, &TLWallPaper::title>, KindString, -1, 0, 0 },
+    { &memberValue<TLWallPaper, TLVector<TLPhotoSize>, &TLWallPaper::sizes>, KindVector, -1, 0, 3 },
+    { &memberValue<TLWallPaper, quint32, &TLWallPaper::color>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLWallPaper, quint32, &TLWallPaper::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLWallPaper, QString, &TLWallPaper::title>, KindString, -1, 0, 0 },
+    { &memberValue<TLWallPaper, quint32, &TLWallPaper::bgColor>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLWallPaper, quint32, &TLWallPaper::color>, KindUInt32, -1, 0, 0 },
+    // TLAccountAuthorizations
+    { &memberValue<TLAccountAuthorizations, TLVector<TLAuthorization>, &TLAccountAuthorizations::authorizations>, KindVector, -1, 0, 4 },
+    // TLChatPhoto
+    { &memberValue<TLChatPhoto, TLFileLocation, &TLChatPhoto::photoSmall>, KindObject, -1, 0, 26 },
+    { &memberValue<TLChatPhoto, TLFileLocation, &TLChatPhoto::photoBig>, KindObject, -1, 0, 26 },
+    // TLConfig
+    { &memberValue<TLConfig, quint32, &TLConfig::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLConfig, quint32, &TLConfig::expires>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLConfig, bool, &TLConfig::testMode>, KindBool, -1, 0, 0 },
+    { &memberValue<TLConfig, quint32, &TLConfig::thisDc>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLConfig, TLVector<TLDcOption>, &TLConfig::dcOptions>, KindVector, -1, 0, 5 },
+    { &memberValue<TLConfig, quint32, &TLConfig::chatSizeMax>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLConfig, quint32, &TLConfig::broadcastSizeMax>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLConfig, quint32, &TLConfig::forwardedCountMax>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLConfig, quint32, &TLConfig::onlineUpdatePeriodMs>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLConfig, quint32, &TLConfig::offlineBlurTimeoutMs>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLConfig, quint32, &TLConfig::offlineIdleTimeoutMs>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLConfig, quint32, &TLConfig::onlineCloudTimeoutMs>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLConfig, quint32, &TLConfig::notifyCloudDelayMs>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLConfig, quint32, &TLConfig::notifyDefaultDelayMs>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLConfig, quint32, &TLConfig::chatBigSize>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLConfig, quint32, &TLConfig::pushChatPeriodMs>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLConfig, quint32, &TLConfig::pushChatLimit>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLConfig, TLVector<TLDisabledFeature>, &TLConfig::disabledFeatures>, KindVector, -1, 0, 6 },
+    // TLContactStatus
+    { &memberValue<TLContactStatus, quint32, &TLContactStatus::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLContactStatus, TLUserStatus, &TLContactStatus::status>, KindObject, -1, 0, 70 },
+    // TLDialog
+    { &memberValue<TLDialog, TLPeer, &TLDialog::peer>, KindObject, -1, 0, 56 },
+    { &memberValue<TLDialog, quint32, &TLDialog::topMessage>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLDialog, quint32, &TLDialog::readInboxMaxId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLDialog, quint32, &TLDialog::unreadCount>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLDialog, TLPeerNotifySettings, &TLDialog::notifySettings>, KindObject, -1, 0, 58 },
+    // TLDocumentAttribute
+    { &memberValue<TLDocumentAttribute, quint32, &TLDocumentAttribute::w>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLDocumentAttribute, quint32, &TLDocumentAttribute::h>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLDocumentAttribute, QString, &TLDocumentAttribute::alt>, KindString, -1, 0, 0 },
+    { &memberValue<TLDocumentAttribute, TLInputStickerSet, &TLDocumentAttribute::stickerset>, KindObject, -1, 0, 47 },
+    { &memberValue<TLDocumentAttribute, quint32, &TLDocumentAttribute::duration>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLDocumentAttribute, quint32, &TLDocumentAttribute::w>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLDocumentAttribute, quint32, &TLDocumentAttribute::h>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLDocumentAttribute, quint32, &TLDocumentAttribute::duration>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLDocumentAttribute, QString, &TLDocumentAttribute::fileName>, KindString, -1, 0, 0 },
+    // TLInputChatPhoto
+    { &memberValue<TLInputChatPhoto, TLInputFile, &TLInputChatPhoto::file>, KindObject, -1, 0, 37 },
+    { &memberValue<TLInputChatPhoto, TLInputPhotoCrop, &TLInputChatPhoto::crop>, KindObject, -1, 0, 45 },
+    { &memberValue<TLInputChatPhoto, TLInputPhoto, &TLInputChatPhoto::id>, KindObject, -1, 0, 44 },
+    { &memberValue<TLInputChatPhoto, TLInputPhotoCrop, &TLInputChatPhoto::crop>, KindObject, -1, 0, 45 },
+    // TLInputMedia
+    { &memberValue<TLInputMedia, TLInputFile, &TLInputMedia::file>, KindObject, -1, 0, 37 },
+    { &memberValue<TLInputMedia, QString, &TLInputMedia::caption>, KindString, -1, 0, 0 },
+    { &memberValue<TLInputMedia, TLInputPhoto, &TLInputMedia::idInputPhoto>, KindObject, -1, 0, 44 },
+    { &memberValue<TLInputMedia, QString, &TLInputMedia::caption>, KindString, -1, 0, 0 },
+    { &memberValue<TLInputMedia, TLInputGeoPoint, &TLInputMedia::geoPoint>, KindObject, -1, 0, 40 },
+    { &memberValue<TLInputMedia, QString, &TLInputMedia::phoneNumber>, KindString, -1, 0, 0 },
+    { &memberValue<TLInputMedia, QString, &TLInputMedia::firstName>, KindString, -1, 0, 0 },
+    { &memberValue<TLInputMedia, QString, &TLInputMedia::lastName>, KindString, -1, 0, 0 },
+    { &memberValue<TLInputMedia, TLInputFile, &TLInputMedia::file>, KindObject, -1, 0, 37 },
+    { &memberValue<TLInputMedia, quint32, &TLInputMedia::duration>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLInputMedia, quint32, &TLInputMedia::w>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLInputMedia, quint32, &TLInputMedia::h>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLInputMedia, QString, &TLInputMedia::caption>, KindString, -1, 0, 0 },
+    { &memberValue<TLInputMedia, TLInputFile, &TLInputMedia::file>, KindObject, -1, 0, 37 },
+    { &memberValue<TLInputMedia, TLInputFile, &TLInputMedia::thumb>, KindObject, -1, 0, 37 },
+    { &memberValue<TLInputMedia, quint32, &TLInputMedia::duration>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLInputMedia, quint32, &TLInputMedia::w>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLInputMedia, quint32, &TLInputMedia::h>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLInputMedia, QString, &TLInputMedia::caption>, KindString, -1, 0, 0 },
+    { &memberValue<TLInputMedia, TLInputVideo, &TLInputMedia::idInputVeo>, KindObject, -1, 0, 49 },
+    { &memberValue<TLInputMedia, QString, &TLInputMedia::caption>, KindString, -1, 0, 0 },
+    { &memberValue<TLInputMedia, TLInputFile, &TLInputMedia::file>, KindObject, -1, 0, 37 },
+    { &memberValue<TLInputMedia, quint32, &TLInputMedia::duration>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLInputMedia, QString, &TLInputMedia::mimeType>, KindString, -1, 0, 0 },
+    { &memberValue<TLInputMedia, TLInputAudio, &TLInputMedia::idInputAudio>, KindObject, -1, 0, 32 },
+    { &memberValue<TLInputMedia, TLInputFile, &TLInputMedia::file>, KindObject, -1, 0, 37 },
+    { &memberValue<TLInputMedia, QString, &TLInputMedia::mimeType>, KindString, -1, 0, 0 },
+    { &memberValue<TLInputMedia, TLVector<TLDocumentAttribute>, &TLInputMedia::attributes>, KindVector, -1, 0, 7 },
+    { &memberValue<TLInputMedia, TLInputFile, &TLInputMedia::file>, KindObject, -1, 0, 37 },
+    { &memberValue<TLInputMedia, TLInputFile, &TLInputMedia::thumb>, KindObject, -1, 0, 37 },
+    { &memberValue<TLInputMedia, QString, &TLInputMedia::mimeType>, KindString, -1, 0, 0 },
+    { &memberValue<TLInputMedia, TLVector<TLDocumentAttribute>, &TLInputMedia::attributes>, KindVector, -1, 0, 7 },
+    { &memberValue<TLInputMedia, TLInputDocument, &TLInputMedia::idInputDocument>, KindObject, -1, 0, 34 },
+    { &memberValue<TLInputMedia, TLInputGeoPoint, &TLInputMedia::geoPoint>, KindObject, -1, 0, 40 },
+    { &memberValue<TLInputMedia, QString, &TLInputMedia::title>, KindString, -1, 0, 0 },
+    { &memberValue<TLInputMedia, QString, &TLInputMedia::address>, KindString, -1, 0, 0 },
+    { &memberValue<TLInputMedia, QString, &TLInputMedia::provider>, KindString, -1, 0, 0 },
+    { &memberValue<TLInputMedia, QString, &TLInputMedia::venueId>, KindString, -1, 0, 0 },
+    // TLInputNotifyPeer
+    { &memberValue<TLInputNotifyPeer, TLInputPeer, &TLInputNotifyPeer::peerInput>, KindObject, -1, 0, 41 },
+    { &memberValue<TLInputNotifyPeer, TLInputGeoChat, &TLInputNotifyPeer::peerInputGeoChat>, KindObject, -1, 0, 39 },
+    // TLInputPrivacyRule
+    { &memberValue<TLInputPrivacyRule, TLVector<TLInputUser>, &TLInputPrivacyRule::users>, KindVector, -1, 0, 8 },
+    { &memberValue<TLInputPrivacyRule, TLVector<TLInputUser>, &TLInputPrivacyRule::users>, KindVector, -1, 0, 8 },
+    // TLNotifyPeer
+    { &memberValue<TLNotifyPeer, TLPeer, &TLNotifyPeer::peer>, KindObject, -1, 0, 56 },
+    // TLPhoto
+    { &memberValue<TLPhoto, quint64, &TLPhoto::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLPhoto, quint64, &TLPhoto::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLPhoto, quint64, &TLPhoto::accessHash>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLPhoto, quint32, &TLPhoto::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLPhoto, quint32, &TLPhoto::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLPhoto, TLGeoPoint, &TLPhoto::geo>, KindObject, -1, 0, 27 },
+    { &memberValue<TLPhoto, TLVector<TLPhotoSize>, &TLPhoto::sizes>, KindVector, -1, 0, 3 },
+    // TLUser
+    { &memberValue<TLUser, quint32, &TLUser::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUser, quint32, &TLUser::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUser, QString, &TLUser::firstName>, KindString, -1, 0, 0 },
+    { &memberValue<TLUser, QString, &TLUser::lastName>, KindString, -1, 0, 0 },
+    { &memberValue<TLUser, QString, &TLUser::username>, KindString, -1, 0, 0 },
+    { &memberValue<TLUser, QString, &TLUser::phone>, KindString, -1, 0, 0 },
+    { &memberValue<TLUser, TLUserProfilePhoto, &TLUser::photo>, KindObject, -1, 0, 69 },
+    { &memberValue<TLUser, TLUserStatus, &TLUser::status>, KindObject, -1, 0, 70 },
+    { &memberValue<TLUser, quint32, &TLUser::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUser, QString, &TLUser::firstName>, KindString, -1, 0, 0 },
+    { &memberValue<TLUser, QString, &TLUser::lastName>, KindString, -1, 0, 0 },
+    { &memberValue<TLUser, QString, &TLUser::username>, KindString, -1, 0, 0 },
+    { &memberValue<TLUser, quint64, &TLUser::accessHash>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLUser, QString, &TLUser::phone>, KindString, -1, 0, 0 },
+    { &memberValue<TLUser, TLUserProfilePhoto, &TLUser::photo>, KindObject, -1, 0, 69 },
+    { &memberValue<TLUser, TLUserStatus, &TLUser::status>, KindObject, -1, 0, 70 },
+    { &memberValue<TLUser, quint32, &TLUser::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUser, QString, &TLUser::firstName>, KindString, -1, 0, 0 },
+    { &memberValue<TLUser, QString, &TLUser::lastName>, KindString, -1, 0, 0 },
+    { &memberValue<TLUser, QString, &TLUser::username>, KindString, -1, 0, 0 },
+    { &memberValue<TLUser, quint64, &TLUser::accessHash>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLUser, QString, &TLUser::phone>, KindString, -1, 0, 0 },
+    { &memberValue<TLUser, TLUserProfilePhoto, &TLUser::photo>, KindObject, -1, 0, 69 },
+    { &memberValue<TLUser, TLUserStatus, &TLUser::status>, KindObject, -1, 0, 70 },
+    { &memberValue<TLUser, quint32, &TLUser::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUser, QString, &TLUser::firstName>, KindString, -1, 0, 0 },
+    { &memberValue<TLUser, QString, &TLUser::lastName>, KindString, -1, 0, 0 },
+    { &memberValue<TLUser, QString, &TLUser::username>, KindString, -1, 0, 0 },
+    { &memberValue<TLUser, quint64, &TLUser::accessHash>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLUser, TLUserProfilePhoto, &TLUser::photo>, KindObject, -1, 0, 69 },
+    { &memberValue<TLUser, TLUserStatus, &TLUser::status>, KindObject, -1, 0, 70 },
+    { &memberValue<TLUser, quint32, &TLUser::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUser, QString, &TLUser::firstName>, KindString, -1, 0, 0 },
+    { &memberValue<TLUser, QString, &TLUser::lastName>, KindString, -1, 0, 0 },
+    { &memberValue<TLUser, QString, &TLUser::username>, KindString, -1, 0, 0 },
+    // TLWebPage
+    { &memberValue<TLWebPage, quint64, &TLWebPage::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLWebPage, quint64, &TLWebPage::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLWebPage, quint32, &TLWebPage::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLWebPage, quint32, &TLWebPage::flags>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLWebPage, quint64, &TLWebPage::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLWebPage, QString, &TLWebPage::url>, KindString, -1, 0, 0 },
+    { &memberValue<TLWebPage, QString, &TLWebPage::displayUrl>, KindString, -1, 0, 0 },
+    { &memberValue<TLWebPage, QString, &TLWebPage::type>, KindString, 0, 400, 0 },
+    { &memberValue<TLWebPage, QString, &TLWebPage::siteName>, KindString, 1, 400, 0 },
+    { &memberValue<TLWebPage, QString, &TLWebPage::title>, KindString, 2, 400, 0 },
+    { &memberValue<TLWebPage, QString, &TLWebPage::description>, KindString, 3, 400, 0 },
+    { &memberValue<TLWebPage, TLPhoto, &TLWebPage::photo>, KindObject, 4, 400, 84 },
+    { &memberValue<TLWebPage, QString, &TLWebPage::embedUrl>, KindString, 5, 400, 0 },
+    { &memberValue<TLWebPage, QString, &TLWebPage::embedType>, KindString, 5, 400, 0 },
+    { &memberValue<TLWebPage, quint32, &TLWebPage::embedWidth>, KindUInt32, 6, 400, 0 },
+    { &memberValue<TLWebPage, quint32, &TLWebPage::embedHeight>, KindUInt32, 6, 400, 0 },
+    { &memberValue<TLWebPage, quint32, &TLWebPage::duration>, KindUInt32, 7, 400, 0 },
+    { &memberValue<TLWebPage, QString, &TLWebPage::author>, KindString, 8, 400, 0 },
+    // TLAccountPrivacyRules
+    { &memberValue<TLAccountPrivacyRules, TLVector<TLPrivacyRule>, &TLAccountPrivacyRules::rules>, KindVector, -1, 0, 9 },
+    { &memberValue<TLAccountPrivacyRules, TLVector<TLUser>, &TLAccountPrivacyRules::users>, KindVector, -1, 0, 10 },
+    // TLAuthAuthorization
+    { &memberValue<TLAuthAuthorization, quint32, &TLAuthAuthorization::expires>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLAuthAuthorization, TLUser, &TLAuthAuthorization::user>, KindObject, -1, 0, 85 },
+    // TLChat
+    { &memberValue<TLChat, quint32, &TLChat::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLChat, quint32, &TLChat::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLChat, QString, &TLChat::title>, KindString, -1, 0, 0 },
+    { &memberValue<TLChat, TLChatPhoto, &TLChat::photo>, KindObject, -1, 0, 74 },
+    { &memberValue<TLChat, quint32, &TLChat::participantsCount>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLChat, quint32, &TLChat::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLChat, bool, &TLChat::left>, KindBool, -1, 0, 0 },
+    { &memberValue<TLChat, quint32, &TLChat::version>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLChat, quint32, &TLChat::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLChat, QString, &TLChat::title>, KindString, -1, 0, 0 },
+    { &memberValue<TLChat, quint32, &TLChat::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLChat, quint32, &TLChat::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLChat, quint64, &TLChat::accessHash>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLChat, QString, &TLChat::title>, KindString, -1, 0, 0 },
+    { &memberValue<TLChat, QString, &TLChat::address>, KindString, -1, 0, 0 },
+    { &memberValue<TLChat, QString, &TLChat::venue>, KindString, -1, 0, 0 },
+    { &memberValue<TLChat, TLGeoPoint, &TLChat::geo>, KindObject, -1, 0, 27 },
+    { &memberValue<TLChat, TLChatPhoto, &TLChat::photo>, KindObject, -1, 0, 74 },
+    { &memberValue<TLChat, quint32, &TLChat::participantsCount>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLChat, quint32, &TLChat::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLChat, bool, &TLChat::checkedIn>, KindBool, -1, 0, 0 },
+    { &memberValue<TLChat, quint32, &TLChat::version>, KindUInt32, -1, 0, 0 },
+    // TLChatFull
+    { &memberValue<TLChatFull, quint32, &TLChatFull::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLChatFull, TLChatParticipants, &TLChatFull::participants>, KindObject, -1, 0, 13 },
+    { &memberValue<TLChatFull, TLPhoto, &TLChatFull::chatPhoto>, KindObject, -1, 0, 84 },
+    { &memberValue<TLChatFull, TLPeerNotifySettings, &TLChatFull::notifySettings>, KindObject, -1, 0, 58 },
+    { &memberValue<TLChatFull, TLExportedChatInvite, &TLChatFull::exportedInvite>, KindObject, -1, 0, 25 },
+    // TLChatInvite
+    { &memberValue<TLChatInvite, TLChat, &TLChatInvite::chat>, KindObject, -1, 0, 89 },
+    { &memberValue<TLChatInvite, QString, &TLChatInvite::title>, KindString, -1, 0, 0 },
+    // TLContactsBlocked
+    { &memberValue<TLContactsBlocked, TLVector<TLContactBlocked>, &TLContactsBlocked::blocked>, KindVector, -1, 0, 11 },
+    { &memberValue<TLContactsBlocked, TLVector<TLUser>, &TLContactsBlocked::users>, KindVector, -1, 0, 10 },
+    { &memberValue<TLContactsBlocked, quint32, &TLContactsBlocked::count>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLContactsBlocked, TLVector<TLContactBlocked>, &TLContactsBlocked::blocked>, KindVector, -1, 0, 11 },
+    { &memberValue<TLContactsBlocked, TLVector<TLUser>, &TLContactsBlocked::users>, KindVector, -1, 0, 10 },
+    // TLContactsContacts
+    { &memberValue<TLContactsContacts, TLVector<TLContact>, &TLContactsContacts::contacts>, KindVector, -1, 0, 12 },
+    { &memberValue<TLContactsContacts, TLVector<TLUser>, &TLContactsContacts::users>, KindVector, -1, 0, 10 },
+    // TLContactsFound
+    { &memberValue<TLContactsFound, TLVector<TLContactFound>, &TLContactsFound::results>, KindVector, -1, 0, 13 },
+    { &memberValue<TLContactsFound, TLVector<TLUser>, &TLContactsFound::users>, KindVector, -1, 0, 10 },
+    // TLContactsImportedContacts
+    { &memberValue<TLContactsImportedContacts, TLVector<TLImportedContact>, &TLContactsImportedContacts::imported>, KindVector, -1, 0, 14 },
+    { &memberValue<TLContactsImportedContacts, TLVector<quint64>, &TLContactsImportedContacts::retryContacts>, KindVector, -1, 0, 2 },
+    { &memberValue<TLContactsImportedContacts, TLVector<TLUser>, &TLContactsImportedContacts::users>, KindVector, -1, 0, 10 },
+    // TLContactsLink
+    { &memberValue<TLContactsLink, TLContactLink, &TLContactsLink::myLink>, KindObject, -1, 0, 17 },
+    { &memberValue<TLContactsLink, TLContactLink, &TLContactsLink::foreignLink>, KindObject, -1, 0, 17 },
+    { &memberValue<TLContactsLink, TLUser, &TLContactsLink::user>, KindObject, -1, 0, 85 },
+    // TLContactsSuggested
+    { &memberValue<TLContactsSuggested, TLVector<TLContactSuggested>, &TLContactsSuggested::results>, KindVector, -1, 0, 15 },
+    { &memberValue<TLContactsSuggested, TLVector<TLUser>, &TLContactsSuggested::users>, KindVector, -1, 0, 10 },
+    // TLDocument
+    { &memberValue<TLDocument, quint64, &TLDocument::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLDocument, quint64, &TLDocument::id>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLDocument, quint64, &TLDocument::accessHash>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLDocument, quint32, &TLDocument::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLDocument, QString, &TLDocument::mimeType>, KindString, -1, 0, 0 },
+    { &memberValue<TLDocument, quint32, &TLDocument::size>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLDocument, TLPhotoSize, &TLDocument::thumb>, KindObject, -1, 0, 59 },
+    { &memberValue<TLDocument, quint32, &TLDocument::dcId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLDocument, TLVector<TLDocumentAttribute>, &TLDocument::attributes>, KindVector, -1, 0, 7 },
+    // TLHelpSupport
+    { &memberValue<TLHelpSupport, QString, &TLHelpSupport::phoneNumber>, KindString, -1, 0, 0 },
+    { &memberValue<TLHelpSupport, TLUser, &TLHelpSupport::user>, KindObject, -1, 0, 85 },
+    // TLMessageAction
+    { &memberValue<TLMessageAction, QString, &TLMessageAction::title>, KindString, -1, 0, 0 },
+    { &memberValue<TLMessageAction, TLVector<quint32>, &TLMessageAction::users>, KindVector, -1, 0, 1 },
+    { &memberValue<TLMessageAction, QString, &TLMessageAction::title>, KindString, -1, 0, 0 },
+    { &memberValue<TLMessageAction, TLPhoto, &TLMessageAction::photo>, KindObject, -1, 0, 84 },
+    { &memberValue<TLMessageAction, quint32, &TLMessageAction::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessageAction, quint32, &TLMessageAction::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessageAction, QString, &TLMessageAction::title>, KindString, -1, 0, 0 },
+    { &memberValue<TLMessageAction, QString, &TLMessageAction::address>, KindString, -1, 0, 0 },
+    { &memberValue<TLMessageAction, quint32, &TLMessageAction::inviterId>, KindUInt32, -1, 0, 0 },
+    // TLMessageMedia
+    { &memberValue<TLMessageMedia, TLPhoto, &TLMessageMedia::photo>, KindObject, -1, 0, 84 },
+    { &memberValue<TLMessageMedia, QString, &TLMessageMedia::caption>, KindString, -1, 0, 0 },
+    { &memberValue<TLMessageMedia, TLVideo, &TLMessageMedia::video>, KindObject, -1, 0, 71 },
+    { &memberValue<TLMessageMedia, QString, &TLMessageMedia::caption>, KindString, -1, 0, 0 },
+    { &memberValue<TLMessageMedia, TLGeoPoint, &TLMessageMedia::geo>, KindObject, -1, 0, 27 },
+    { &memberValue<TLMessageMedia, QString, &TLMessageMedia::phoneNumber>, KindString, -1, 0, 0 },
+    { &memberValue<TLMessageMedia, QString, &TLMessageMedia::firstName>, KindString, -1, 0, 0 },
+    { &memberValue<TLMessageMedia, QString, &TLMessageMedia::lastName>, KindString, -1, 0, 0 },
+    { &memberValue<TLMessageMedia, quint32, &TLMessageMedia::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessageMedia, TLDocument, &TLMessageMedia::document>, KindObject, -1, 0, 98 },
+    { &memberValue<TLMessageMedia, TLAudio, &TLMessageMedia::audio>, KindObject, -1, 0, 5 },
+    { &memberValue<TLMessageMedia, TLWebPage, &TLMessageMedia::webpage>, KindObject, -1, 0, 86 },
+    { &memberValue<TLMessageMedia, TLGeoPoint, &TLMessageMedia::geo>, KindObject, -1, 0, 27 },
+    { &memberValue<TLMessageMedia, QString, &TLMessageMedia::title>, KindString, -1, 0, 0 },
+    { &memberValue<TLMessageMedia, QString, &TLMessageMedia::address>, KindString, -1, 0, 0 },
+    { &memberValue<TLMessageMedia, QString, &TLMessageMedia::provider>, KindString, -1, 0, 0 },
+    { &memberValue<TLMessageMedia, QString, &TLMessageMedia::venueId>, KindString, -1, 0, 0 },
+    // TLMessagesAllStickers
+    { &memberValue<TLMessagesAllStickers, QString, &TLMessagesAllStickers::hash>, KindString, -1, 0, 0 },
+    { &memberValue<TLMessagesAllStickers, TLVector<TLStickerPack>, &TLMessagesAllStickers::packs>, KindVector, -1, 0, 16 },
+    { &memberValue<TLMessagesAllStickers, TLVector<TLStickerSet>, &TLMessagesAllStickers::sets>, KindVector, -1, 0, 17 },
+    { &memberValue<TLMessagesAllStickers, TLVector<TLDocument>, &TLMessagesAllStickers::documents>, KindVector, -1, 0, 18 },
+    // TLMessagesChatFull
+    { &memberValue<TLMessagesChatFull, TLChatFull, &TLMessagesChatFull::fullChat>, KindObject, -1, 0, 90 },
+    { &memberValue<TLMessagesChatFull, TLVector<TLChat>, &TLMessagesChatFull::chats>, KindVector, -1, 0, 19 },
+    { &memberValue<TLMessagesChatFull, TLVector<TLUser>, &TLMessagesChatFull::users>, KindVector, -1, 0, 10 },
+    // TLMessagesChats
+    { &memberValue<TLMessagesChats, TLVector<TLChat>, &TLMessagesChats::chats>, KindVector, -1, 0, 19 },
+    // TLMessagesSentMessage
+    { &memberValue<TLMessagesSentMessage, quint32, &TLMessagesSentMessage::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessagesSentMessage, quint32, &TLMessagesSentMessage::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessagesSentMessage, TLMessageMedia, &TLMessagesSentMessage::media>, KindObject, -1, 0, 101 },
+    { &memberValue<TLMessagesSentMessage, quint32, &TLMessagesSentMessage::pts>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessagesSentMessage, quint32, &TLMessagesSentMessage::ptsCount>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessagesSentMessage, quint32, &TLMessagesSentMessage::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessagesSentMessage, quint32, &TLMessagesSentMessage::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessagesSentMessage, TLMessageMedia, &TLMessagesSentMessage::media>, KindObject, -1, 0, 101 },
+    { &memberValue<TLMessagesSentMessage, quint32, &TLMessagesSentMessage::pts>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessagesSentMessage, quint32, &TLMessagesSentMessage::ptsCount>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessagesSentMessage, TLVector<TLContactsLink>, &TLMessagesSentMessage::links>, KindVector, -1, 0, 20 },
+    { &memberValue<TLMessagesSentMessage, quint32, &TLMessagesSentMessage::seq>, KindUInt32, -1, 0, 0 },
+    // TLMessagesStickerSet
+    { &memberValue<TLMessagesStickerSet, TLStickerSet, &TLMessagesStickerSet::set>, KindObject, -1, 0, 65 },
+    { &memberValue<TLMessagesStickerSet, TLVector<TLStickerPack>, &TLMessagesStickerSet::packs>, KindVector, -1, 0, 16 },
+    { &memberValue<TLMessagesStickerSet, TLVector<TLDocument>, &TLMessagesStickerSet::documents>, KindVector, -1, 0, 18 },
+    // TLMessagesStickers
+    { &memberValue<TLMessagesStickers, QString, &TLMessagesStickers::hash>, KindString, -1, 0, 0 },
+    { &memberValue<TLMessagesStickers, TLVector<TLDocument>, &TLMessagesStickers::stickers>, KindVector, -1, 0, 18 },
+    // TLPhotosPhoto
+    { &memberValue<TLPhotosPhoto, TLPhoto, &TLPhotosPhoto::photo>, KindObject, -1, 0, 84 },
+    { &memberValue<TLPhotosPhoto, TLVector<TLUser>, &TLPhotosPhoto::users>, KindVector, -1, 0, 10 },
+    // TLPhotosPhotos
+    { &memberValue<TLPhotosPhotos, TLVector<TLPhoto>, &TLPhotosPhotos::photos>, KindVector, -1, 0, 21 },
+    { &memberValue<TLPhotosPhotos, TLVector<TLUser>, &TLPhotosPhotos::users>, KindVector, -1, 0, 10 },
+    { &memberValue<TLPhotosPhotos, quint32, &TLPhotosPhotos::count>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLPhotosPhotos, TLVector<TLPhoto>, &TLPhotosPhotos::photos>, KindVector, -1, 0, 21 },
+    { &memberValue<TLPhotosPhotos, TLVector<TLUser>, &TLPhotosPhotos::users>, KindVector, -1, 0, 10 },
+    // TLUserFull
+    { &memberValue<TLUserFull, TLUser, &TLUserFull::user>, KindObject, -1, 0, 85 },
+    { &memberValue<TLUserFull, TLContactsLink, &TLUserFull::link>, KindObject, -1, 0, 96 },
+    { &memberValue<TLUserFull, TLPhoto, &TLUserFull::profilePhoto>, KindObject, -1, 0, 84 },
+    { &memberValue<TLUserFull, TLPeerNotifySettings, &TLUserFull::notifySettings>, KindObject, -1, 0, 58 },
+    { &memberValue<TLUserFull, bool, &TLUserFull::blocked>, KindBool, -1, 0, 0 },
+    { &memberValue<TLUserFull, QString, &TLUserFull::realFirstName>, KindString, -1, 0, 0 },
+    { &memberValue<TLUserFull, QString, &TLUserFull::realLastName>, KindString, -1, 0, 0 },
+    // TLGeoChatMessage
+    { &memberValue<TLGeoChatMessage, quint32, &TLGeoChatMessage::chatId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLGeoChatMessage, quint32, &TLGeoChatMessage::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLGeoChatMessage, quint32, &TLGeoChatMessage::chatId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLGeoChatMessage, quint32, &TLGeoChatMessage::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLGeoChatMessage, quint32, &TLGeoChatMessage::fromId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLGeoChatMessage, quint32, &TLGeoChatMessage::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLGeoChatMessage, QString, &TLGeoChatMessage::message>, KindString, -1, 0, 0 },
+    { &memberValue<TLGeoChatMessage, TLMessageMedia, &TLGeoChatMessage::media>, KindObject, -1, 0, 101 },
+    { &memberValue<TLGeoChatMessage, quint32, &TLGeoChatMessage::chatId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLGeoChatMessage, quint32, &TLGeoChatMessage::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLGeoChatMessage, quint32, &TLGeoChatMessage::fromId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLGeoChatMessage, quint32, &TLGeoChatMessage::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLGeoChatMessage, TLMessageAction, &TLGeoChatMessage::action>, KindObject, -1, 0, 100 },
+    // TLGeochatsLocated
+    { &memberValue<TLGeochatsLocated, TLVector<TLChatLocated>, &TLGeochatsLocated::results>, KindVector, -1, 0, 22 },
+    { &memberValue<TLGeochatsLocated, TLVector<TLGeoChatMessage>, &TLGeochatsLocated::messages>, KindVector, -1, 0, 23 },
+    { &memberValue<TLGeochatsLocated, TLVector<TLChat>, &TLGeochatsLocated::chats>, KindVector, -1, 0, 19 },
+    { &memberValue<TLGeochatsLocated, TLVector<TLUser>, &TLGeochatsLocated::users>, KindVector, -1, 0, 10 },
+    // TLGeochatsMessages
+    { &memberValue<TLGeochatsMessages, TLVector<TLGeoChatMessage>, &TLGeochatsMessages::messages>, KindVector, -1, 0, 23 },
+    { &memberValue<TLGeochatsMessages, TLVector<TLChat>, &TLGeochatsMessages::chats>, KindVector, -1, 0, 19 },
+    { &memberValue<TLGeochatsMessages, TLVector<TLUser>, &TLGeochatsMessages::users>, KindVector, -1, 0, 10 },
+    { &memberValue<TLGeochatsMessages, quint32, &TLGeochatsMessages::count>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLGeochatsMessages, TLVector<TLGeoChatMessage>, &TLGeochatsMessages::messages>, KindVector, -1, 0, 23 },
+    { &memberValue<TLGeochatsMessages, TLVector<TLChat>, &TLGeochatsMessages::chats>, KindVector, -1, 0, 19 },
+    { &memberValue<TLGeochatsMessages, TLVector<TLUser>, &TLGeochatsMessages::users>, KindVector, -1, 0, 10 },
+    // TLGeochatsStatedMessage
+    { &memberValue<TLGeochatsStatedMessage, TLGeoChatMessage, &TLGeochatsStatedMessage::message>, KindObject, -1, 0, 111 },
+    { &memberValue<TLGeochatsStatedMessage, TLVector<TLChat>, &TLGeochatsStatedMessage::chats>, KindVector, -1, 0, 19 },
+    { &memberValue<TLGeochatsStatedMessage, TLVector<TLUser>, &TLGeochatsStatedMessage::users>, KindVector, -1, 0, 10 },
+    { &memberValue<TLGeochatsStatedMessage, quint32, &TLGeochatsStatedMessage::seq>, KindUInt32, -1, 0, 0 },
+    // TLMessage
+    { &memberValue<TLMessage, quint32, &TLMessage::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessage, quint32, &TLMessage::flags>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessage, quint32, &TLMessage::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessage, quint32, &TLMessage::fromId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessage, TLPeer, &TLMessage::toId>, KindObject, -1, 0, 56 },
+    { &memberValue<TLMessage, quint32, &TLMessage::fwdFromId>, KindUInt32, 2, 570, 0 },
+    { &memberValue<TLMessage, quint32, &TLMessage::fwdDate>, KindUInt32, 2, 570, 0 },
+    { &memberValue<TLMessage, quint32, &TLMessage::replyToMsgId>, KindUInt32, 3, 570, 0 },
+    { &memberValue<TLMessage, quint32, &TLMessage::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessage, QString, &TLMessage::message>, KindString, -1, 0, 0 },
+    { &memberValue<TLMessage, TLMessageMedia, &TLMessage::media>, KindObject, -1, 0, 101 },
+    { &memberValue<TLMessage, quint32, &TLMessage::flags>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessage, quint32, &TLMessage::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessage, quint32, &TLMessage::fromId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessage, TLPeer, &TLMessage::toId>, KindObject, -1, 0, 56 },
+    { &memberValue<TLMessage, quint32, &TLMessage::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessage, TLMessageAction, &TLMessage::action>, KindObject, -1, 0, 100 },
+    // TLMessagesDialogs
+    { &memberValue<TLMessagesDialogs, TLVector<TLDialog>, &TLMessagesDialogs::dialogs>, KindVector, -1, 0, 24 },
+    { &memberValue<TLMessagesDialogs, TLVector<TLMessage>, &TLMessagesDialogs::messages>, KindVector, -1, 0, 25 },
+    { &memberValue<TLMessagesDialogs, TLVector<TLChat>, &TLMessagesDialogs::chats>, KindVector, -1, 0, 19 },
+    { &memberValue<TLMessagesDialogs, TLVector<TLUser>, &TLMessagesDialogs::users>, KindVector, -1, 0, 10 },
+    { &memberValue<TLMessagesDialogs, quint32, &TLMessagesDialogs::count>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessagesDialogs, TLVector<TLDialog>, &TLMessagesDialogs::dialogs>, KindVector, -1, 0, 24 },
+    { &memberValue<TLMessagesDialogs, TLVector<TLMessage>, &TLMessagesDialogs::messages>, KindVector, -1, 0, 25 },
+    { &memberValue<TLMessagesDialogs, TLVector<TLChat>, &TLMessagesDialogs::chats>, KindVector, -1, 0, 19 },
+    { &memberValue<TLMessagesDialogs, TLVector<TLUser>, &TLMessagesDialogs::users>, KindVector, -1, 0, 10 },
+    // TLMessagesMessages
+    { &memberValue<TLMessagesMessages, TLVector<TLMessage>, &TLMessagesMessages::messages>, KindVector, -1, 0, 25 },
+    { &memberValue<TLMessagesMessages, TLVector<TLChat>, &TLMessagesMessages::chats>, KindVector, -1, 0, 19 },
+    { &memberValue<TLMessagesMessages, TLVector<TLUser>, &TLMessagesMessages::users>, KindVector, -1, 0, 10 },
+    { &memberValue<TLMessagesMessages, quint32, &TLMessagesMessages::count>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLMessagesMessages, TLVector<TLMessage>, &TLMessagesMessages::messages>, KindVector, -1, 0, 25 },
+    { &memberValue<TLMessagesMessages, TLVector<TLChat>, &TLMessagesMessages::chats>, KindVector, -1, 0, 19 },
+    { &memberValue<TLMessagesMessages, TLVector<TLUser>, &TLMessagesMessages::users>, KindVector, -1, 0, 10 },
+    // TLUpdate
+    { &memberValue<TLUpdate, TLMessage, &TLUpdate::message>, KindObject, -1, 0, 115 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::pts>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::ptsCount>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint64, &TLUpdate::randomId>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLUpdate, TLVector<quint32>, &TLUpdate::messages>, KindVector, -1, 0, 1 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::pts>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::ptsCount>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, TLSendMessageAction, &TLUpdate::action>, KindObject, -1, 0, 63 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::chatId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, TLSendMessageAction, &TLUpdate::action>, KindObject, -1, 0, 63 },
+    { &memberValue<TLUpdate, TLChatParticipants, &TLUpdate::participants>, KindObject, -1, 0, 13 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, TLUserStatus, &TLUpdate::status>, KindObject, -1, 0, 70 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, QString, &TLUpdate::firstName>, KindString, -1, 0, 0 },
+    { &memberValue<TLUpdate, QString, &TLUpdate::lastName>, KindString, -1, 0, 0 },
+    { &memberValue<TLUpdate, QString, &TLUpdate::username>, KindString, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, TLUserProfilePhoto, &TLUpdate::photo>, KindObject, -1, 0, 69 },
+    { &memberValue<TLUpdate, bool, &TLUpdate::previous>, KindBool, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, TLContactLink, &TLUpdate::myLink>, KindObject, -1, 0, 17 },
+    { &memberValue<TLUpdate, TLContactLink, &TLUpdate::foreignLink>, KindObject, -1, 0, 17 },
+    { &memberValue<TLUpdate, quint64, &TLUpdate::authKeyId>, KindUInt64, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, QString, &TLUpdate::device>, KindString, -1, 0, 0 },
+    { &memberValue<TLUpdate, QString, &TLUpdate::location>, KindString, -1, 0, 0 },
+    { &memberValue<TLUpdate, TLGeoChatMessage, &TLUpdate::messageGeoChat>, KindObject, -1, 0, 111 },
+    { &memberValue<TLUpdate, TLEncryptedMessage, &TLUpdate::messageEncrypted>, KindObject, -1, 0, 23 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::qts>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::chatId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, TLEncryptedChat, &TLUpdate::chat>, KindObject, -1, 0, 21 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::chatId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::maxDate>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::chatId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::inviterId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::version>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::chatId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::version>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, TLVector<TLDcOption>, &TLUpdate::dcOptions>, KindVector, -1, 0, 5 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, bool, &TLUpdate::blocked>, KindBool, -1, 0, 0 },
+    { &memberValue<TLUpdate, TLNotifyPeer, &TLUpdate::peerNotify>, KindObject, -1, 0, 83 },
+    { &memberValue<TLUpdate, TLPeerNotifySettings, &TLUpdate::notifySettings>, KindObject, -1, 0, 58 },
+    { &memberValue<TLUpdate, QString, &TLUpdate::type>, KindString, -1, 0, 0 },
+    { &memberValue<TLUpdate, QString, &TLUpdate::messageQString>, KindString, -1, 0, 0 },
+    { &memberValue<TLUpdate, TLMessageMedia, &TLUpdate::media>, KindObject, -1, 0, 101 },
+    { &memberValue<TLUpdate, bool, &TLUpdate::popup>, KindBool, -1, 0, 0 },
+    { &memberValue<TLUpdate, TLPrivacyKey, &TLUpdate::key>, KindObject, -1, 0, 60 },
+    { &memberValue<TLUpdate, TLVector<TLPrivacyRule>, &TLUpdate::rules>, KindVector, -1, 0, 9 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, QString, &TLUpdate::phone>, KindString, -1, 0, 0 },
+    { &memberValue<TLUpdate, TLPeer, &TLUpdate::peer>, KindObject, -1, 0, 56 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::maxId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::pts>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::ptsCount>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, TLPeer, &TLUpdate::peer>, KindObject, -1, 0, 56 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::maxId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::pts>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::ptsCount>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, TLWebPage, &TLUpdate::webpage>, KindObject, -1, 0, 86 },
+    { &memberValue<TLUpdate, TLVector<quint32>, &TLUpdate::messages>, KindVector, -1, 0, 1 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::pts>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdate, quint32, &TLUpdate::ptsCount>, KindUInt32, -1, 0, 0 },
+    // TLUpdates
+    { &memberValue<TLUpdates, quint32, &TLUpdates::flags>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::userId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdates, QString, &TLUpdates::message>, KindString, -1, 0, 0 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::pts>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::ptsCount>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::fwdFromId>, KindUInt32, 2, 676, 0 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::fwdDate>, KindUInt32, 2, 676, 0 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::replyToMsgId>, KindUInt32, 3, 676, 0 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::flags>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::id>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::fromId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::chatId>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdates, QString, &TLUpdates::message>, KindString, -1, 0, 0 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::pts>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::ptsCount>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::fwdFromId>, KindUInt32, 2, 686, 0 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::fwdDate>, KindUInt32, 2, 686, 0 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::replyToMsgId>, KindUInt32, 3, 686, 0 },
+    { &memberValue<TLUpdates, TLUpdate, &TLUpdates::update>, KindObject, -1, 0, 118 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdates, TLVector<TLUpdate>, &TLUpdates::updates>, KindVector, -1, 0, 26 },
+    { &memberValue<TLUpdates, TLVector<TLUser>, &TLUpdates::users>, KindVector, -1, 0, 10 },
+    { &memberValue<TLUpdates, TLVector<TLChat>, &TLUpdates::chats>, KindVector, -1, 0, 19 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::seqStart>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::seq>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdates, TLVector<TLUpdate>, &TLUpdates::updates>, KindVector, -1, 0, 26 },
+    { &memberValue<TLUpdates, TLVector<TLUser>, &TLUpdates::users>, KindVector, -1, 0, 10 },
+    { &memberValue<TLUpdates, TLVector<TLChat>, &TLUpdates::chats>, KindVector, -1, 0, 19 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdates, quint32, &TLUpdates::seq>, KindUInt32, -1, 0, 0 },
+    // TLUpdatesDifference
+    { &memberValue<TLUpdatesDifference, quint32, &TLUpdatesDifference::date>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdatesDifference, quint32, &TLUpdatesDifference::seq>, KindUInt32, -1, 0, 0 },
+    { &memberValue<TLUpdatesDifference, TLVector<TLMessage>, &TLUpdatesDifference::newMessages>, KindVector, -1, 0, 25 },
+    { &memberValue<TLUpdatesDifference, TLVector<TLEncryptedMessage>, &TLUpdatesDifference::newEncryptedMessages>, KindVector, -1, 0, 27 },
+    { &memberValue<TLUpdatesDifference, TLVector<TLUpdate>, &TLUpdatesDifference::otherUpdates>, KindVector, -1, 0, 26 },
+    { &memberValue<TLUpdatesDifference, TLVector<TLChat>, &TLUpdatesDifference::chats>, KindVector, -1, 0, 19 },
+    { &memberValue<TLUpdatesDifference, TLVector<TLUser>, &TLUpdatesDifference::users>, KindVector, -1, 0, 10 },
+    { &memberValue<TLUpdatesDifference, TLUpdatesState, &TLUpdatesDifference::state>, KindObject, -1, 0, 67 },
+    { &memberValue<TLUpdatesDifference, TLVector<TLMessage>, &TLUpdatesDifference::newMessages>, KindVector, -1, 0, 25 },
+    { &memberValue<TLUpdatesDifference, TLVector<TLEncryptedMessage>, &TLUpdatesDifference::newEncryptedMessages>, KindVector, -1, 0, 27 },
+    { &memberValue<TLUpdatesDifference, TLVector<TLUpdate>, &TLUpdatesDifference::otherUpdates>, KindVector, -1, 0, 26 },
+    { &memberValue<TLUpdatesDifference, TLVector<TLChat>, &TLUpdatesDifference::chats>, KindVector, -1, 0, 19 },
+    { &memberValue<TLUpdatesDifference, TLVector<TLUser>, &TLUpdatesDifference::users>, KindVector, -1, 0, 10 },
+    { &memberValue<TLUpdatesDifference, TLUpdatesState, &TLUpdatesDifference::intermediateState>, KindObject, -1, 0, 67 },
+};
+
+static const SchemaConstructor s_schemaConstructors[] = {
+    { TLValue::AccountDaysTTL, 0, 1 },
+    { TLValue::AccountNoPassword, 1, 2 },
+    { TLValue::AccountPassword, 3, 5 },
+    { TLValue::AccountPasswordInputSettings, 8, 5 },
+    { TLValue::AccountPasswordSettings, 13, 1 },
+    { TLValue::AccountSentChangePhoneCode, 14, 2 },
+    { TLValue::AudioEmpty, 16, 1 },
+    { TLValue::Audio, 17, 8 },
+    { TLValue::AuthCheckedPhone, 25, 1 },
+    { TLValue::AuthExportedAuthorization, 26, 2 },
+    { TLValue::AuthPasswordRecovery, 28, 1 },
+    { TLValue::AuthSentCode, 29, 4 },
+    { TLValue::AuthSentAppCode, 33, 4 },
+    { TLValue::Authorization, 37, 13 },
+    { TLValue::ChatLocated, 50, 2 },
+    { TLValue::ChatParticipant, 52, 3 },
+    { TLValue::ChatParticipantsForbidden, 55, 1 },
+    { TLValue::ChatParticipants, 56, 4 },
+    { TLValue::Contact, 60, 2 },
+    { TLValue::ContactBlocked, 62, 2 },
+    { TLValue::ContactFound, 64, 1 },
+    { TLValue::ContactLinkUnknown, 65, 0 },
+    { TLValue::ContactLinkNone, 65, 0 },
+    { TLValue::ContactLinkHasPhone, 65, 0 },
+    { TLValue::ContactLinkContact, 65, 0 },
+    { TLValue::ContactSuggested, 65, 2 },
+    { TLValue::DcOption, 67, 4 },
+    { TLValue::DisabledFeature, 71, 2 },
+    { TLValue::EncryptedChatEmpty, 73, 1 },
+    { TLValue::EncryptedChatWaiting, 74, 5 },
+    { TLValue::EncryptedChatRequested, 79, 6 },
+    { TLValue::EncryptedChat, 85, 7 },
+    { TLValue::EncryptedChatDiscarded, 92, 1 },
+    { TLValue::EncryptedFileEmpty, 93, 0 },
+    { TLValue::EncryptedFile, 93, 5 },
+    { TLValue::EncryptedMessage, 98, 5 },
+    { TLValue::EncryptedMessageService, 103, 4 },
+    { TLValue::Error, 107, 2 },
+    { TLValue::ChatInviteEmpty, 109, 0 },
+    { TLValue::ChatInviteExported, 109, 1 },
+    { TLValue::FileLocationUnavailable, 110, 3 },
+    { TLValue::FileLocation, 113, 4 },
+    { TLValue::GeoPointEmpty, 117, 0 },
+    { TLValue::GeoPoint, 117, 2 },
+    { TLValue::HelpAppUpdate, 119, 4 },
+    { TLValue::HelpNoAppUpdate, 123, 0 },
+    { TLValue::HelpInviteText, 123, 1 },
+    { TLValue::ImportedContact, 124, 2 },
+    { TLValue::InputAppEvent, 126, 4 },
+    { TLValue::InputAudioEmpty, 130, 0 },
+    { TLValue::InputAudio, 130, 2 },
+    { TLValue::InputPhoneContact, 132, 4 },
+    { TLValue::InputDocumentEmpty, 136, 0 },
+    { TLValue::InputDocument, 136, 2 },
+    { TLValue::InputEncryptedChat, 138, 2 },
+    { TLValue::InputEncryptedFileEmpty, 140, 0 },
+    { TLValue::InputEncryptedFileUploaded, 140, 4 },
+    { TLValue::InputEncryptedFile, 144, 2 },
+    { TLValue::InputEncryptedFileBigUploaded, 146, 3 },
+    { TLValue::InputFile, 149, 4 },
+    { TLValue::InputFileBig, 153, 3 },
+    { TLValue::InputFileLocation, 156, 3 },
+    { TLValue::InputVideoFileLocation, 159, 2 },
+    { TLValue::InputEncryptedFileLocation, 161, 2 },
+    { TLValue::InputAudioFileLocation, 163, 2 },
+    { TLValue::InputDocumentFileLocation, 165, 2 },
+    { TLValue::InputGeoChat, 167, 2 },
+    { TLValue::InputGeoPointEmpty, 169, 0 },
+    { TLValue::InputGeoPoint, 169, 2 },
+    { TLValue::InputPeerEmpty, 171, 0 },
+    { TLValue::InputPeerSelf, 171, 0 },
+    { TLValue::InputPeerContact, 171, 1 },
+    { TLValue::InputPeerForeign, 172, 2 },
+    { TLValue::InputPeerChat, 174, 1 },
+    { TLValue::InputPeerNotifyEventsEmpty, 175, 0 },
+    { TLValue::InputPeerNotifyEventsAll, 175, 0 },
+    { TLValue::InputPeerNotifySettings, 175, 4 },
+    { TLValue::InputPhotoEmpty, 179, 0 },
+    { TLValue::InputPhoto, 179, 2 },
+    { TLValue::InputPhotoCropAuto, 181, 0 },
+    { TLValue::InputPhotoCrop, 181, 3 },
+    { TLValue::InputPrivacyKeyStatusTimestamp, 184, 0 },
+    { TLValue::InputStickerSetEmpty, 184, 0 },
+    { TLValue::InputStickerSetID, 184, 2 },
+    { TLValue::InputStickerSetShortName, 186, 1 },
+    { TLValue::InputUserEmpty, 187, 0 },
+    { TLValue::InputUserSelf, 187, 0 },
+    { TLValue::InputUserContact, 187, 1 },
+    { TLValue::InputUserForeign, 188, 2 },
+    { TLValue::InputVideoEmpty, 190, 0 },
+    { TLValue::InputVideo, 190, 2 },
+    { TLValue::MessagesAffectedHistory, 192, 3 },
+    { TLValue::MessagesAffectedMessages, 195, 2 },
+    { TLValue::MessagesDhConfigNotModified, 197, 1 },
+    { TLValue::MessagesDhConfig, 198, 4 },
+    { TLValue::InputMessagesFilterEmpty, 202, 0 },
+    { TLValue::InputMessagesFilterPhotos, 202, 0 },
+    { TLValue::InputMessagesFilterVideo, 202, 0 },
+    { TLValue::InputMessagesFilterPhotoVideo, 202, 0 },
+    { TLValue::InputMessagesFilterPhotoVideoDocuments, 202, 0 },
+    { TLValue::InputMessagesFilterDocument, 202, 0 },
+    { TLValue::InputMessagesFilterAudio, 202, 0 },
+    { TLValue::MessagesSentEncryptedMessage, 202, 1 },
+    { TLValue::MessagesSentEncryptedFile, 203, 2 },
+    { TLValue::NearestDc, 205, 3 },
+    { TLValue::PeerUser, 208, 1 },
+    { TLValue::PeerChat, 209, 1 },
+    { TLValue::PeerNotifyEventsEmpty, 210, 0 },
+    { TLValue::PeerNotifyEventsAll, 210, 0 },
+    { TLValue::PeerNotifySettingsEmpty, 210, 0 },
+    { TLValue::PeerNotifySettings, 210, 4 },
+    { TLValue::PhotoSizeEmpty, 214, 1 },
+    { TLValue::PhotoSize, 215, 5 },
+    { TLValue::PhotoCachedSize, 220, 5 },
+    { TLValue::PrivacyKeyStatusTimestamp, 225, 0 },
+    { TLValue::PrivacyValueAllowContacts, 225, 0 },
+    { TLValue::PrivacyValueAllowAll, 225, 0 },
+    { TLValue::PrivacyValueAllowUsers, 225, 1 },
+    { TLValue::PrivacyValueDisallowContacts, 226, 0 },
+    { TLValue::PrivacyValueDisallowAll, 226, 0 },
+    { TLValue::PrivacyValueDisallowUsers, 226, 1 },
+    { TLValue::ReceivedNotifyMessage, 227, 2 },
+    { TLValue::SendMessageTypingAction, 229, 0 },
+    { TLValue::SendMessageCancelAction, 229, 0 },
+    { TLValue::SendMessageRecordVideoAction, 229, 0 },
+    { TLValue::SendMessageUploadVideoAction, 229, 1 },
+    { TLValue::SendMessageRecordAudioAction, 230, 0 },
+    { TLValue::SendMessageUploadAudioAction, 230, 1 },
+    { TLValue::SendMessageUploadPhotoAction, 231, 1 },
+    { TLValue::SendMessageUploadDocumentAction, 232, 1 },
+    { TLValue::SendMessageGeoLocationAction, 233, 0 },
+    { TLValue::SendMessageChooseContactAction, 233, 0 },
+    { TLValue::StickerPack, 233, 2 },
+    { TLValue::StickerSet, 235, 4 },
+    { TLValue::StorageFileUnknown, 239, 0 },
+    { TLValue::StorageFileJpeg, 239, 0 },
+    { TLValue::StorageFileGif, 239, 0 },
+    { TLValue::StorageFilePng, 239, 0 },
+    { TLValue::StorageFilePdf, 239, 0 },
+    { TLValue::StorageFileMp3, 239, 0 },
+    { TLValue::StorageFileMov, 239, 0 },
+    { TLValue::StorageFilePartial, 239, 0 },
+    { TLValue::StorageFileMp4, 239, 0 },
+    { TLValue::StorageFileWebp, 239, 0 },
+    { TLValue::UpdatesState, 239, 5 },
+    { TLValue::UploadFile, 244, 3 },
+    { TLValue::UserProfilePhotoEmpty, 247, 0 },
+    { TLValue::UserProfilePhoto, 247, 3 },
+    { TLValue::UserStatusEmpty, 250, 0 },
+    { TLValue::UserStatusOnline, 250, 1 },
+    { TLValue::UserStatusOffline, 251, 1 },
+    { TLValue::UserStatusRecently, 252, 0 },
+    { TLValue::UserStatusLastWeek, 252, 0 },
+    { TLValue::UserStatusLastMonth, 252, 0 },
+    { TLValue::VideoEmpty, 252, 1 },
+    { TLValue::Video, 253, 10 },
+    { TLValue::WallPaper, 263, 4 },
+    { TLValue::WallPaperSolid, 267, 4 },
+    { TLValue::AccountAuthorizations, 271, 1 },
+    { TLValue::ChatPhotoEmpty, 272, 0 },
+    { TLValue::ChatPhoto, 272, 2 },
+    { TLValue::Config, 274, 18 },
+    { TLValue::ContactStatus, 292, 2 },
+    { TLValue::Dialog, 294, 5 },
+    { TLValue::DocumentAttributeImageSize, 299, 2 },
+    { TLValue::DocumentAttributeAnimated, 301, 0 },
+    { TLValue::DocumentAttributeSticker, 301, 2 },
+    { TLValue::DocumentAttributeVideo, 303, 3 },
+    { TLValue::DocumentAttributeAudio, 306, 1 },
+    { TLValue::DocumentAttributeFilename, 307, 1 },
+    { TLValue::InputChatPhotoEmpty, 308, 0 },
+    { TLValue::InputChatUploadedPhoto, 308, 2 },
+    { TLValue::InputChatPhoto, 310, 2 },
+    { TLValue::InputMediaEmpty, 312, 0 },
+    { TLValue::InputMediaUploadedPhoto, 312, 2 },
+    { TLValue::InputMediaPhoto, 314, 2 },
+    { TLValue::InputMediaGeoPoint, 316, 1 },
+    { TLValue::InputMediaContact, 317, 3 },
+    { TLValue::InputMediaUploadedVideo, 320, 5 },
+    { TLValue::InputMediaUploadedThumbVideo, 325, 6 },
+    { TLValue::InputMediaVideo, 331, 2 },
+    { TLValue::InputMediaUploadedAudio, 333, 3 },
+    { TLValue::InputMediaAudio, 336, 1 },
+    { TLValue::InputMediaUploadedDocument, 337, 3 },
+    { TLValue::InputMediaUploadedThumbDocument, 340, 4 },
+    { TLValue::InputMediaDocument, 344, 1 },
+    { TLValue::InputMediaVenue, 345, 5 },
+    { TLValue::InputNotifyPeer, 350, 1 },
+    { TLValue::InputNotifyUsers, 351, 0 },
+    { TLValue::InputNotifyChats, 351, 0 },
+    { TLValue::InputNotifyAll, 351, 0 },
+    { TLValue::InputNotifyGeoChatPeer, 351, 1 },
+    { TLValue::InputPrivacyValueAllowContacts, 352, 0 },
+    { TLValue::InputPrivacyValueAllowAll, 352, 0 },
+    { TLValue::InputPrivacyValueAllowUsers, 352, 1 },
+    { TLValue::InputPrivacyValueDisallowContacts, 353, 0 },
+    { TLValue::InputPrivacyValueDisallowAll, 353, 0 },
+    { TLValue::InputPrivacyValueDisallowUsers, 353, 1 },
+    { TLValue::NotifyPeer, 354, 1 },
+    { TLValue::NotifyUsers, 355, 0 },
+    { TLValue::NotifyChats, 355, 0 },
+    { TLValue::NotifyAll, 355, 0 },
+    { TLValue::PhotoEmpty, 355, 1 },
+    { TLValue::Photo, 356, 6 },
+    { TLValue::UserEmpty, 362, 1 },
+    { TLValue::UserSelf, 363, 7 },
+    { TLValue::UserContact, 370, 8 },
+    { TLValue::UserRequest, 378, 8 },
+    { TLValue::UserForeign, 386, 7 },
+    { TLValue::UserDeleted, 393, 4 },
+    { TLValue::WebPageEmpty, 397, 1 },
+    { TLValue::WebPagePending, 398, 2 },
+    { TLValue::WebPage, 400, 15 },
+    { TLValue::AccountPrivacyRules, 415, 2 },
+    { TLValue::AuthAuthorization, 417, 2 },
+    { TLValue::ChatEmpty, 419, 1 },
+    { TLValue::Chat, 420, 7 },
+    { TLValue::ChatForbidden, 427, 3 },
+    { TLValue::GeoChat, 430, 11 },
+    { TLValue::ChatFull, 441, 5 },
+    { TLValue::ChatInviteAlready, 446, 1 },
+    { TLValue::ChatInvite, 447, 1 },
+    { TLValue::ContactsBlocked, 448, 2 },
+    { TLValue::ContactsBlockedSlice, 450, 3 },
+    { TLValue::ContactsContactsNotModified, 453, 0 },
+    { TLValue::ContactsContacts, 453, 2 },
+    { TLValue::ContactsFound, 455, 2 },
+    { TLValue::ContactsImportedContacts, 457, 3 },
+    { TLValue::ContactsLink, 460, 3 },
+    { TLValue::ContactsSuggested, 463, 2 },
+    { TLValue::DocumentEmpty, 465, 1 },
+    { TLValue::Document, 466, 8 },
+    { TLValue::HelpSupport, 474, 2 },
+    { TLValue::MessageActionEmpty, 476, 0 },
+    { TLValue::MessageActionChatCreate, 476, 2 },
+    { TLValue::MessageActionChatEditTitle, 478, 1 },
+    { TLValue::MessageActionChatEditPhoto, 479, 1 },
+    { TLValue::MessageActionChatDeletePhoto, 480, 0 },
+    { TLValue::MessageActionChatAddUser, 480, 1 },
+    { TLValue::MessageActionChatDeleteUser, 481, 1 },
+    { TLValue::MessageActionGeoChatCreate, 482, 2 },
+    { TLValue::MessageActionGeoChatCheckin, 484, 0 },
+    { TLValue::MessageActionChatJoinedByLink, 484, 1 },
+    { TLValue::MessageMediaEmpty, 485, 0 },
+    { TLValue::MessageMediaPhoto, 485, 2 },
+    { TLValue::MessageMediaVideo, 487, 2 },
+    { TLValue::MessageMediaGeo, 489, 1 },
+    { TLValue::MessageMediaContact, 490, 4 },
+    { TLValue::MessageMediaUnsupported, 494, 0 },
+    { TLValue::MessageMediaDocument, 494, 1 },
+    { TLValue::MessageMediaAudio, 495, 1 },
+    { TLValue::MessageMediaWebPage, 496, 1 },
+    { TLValue::MessageMediaVenue, 497, 5 },
+    { TLValue::MessagesAllStickersNotModified, 502, 0 },
+    { TLValue::MessagesAllStickers, 502, 4 },
+    { TLValue::MessagesChatFull, 506, 3 },
+    { TLValue::MessagesChats, 509, 1 },
+    { TLValue::MessagesSentMessage, 510, 5 },
+    { TLValue::MessagesSentMessageLink, 515, 7 },
+    { TLValue::MessagesStickerSet, 522, 3 },
+    { TLValue::MessagesStickersNotModified, 525, 0 },
+    { TLValue::MessagesStickers, 525, 2 },
+    { TLValue::PhotosPhoto, 527, 2 },
+    { TLValue::PhotosPhotos, 529, 2 },
+    { TLValue::PhotosPhotosSlice, 531, 3 },
+    { TLValue::UserFull, 534, 7 },
+    { TLValue::GeoChatMessageEmpty, 541, 2 },
+    { TLValue::GeoChatMessage, 543, 6 },
+    { TLValue::GeoChatMessageService, 549, 5 },
+    { TLValue::GeochatsLocated, 554, 4 },
+    { TLValue::GeochatsMessages, 558, 3 },
+    { TLValue::GeochatsMessagesSlice, 561, 4 },
+    { TLValue::GeochatsStatedMessage, 565, 4 },
+    { TLValue::MessageEmpty, 569, 1 },
+    { TLValue::Message, 570, 10 },
+    { TLValue::MessageService, 580, 6 },
+    { TLValue::MessagesDialogs, 586, 4 },
+    { TLValue::MessagesDialogsSlice, 590, 5 },
+    { TLValue::MessagesMessages, 595, 3 },
+    { TLValue::MessagesMessagesSlice, 598, 4 },
+    { TLValue::UpdateNewMessage, 602, 3 },
+    { TLValue::UpdateMessageID, 605, 2 },
+    { TLValue::UpdateDeleteMessages, 607, 3 },
+    { TLValue::UpdateUserTyping, 610, 2 },
+    { TLValue::UpdateChatUserTyping, 612, 3 },
+    { TLValue::UpdateChatParticipants, 615, 1 },
+    { TLValue::UpdateUserStatus, 616, 2 },
+    { TLValue::UpdateUserName, 618, 4 },
+    { TLValue::UpdateUserPhoto, 622, 4 },
+    { TLValue::UpdateContactRegistered, 626, 2 },
+    { TLValue::UpdateContactLink, 628, 3 },
+    { TLValue::UpdateNewAuthorization, 631, 4 },
+    { TLValue::UpdateNewGeoChatMessage, 635, 1 },
+    { TLValue::UpdateNewEncryptedMessage, 636, 2 },
+    { TLValue::UpdateEncryptedChatTyping, 638, 1 },
+    { TLValue::UpdateEncryption, 639, 2 },
+    { TLValue::UpdateEncryptedMessagesRead, 641, 3 },
+    { TLValue::UpdateChatParticipantAdd, 644, 4 },
+    { TLValue::UpdateChatParticipantDelete, 648, 3 },
+    { TLValue::UpdateDcOptions, 651, 1 },
+    { TLValue::UpdateUserBlocked, 652, 2 },
+    { TLValue::UpdateNotifySettings, 654, 2 },
+    { TLValue::UpdateServiceNotification, 656, 4 },
+    { TLValue::UpdatePrivacy, 660, 2 },
+    { TLValue::UpdateUserPhone, 662, 2 },
+    { TLValue::UpdateReadHistoryInbox, 664, 4 },
+    { TLValue::UpdateReadHistoryOutbox, 668, 4 },
+    { TLValue::UpdateWebPage, 672, 1 },
+    { TLValue::UpdateReadMessagesContents, 673, 3 },
+    { TLValue::UpdatesTooLong, 676, 0 },
+    { TLValue::UpdateShortMessage, 676, 10 },
+    { TLValue::UpdateShortChatMessage, 686, 11 },
+    { TLValue::UpdateShort, 697, 2 },
+    { TLValue::UpdatesCombined, 699, 6 },
+    { TLValue::Updates, 705, 5 },
+    { TLValue::UpdatesDifferenceEmpty, 710, 2 },
+    { TLValue::UpdatesDifference, 712, 6 },
+    { TLValue::UpdatesDifferenceSlice, 718, 6 },
+};
+
+static const SchemaType s_schemaTypes[] = {
+    { 0, 1, &typeValue<TLAccountDaysTTL>, &resetValue<TLAccountDaysTTL> },
+    { 1, 2, &typeValue<TLAccountPassword>, &resetValue<TLAccountPassword> },
+    { 3, 1, &typeValue<TLAccountPasswordInputSettings>, &resetValue<TLAccountPasswordInputSettings> },
+    { 4, 1, &typeValue<TLAccountPasswordSettings>, &resetValue<TLAccountPasswordSettings> },
+    { 5, 1, &typeValue<TLAccountSentChangePhoneCode>, &resetValue<TLAccountSentChangePhoneCode> },
+    { 6, 2, &typeValue<TLAudio>, &resetValue<TLAudio> },
+    { 8, 1, &typeValue<TLAuthCheckedPhone>, &resetValue<TLAuthCheckedPhone> },
+    { 9, 1, &typeValue<TLAuthExportedAuthorization>, &resetValue<TLAuthExportedAuthorization> },
+    { 10, 1, &typeValue<TLAuthPasswordRecovery>, &resetValue<TLAuthPasswordRecovery> },
+    { 11, 2, &typeValue<TLAuthSentCode>, &resetValue<TLAuthSentCode> },
+    { 13, 1, &typeValue<TLAuthorization>, &resetValue<TLAuthorization> },
+    { 14, 1, &typeValue<TLChatLocated>, &resetValue<TLChatLocated> },
+    { 15, 1, &typeValue<TLChatParticipant>, &resetValue<TLChatParticipant> },
+    { 16, 2, &typeValue<TLChatParticipants>, &resetValue<TLChatParticipants> },
+    { 18, 1, &typeValue<TLContact>, &resetValue<TLContact> },
+    { 19, 1, &typeValue<TLContactBlocked>, &resetValue<TLContactBlocked> },
+    { 20, 1, &typeValue<TLContactFound>, &resetValue<TLContactFound> },
+    { 21, 4, &typeValue<TLContactLink>, &resetValue<TLContactLink> },
+    { 25, 1, &typeValue<TLContactSuggested>, &resetValue<TLContactSuggested> },
+    { 26, 1, &typeValue<TLDcOption>, &resetValue<TLDcOption> },
+    { 27, 1, &typeValue<TLDisabledFeature>, &resetValue<TLDisabledFeature> },
+    { 28, 5, &typeValue<TLEncryptedChat>, &resetValue<TLEncryptedChat> },
+    { 33, 2, &typeValue<TLEncryptedFile>, &resetValue<TLEncryptedFile> },
+    { 35, 2, &typeValue<TLEncryptedMessage>, &resetValue<TLEncryptedMessage> },
+    { 37, 1, &typeValue<TLError>, &resetValue<TLError> },
+    { 38, 2, &typeValue<TLExportedChatInvite>, &resetValue<TLExportedChatInvite> },
+    { 40, 2, &typeValue<TLFileLocation>, &resetValue<TLFileLocation> },
+    { 42, 2, &typeValue<TLGeoPoint>, &resetValue<TLGeoPoint> },
+    { 44, 2, &typeValue<TLHelpAppUpdate>, &resetValue<TLHelpAppUpdate> },
+    { 46, 1, &typeValue<TLHelpInviteText>, &resetValue<TLHelpInviteText> },
+    { 47, 1, &typeValue<TLImportedContact>, &resetValue<TLImportedContact> },
+    { 48, 1, &typeValue<TLInputAppEvent>, &resetValue<TLInputAppEvent> },
+    { 49, 2, &typeValue<TLInputAudio>, &resetValue<TLInputAudio> },
+    { 51, 1, &typeValue<TLInputContact>, &resetValue<TLInputContact> },
+    { 52, 2, &typeValue<TLInputDocument>, &resetValue<TLInputDocument> },
+    { 54, 1, &typeValue<TLInputEncryptedChat>, &resetValue<TLInputEncryptedChat> },
+    { 55, 4, &typeValue<TLInputEncryptedFile>, &resetValue<TLInputEncryptedFile> },
+    { 59, 2, &typeValue<TLInputFile>, &resetValue<TLInputFile> },
+    { 61, 5, &typeValue<TLInputFileLocation>, &resetValue<TLInputFileLocation> },
+    { 66, 1, &typeValue<TLInputGeoChat>, &resetValue<TLInputGeoChat> },
+    { 67, 2, &typeValue<TLInputGeoPoint>, &resetValue<TLInputGeoPoint> },
+    { 69, 5, &typeValue<TLInputPeer>, &resetValue<TLInputPeer> },
+    { 74, 2, &typeValue<TLInputPeerNotifyEvents>, &resetValue<TLInputPeerNotifyEvents> },
+    { 76, 1, &typeValue<TLInputPeerNotifySettings>, &resetValue<TLInputPeerNotifySettings> },
+    { 77, 2, &typeValue<TLInputPhoto>, &resetValue<TLInputPhoto> },
+    { 79, 2, &typeValue<TLInputPhotoCrop>, &resetValue<TLInputPhotoCrop> },
+    { 81, 1, &typeValue<TLInputPrivacyKey>, &resetValue<TLInputPrivacyKey> },
+    { 82, 3, &typeValue<TLInputStickerSet>, &resetValue<TLInputStickerSet> },
+    { 85, 4, &typeValue<TLInputUser>, &resetValue<TLInputUser> },
+    { 89, 2, &typeValue<TLInputVideo>, &resetValue<TLInputVideo> },
+    { 91, 1, &typeValue<TLMessagesAffectedHistory>, &resetValue<TLMessagesAffectedHistory> },
+    { 92, 1, &typeValue<TLMessagesAffectedMessages>, &resetValue<TLMessagesAffectedMessages> },
+    { 93, 2, &typeValue<TLMessagesDhConfig>, &resetValue<TLMessagesDhConfig> },
+    { 95, 7, &typeValue<TLMessagesFilter>, &resetValue<TLMessagesFilter> },
+    { 102, 2, &typeValue<TLMessagesSentEncryptedMessage>, &resetValue<TLMessagesSentEncryptedMessage> },
+    { 104, 1, &typeValue<TLNearestDc>, &resetValue<TLNearestDc> },
+    { 105, 2, &typeValue<TLPeer>, &resetValue<TLPeer> },
+    { 107, 2, &typeValue<TLPeerNotifyEvents>, &resetValue<TLPeerNotifyEvents> },
+    { 109, 2, &typeValue<TLPeerNotifySettings>, &resetValue<TLPeerNotifySettings> },
+    { 111, 3, &typeValue<TLPhotoSize>, &resetValue<TLPhotoSize> },
+    { 114, 1, &typeValue<TLPrivacyKey>, &resetValue<TLPrivacyKey> },
+    { 115, 6, &typeValue<TLPrivacyRule>, &resetValue<TLPrivacyRule> },
+    { 121, 1, &typeValue<TLReceivedNotifyMessage>, &resetValue<TLReceivedNotifyMessage> },
+    { 122, 10, &typeValue<TLSendMessageAction>, &resetValue<TLSendMessageAction> },
+    { 132, 1, &typeValue<TLStickerPack>, &resetValue<TLStickerPack> },
+    { 133, 1, &typeValue<TLStickerSet>, &resetValue<TLStickerSet> },
+    { 134, 10, &typeValue<TLStorageFileType>, &resetValue<TLStorageFileType> },
+    { 144, 1, &typeValue<TLUpdatesState>, &resetValue<TLUpdatesState> },
+    { 145, 1, &typeValue<TLUploadFile>, &resetValue<TLUploadFile> },
+    { 146, 2, &typeValue<TLUserProfilePhoto>, &resetValue<TLUserProfilePhoto> },
+    { 148, 6, &typeValue<TLUserStatus>, &resetValue<TLUserStatus> },
+    { 154, 2, &typeValue<TLVideo>, &resetValue<TLVideo> },
+    { 156, 2, &typeValue<TLWallPaper>, &resetValue<TLWallPaper> },
+    { 158, 1, &typeValue<TLAccountAuthorizations>, &resetValue<TLAccountAuthorizations> },
+    { 159, 2, &typeValue<TLChatPhoto>, &resetValue<TLChatPhoto> },
+    { 161, 1, &typeValue<TLConfig>, &resetValue<TLConfig> },
+    { 162, 1, &typeValue<TLContactStatus>, &resetValue<TLContactStatus> },
+    { 163, 1, &typeValue<TLDialog>, &resetValue<TLDialog> },
+    { 164, 6, &typeValue<TLDocumentAttribute>, &resetValue<TLDocumentAttribute> },
+    { 170, 3, &typeValue<TLInputChatPhoto>, &resetValue<TLInputChatPhoto> },
+    { 173, 14, &typeValue<TLInputMedia>, &resetValue<TLInputMedia> },
+    { 187, 5, &typeValue<TLInputNotifyPeer>, &resetValue<TLInputNotifyPeer> },
+    { 192, 6, &typeValue<TLInputPrivacyRule>, &resetValue<TLInputPrivacyRule> },
+    { 198, 4, &typeValue<TLNotifyPeer>, &resetValue<TLNotifyPeer> },
+    { 202, 2, &typeValue<TLPhoto>, &resetValue<TLPhoto> },
+    { 204, 6, &typeValue<TLUser>, &resetValue<TLUser> },
+    { 210, 3, &typeValue<TLWebPage>, &resetValue<TLWebPage> },
+    { 213, 1, &typeValue<TLAccountPrivacyRules>, &resetValue<TLAccountPrivacyRules> },
+    { 214, 1, &typeValue<TLAuthAuthorization>, &resetValue<TLAuthAuthorization> },
+    { 215, 4, &typeValue<TLChat>, &resetValue<TLChat> },
+    { 219, 1, &typeValue<TLChatFull>, &resetValue<TLChatFull> },
+    { 220, 2, &typeValue<TLChatInvite>, &resetValue<TLChatInvite> },
+    { 222, 2, &typeValue<TLContactsBlocked>, &resetValue<TLContactsBlocked> },
+    { 224, 2, &typeValue<TLContactsContacts>, &resetValue<TLContactsContacts> },
+    { 226, 1, &typeValue<TLContactsFound>, &resetValue<TLContactsFound> },
+    { 227, 1, &typeValue<TLContactsImportedContacts>, &resetValue<TLContactsImportedContacts> },
+    { 228, 1, &typeValue<TLContactsLink>, &resetValue<TLContactsLink> },
+    { 229, 1, &typeValue<TLContactsSuggested>, &resetValue<TLContactsSuggested> },
+    { 230, 2, &typeValue<TLDocument>, &resetValue<TLDocument> },
+    { 232, 1, &typeValue<TLHelpSupport>, &resetValue<TLHelpSupport> },
+    { 233, 10, &typeValue<TLMessageAction>, &resetValue<TLMessageAction> },
+    { 243, 10, &typeValue<TLMessageMedia>, &resetValue<TLMessageMedia> },
+    { 253, 2, &typeValue<TLMessagesAllStickers>, &resetValue<TLMessagesAllStickers> },
+    { 255, 1, &typeValue<TLMessagesChatFull>, &resetValue<TLMessagesChatFull> },
+    { 256, 1, &typeValue<TLMessagesChats>, &resetValue<TLMessagesChats> },
+    { 257, 2, &typeValue<TLMessagesSentMessage>, &resetValue<TLMessagesSentMessage> },
+    { 259, 1, &typeValue<TLMessagesStickerSet>, &resetValue<TLMessagesStickerSet> },
+    { 260, 2, &typeValue<TLMessagesStickers>, &resetValue<TLMessagesStickers> },
+    { 262, 1, &typeValue<TLPhotosPhoto>, &resetValue<TLPhotosPhoto> },
+    { 263, 2, &typeValue<TLPhotosPhotos>, &resetValue<TLPhotosPhotos> },
+    { 265, 1, &typeValue<TLUserFull>, &resetValue<TLUserFull> },
+    { 266, 3, &typeValue<TLGeoChatMessage>, &resetValue<TLGeoChatMessage> },
+    { 269, 1, &typeValue<TLGeochatsLocated>, &resetValue<TLGeochatsLocated> },
+    { 270, 2, &typeValue<TLGeochatsMessages>, &resetValue<TLGeochatsMessages> },
+    { 272, 1, &typeValue<TLGeochatsStatedMessage>, &resetValue<TLGeochatsStatedMessage> },
+    { 273, 3, &typeValue<TLMessage>, &resetValue<TLMessage> },
+    { 276, 2, &typeValue<TLMessagesDialogs>, &resetValue<TLMessagesDialogs> },
+    { 278, 2, &typeValue<TLMessagesMessages>, &resetValue<TLMessagesMessages> },
+    { 280, 29, &typeValue<TLUpdate>, &resetValue<TLUpdate> },
+    { 309, 6, &typeValue<TLUpdates>, &resetValue<TLUpdates> },
+    { 315, 3, &typeValue<TLUpdatesDifference>, &resetValue<TLUpdatesDifference> },
+};
+
+static const SchemaVectorType s_schemaVectorTypes[] = {
+    { KindObject, 12, sizeof(TLChatParticipant), &typeValue<TLVector<TLChatParticipant> >, &resizeVector<TLChatParticipant>, &vectorData<TLChatParticipant> },
+    { KindUInt32, 0, sizeof(quint32), &typeValue<TLVector<quint32> >, &resizeVector<quint32>, &vectorData<quint32> },
+    { KindUInt64, 0, sizeof(quint64), &typeValue<TLVector<quint64> >, &resizeVector<quint64>, &vectorData<quint64> },
+    { KindObject, 59, sizeof(TLPhotoSize), &typeValue<TLVector<TLPhotoSize> >, &resizeVector<TLPhotoSize>, &vectorData<TLPhotoSize> },
+    { KindObject, 10, sizeof(TLAuthorization), &typeValue<TLVector<TLAuthorization> >, &resizeVector<TLAuthorization>, &vectorData<TLAuthorization> },
+    { KindObject, 19, sizeof(TLDcOption), &typeValue<TLVector<TLDcOption> >, &resizeVector<TLDcOption>, &vectorData<TLDcOption> },
+    { KindObject, 20, sizeof(TLDisabledFeature), &typeValue<TLVector<TLDisabledFeature> >, &resizeVector<TLDisabledFeature>, &vectorData<TLDisabledFeature> },
+    { KindObject, 78, sizeof(TLDocumentAttribute), &typeValue<TLVector<TLDocumentAttribute> >, &resizeVector<TLDocumentAttribute>, &vectorData<TLDocumentAttribute> },
+    { KindObject, 48, sizeof(TLInputUser), &typeValue<TLVector<TLInputUser> >, &resizeVector<TLInputUser>, &vectorData<TLInputUser> },
+    { KindObject, 61, sizeof(TLPrivacyRule), &typeValue<TLVector<TLPrivacyRule> >, &resizeVector<TLPrivacyRule>, &vectorData<TLPrivacyRule> },
+    { KindObject, 85, sizeof(TLUser), &typeValue<TLVector<TLUser> >, &resizeVector<TLUser>, &vectorData<TLUser> },
+    { KindObject, 15, sizeof(TLContactBlocked), &typeValue<TLVector<TLContactBlocked> >, &resizeVector<TLContactBlocked>, &vectorData<TLContactBlocked> },
+    { KindObject, 14, sizeof(TLContact), &typeValue<TLVector<TLContact> >, &resizeVector<TLContact>, &vectorData<TLContact> },
+    { KindObject, 16, sizeof(TLContactFound), &typeValue<TLVector<TLContactFound> >, &resizeVector<TLContactFound>, &vectorData<TLContactFound> },
+    { KindObject, 30, sizeof(TLImportedContact), &typeValue<TLVector<TLImportedContact> >, &resizeVector<TLImportedContact>, &vectorData<TLImportedContact> },
+    { KindObject, 18, sizeof(TLContactSuggested), &typeValue<TLVector<TLContactSuggested> >, &resizeVector<TLContactSuggested>, &vectorData<TLContactSuggested> },
+    { KindObject, 64, sizeof(TLStickerPack), &typeValue<TLVector<TLStickerPack> >, &resizeVector<TLStickerPack>, &vectorData<TLStickerPack> },
+    { KindObject, 65, sizeof(TLStickerSet), &typeValue<TLVector<TLStickerSet> >, &resizeVector<TLStickerSet>, &vectorData<TLStickerSet> },
+    { KindObject, 98, sizeof(TLDocument), &typeValue<TLVector<TLDocument> >, &resizeVector<TLDocument>, &vectorData<TLDocument> },
+    { KindObject, 89, sizeof(TLChat), &typeValue<TLVector<TLChat> >, &resizeVector<TLChat>, &vectorData<TLChat> },
+    { KindObject, 96, sizeof(TLContactsLink), &typeValue<TLVector<TLContactsLink> >, &resizeVector<TLContactsLink>, &vectorData<TLContactsLink> },
+    { KindObject, 84, sizeof(TLPhoto), &typeValue<TLVector<TLPhoto> >, &resizeVector<TLPhoto>, &vectorData<TLPhoto> },
+    { KindObject, 11, sizeof(TLChatLocated), &typeValue<TLVector<TLChatLocated> >, &resizeVector<TLChatLocated>, &vectorData<TLChatLocated> },
+    { KindObject, 111, sizeof(TLGeoChatMessage), &typeValue<TLVector<TLGeoChatMessage> >, &resizeVector<TLGeoChatMessage>, &vectorData<TLGeoChatMessage> },
+    { KindObject, 77, sizeof(TLDialog), &typeValue<TLVector<TLDialog> >, &resizeVector<TLDialog>, &vectorData<TLDialog> },
+    { KindObject, 115, sizeof(TLMessage), &typeValue<TLVector<TLMessage> >, &resizeVector<TLMessage>, &vectorData<TLMessage> },
+    { KindObject, 118, sizeof(TLUpdate), &typeValue<TLVector<TLUpdate> >, &resizeVector<TLUpdate>, &vectorData<TLUpdate> },
+    { KindObject, 23, sizeof(TLEncryptedMessage), &typeValue<TLVector<TLEncryptedMessage> >, &resizeVector<TLEncryptedMessage>, &vectorData<TLEncryptedMessage> },
+};
+
+// End of generated schema tables
+
+const SchemaConstructor *findConstructor(const SchemaType &type, quint32 id)
+{
+    const SchemaConstructor *constructor = s_schemaConstructors + type.firstConstructor;
+    const SchemaConstructor *end = constructor + type.constructorsCount;
+
+    for (; constructor != end; ++constructor) {
+        if (constructor->id == id) {
+            return constructor;
+        }
+    }
+
+    return 0;
+}
+
+void *memberAddress(const SchemaMember &member, const void *object)
+{
+    return member.value(const_cast<void *>(object));
+}
+
+bool isMemberPresent(const SchemaMember &member, const void *object)
+{
+    if (member.flagBit < 0) {
+        return true;
+    }
+
+    const quint32 flags = *static_cast<const quint32 *>(memberAddress(s_schemaMembers[member.flagMember], object));
+    return flags & 1 << member.flagBit;
+}
+
+} // anonymous namespace
+
+int CTelegramSchemaCodec::tablesSize()
+{
+    return sizeof(s_schemaMembers) + sizeof(s_schemaConstructors) + sizeof(s_schemaTypes) + sizeof(s_schemaVectorTypes);
+}
+
+bool CTelegramSchemaCodec::readObject(CTelegramStream &stream, int type, void *value)
+{
+    const SchemaType &schemaType = s_schemaTypes[type];
+    TLValue &tlType = *schemaType.tlType(value);
+
+    schemaType.reset(value);
+    stream >> tlType;
+
+    const SchemaConstructor *constructor = findConstructor(schemaType, tlType);
+
+    if (!constructor) {
+        return !stream.error();
+    }
+
+    const SchemaMember *member = s_schemaMembers + constructor->firstMember;
+    const SchemaMember *end = member + constructor->membersCount;
+
+    for (; (member != end) && !stream.error(); ++member) {
+        if (isMemberPresent(*member, value)) {
+            readValue(stream, member->kind, member->type, memberAddress(*member, value));
+        }
+    }
+
+    return !stream.error();
+}
+
+bool CTelegramSchemaCodec::writeObject(CTelegramStream &stream, int type, const void *value)
+{
+    const SchemaType &schemaType = s_schemaTypes[type];
+    const TLValue tlType = *schemaType.tlType(const_cast<void *>(value));
+
+    const SchemaConstructor *constructor = findConstructor(schemaType, tlType);
+
+    if (!constructor) {
+        return false;
+    }
+
+    stream << tlType;
+
+    const SchemaMember *member = s_schemaMembers + constructor->firstMember;
+    const SchemaMember *end = member + constructor->membersCount;
+
+    for (; member != end; ++member) {
+        if (isMemberPresent(*member, value)) {
+            writeValue(stream, member->kind, member->type, memberAddress(*member, value));
+        }
+    }
+
+    return !stream.error();
+}
+
+void CTelegramSchemaCodec::readValue(CTelegramStream &stream, int kind, int type, void *value)
+{
+    switch (kind) {
+    case KindBool:
+        stream >> *static_cast<bool *>(value);
+        break;
+    case KindUInt32:
+        stream >> *static_cast<quint32 *>(value);
+        break;
+    case KindUInt64:
+        stream >> *static_cast<quint64 *>(value);
+        break;
+    case KindDouble:
+        stream >> *static_cast<double *>(value);
+        break;
+    case KindString:
+        stream >> *static_cast<QString *>(value);
+        break;
+    case KindBytes:
+        stream >> *static_cast<QByteArray *>(value);
+        break;
+    case KindObject:
+        readObject(stream, type, value);
+        break;
+    case KindVector:
+        readVector(stream, type, value);
+        break;
+    default:
+        break;
+    }
+}
+
+void CTelegramSchemaCodec::writeValue(CTelegramStream &stream, int kind, int type, const void *value)
+{
+    switch (kind) {
+    case KindBool:
+        stream << *static_cast<const bool *>(value);
+        break;
+    case KindUInt32:
+        stream << *static_cast<const quint32 *>(value);
+        break;
+    case KindUInt64:
+        stream << *static_cast<const quint64 *>(value);
+        break;
+    case KindDouble:
+        stream << *static_cast<const double *>(value);
+        break;
+    case KindString:
+        stream << *static_cast<const QString *>(value);
+        break;
+    case KindBytes:
+        stream << *static_cast<const QByteArray *>(value);
+        break;
+    case KindObject:
+        writeObject(stream, type, value);
+        break;
+    case KindVector:
+        writeVector(stream, type, value);
+        break;
+    default:
+        break;
+    }
+}
+
+void CTelegramSchemaCodec::readVector(CTelegramStream &stream, int vectorType, void *vector)
+{
+    const SchemaVectorType &schemaVectorType = s_schemaVectorTypes[vectorType];
+    TLValue &tlType = *schemaVectorType.tlType(vector);
+
+    schemaVectorType.resize(vector, 0);
+    stream >> tlType;
+
+    if (tlType != TLValue::Vector) {
+        return;
+    }
+
+    quint32 length = 0;
+    stream >> length;
+
+    // Each item takes at least 4 bytes, so a broken length does not cause a huge allocation
+    int capacity = qMin<quint32>(length, stream.bytesRemaining() / 4);
+    char *data = static_cast<char *>(schemaVectorType.resize(vector, capacity));
+
+    quint32 i = 0;
+    for (; (i < length) && !stream.error(); ++i) {
+        if (int(i) == capacity) {
+            capacity = qMin<quint32>(length, capacity * 2 + 1);
+            data = static_cast<char *>(schemaVectorType.resize(vector, capacity));
+        }
+
+        readValue(stream, schemaVectorType.elementKind, schemaVectorType.elementType, data + i * schemaVectorType.elementSize);
+    }
+
+    if (int(i) != capacity) {
+        schemaVectorType.resize(vector, i);
+    }
+}
+
+void CTelegramSchemaCodec::writeVector(CTelegramStream &stream, int vectorType, const void *vector)
+{
+    const SchemaVectorType &schemaVectorType = s_schemaVectorTypes[vectorType];
+
+    int count = 0;
+    const char *data = static_cast<const char *>(schemaVectorType.data(vector, &count));
+
+    stream << TLValue::Vector;
+    stream << quint32(count);
+
+    for (int i = 0; i < count; ++i) {
+        writeValue(stream, schemaVectorType.elementKind, schemaVectorType.elementType, data + i * schemaVectorType.elementSize);
+    }
+}
+
+#ifdef TELEGRAMQT_SCHEMA_CODEC
+// The codec replaces the generated read and write operators in this build (see CTelegramStream.cpp).
+// Generated schema codec operators
+CTelegramStream &CTelegramStream::operator>>(TLAccountDaysTTL &accountDaysTTLValue) { CTelegramSchemaCodec::read(*this, accountDaysTTLValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLAccountDaysTTL &accountDaysTTLValue) { CTelegramSchemaCodec::write(*this, accountDaysTTLValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLAccountPassword &accountPasswordValue) { CTelegramSchemaCodec::read(*this, accountPasswordValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLAccountPassword &accountPasswordValue) { CTelegramSchemaCodec::write(*this, accountPasswordValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLAccountPasswordInputSettings &accountPasswordInputSettingsValue) { CTelegramSchemaCodec::read(*this, accountPasswordInputSettingsValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLAccountPasswordInputSettings &accountPasswordInputSettingsValue) { CTelegramSchemaCodec::write(*this, accountPasswordInputSettingsValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLAccountPasswordSettings &accountPasswordSettingsValue) { CTelegramSchemaCodec::read(*this, accountPasswordSettingsValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLAccountPasswordSettings &accountPasswordSettingsValue) { CTelegramSchemaCodec::write(*this, accountPasswordSettingsValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLAccountSentChangePhoneCode &accountSentChangePhoneCodeValue) { CTelegramSchemaCodec::read(*this, accountSentChangePhoneCodeValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLAccountSentChangePhoneCode &accountSentChangePhoneCodeValue) { CTelegramSchemaCodec::write(*this, accountSentChangePhoneCodeValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLAudio &audioValue) { CTelegramSchemaCodec::read(*this, audioValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLAudio &audioValue) { CTelegramSchemaCodec::write(*this, audioValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLAuthCheckedPhone &authCheckedPhoneValue) { CTelegramSchemaCodec::read(*this, authCheckedPhoneValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLAuthCheckedPhone &authCheckedPhoneValue) { CTelegramSchemaCodec::write(*this, authCheckedPhoneValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLAuthExportedAuthorization &authExportedAuthorizationValue) { CTelegramSchemaCodec::read(*this, authExportedAuthorizationValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLAuthExportedAuthorization &authExportedAuthorizationValue) { CTelegramSchemaCodec::write(*this, authExportedAuthorizationValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLAuthPasswordRecovery &authPasswordRecoveryValue) { CTelegramSchemaCodec::read(*this, authPasswordRecoveryValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLAuthPasswordRecovery &authPasswordRecoveryValue) { CTelegramSchemaCodec::write(*this, authPasswordRecoveryValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLAuthSentCode &authSentCodeValue) { CTelegramSchemaCodec::read(*this, authSentCodeValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLAuthSentCode &authSentCodeValue) { CTelegramSchemaCodec::write(*this, authSentCodeValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLAuthorization &authorizationValue) { CTelegramSchemaCodec::read(*this, authorizationValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLAuthorization &authorizationValue) { CTelegramSchemaCodec::write(*this, authorizationValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLChatLocated &chatLocatedValue) { CTelegramSchemaCodec::read(*this, chatLocatedValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLChatLocated &chatLocatedValue) { CTelegramSchemaCodec::write(*this, chatLocatedValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLChatParticipant &chatParticipantValue) { CTelegramSchemaCodec::read(*this, chatParticipantValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLChatParticipant &chatParticipantValue) { CTelegramSchemaCodec::write(*this, chatParticipantValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLChatParticipants &chatParticipantsValue) { CTelegramSchemaCodec::read(*this, chatParticipantsValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLChatParticipants &chatParticipantsValue) { CTelegramSchemaCodec::write(*this, chatParticipantsValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLContact &contactValue) { CTelegramSchemaCodec::read(*this, contactValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLContact &contactValue) { CTelegramSchemaCodec::write(*this, contactValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLContactBlocked &contactBlockedValue) { CTelegramSchemaCodec::read(*this, contactBlockedValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLContactBlocked &contactBlockedValue) { CTelegramSchemaCodec::write(*this, contactBlockedValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLContactFound &contactFoundValue) { CTelegramSchemaCodec::read(*this, contactFoundValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLContactFound &contactFoundValue) { CTelegramSchemaCodec::write(*this, contactFoundValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLContactLink &contactLinkValue) { CTelegramSchemaCodec::read(*this, contactLinkValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLContactLink &contactLinkValue) { CTelegramSchemaCodec::write(*this, contactLinkValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLContactSuggested &contactSuggestedValue) { CTelegramSchemaCodec::read(*this, contactSuggestedValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLContactSuggested &contactSuggestedValue) { CTelegramSchemaCodec::write(*this, contactSuggestedValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLDcOption &dcOptionValue) { CTelegramSchemaCodec::read(*this, dcOptionValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLDcOption &dcOptionValue) { CTelegramSchemaCodec::write(*this, dcOptionValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLDisabledFeature &disabledFeatureValue) { CTelegramSchemaCodec::read(*this, disabledFeatureValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLDisabledFeature &disabledFeatureValue) { CTelegramSchemaCodec::write(*this, disabledFeatureValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLEncryptedChat &encryptedChatValue) { CTelegramSchemaCodec::read(*this, encryptedChatValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLEncryptedChat &encryptedChatValue) { CTelegramSchemaCodec::write(*this, encryptedChatValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLEncryptedFile &encryptedFileValue) { CTelegramSchemaCodec::read(*this, encryptedFileValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLEncryptedFile &encryptedFileValue) { CTelegramSchemaCodec::write(*this, encryptedFileValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLEncryptedMessage &encryptedMessageValue) { CTelegramSchemaCodec::read(*this, encryptedMessageValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLEncryptedMessage &encryptedMessageValue) { CTelegramSchemaCodec::write(*this, encryptedMessageValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLError &errorValue) { CTelegramSchemaCodec::read(*this, errorValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLError &errorValue) { CTelegramSchemaCodec::write(*this, errorValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLExportedChatInvite &exportedChatInviteValue) { CTelegramSchemaCodec::read(*this, exportedChatInviteValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLExportedChatInvite &exportedChatInviteValue) { CTelegramSchemaCodec::write(*this, exportedChatInviteValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLFileLocation &fileLocationValue) { CTelegramSchemaCodec::read(*this, fileLocationValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLFileLocation &fileLocationValue) { CTelegramSchemaCodec::write(*this, fileLocationValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLGeoPoint &geoPointValue) { CTelegramSchemaCodec::read(*this, geoPointValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLGeoPoint &geoPointValue) { CTelegramSchemaCodec::write(*this, geoPointValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLHelpAppUpdate &helpAppUpdateValue) { CTelegramSchemaCodec::read(*this, helpAppUpdateValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLHelpAppUpdate &helpAppUpdateValue) { CTelegramSchemaCodec::write(*this, helpAppUpdateValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLHelpInviteText &helpInviteTextValue) { CTelegramSchemaCodec::read(*this, helpInviteTextValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLHelpInviteText &helpInviteTextValue) { CTelegramSchemaCodec::write(*this, helpInviteTextValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLImportedContact &importedContactValue) { CTelegramSchemaCodec::read(*this, importedContactValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLImportedContact &importedContactValue) { CTelegramSchemaCodec::write(*this, importedContactValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLInputAppEvent &inputAppEventValue) { CTelegramSchemaCodec::read(*this, inputAppEventValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLInputAppEvent &inputAppEventValue) { CTelegramSchemaCodec::write(*this, inputAppEventValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLInputAudio &inputAudioValue) { CTelegramSchemaCodec::read(*this, inputAudioValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLInputAudio &inputAudioValue) { CTelegramSchemaCodec::write(*this, inputAudioValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLInputContact &inputContactValue) { CTelegramSchemaCodec::read(*this, inputContactValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLInputContact &inputContactValue) { CTelegramSchemaCodec::write(*this, inputContactValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLInputDocument &inputDocumentValue) { CTelegramSchemaCodec::read(*this, inputDocumentValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLInputDocument &inputDocumentValue) { CTelegramSchemaCodec::write(*this, inputDocumentValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLInputEncryptedChat &inputEncryptedChatValue) { CTelegramSchemaCodec::read(*this, inputEncryptedChatValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLInputEncryptedChat &inputEncryptedChatValue) { CTelegramSchemaCodec::write(*this, inputEncryptedChatValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLInputEncryptedFile &inputEncryptedFileValue) { CTelegramSchemaCodec::read(*this, inputEncryptedFileValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLInputEncryptedFile &inputEncryptedFileValue) { CTelegramSchemaCodec::write(*this, inputEncryptedFileValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLInputFile &inputFileValue) { CTelegramSchemaCodec::read(*this, inputFileValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLInputFile &inputFileValue) { CTelegramSchemaCodec::write(*this, inputFileValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLInputFileLocation &inputFileLocationValue) { CTelegramSchemaCodec::read(*this, inputFileLocationValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLInputFileLocation &inputFileLocationValue) { CTelegramSchemaCodec::write(*this, inputFileLocationValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLInputGeoChat &inputGeoChatValue) { CTelegramSchemaCodec::read(*this, inputGeoChatValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLInputGeoChat &inputGeoChatValue) { CTelegramSchemaCodec::write(*this, inputGeoChatValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLInputGeoPoint &inputGeoPointValue) { CTelegramSchemaCodec::read(*this, inputGeoPointValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLInputGeoPoint &inputGeoPointValue) { CTelegramSchemaCodec::write(*this, inputGeoPointValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLInputPeer &inputPeerValue) { CTelegramSchemaCodec::read(*this, inputPeerValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLInputPeer &inputPeerValue) { CTelegramSchemaCodec::write(*this, inputPeerValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLInputPeerNotifyEvents &inputPeerNotifyEventsValue) { CTelegramSchemaCodec::read(*this, inputPeerNotifyEventsValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLInputPeerNotifyEvents &inputPeerNotifyEventsValue) { CTelegramSchemaCodec::write(*this, inputPeerNotifyEventsValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLInputPeerNotifySettings &inputPeerNotifySettingsValue) { CTelegramSchemaCodec::read(*this, inputPeerNotifySettingsValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLInputPeerNotifySettings &inputPeerNotifySettingsValue) { CTelegramSchemaCodec::write(*this, inputPeerNotifySettingsValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLInputPhoto &inputPhotoValue) { CTelegramSchemaCodec::read(*this, inputPhotoValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLInputPhoto &inputPhotoValue) { CTelegramSchemaCodec::write(*this, inputPhotoValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLInputPhotoCrop &inputPhotoCropValue) { CTelegramSchemaCodec::read(*this, inputPhotoCropValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLInputPhotoCrop &inputPhotoCropValue) { CTelegramSchemaCodec::write(*this, inputPhotoCropValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLInputPrivacyKey &inputPrivacyKeyValue) { CTelegramSchemaCodec::read(*this, inputPrivacyKeyValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLInputPrivacyKey &inputPrivacyKeyValue) { CTelegramSchemaCodec::write(*this, inputPrivacyKeyValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLInputStickerSet &inputStickerSetValue) { CTelegramSchemaCodec::read(*this, inputStickerSetValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLInputStickerSet &inputStickerSetValue) { CTelegramSchemaCodec::write(*this, inputStickerSetValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLInputUser &inputUserValue) { CTelegramSchemaCodec::read(*this, inputUserValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLInputUser &inputUserValue) { CTelegramSchemaCodec::write(*this, inputUserValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLInputVideo &inputVideoValue) { CTelegramSchemaCodec::read(*this, inputVideoValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLInputVideo &inputVideoValue) { CTelegramSchemaCodec::write(*this, inputVideoValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLMessagesAffectedHistory &messagesAffectedHistoryValue) { CTelegramSchemaCodec::read(*this, messagesAffectedHistoryValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesAffectedHistory &messagesAffectedHistoryValue) { CTelegramSchemaCodec::write(*this, messagesAffectedHistoryValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLMessagesAffectedMessages &messagesAffectedMessagesValue) { CTelegramSchemaCodec::read(*this, messagesAffectedMessagesValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesAffectedMessages &messagesAffectedMessagesValue) { CTelegramSchemaCodec::write(*this, messagesAffectedMessagesValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLMessagesDhConfig &messagesDhConfigValue) { CTelegramSchemaCodec::read(*this, messagesDhConfigValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesDhConfig &messagesDhConfigValue) { CTelegramSchemaCodec::write(*this, messagesDhConfigValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLMessagesFilter &messagesFilterValue) { CTelegramSchemaCodec::read(*this, messagesFilterValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesFilter &messagesFilterValue) { CTelegramSchemaCodec::write(*this, messagesFilterValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLMessagesSentEncryptedMessage &messagesSentEncryptedMessageValue) { CTelegramSchemaCodec::read(*this, messagesSentEncryptedMessageValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesSentEncryptedMessage &messagesSentEncryptedMessageValue) { CTelegramSchemaCodec::write(*this, messagesSentEncryptedMessageValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLNearestDc &nearestDcValue) { CTelegramSchemaCodec::read(*this, nearestDcValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLNearestDc &nearestDcValue) { CTelegramSchemaCodec::write(*this, nearestDcValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLPeer &peerValue) { CTelegramSchemaCodec::read(*this, peerValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLPeer &peerValue) { CTelegramSchemaCodec::write(*this, peerValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLPeerNotifyEvents &peerNotifyEventsValue) { CTelegramSchemaCodec::read(*this, peerNotifyEventsValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLPeerNotifyEvents &peerNotifyEventsValue) { CTelegramSchemaCodec::write(*this, peerNotifyEventsValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLPeerNotifySettings &peerNotifySettingsValue) { CTelegramSchemaCodec::read(*this, peerNotifySettingsValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLPeerNotifySettings &peerNotifySettingsValue) { CTelegramSchemaCodec::write(*this, peerNotifySettingsValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLPhotoSize &photoSizeValue) { CTelegramSchemaCodec::read(*this, photoSizeValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLPhotoSize &photoSizeValue) { CTelegramSchemaCodec::write(*this, photoSizeValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLPrivacyKey &privacyKeyValue) { CTelegramSchemaCodec::read(*this, privacyKeyValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLPrivacyKey &privacyKeyValue) { CTelegramSchemaCodec::write(*this, privacyKeyValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLPrivacyRule &privacyRuleValue) { CTelegramSchemaCodec::read(*this, privacyRuleValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLPrivacyRule &privacyRuleValue) { CTelegramSchemaCodec::write(*this, privacyRuleValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLReceivedNotifyMessage &receivedNotifyMessageValue) { CTelegramSchemaCodec::read(*this, receivedNotifyMessageValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLReceivedNotifyMessage &receivedNotifyMessageValue) { CTelegramSchemaCodec::write(*this, receivedNotifyMessageValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLSendMessageAction &sendMessageActionValue) { CTelegramSchemaCodec::read(*this, sendMessageActionValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLSendMessageAction &sendMessageActionValue) { CTelegramSchemaCodec::write(*this, sendMessageActionValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLStickerPack &stickerPackValue) { CTelegramSchemaCodec::read(*this, stickerPackValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLStickerPack &stickerPackValue) { CTelegramSchemaCodec::write(*this, stickerPackValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLStickerSet &stickerSetValue) { CTelegramSchemaCodec::read(*this, stickerSetValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLStickerSet &stickerSetValue) { CTelegramSchemaCodec::write(*this, stickerSetValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLStorageFileType &storageFileTypeValue) { CTelegramSchemaCodec::read(*this, storageFileTypeValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLStorageFileType &storageFileTypeValue) { CTelegramSchemaCodec::write(*this, storageFileTypeValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLUpdatesState &updatesStateValue) { CTelegramSchemaCodec::read(*this, updatesStateValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLUpdatesState &updatesStateValue) { CTelegramSchemaCodec::write(*this, updatesStateValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLUploadFile &uploadFileValue) { CTelegramSchemaCodec::read(*this, uploadFileValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLUploadFile &uploadFileValue) { CTelegramSchemaCodec::write(*this, uploadFileValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLUserProfilePhoto &userProfilePhotoValue) { CTelegramSchemaCodec::read(*this, userProfilePhotoValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLUserProfilePhoto &userProfilePhotoValue) { CTelegramSchemaCodec::write(*this, userProfilePhotoValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLUserStatus &userStatusValue) { CTelegramSchemaCodec::read(*this, userStatusValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLUserStatus &userStatusValue) { CTelegramSchemaCodec::write(*this, userStatusValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLVideo &videoValue) { CTelegramSchemaCodec::read(*this, videoValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLVideo &videoValue) { CTelegramSchemaCodec::write(*this, videoValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLWallPaper &wallPaperValue) { CTelegramSchemaCodec::read(*this, wallPaperValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLWallPaper &wallPaperValue) { CTelegramSchemaCodec::write(*this, wallPaperValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLAccountAuthorizations &accountAuthorizationsValue) { CTelegramSchemaCodec::read(*this, accountAuthorizationsValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLAccountAuthorizations &accountAuthorizationsValue) { CTelegramSchemaCodec::write(*this, accountAuthorizationsValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLChatPhoto &chatPhotoValue) { CTelegramSchemaCodec::read(*this, chatPhotoValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLChatPhoto &chatPhotoValue) { CTelegramSchemaCodec::write(*this, chatPhotoValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLConfig &configValue) { CTelegramSchemaCodec::read(*this, configValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLConfig &configValue) { CTelegramSchemaCodec::write(*this, configValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLContactStatus &contactStatusValue) { CTelegramSchemaCodec::read(*this, contactStatusValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLContactStatus &contactStatusValue) { CTelegramSchemaCodec::write(*this, contactStatusValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLDialog &dialogValue) { CTelegramSchemaCodec::read(*this, dialogValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLDialog &dialogValue) { CTelegramSchemaCodec::write(*this, dialogValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLDocumentAttribute &documentAttributeValue) { CTelegramSchemaCodec::read(*this, documentAttributeValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLDocumentAttribute &documentAttributeValue) { CTelegramSchemaCodec::write(*this, documentAttributeValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLInputChatPhoto &inputChatPhotoValue) { CTelegramSchemaCodec::read(*this, inputChatPhotoValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLInputChatPhoto &inputChatPhotoValue) { CTelegramSchemaCodec::write(*this, inputChatPhotoValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLInputMedia &inputMediaValue) { CTelegramSchemaCodec::read(*this, inputMediaValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLInputMedia &inputMediaValue) { CTelegramSchemaCodec::write(*this, inputMediaValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLInputNotifyPeer &inputNotifyPeerValue) { CTelegramSchemaCodec::read(*this, inputNotifyPeerValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLInputNotifyPeer &inputNotifyPeerValue) { CTelegramSchemaCodec::write(*this, inputNotifyPeerValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLInputPrivacyRule &inputPrivacyRuleValue) { CTelegramSchemaCodec::read(*this, inputPrivacyRuleValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLInputPrivacyRule &inputPrivacyRuleValue) { CTelegramSchemaCodec::write(*this, inputPrivacyRuleValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLNotifyPeer &notifyPeerValue) { CTelegramSchemaCodec::read(*this, notifyPeerValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLNotifyPeer &notifyPeerValue) { CTelegramSchemaCodec::write(*this, notifyPeerValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLPhoto &photoValue) { CTelegramSchemaCodec::read(*this, photoValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLPhoto &photoValue) { CTelegramSchemaCodec::write(*this, photoValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLUser &userValue) { CTelegramSchemaCodec::read(*this, userValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLUser &userValue) { CTelegramSchemaCodec::write(*this, userValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLWebPage &webPageValue) { CTelegramSchemaCodec::read(*this, webPageValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLWebPage &webPageValue) { CTelegramSchemaCodec::write(*this, webPageValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLAccountPrivacyRules &accountPrivacyRulesValue) { CTelegramSchemaCodec::read(*this, accountPrivacyRulesValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLAccountPrivacyRules &accountPrivacyRulesValue) { CTelegramSchemaCodec::write(*this, accountPrivacyRulesValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLAuthAuthorization &authAuthorizationValue) { CTelegramSchemaCodec::read(*this, authAuthorizationValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLAuthAuthorization &authAuthorizationValue) { CTelegramSchemaCodec::write(*this, authAuthorizationValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLChat &chatValue) { CTelegramSchemaCodec::read(*this, chatValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLChat &chatValue) { CTelegramSchemaCodec::write(*this, chatValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLChatFull &chatFullValue) { CTelegramSchemaCodec::read(*this, chatFullValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLChatFull &chatFullValue) { CTelegramSchemaCodec::write(*this, chatFullValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLChatInvite &chatInviteValue) { CTelegramSchemaCodec::read(*this, chatInviteValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLChatInvite &chatInviteValue) { CTelegramSchemaCodec::write(*this, chatInviteValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLContactsBlocked &contactsBlockedValue) { CTelegramSchemaCodec::read(*this, contactsBlockedValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLContactsBlocked &contactsBlockedValue) { CTelegramSchemaCodec::write(*this, contactsBlockedValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLContactsContacts &contactsContactsValue) { CTelegramSchemaCodec::read(*this, contactsContactsValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLContactsContacts &contactsContactsValue) { CTelegramSchemaCodec::write(*this, contactsContactsValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLContactsFound &contactsFoundValue) { CTelegramSchemaCodec::read(*this, contactsFoundValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLContactsFound &contactsFoundValue) { CTelegramSchemaCodec::write(*this, contactsFoundValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLContactsImportedContacts &contactsImportedContactsValue) { CTelegramSchemaCodec::read(*this, contactsImportedContactsValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLContactsImportedContacts &contactsImportedContactsValue) { CTelegramSchemaCodec::write(*this, contactsImportedContactsValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLContactsLink &contactsLinkValue) { CTelegramSchemaCodec::read(*this, contactsLinkValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLContactsLink &contactsLinkValue) { CTelegramSchemaCodec::write(*this, contactsLinkValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLContactsSuggested &contactsSuggestedValue) { CTelegramSchemaCodec::read(*this, contactsSuggestedValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLContactsSuggested &contactsSuggestedValue) { CTelegramSchemaCodec::write(*this, contactsSuggestedValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLDocument &documentValue) { CTelegramSchemaCodec::read(*this, documentValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLDocument &documentValue) { CTelegramSchemaCodec::write(*this, documentValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLHelpSupport &helpSupportValue) { CTelegramSchemaCodec::read(*this, helpSupportValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLHelpSupport &helpSupportValue) { CTelegramSchemaCodec::write(*this, helpSupportValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLMessageAction &messageActionValue) { CTelegramSchemaCodec::read(*this, messageActionValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLMessageAction &messageActionValue) { CTelegramSchemaCodec::write(*this, messageActionValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLMessageMedia &messageMediaValue) { CTelegramSchemaCodec::read(*this, messageMediaValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLMessageMedia &messageMediaValue) { CTelegramSchemaCodec::write(*this, messageMediaValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLMessagesAllStickers &messagesAllStickersValue) { CTelegramSchemaCodec::read(*this, messagesAllStickersValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesAllStickers &messagesAllStickersValue) { CTelegramSchemaCodec::write(*this, messagesAllStickersValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLMessagesChatFull &messagesChatFullValue) { CTelegramSchemaCodec::read(*this, messagesChatFullValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesChatFull &messagesChatFullValue) { CTelegramSchemaCodec::write(*this, messagesChatFullValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLMessagesChats &messagesChatsValue) { CTelegramSchemaCodec::read(*this, messagesChatsValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesChats &messagesChatsValue) { CTelegramSchemaCodec::write(*this, messagesChatsValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLMessagesSentMessage &messagesSentMessageValue) { CTelegramSchemaCodec::read(*this, messagesSentMessageValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesSentMessage &messagesSentMessageValue) { CTelegramSchemaCodec::write(*this, messagesSentMessageValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLMessagesStickerSet &messagesStickerSetValue) { CTelegramSchemaCodec::read(*this, messagesStickerSetValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesStickerSet &messagesStickerSetValue) { CTelegramSchemaCodec::write(*this, messagesStickerSetValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLMessagesStickers &messagesStickersValue) { CTelegramSchemaCodec::read(*this, messagesStickersValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesStickers &messagesStickersValue) { CTelegramSchemaCodec::write(*this, messagesStickersValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLPhotosPhoto &photosPhotoValue) { CTelegramSchemaCodec::read(*this, photosPhotoValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLPhotosPhoto &photosPhotoValue) { CTelegramSchemaCodec::write(*this, photosPhotoValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLPhotosPhotos &photosPhotosValue) { CTelegramSchemaCodec::read(*this, photosPhotosValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLPhotosPhotos &photosPhotosValue) { CTelegramSchemaCodec::write(*this, photosPhotosValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLUserFull &userFullValue) { CTelegramSchemaCodec::read(*this, userFullValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLUserFull &userFullValue) { CTelegramSchemaCodec::write(*this, userFullValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLGeoChatMessage &geoChatMessageValue) { CTelegramSchemaCodec::read(*this, geoChatMessageValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLGeoChatMessage &geoChatMessageValue) { CTelegramSchemaCodec::write(*this, geoChatMessageValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLGeochatsLocated &geochatsLocatedValue) { CTelegramSchemaCodec::read(*this, geochatsLocatedValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLGeochatsLocated &geochatsLocatedValue) { CTelegramSchemaCodec::write(*this, geochatsLocatedValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLGeochatsMessages &geochatsMessagesValue) { CTelegramSchemaCodec::read(*this, geochatsMessagesValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLGeochatsMessages &geochatsMessagesValue) { CTelegramSchemaCodec::write(*this, geochatsMessagesValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLGeochatsStatedMessage &geochatsStatedMessageValue) { CTelegramSchemaCodec::read(*this, geochatsStatedMessageValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLGeochatsStatedMessage &geochatsStatedMessageValue) { CTelegramSchemaCodec::write(*this, geochatsStatedMessageValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLMessage &messageValue) { CTelegramSchemaCodec::read(*this, messageValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLMessage &messageValue) { CTelegramSchemaCodec::write(*this, messageValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLMessagesDialogs &messagesDialogsValue) { CTelegramSchemaCodec::read(*this, messagesDialogsValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesDialogs &messagesDialogsValue) { CTelegramSchemaCodec::write(*this, messagesDialogsValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLMessagesMessages &messagesMessagesValue) { CTelegramSchemaCodec::read(*this, messagesMessagesValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesMessages &messagesMessagesValue) { CTelegramSchemaCodec::write(*this, messagesMessagesValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLUpdate &updateValue) { CTelegramSchemaCodec::read(*this, updateValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLUpdate &updateValue) { CTelegramSchemaCodec::write(*this, updateValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLUpdates &updatesValue) { CTelegramSchemaCodec::read(*this, updatesValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLUpdates &updatesValue) { CTelegramSchemaCodec::write(*this, updatesValue); return *this; }
+CTelegramStream &CTelegramStream::operator>>(TLUpdatesDifference &updatesDifferenceValue) { CTelegramSchemaCodec::read(*this, updatesDifferenceValue); return *this; }
+CTelegramStream &CTelegramStream::operator<<(const TLUpdatesDifference &updatesDifferenceValue) { CTelegramSchemaCodec::write(*this, updatesDifferenceValue); return *this; }
+// End of generated schema codec operators
+#endif // TELEGRAMQT_SCHEMA_CODEC
@@ -0,0 +1,174 @@
+/*
+   Copyright (C) 2014-2015 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef CTELEGRAMSCHEMACODEC_HPP
+#define CTELEGRAMSCHEMACODEC_HPP
+
+#include "CTelegramStream.hpp"
+
+/* Reads and writes TL types by the schema tables instead of the generated operators.
+ * The tables and the interpreter are much smaller than the generated code, but the decoding is slower.
+ * The codec works only with the default (not compact or shared) layout of the types. */
+class CTelegramSchemaCodec
+{
+public:
+    template <typename T>
+    static bool read(CTelegramStream &stream, T &value) { return readObject(stream, typeIndex(&value), &value); }
+
+    template <typename T>
+    static bool write(CTelegramStream &stream, const T &value) { return writeObject(stream, typeIndex(&value), &value); }
+
+    // The size of the schema tables in bytes
+    static int tablesSize();
+
+protected:
+    static bool readObject(CTelegramStream &stream, int type, void *value);
+    static bool writeObject(CTelegramStream &stream, int type, const void *value);
+
+    static void readValue(CTelegramStream &stream, int kind, int type, void *value);
+    static void writeValue(CTelegramStream &stream, int kind, int type, const void *value);
+
+    static void readVector(CTelegramStream &stream, int vectorType, void *vector);
+    static void writeVector(CTelegramStream &stream, int vectorType, const void *vector);
+
+    // Generated schema type indices
+    static int typeIndex(const TLAccountDaysTTL *) { return 0; }
+    static int typeIndex(const TLAccountPassword *) { return 1; }
+    static int typeIndex(const TLAccountPasswordInputSettings *) { return 2; }
+    static int typeIndex(const TLAccountPasswordSettings *) { return 3; }
+    static int typeIndex(const TLAccountSentChangePhoneCode *) { return 4; }
+    static int typeIndex(const TLAudio *) { return 5; }
+    static int typeIndex(const TLAuthCheckedPhone *) { return 6; }
+    static int typeIndex(const TLAuthExportedAuthorization *) { return 7; }
+    static int typeIndex(const TLAuthPasswordRecovery *) { return 8; }
+    static int typeIndex(const TLAuthSentCode *) { return 9; }
+    static int typeIndex(const TLAuthorization *) { return 10; }
+    static int typeIndex(const TLChatLocated *) { return 11; }
+    static int typeIndex(const TLChatParticipant *) { return 12; }
+    static int typeIndex(const TLChatParticipants *) { return 13; }
+    static int typeIndex(const TLContact *) { return 14; }
+    static int typeIndex(const TLContactBlocked *) { return 15; }
+    static int typeIndex(const TLContactFound *) { return 16; }
+    static int typeIndex(const TLContactLink *) { return 17; }
+    static int typeIndex(const TLContactSuggested *) { return 18; }
+    static int typeIndex(const TLDcOption *) { return 19; }
+    static int typeIndex(const TLDisabledFeature *) { return 20; }
+    static int typeIndex(const TLEncryptedChat *) { return 21; }
+    static int typeIndex(const TLEncryptedFile *) { return 22; }
+    static int typeIndex(const TLEncryptedMessage *) { return 23; }
+    static int typeIndex(const TLError *) { return 24; }
+    static int typeIndex(const TLExportedChatInvite *) { return 25; }
+    static int typeIndex(const TLFileLocation *) { return 26; }
+    static int typeIndex(const TLGeoPoint *) { return 27; }
+    static int typeIndex(const TLHelpAppUpdate *) { return 28; }
+    static int typeIndex(const TLHelpInviteText *) { return 29; }
+    static int typeIndex(const TLImportedContact *) { return 30; }
+    static int typeIndex(const TLInputAppEvent *) { return 31; }
+    static int typeIndex(const TLInputAudio *) { return 32; }
+    static int typeIndex(const TLInputContact *) { return 33; }
+    static int typeIndex(const TLInputDocument *) { return 34; }
+    static int typeIndex(const TLInputEncryptedChat *) { return 35; }
+    static int typeIndex(const TLInputEncryptedFile *) { return 36; }
+    static int typeIndex(const TLInputFile *) { return 37; }
+    static int typeIndex(const TLInputFileLocation *) { return 38; }
+    static int typeIndex(const TLInputGeoChat *) { return 39; }
+    static int typeIndex(const TLInputGeoPoint *) { return 40; }
+    static int typeIndex(const TLInputPeer *) { return 41; }
+    static int typeIndex(const TLInputPeerNotifyEvents *) { return 42; }
+    static int typeIndex(const TLInputPeerNotifySettings *) { return 43; }
+    static int typeIndex(const TLInputPhoto *) { return 44; }
+    static int typeIndex(const TLInputPhotoCrop *) { return 45; }
+    static int typeIndex(const TLInputPrivacyKey *) { return 46; }
+    static int typeIndex(const TLInputStickerSet *) { return 47; }
+    static int typeIndex(const TLInputUser *) { return 48; }
+    static int typeIndex(const TLInputVideo *) { return 49; }
+    static int typeIndex(const TLMessagesAffectedHistory *) { return 50; }
+    static int typeIndex(const TLMessagesAffectedMessages *) { return 51; }
+    static int typeIndex(const TLMessagesDhConfig *) { return 52; }
+    static int typeIndex(const TLMessagesFilter *) { return 53; }
+    static int typeIndex(const TLMessagesSentEncryptedMessage *) { return 54; }
+    static int typeIndex(const TLNearestDc *) { return 55; }
+    static int typeIndex(const TLPeer *) { return 56; }
+    static int typeIndex(const TLPeerNotifyEvents *) { return 57; }
+    static int typeIndex(const TLPeerNotifySettings *) { return 58; }
+    static int typeIndex(const TLPhotoSize *) { return 59; }
+    static int typeIndex(const TLPrivacyKey *) { return 60; }
+    static int typeIndex(const TLPrivacyRule *) { return 61; }
+    static int typeIndex(const TLReceivedNotifyMessage *) { return 62; }
+    static int typeIndex(const TLSendMessageAction *) { return 63; }
+    static int typeIndex(const TLStickerPack *) { return 64; }
+    static int typeIndex(const TLStickerSet *) { return 65; }
+    static int typeIndex(const TLStorageFileType *) { return 66; }
+    static int typeIndex(const TLUpdatesState *) { return 67; }
+    static int typeIndex(const TLUploadFile *) { return 68; }
+    static int typeIndex(const TLUserProfilePhoto *) { return 69; }
+    static int typeIndex(const TLUserStatus *) { return 70; }
+    static int typeIndex(const TLVideo *) { return 71; }
+    static int typeIndex(const TLWallPaper *) { return 72; }
+    static int typeIndex(const TLAccountAuthorizations *) { return 73; }
+    static int typeIndex(const TLChatPhoto *) { return 74; }
+    static int typeIndex(const TLConfig *) { return 75; }
+    static int typeIndex(const TLContactStatus *) { return 76; }
+    static int typeIndex(const TLDialog *) { return 77; }
+    static int typeIndex(const TLDocumentAttribute *) { return 78; }
+    static int typeIndex(const TLInputChatPhoto *) { return 79; }
+    static int typeIndex(const TLInputMedia *) { return 80; }
+    static int typeIndex(const TLInputNotifyPeer *) { return 81; }
+    static int typeIndex(const TLInputPrivacyRule *) { return 82; }
+    static int typeIndex(const TLNotifyPeer *) { return 83; }
+    static int typeIndex(const TLPhoto *) { return 84; }
+    static int typeIndex(const TLUser *) { return 85; }
+    static int typeIndex(const TLWebPage *) { return 86; }
+    static int typeIndex(const TLAccountPrivacyRules *) { return 87; }
+    static int typeIndex(const TLAuthAuthorization *) { return 88; }
+    static int typeIndex(const TLChat *) { return 89; }
+    static int typeIndex(const TLChatFull *) { return 90; }
+    static int typeIndex(const TLChatInvite *) { return 91; }
+    static int typeIndex(const TLContactsBlocked *) { return 92; }
+    static int typeIndex(const TLContactsContacts *) { return 93; }
+    static int typeIndex(const TLContactsFound *) { return 94; }
+    static int typeIndex(const TLContactsImportedContacts *) { return 95; }
+    static int typeIndex(const TLContactsLink *) { return 96; }
+    static int typeIndex(const TLContactsSuggested *) { return 97; }
+    static int typeIndex(const TLDocument *) { return 98; }
+    static int typeIndex(const TLHelpSupport *) { return 99; }
+    static int typeIndex(const TLMessageAction *) { return 100; }
+    static int typeIndex(const TLMessageMedia *) { return 101; }
+    static int typeIndex(const TLMessagesAllStickers *) { return 102; }
+    static int typeIndex(const TLMessagesChatFull *) { return 103; }
+    static int typeIndex(const TLMessagesChats *) { return 104; }
+    static int typeIndex(const TLMessagesSentMessage *) { return 105; }
+    static int typeIndex(const TLMessagesStickerSet *) { return 106; }
+    static int typeIndex(const TLMessagesStickers *) { return 107; }
+    static int typeIndex(const TLPhotosPhoto *) { return 108; }
+    static int typeIndex(const TLPhotosPhotos *) { return 109; }
+    static int typeIndex(const TLUserFull *) { return 110; }
+    static int typeIndex(const TLGeoChatMessage *) { return 111; }
+    static int typeIndex(const TLGeochatsLocated *) { return 112; }
+    static int typeIndex(const TLGeochatsMessages *) { return 113; }
+    static int typeIndex(const TLGeochatsStatedMessage *) { return 114; }
+    static int typeIndex(const TLMessage *) { return 115; }
+    static int typeIndex(const TLMessagesDialogs *) { return 116; }
+    static int typeIndex(const TLMessagesMessages *) { return 117; }
+    static int typeIndex(const TLUpdate *) { return 118; }
+    static int typeIndex(const TLUpdates *) { return 119; }
+    static int typeIndex(const TLUpdatesDifference *) { return 120; }
+    // End of generated schema type indices
+
+};
+
+#endif // CTELEGRAMSCHEMACODEC_HPP
@@ -72,466 +72,503 @@ template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLInputCont
 template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLInputAppEvent> &v);
 template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLInputPhoto> &v);
 template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLDocumentAttribute> &v);
-// End of generated vector write templates instancing
+template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLChatParticipant> &v);
+template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLPhotoSize> &v);
+template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLAuthorization> &v);
 template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLDcOption> &v);
+template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLDisabledFeature> &v);
+template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLPrivacyRule> &v);
+template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLUser> &v);
+template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLContactBlocked> &v);
+template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLContact> &v);
+template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLContactFound> &v);
+template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLImportedContact> &v);
+template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLContactSuggested> &v);
+template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLStickerPack> &v);
+template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLStickerSet> &v);
+template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLDocument> &v);
+template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLChat> &v);
+template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLContactsLink> &v);
+template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLPhoto> &v);
+template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLChatLocated> &v);
+template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLGeoChatMessage> &v);
+template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLDialog> &v);
+template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLMessage> &v);
+template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLUpdate> &v);
+template CTelegramStream &CTelegramStream::operator<<(const TLVector<TLEncryptedMessage> &v);
+// End of generated vector write templates instancing
 
 CTelegramStream::CTelegramStream(QByteArray *data, bool write) :
-    CRawStream(data, write)
+    CRawStream(data, write),
+    m_sharedBytesEnabled(false),
+    m_visitor(0),
+    m_stringPool(0)
 {
 
 }
 
 CTelegramStream::CTelegramStream(const QByteArray &data) :
-    CRawStream(data)
+    CRawStream(data),
+    m_sharedBytesEnabled(false),
+    m_visitor(0),
+    m_stringPool(0)
 {
 
 }
 
 CTelegramStream::CTelegramStream(QIODevice *d) :
-    CRawStream(d)
+    CRawStream(d),
+    m_sharedBytesEnabled(false),
+    m_visitor(0),
+    m_stringPool(0)
 {
 
 }
 
-CTelegramStream &CTelegramStream::operator>>(QByteArray &data)
+/* If shared is true, the data is a slice of the stream buffer (see CRawStream::readSharedBytes()) */
+void CTelegramStream::readBytesValue(QByteArray &data, bool shared)
 {
     quint32 length = 0;
     read(&length, 1);
 
+    quint32 fullLength = 0;
+
     if (length < 0xfe) {
-        data.resize(length);
-        length += 1; // Plus one byte before data
+        fullLength = length + 1; // Plus one byte before data
     } else {
         read(&length, 3);
+        fullLength = length + 4; // Plus four bytes before data
+    }
+
+    if (shared) {
+        data = readSharedBytes(length);
+    } else {
         data.resize(length);
-        length += 4; // Plus four bytes before data
+        read(data.data(), data.size());
+    }
+
+    if (fullLength & 3) {
+        readSharedBytes(4 - (fullLength & 3));
     }
+}
+
+CTelegramStream &CTelegramStream::skipValue(const QByteArray *)
+{
+    quint32 length = 0;
+    read(&length, 1);
 
-    read(data.data(), data.size());
+    quint32 fullLength = 0;
 
-    if (length & 3) {
-        readBytes(4 - (length & 3));
+    if (length < 0xfe) {
+        fullLength = length + 1; // Plus one byte before data
+    } else {
+        read(&length, 3);
+        fullLength = length + 4; // Plus four bytes before data
     }
 
+    skipBytes(length + ((4 - (fullLength & 3)) & 3));
+
     return *this;
 }
 
 template <typename T>
 CTelegramStream &CTelegramStream::operator>>(TLVector<T> &v)
 {
-    TLVector<T> result;
+    v.clear();
 
-    *this >> result.tlType;
+    *this >> v.tlType;
 
-    if (result.tlType == TLValue::Vector) {
+    if (v.tlType == TLValue::Vector) {
         quint32 length = 0;
         *this >> length;
-        for (quint32 i = 0; i < length; ++i) {
+
+        if (m_visitor) {
+            // The items are offered to the visitor one by one and only the rejected ones are stored.
             T value;
-            *this >> value;
-            result.append(value);
+            for (quint32 i = 0; (i < length) && !error(); ++i) {
+                *this >> value;
+                if (!m_visitor->visit(value)) {
+                    v.append(value);
+                }
+            }
+
+            return *this;
+        }
+
+        // Each item takes at least four bytes, so a broken length can not cause a huge allocation.
+        v.reserve(qMin(length, quint32(bytesRemaining() / 4)));
+
+        for (quint32 i = 0; (i < length) && !error(); ++i) {
+            v.resize(i + 1);
+            *this >> v[i];
         }
     }
 
-    v = result;
     return *this;
 }
 
+#ifndef TELEGRAMQT_SCHEMA_CODEC // The schema codec replaces the generated operators
 // Generated read operators implementation
 CTelegramStream &CTelegramStream::operator>>(TLAccountDaysTTL &accountDaysTTLValue)
 {
-    TLAccountDaysTTL result;
+    accountDaysTTLValue = TLAccountDaysTTL();
 
-    *this >> result.tlType;
+    *this >> accountDaysTTLValue.tlType;
 
-    switch (result.tlType) {
+    switch (accountDaysTTLValue.tlType) {
     case TLValue::AccountDaysTTL:
-        *this >> result.days;
+        *this >> accountDaysTTLValue.days;
         break;
     default:
         break;
     }
 
-    accountDaysTTLValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAccountPassword &accountPasswordValue)
 {
-    TLAccountPassword result;
+    accountPasswordValue = TLAccountPassword();
 
-    *this >> result.tlType;
+    *this >> accountPasswordValue.tlType;
 
-    switch (result.tlType) {
+    switch (accountPasswordValue.tlType) {
     case TLValue::AccountNoPassword:
-        *this >> result.newSalt;
-        *this >> result.emailUnconfirmedPattern;
+        *this >> accountPasswordValue.newSalt;
+        *this >> accountPasswordValue.emailUnconfirmedPattern;
         break;
     case TLValue::AccountPassword:
-        *this >> result.currentSalt;
-        *this >> result.newSalt;
-        *this >> result.hint;
-        *this >> result.hasRecovery;
-        *this >> result.emailUnconfirmedPattern;
+        *this >> accountPasswordValue.currentSalt;
+        *this >> accountPasswordValue.newSalt;
+        *this >> accountPasswordValue.hint;
+        *this >> accountPasswordValue.hasRecovery;
+        *this >> accountPasswordValue.emailUnconfirmedPattern;
         break;
     default:
         break;
     }
 
-    accountPasswordValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAccountPasswordInputSettings &accountPasswordInputSettingsValue)
 {
-    TLAccountPasswordInputSettings result;
+    accountPasswordInputSettingsValue = TLAccountPasswordInputSettings();
 
-    *this >> result.tlType;
+    *this >> accountPasswordInputSettingsValue.tlType;
 
-    switch (result.tlType) {
+    switch (accountPasswordInputSettingsValue.tlType) {
     case TLValue::AccountPasswordInputSettings:
-        *this >> result.flags;
-        if (result.flags & 1 << 0) {
-            *this >> result.newSalt;
+        *this >> accountPasswordInputSettingsValue.flags;
+        if (accountPasswordInputSettingsValue.flags & 1 << 0) {
+            *this >> accountPasswordInputSettingsValue.newSalt;
         }
-        if (result.flags & 1 << 0) {
-            *this >> result.newPasswordHash;
+        if (accountPasswordInputSettingsValue.flags & 1 << 0) {
+            *this >> accountPasswordInputSettingsValue.newPasswordHash;
         }
-        if (result.flags & 1 << 0) {
-            *this >> result.hint;
+        if (accountPasswordInputSettingsValue.flags & 1 << 0) {
+            *this >> accountPasswordInputSettingsValue.hint;
         }
-        if (result.flags & 1 << 1) {
-            *this >> result.email;
+        if (accountPasswordInputSettingsValue.flags & 1 << 1) {
+            *this >> accountPasswordInputSettingsValue.email;
         }
         break;
     default:
         break;
     }
 
-    accountPasswordInputSettingsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAccountPasswordSettings &accountPasswordSettingsValue)
 {
-    TLAccountPasswordSettings result;
+    accountPasswordSettingsValue = TLAccountPasswordSettings();
 
-    *this >> result.tlType;
+    *this >> accountPasswordSettingsValue.tlType;
 
-    switch (result.tlType) {
+    switch (accountPasswordSettingsValue.tlType) {
     case TLValue::AccountPasswordSettings:
-        *this >> result.email;
+        *this >> accountPasswordSettingsValue.email;
         break;
     default:
         break;
     }
 
-    accountPasswordSettingsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAccountSentChangePhoneCode &accountSentChangePhoneCodeValue)
 {
-    TLAccountSentChangePhoneCode result;
+    accountSentChangePhoneCodeValue = TLAccountSentChangePhoneCode();
 
-    *this >> result.tlType;
+    *this >> accountSentChangePhoneCodeValue.tlType;
 
-    switch (result.tlType) {
+    switch (accountSentChangePhoneCodeValue.tlType) {
     case TLValue::AccountSentChangePhoneCode:
-        *this >> result.phoneCodeHash;
-        *this >> result.sendCallTimeout;
+        *this >> accountSentChangePhoneCodeValue.phoneCodeHash;
+        *this >> accountSentChangePhoneCodeValue.sendCallTimeout;
         break;
     default:
         break;
     }
 
-    accountSentChangePhoneCodeValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAudio &audioValue)
 {
-    TLAudio result;
+    audioValue = TLAudio();
 
-    *this >> result.tlType;
+    *this >> audioValue.tlType;
 
-    switch (result.tlType) {
+    switch (audioValue.tlType) {
     case TLValue::AudioEmpty:
-        *this >> result.id;
+        *this >> audioValue.id;
         break;
     case TLValue::Audio:
-        *this >> result.id;
-        *this >> result.accessHash;
-        *this >> result.userId;
-        *this >> result.date;
-        *this >> result.duration;
-        *this >> result.mimeType;
-        *this >> result.size;
-        *this >> result.dcId;
+        *this >> audioValue.id;
+        *this >> audioValue.accessHash;
+        *this >> audioValue.userId;
+        *this >> audioValue.date;
+        *this >> audioValue.duration;
+        readInterned(audioValue.mimeType);
+        *this >> audioValue.size;
+        *this >> audioValue.dcId;
         break;
     default:
         break;
     }
 
-    audioValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAuthCheckedPhone &authCheckedPhoneValue)
 {
-    TLAuthCheckedPhone result;
+    authCheckedPhoneValue = TLAuthCheckedPhone();
 
-    *this >> result.tlType;
+    *this >> authCheckedPhoneValue.tlType;
 
-    switch (result.tlType) {
+    switch (authCheckedPhoneValue.tlType) {
     case TLValue::AuthCheckedPhone:
-        *this >> result.phoneRegistered;
+        *this >> authCheckedPhoneValue.phoneRegistered;
         break;
     default:
         break;
     }
 
-    authCheckedPhoneValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAuthExportedAuthorization &authExportedAuthorizationValue)
 {
-    TLAuthExportedAuthorization result;
+    authExportedAuthorizationValue = TLAuthExportedAuthorization();
 
-    *this >> result.tlType;
+    *this >> authExportedAuthorizationValue.tlType;
 
-    switch (result.tlType) {
+    switch (authExportedAuthorizationValue.tlType) {
     case TLValue::AuthExportedAuthorization:
-        *this >> result.id;
-        *this >> result.bytes;
+        *this >> authExportedAuthorizationValue.id;
+        *this >> authExportedAuthorizationValue.bytes;
         break;
     default:
         break;
     }
 
-    authExportedAuthorizationValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAuthPasswordRecovery &authPasswordRecoveryValue)
 {
-    TLAuthPasswordRecovery result;
+    authPasswordRecoveryValue = TLAuthPasswordRecovery();
 
-    *this >> result.tlType;
+    *this >> authPasswordRecoveryValue.tlType;
 
-    switch (result.tlType) {
+    switch (authPasswordRecoveryValue.tlType) {
     case TLValue::AuthPasswordRecovery:
-        *this >> result.emailPattern;
+        *this >> authPasswordRecoveryValue.emailPattern;
         break;
     default:
         break;
     }
 
-    authPasswordRecoveryValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAuthSentCode &authSentCodeValue)
 {
-    TLAuthSentCode result;
+    authSentCodeValue = TLAuthSentCode();
 
-    *this >> result.tlType;
+    *this >> authSentCodeValue.tlType;
 
-    switch (result.tlType) {
+    switch (authSentCodeValue.tlType) {
     case TLValue::AuthSentCode:
-        *this >> result.phoneRegistered;
-        *this >> result.phoneCodeHash;
-        *this >> result.sendCallTimeout;
-        *this >> result.isPassword;
+        *this >> authSentCodeValue.phoneRegistered;
+        *this >> authSentCodeValue.phoneCodeHash;
+        *this >> authSentCodeValue.sendCallTimeout;
+        *this >> authSentCodeValue.isPassword;
         break;
     case TLValue::AuthSentAppCode:
-        *this >> result.phoneRegistered;
-        *this >> result.phoneCodeHash;
-        *this >> result.sendCallTimeout;
-        *this >> result.isPassword;
+        *this >> authSentCodeValue.phoneRegistered;
+        *this >> authSentCodeValue.phoneCodeHash;
+        *this >> authSentCodeValue.sendCallTimeout;
+        *this >> authSentCodeValue.isPassword;
         break;
     default:
         break;
     }
 
-    authSentCodeValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAuthorization &authorizationValue)
 {
-    TLAuthorization result;
+    authorizationValue = TLAuthorization();
 
-    *this >> result.tlType;
+    *this >> authorizationValue.tlType;
 
-    switch (result.tlType) {
+    switch (authorizationValue.tlType) {
     case TLValue::Authorization:
-        *this >> result.hash;
-        *this >> result.flags;
-        *this >> result.deviceModel;
-        *this >> result.platform;
-        *this >> result.systemVersion;
-        *this >> result.apiId;
-        *this >> result.appName;
-        *this >> result.appVersion;
-        *this >> result.dateCreated;
-        *this >> result.dateActive;
-        *this >> result.ip;
-        *this >> result.country;
-        *this >> result.region;
+        *this >> authorizationValue.hash;
+        *this >> authorizationValue.flags;
+        readInterned(authorizationValue.deviceModel);
+        readInterned(authorizationValue.platform);
+        readInterned(authorizationValue.systemVersion);
+        *this >> authorizationValue.apiId;
+        readInterned(authorizationValue.appName);
+        readInterned(authorizationValue.appVersion);
+        *this >> authorizationValue.dateCreated;
+        *this >> authorizationValue.dateActive;
+        *this >> authorizationValue.ip;
+        readInterned(authorizationValue.country);
+        readInterned(authorizationValue.region);
         break;
     default:
         break;
     }
 
-    authorizationValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLChatLocated &chatLocatedValue)
 {
-    TLChatLocated result;
+    chatLocatedValue = TLChatLocated();
 
-    *this >> result.tlType;
+    *this >> chatLocatedValue.tlType;
 
-    switch (result.tlType) {
+    switch (chatLocatedValue.tlType) {
     case TLValue::ChatLocated:
-        *this >> result.chatId;
-        *this >> result.distance;
+        *this >> chatLocatedValue.chatId;
+        *this >> chatLocatedValue.distance;
         break;
     default:
         break;
     }
 
-    chatLocatedValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLChatParticipant &chatParticipantValue)
 {
-    TLChatParticipant result;
+    chatParticipantValue = TLChatParticipant();
 
-    *this >> result.tlType;
+    *this >> chatParticipantValue.tlType;
 
-    switch (result.tlType) {
+    switch (chatParticipantValue.tlType) {
     case TLValue::ChatParticipant:
-        *this >> result.userId;
-        *this >> result.inviterId;
-        *this >> result.date;
+        *this >> chatParticipantValue.userId;
+        *this >> chatParticipantValue.inviterId;
+        *this >> chatParticipantValue.date;
         break;
     default:
         break;
     }
 
-    chatParticipantValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLChatParticipants &chatParticipantsValue)
 {
-    TLChatParticipants result;
+    chatParticipantsValue = TLChatParticipants();
 
-    *this >> result.tlType;
+    *this >> chatParticipantsValue.tlType;
 
-    switch (result.tlType) {
+    switch (chatParticipantsValue.tlType) {
     case TLValue::ChatParticipantsForbidden:
-        *this >> result.chatId;
+        *this >> chatParticipantsValue.chatId;
         break;
     case TLValue::ChatParticipants:
-        *this >> result.chatId;
-        *this >> result.adminId;
-        *this >> result.participants;
-        *this >> result.version;
+        *this >> chatParticipantsValue.chatId;
+        *this >> chatParticipantsValue.adminId;
+        *this >> chatParticipantsValue.participants;
+        *this >> chatParticipantsValue.version;
         break;
     default:
         break;
     }
 
-    chatParticipantsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContact &contactValue)
 {
-    TLContact result;
+    contactValue = TLContact();
 
-    *this >> result.tlType;
+    *this >> contactValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactValue.tlType) {
     case TLValue::Contact:
-        *this >> result.userId;
-        *this >> result.mutual;
+        *this >> contactValue.userId;
+        *this >> contactValue.mutual;
         break;
     default:
         break;
     }
 
-    contactValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContactBlocked &contactBlockedValue)
 {
-    TLContactBlocked result;
+    contactBlockedValue = TLContactBlocked();
 
-    *this >> result.tlType;
+    *this >> contactBlockedValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactBlockedValue.tlType) {
     case TLValue::ContactBlocked:
-        *this >> result.userId;
-        *this >> result.date;
+        *this >> contactBlockedValue.userId;
+        *this >> contactBlockedValue.date;
         break;
     default:
         break;
     }
 
-    contactBlockedValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContactFound &contactFoundValue)
 {
-    TLContactFound result;
+    contactFoundValue = TLContactFound();
 
-    *this >> result.tlType;
+    *this >> contactFoundValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactFoundValue.tlType) {
     case TLValue::ContactFound:
-        *this >> result.userId;
+        *this >> contactFoundValue.userId;
         break;
     default:
         break;
     }
 
-    contactFoundValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContactLink &contactLinkValue)
 {
-    TLContactLink result;
+    contactLinkValue = TLContactLink();
 
-    *this >> result.tlType;
+    *this >> contactLinkValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactLinkValue.tlType) {
     case TLValue::ContactLinkUnknown:
         break;
     case TLValue::ContactLinkNone:
@@ -544,275 +581,253 @@ CTelegramStream &CTelegramStream::operator>>(TLContactLink &contactLinkValue)
         break;
     }
 
-    contactLinkValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContactSuggested &contactSuggestedValue)
 {
-    TLContactSuggested result;
+    contactSuggestedValue = TLContactSuggested();
 
-    *this >> result.tlType;
+    *this >> contactSuggestedValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactSuggestedValue.tlType) {
     case TLValue::ContactSuggested:
-        *this >> result.userId;
-        *this >> result.mutualContacts;
+        *this >> contactSuggestedValue.userId;
+        *this >> contactSuggestedValue.mutualContacts;
         break;
     default:
         break;
     }
 
-    contactSuggestedValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLDcOption &dcOptionValue)
 {
-    TLDcOption result;
+    dcOptionValue = TLDcOption();
 
-    *this >> result.tlType;
+    *this >> dcOptionValue.tlType;
 
-    switch (result.tlType) {
+    switch (dcOptionValue.tlType) {
     case TLValue::DcOption:
-        *this >> result.id;
-        *this >> result.hostname;
-        *this >> result.ipAddress;
-        *this >> result.port;
+        *this >> dcOptionValue.id;
+        *this >> dcOptionValue.hostname;
+        *this >> dcOptionValue.ipAddress;
+        *this >> dcOptionValue.port;
         break;
     default:
         break;
     }
 
-    dcOptionValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLDisabledFeature &disabledFeatureValue)
 {
-    TLDisabledFeature result;
+    disabledFeatureValue = TLDisabledFeature();
 
-    *this >> result.tlType;
+    *this >> disabledFeatureValue.tlType;
 
-    switch (result.tlType) {
+    switch (disabledFeatureValue.tlType) {
     case TLValue::DisabledFeature:
-        *this >> result.feature;
-        *this >> result.description;
+        *this >> disabledFeatureValue.feature;
+        *this >> disabledFeatureValue.description;
         break;
     default:
         break;
     }
 
-    disabledFeatureValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLEncryptedChat &encryptedChatValue)
 {
-    TLEncryptedChat result;
+    encryptedChatValue = TLEncryptedChat();
 
-    *this >> result.tlType;
+    *this >> encryptedChatValue.tlType;
 
-    switch (result.tlType) {
+    switch (encryptedChatValue.tlType) {
     case TLValue::EncryptedChatEmpty:
-        *this >> result.id;
+        *this >> encryptedChatValue.id;
         break;
     case TLValue::EncryptedChatWaiting:
-        *this >> result.id;
-        *this >> result.accessHash;
-        *this >> result.date;
-        *this >> result.adminId;
-        *this >> result.participantId;
+        *this >> encryptedChatValue.id;
+        *this >> encryptedChatValue.accessHash;
+        *this >> encryptedChatValue.date;
+        *this >> encryptedChatValue.adminId;
+        *this >> encryptedChatValue.participantId;
         break;
     case TLValue::EncryptedChatRequested:
-        *this >> result.id;
-        *this >> result.accessHash;
-        *this >> result.date;
-        *this >> result.adminId;
-        *this >> result.participantId;
-        *this >> result.gA;
+        *this >> encryptedChatValue.id;
+        *this >> encryptedChatValue.accessHash;
+        *this >> encryptedChatValue.date;
+        *this >> encryptedChatValue.adminId;
+        *this >> encryptedChatValue.participantId;
+        *this >> encryptedChatValue.gA;
         break;
     case TLValue::EncryptedChat:
-        *this >> result.id;
-        *this >> result.accessHash;
-        *this >> result.date;
-        *this >> result.adminId;
-        *this >> result.participantId;
-        *this >> result.gAOrB;
-        *this >> result.keyFingerprint;
+        *this >> encryptedChatValue.id;
+        *this >> encryptedChatValue.accessHash;
+        *this >> encryptedChatValue.date;
+        *this >> encryptedChatValue.adminId;
+        *this >> encryptedChatValue.participantId;
+        *this >> encryptedChatValue.gAOrB;
+        *this >> encryptedChatValue.keyFingerprint;
         break;
     case TLValue::EncryptedChatDiscarded:
-        *this >> result.id;
+        *this >> encryptedChatValue.id;
         break;
     default:
         break;
     }
 
-    encryptedChatValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLEncryptedFile &encryptedFileValue)
 {
-    TLEncryptedFile result;
+    encryptedFileValue = TLEncryptedFile();
 
-    *this >> result.tlType;
+    *this >> encryptedFileValue.tlType;
 
-    switch (result.tlType) {
+    switch (encryptedFileValue.tlType) {
     case TLValue::EncryptedFileEmpty:
         break;
     case TLValue::EncryptedFile:
-        *this >> result.id;
-        *this >> result.accessHash;
-        *this >> result.size;
-        *this >> result.dcId;
-        *this >> result.keyFingerprint;
+        *this >> encryptedFileValue.id;
+        *this >> encryptedFileValue.accessHash;
+        *this >> encryptedFileValue.size;
+        *this >> encryptedFileValue.dcId;
+        *this >> encryptedFileValue.keyFingerprint;
         break;
     default:
         break;
     }
 
-    encryptedFileValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLEncryptedMessage &encryptedMessageValue)
 {
-    TLEncryptedMessage result;
+    encryptedMessageValue = TLEncryptedMessage();
 
-    *this >> result.tlType;
+    *this >> encryptedMessageValue.tlType;
 
-    switch (result.tlType) {
+    switch (encryptedMessageValue.tlType) {
     case TLValue::EncryptedMessage:
-        *this >> result.randomId;
-        *this >> result.chatId;
-        *this >> result.date;
-        *this >> result.bytes;
-        *this >> result.file;
+        *this >> encryptedMessageValue.randomId;
+        *this >> encryptedMessageValue.chatId;
+        *this >> encryptedMessageValue.date;
+        *this >> encryptedMessageValue.bytes;
+        *this >> encryptedMessageValue.file;
         break;
     case TLValue::EncryptedMessageService:
-        *this >> result.randomId;
-        *this >> result.chatId;
-        *this >> result.date;
-        *this >> result.bytes;
+        *this >> encryptedMessageValue.randomId;
+        *this >> encryptedMessageValue.chatId;
+        *this >> encryptedMessageValue.date;
+        *this >> encryptedMessageValue.bytes;
         break;
     default:
         break;
     }
 
-    encryptedMessageValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLError &errorValue)
 {
-    TLError result;
+    errorValue = TLError();
 
-    *this >> result.tlType;
+    *this >> errorValue.tlType;
 
-    switch (result.tlType) {
+    switch (errorValue.tlType) {
     case TLValue::Error:
-        *this >> result.code;
-        *this >> result.text;
+        *this >> errorValue.code;
+        *this >> errorValue.text;
         break;
     default:
         break;
     }
 
-    errorValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLExportedChatInvite &exportedChatInviteValue)
 {
-    TLExportedChatInvite result;
+    exportedChatInviteValue = TLExportedChatInvite();
 
-    *this >> result.tlType;
+    *this >> exportedChatInviteValue.tlType;
 
-    switch (result.tlType) {
+    switch (exportedChatInviteValue.tlType) {
     case TLValue::ChatInviteEmpty:
         break;
     case TLValue::ChatInviteExported:
-        *this >> result.link;
+        *this >> exportedChatInviteValue.link;
         break;
     default:
         break;
     }
 
-    exportedChatInviteValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLFileLocation &fileLocationValue)
 {
-    TLFileLocation result;
+    fileLocationValue = TLFileLocation();
 
-    *this >> result.tlType;
+    *this >> fileLocationValue.tlType;
 
-    switch (result.tlType) {
+    switch (fileLocationValue.tlType) {
     case TLValue::FileLocationUnavailable:
-        *this >> result.volumeId;
-        *this >> result.localId;
-        *this >> result.secret;
+        *this >> fileLocationValue.volumeId;
+        *this >> fileLocationValue.localId;
+        *this >> fileLocationValue.secret;
         break;
     case TLValue::FileLocation:
-        *this >> result.dcId;
-        *this >> result.volumeId;
-        *this >> result.localId;
-        *this >> result.secret;
+        *this >> fileLocationValue.dcId;
+        *this >> fileLocationValue.volumeId;
+        *this >> fileLocationValue.localId;
+        *this >> fileLocationValue.secret;
         break;
     default:
         break;
     }
 
-    fileLocationValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLGeoPoint &geoPointValue)
 {
-    TLGeoPoint result;
+    geoPointValue = TLGeoPoint();
 
-    *this >> result.tlType;
+    *this >> geoPointValue.tlType;
 
-    switch (result.tlType) {
+    switch (geoPointValue.tlType) {
     case TLValue::GeoPointEmpty:
         break;
     case TLValue::GeoPoint:
-        *this >> result.longitude;
-        *this >> result.latitude;
+        *this >> geoPointValue.longitude;
+        *this >> geoPointValue.latitude;
         break;
     default:
         break;
     }
 
-    geoPointValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLHelpAppUpdate &helpAppUpdateValue)
 {
-    TLHelpAppUpdate result;
+    helpAppUpdateValue = TLHelpAppUpdate();
 
-    *this >> result.tlType;
+    *this >> helpAppUpdateValue.tlType;
 
-    switch (result.tlType) {
+    switch (helpAppUpdateValue.tlType) {
     case TLValue::HelpAppUpdate:
-        *this >> result.id;
-        *this >> result.critical;
-        *this >> result.url;
-        *this >> result.text;
+        *this >> helpAppUpdateValue.id;
+        *this >> helpAppUpdateValue.critical;
+        *this >> helpAppUpdateValue.url;
+        *this >> helpAppUpdateValue.text;
         break;
     case TLValue::HelpNoAppUpdate:
         break;
@@ -820,334 +835,306 @@ CTelegramStream &CTelegramStream::operator>>(TLHelpAppUpdate &helpAppUpdateValue
         break;
     }
 
-    helpAppUpdateValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLHelpInviteText &helpInviteTextValue)
 {
-    TLHelpInviteText result;
+    helpInviteTextValue = TLHelpInviteText();
 
-    *this >> result.tlType;
+    *this >> helpInviteTextValue.tlType;
 
-    switch (result.tlType) {
+    switch (helpInviteTextValue.tlType) {
     case TLValue::HelpInviteText:
-        *this >> result.message;
+        *this >> helpInviteTextValue.message;
         break;
     default:
         break;
     }
 
-    helpInviteTextValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLImportedContact &importedContactValue)
 {
-    TLImportedContact result;
+    importedContactValue = TLImportedContact();
 
-    *this >> result.tlType;
+    *this >> importedContactValue.tlType;
 
-    switch (result.tlType) {
+    switch (importedContactValue.tlType) {
     case TLValue::ImportedContact:
-        *this >> result.userId;
-        *this >> result.clientId;
+        *this >> importedContactValue.userId;
+        *this >> importedContactValue.clientId;
         break;
     default:
         break;
     }
 
-    importedContactValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputAppEvent &inputAppEventValue)
 {
-    TLInputAppEvent result;
+    inputAppEventValue = TLInputAppEvent();
 
-    *this >> result.tlType;
+    *this >> inputAppEventValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputAppEventValue.tlType) {
     case TLValue::InputAppEvent:
-        *this >> result.time;
-        *this >> result.type;
-        *this >> result.peer;
-        *this >> result.data;
+        *this >> inputAppEventValue.time;
+        *this >> inputAppEventValue.type;
+        *this >> inputAppEventValue.peer;
+        *this >> inputAppEventValue.data;
         break;
     default:
         break;
     }
 
-    inputAppEventValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputAudio &inputAudioValue)
 {
-    TLInputAudio result;
+    inputAudioValue = TLInputAudio();
 
-    *this >> result.tlType;
+    *this >> inputAudioValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputAudioValue.tlType) {
     case TLValue::InputAudioEmpty:
         break;
     case TLValue::InputAudio:
-        *this >> result.id;
-        *this >> result.accessHash;
+        *this >> inputAudioValue.id;
+        *this >> inputAudioValue.accessHash;
         break;
     default:
         break;
     }
 
-    inputAudioValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputContact &inputContactValue)
 {
-    TLInputContact result;
+    inputContactValue = TLInputContact();
 
-    *this >> result.tlType;
+    *this >> inputContactValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputContactValue.tlType) {
     case TLValue::InputPhoneContact:
-        *this >> result.clientId;
-        *this >> result.phone;
-        *this >> result.firstName;
-        *this >> result.lastName;
+        *this >> inputContactValue.clientId;
+        *this >> inputContactValue.phone;
+        *this >> inputContactValue.firstName;
+        *this >> inputContactValue.lastName;
         break;
     default:
         break;
     }
 
-    inputContactValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputDocument &inputDocumentValue)
 {
-    TLInputDocument result;
+    inputDocumentValue = TLInputDocument();
 
-    *this >> result.tlType;
+    *this >> inputDocumentValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputDocumentValue.tlType) {
     case TLValue::InputDocumentEmpty:
         break;
     case TLValue::InputDocument:
-        *this >> result.id;
-        *this >> result.accessHash;
+        *this >> inputDocumentValue.id;
+        *this >> inputDocumentValue.accessHash;
         break;
     default:
         break;
     }
 
-    inputDocumentValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputEncryptedChat &inputEncryptedChatValue)
 {
-    TLInputEncryptedChat result;
+    inputEncryptedChatValue = TLInputEncryptedChat();
 
-    *this >> result.tlType;
+    *this >> inputEncryptedChatValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputEncryptedChatValue.tlType) {
     case TLValue::InputEncryptedChat:
-        *this >> result.chatId;
-        *this >> result.accessHash;
+        *this >> inputEncryptedChatValue.chatId;
+        *this >> inputEncryptedChatValue.accessHash;
         break;
     default:
         break;
     }
 
-    inputEncryptedChatValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputEncryptedFile &inputEncryptedFileValue)
 {
-    TLInputEncryptedFile result;
+    inputEncryptedFileValue = TLInputEncryptedFile();
 
-    *this >> result.tlType;
+    *this >> inputEncryptedFileValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputEncryptedFileValue.tlType) {
     case TLValue::InputEncryptedFileEmpty:
         break;
     case TLValue::InputEncryptedFileUploaded:
-        *this >> result.id;
-        *this >> result.parts;
-        *this >> result.md5Checksum;
-        *this >> result.keyFingerprint;
+        *this >> inputEncryptedFileValue.id;
+        *this >> inputEncryptedFileValue.parts;
+        *this >> inputEncryptedFileValue.md5Checksum;
+        *this >> inputEncryptedFileValue.keyFingerprint;
         break;
     case TLValue::InputEncryptedFile:
-        *this >> result.id;
-        *this >> result.accessHash;
+        *this >> inputEncryptedFileValue.id;
+        *this >> inputEncryptedFileValue.accessHash;
         break;
     case TLValue::InputEncryptedFileBigUploaded:
-        *this >> result.id;
-        *this >> result.parts;
-        *this >> result.keyFingerprint;
+        *this >> inputEncryptedFileValue.id;
+        *this >> inputEncryptedFileValue.parts;
+        *this >> inputEncryptedFileValue.keyFingerprint;
         break;
     default:
         break;
     }
 
-    inputEncryptedFileValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputFile &inputFileValue)
 {
-    TLInputFile result;
+    inputFileValue = TLInputFile();
 
-    *this >> result.tlType;
+    *this >> inputFileValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputFileValue.tlType) {
     case TLValue::InputFile:
-        *this >> result.id;
-        *this >> result.parts;
-        *this >> result.name;
-        *this >> result.md5Checksum;
+        *this >> inputFileValue.id;
+        *this >> inputFileValue.parts;
+        *this >> inputFileValue.name;
+        *this >> inputFileValue.md5Checksum;
         break;
     case TLValue::InputFileBig:
-        *this >> result.id;
-        *this >> result.parts;
-        *this >> result.name;
+        *this >> inputFileValue.id;
+        *this >> inputFileValue.parts;
+        *this >> inputFileValue.name;
         break;
     default:
         break;
     }
 
-    inputFileValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputFileLocation &inputFileLocationValue)
 {
-    TLInputFileLocation result;
+    inputFileLocationValue = TLInputFileLocation();
 
-    *this >> result.tlType;
+    *this >> inputFileLocationValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputFileLocationValue.tlType) {
     case TLValue::InputFileLocation:
-        *this >> result.volumeId;
-        *this >> result.localId;
-        *this >> result.secret;
+        *this >> inputFileLocationValue.volumeId;
+        *this >> inputFileLocationValue.localId;
+        *this >> inputFileLocationValue.secret;
         break;
     case TLValue::InputVideoFileLocation:
-        *this >> result.id;
-        *this >> result.accessHash;
+        *this >> inputFileLocationValue.id;
+        *this >> inputFileLocationValue.accessHash;
         break;
     case TLValue::InputEncryptedFileLocation:
-        *this >> result.id;
-        *this >> result.accessHash;
+        *this >> inputFileLocationValue.id;
+        *this >> inputFileLocationValue.accessHash;
         break;
     case TLValue::InputAudioFileLocation:
-        *this >> result.id;
-        *this >> result.accessHash;
+        *this >> inputFileLocationValue.id;
+        *this >> inputFileLocationValue.accessHash;
         break;
     case TLValue::InputDocumentFileLocation:
-        *this >> result.id;
-        *this >> result.accessHash;
+        *this >> inputFileLocationValue.id;
+        *this >> inputFileLocationValue.accessHash;
         break;
     default:
         break;
     }
 
-    inputFileLocationValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputGeoChat &inputGeoChatValue)
 {
-    TLInputGeoChat result;
+    inputGeoChatValue = TLInputGeoChat();
 
-    *this >> result.tlType;
+    *this >> inputGeoChatValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputGeoChatValue.tlType) {
     case TLValue::InputGeoChat:
-        *this >> result.chatId;
-        *this >> result.accessHash;
+        *this >> inputGeoChatValue.chatId;
+        *this >> inputGeoChatValue.accessHash;
         break;
     default:
         break;
     }
 
-    inputGeoChatValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputGeoPoint &inputGeoPointValue)
 {
-    TLInputGeoPoint result;
+    inputGeoPointValue = TLInputGeoPoint();
 
-    *this >> result.tlType;
+    *this >> inputGeoPointValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputGeoPointValue.tlType) {
     case TLValue::InputGeoPointEmpty:
         break;
     case TLValue::InputGeoPoint:
-        *this >> result.latitude;
-        *this >> result.longitude;
+        *this >> inputGeoPointValue.latitude;
+        *this >> inputGeoPointValue.longitude;
         break;
     default:
         break;
     }
 
-    inputGeoPointValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputPeer &inputPeerValue)
 {
-    TLInputPeer result;
+    inputPeerValue = TLInputPeer();
 
-    *this >> result.tlType;
+    *this >> inputPeerValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputPeerValue.tlType) {
     case TLValue::InputPeerEmpty:
         break;
     case TLValue::InputPeerSelf:
         break;
     case TLValue::InputPeerContact:
-        *this >> result.userId;
+        *this >> inputPeerValue.userId;
         break;
     case TLValue::InputPeerForeign:
-        *this >> result.userId;
-        *this >> result.accessHash;
+        *this >> inputPeerValue.userId;
+        *this >> inputPeerValue.accessHash;
         break;
     case TLValue::InputPeerChat:
-        *this >> result.chatId;
+        *this >> inputPeerValue.chatId;
         break;
     default:
         break;
     }
 
-    inputPeerValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputPeerNotifyEvents &inputPeerNotifyEventsValue)
 {
-    TLInputPeerNotifyEvents result;
+    inputPeerNotifyEventsValue = TLInputPeerNotifyEvents();
 
-    *this >> result.tlType;
+    *this >> inputPeerNotifyEventsValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputPeerNotifyEventsValue.tlType) {
     case TLValue::InputPeerNotifyEventsEmpty:
         break;
     case TLValue::InputPeerNotifyEventsAll:
@@ -1156,243 +1143,221 @@ CTelegramStream &CTelegramStream::operator>>(TLInputPeerNotifyEvents &inputPeerN
         break;
     }
 
-    inputPeerNotifyEventsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputPeerNotifySettings &inputPeerNotifySettingsValue)
 {
-    TLInputPeerNotifySettings result;
+    inputPeerNotifySettingsValue = TLInputPeerNotifySettings();
 
-    *this >> result.tlType;
+    *this >> inputPeerNotifySettingsValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputPeerNotifySettingsValue.tlType) {
     case TLValue::InputPeerNotifySettings:
-        *this >> result.muteUntil;
-        *this >> result.sound;
-        *this >> result.showPreviews;
-        *this >> result.eventsMask;
+        *this >> inputPeerNotifySettingsValue.muteUntil;
+        *this >> inputPeerNotifySettingsValue.sound;
+        *this >> inputPeerNotifySettingsValue.showPreviews;
+        *this >> inputPeerNotifySettingsValue.eventsMask;
         break;
     default:
         break;
     }
 
-    inputPeerNotifySettingsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputPhoto &inputPhotoValue)
 {
-    TLInputPhoto result;
+    inputPhotoValue = TLInputPhoto();
 
-    *this >> result.tlType;
+    *this >> inputPhotoValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputPhotoValue.tlType) {
     case TLValue::InputPhotoEmpty:
         break;
     case TLValue::InputPhoto:
-        *this >> result.id;
-        *this >> result.accessHash;
+        *this >> inputPhotoValue.id;
+        *this >> inputPhotoValue.accessHash;
         break;
     default:
         break;
     }
 
-    inputPhotoValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputPhotoCrop &inputPhotoCropValue)
 {
-    TLInputPhotoCrop result;
+    inputPhotoCropValue = TLInputPhotoCrop();
 
-    *this >> result.tlType;
+    *this >> inputPhotoCropValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputPhotoCropValue.tlType) {
     case TLValue::InputPhotoCropAuto:
         break;
     case TLValue::InputPhotoCrop:
-        *this >> result.cropLeft;
-        *this >> result.cropTop;
-        *this >> result.cropWidth;
+        *this >> inputPhotoCropValue.cropLeft;
+        *this >> inputPhotoCropValue.cropTop;
+        *this >> inputPhotoCropValue.cropWidth;
         break;
     default:
         break;
     }
 
-    inputPhotoCropValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputPrivacyKey &inputPrivacyKeyValue)
 {
-    TLInputPrivacyKey result;
+    inputPrivacyKeyValue = TLInputPrivacyKey();
 
-    *this >> result.tlType;
+    *this >> inputPrivacyKeyValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputPrivacyKeyValue.tlType) {
     case TLValue::InputPrivacyKeyStatusTimestamp:
         break;
     default:
         break;
     }
 
-    inputPrivacyKeyValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputStickerSet &inputStickerSetValue)
 {
-    TLInputStickerSet result;
+    inputStickerSetValue = TLInputStickerSet();
 
-    *this >> result.tlType;
+    *this >> inputStickerSetValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputStickerSetValue.tlType) {
     case TLValue::InputStickerSetEmpty:
         break;
     case TLValue::InputStickerSetID:
-        *this >> result.id;
-        *this >> result.accessHash;
+        *this >> inputStickerSetValue.id;
+        *this >> inputStickerSetValue.accessHash;
         break;
     case TLValue::InputStickerSetShortName:
-        *this >> result.shortName;
+        *this >> inputStickerSetValue.shortName;
         break;
     default:
         break;
     }
 
-    inputStickerSetValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputUser &inputUserValue)
 {
-    TLInputUser result;
+    inputUserValue = TLInputUser();
 
-    *this >> result.tlType;
+    *this >> inputUserValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputUserValue.tlType) {
     case TLValue::InputUserEmpty:
         break;
     case TLValue::InputUserSelf:
         break;
     case TLValue::InputUserContact:
-        *this >> result.userId;
+        *this >> inputUserValue.userId;
         break;
     case TLValue::InputUserForeign:
-        *this >> result.userId;
-        *this >> result.accessHash;
+        *this >> inputUserValue.userId;
+        *this >> inputUserValue.accessHash;
         break;
     default:
         break;
     }
 
-    inputUserValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputVideo &inputVideoValue)
 {
-    TLInputVideo result;
+    inputVideoValue = TLInputVideo();
 
-    *this >> result.tlType;
+    *this >> inputVideoValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputVideoValue.tlType) {
     case TLValue::InputVideoEmpty:
         break;
     case TLValue::InputVideo:
-        *this >> result.id;
-        *this >> result.accessHash;
+        *this >> inputVideoValue.id;
+        *this >> inputVideoValue.accessHash;
         break;
     default:
         break;
     }
 
-    inputVideoValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesAffectedHistory &messagesAffectedHistoryValue)
 {
-    TLMessagesAffectedHistory result;
+    messagesAffectedHistoryValue = TLMessagesAffectedHistory();
 
-    *this >> result.tlType;
+    *this >> messagesAffectedHistoryValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesAffectedHistoryValue.tlType) {
     case TLValue::MessagesAffectedHistory:
-        *this >> result.pts;
-        *this >> result.ptsCount;
-        *this >> result.offset;
+        *this >> messagesAffectedHistoryValue.pts;
+        *this >> messagesAffectedHistoryValue.ptsCount;
+        *this >> messagesAffectedHistoryValue.offset;
         break;
     default:
         break;
     }
 
-    messagesAffectedHistoryValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesAffectedMessages &messagesAffectedMessagesValue)
 {
-    TLMessagesAffectedMessages result;
+    messagesAffectedMessagesValue = TLMessagesAffectedMessages();
 
-    *this >> result.tlType;
+    *this >> messagesAffectedMessagesValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesAffectedMessagesValue.tlType) {
     case TLValue::MessagesAffectedMessages:
-        *this >> result.pts;
-        *this >> result.ptsCount;
+        *this >> messagesAffectedMessagesValue.pts;
+        *this >> messagesAffectedMessagesValue.ptsCount;
         break;
     default:
         break;
     }
 
-    messagesAffectedMessagesValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesDhConfig &messagesDhConfigValue)
 {
-    TLMessagesDhConfig result;
+    messagesDhConfigValue = TLMessagesDhConfig();
 
-    *this >> result.tlType;
+    *this >> messagesDhConfigValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesDhConfigValue.tlType) {
     case TLValue::MessagesDhConfigNotModified:
-        *this >> result.random;
+        *this >> messagesDhConfigValue.random;
         break;
     case TLValue::MessagesDhConfig:
-        *this >> result.g;
-        *this >> result.p;
-        *this >> result.version;
-        *this >> result.random;
+        *this >> messagesDhConfigValue.g;
+        *this >> messagesDhConfigValue.p;
+        *this >> messagesDhConfigValue.version;
+        *this >> messagesDhConfigValue.random;
         break;
     default:
         break;
     }
 
-    messagesDhConfigValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesFilter &messagesFilterValue)
 {
-    TLMessagesFilter result;
+    messagesFilterValue = TLMessagesFilter();
 
-    *this >> result.tlType;
+    *this >> messagesFilterValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesFilterValue.tlType) {
     case TLValue::InputMessagesFilterEmpty:
         break;
     case TLValue::InputMessagesFilterPhotos:
@@ -1411,84 +1376,76 @@ CTelegramStream &CTelegramStream::operator>>(TLMessagesFilter &messagesFilterVal
         break;
     }
 
-    messagesFilterValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesSentEncryptedMessage &messagesSentEncryptedMessageValue)
 {
-    TLMessagesSentEncryptedMessage result;
+    messagesSentEncryptedMessageValue = TLMessagesSentEncryptedMessage();
 
-    *this >> result.tlType;
+    *this >> messagesSentEncryptedMessageValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesSentEncryptedMessageValue.tlType) {
     case TLValue::MessagesSentEncryptedMessage:
-        *this >> result.date;
+        *this >> messagesSentEncryptedMessageValue.date;
         break;
     case TLValue::MessagesSentEncryptedFile:
-        *this >> result.date;
-        *this >> result.file;
+        *this >> messagesSentEncryptedMessageValue.date;
+        *this >> messagesSentEncryptedMessageValue.file;
         break;
     default:
         break;
     }
 
-    messagesSentEncryptedMessageValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLNearestDc &nearestDcValue)
 {
-    TLNearestDc result;
+    nearestDcValue = TLNearestDc();
 
-    *this >> result.tlType;
+    *this >> nearestDcValue.tlType;
 
-    switch (result.tlType) {
+    switch (nearestDcValue.tlType) {
     case TLValue::NearestDc:
-        *this >> result.country;
-        *this >> result.thisDc;
-        *this >> result.nearestDc;
+        readInterned(nearestDcValue.country);
+        *this >> nearestDcValue.thisDc;
+        *this >> nearestDcValue.nearestDc;
         break;
     default:
         break;
     }
 
-    nearestDcValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLPeer &peerValue)
 {
-    TLPeer result;
+    peerValue = TLPeer();
 
-    *this >> result.tlType;
+    *this >> peerValue.tlType;
 
-    switch (result.tlType) {
+    switch (peerValue.tlType) {
     case TLValue::PeerUser:
-        *this >> result.userId;
+        *this >> peerValue.userId;
         break;
     case TLValue::PeerChat:
-        *this >> result.chatId;
+        *this >> peerValue.chatId;
         break;
     default:
         break;
     }
 
-    peerValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLPeerNotifyEvents &peerNotifyEventsValue)
 {
-    TLPeerNotifyEvents result;
+    peerNotifyEventsValue = TLPeerNotifyEvents();
 
-    *this >> result.tlType;
+    *this >> peerNotifyEventsValue.tlType;
 
-    switch (result.tlType) {
+    switch (peerNotifyEventsValue.tlType) {
     case TLValue::PeerNotifyEventsEmpty:
         break;
     case TLValue::PeerNotifyEventsAll:
@@ -1497,143 +1454,131 @@ CTelegramStream &CTelegramStream::operator>>(TLPeerNotifyEvents &peerNotifyEvent
         break;
     }
 
-    peerNotifyEventsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLPeerNotifySettings &peerNotifySettingsValue)
 {
-    TLPeerNotifySettings result;
+    peerNotifySettingsValue = TLPeerNotifySettings();
 
-    *this >> result.tlType;
+    *this >> peerNotifySettingsValue.tlType;
 
-    switch (result.tlType) {
+    switch (peerNotifySettingsValue.tlType) {
     case TLValue::PeerNotifySettingsEmpty:
         break;
     case TLValue::PeerNotifySettings:
-        *this >> result.muteUntil;
-        *this >> result.sound;
-        *this >> result.showPreviews;
-        *this >> result.eventsMask;
+        *this >> peerNotifySettingsValue.muteUntil;
+        *this >> peerNotifySettingsValue.sound;
+        *this >> peerNotifySettingsValue.showPreviews;
+        *this >> peerNotifySettingsValue.eventsMask;
         break;
     default:
         break;
     }
 
-    peerNotifySettingsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLPhotoSize &photoSizeValue)
 {
-    TLPhotoSize result;
+    photoSizeValue = TLPhotoSize();
 
-    *this >> result.tlType;
+    *this >> photoSizeValue.tlType;
 
-    switch (result.tlType) {
+    switch (photoSizeValue.tlType) {
     case TLValue::PhotoSizeEmpty:
-        *this >> result.type;
+        *this >> photoSizeValue.type;
         break;
     case TLValue::PhotoSize:
-        *this >> result.type;
-        *this >> result.location;
-        *this >> result.w;
-        *this >> result.h;
-        *this >> result.size;
+        *this >> photoSizeValue.type;
+        *this >> photoSizeValue.location;
+        *this >> photoSizeValue.w;
+        *this >> photoSizeValue.h;
+        *this >> photoSizeValue.size;
         break;
     case TLValue::PhotoCachedSize:
-        *this >> result.type;
-        *this >> result.location;
-        *this >> result.w;
-        *this >> result.h;
-        *this >> result.bytes;
+        *this >> photoSizeValue.type;
+        *this >> photoSizeValue.location;
+        *this >> photoSizeValue.w;
+        *this >> photoSizeValue.h;
+        *this >> photoSizeValue.bytes;
         break;
     default:
         break;
     }
 
-    photoSizeValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLPrivacyKey &privacyKeyValue)
 {
-    TLPrivacyKey result;
+    privacyKeyValue = TLPrivacyKey();
 
-    *this >> result.tlType;
+    *this >> privacyKeyValue.tlType;
 
-    switch (result.tlType) {
+    switch (privacyKeyValue.tlType) {
     case TLValue::PrivacyKeyStatusTimestamp:
         break;
     default:
         break;
     }
 
-    privacyKeyValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLPrivacyRule &privacyRuleValue)
 {
-    TLPrivacyRule result;
+    privacyRuleValue = TLPrivacyRule();
 
-    *this >> result.tlType;
+    *this >> privacyRuleValue.tlType;
 
-    switch (result.tlType) {
+    switch (privacyRuleValue.tlType) {
     case TLValue::PrivacyValueAllowContacts:
         break;
     case TLValue::PrivacyValueAllowAll:
         break;
     case TLValue::PrivacyValueAllowUsers:
-        *this >> result.users;
+        *this >> privacyRuleValue.users;
         break;
     case TLValue::PrivacyValueDisallowContacts:
         break;
     case TLValue::PrivacyValueDisallowAll:
         break;
     case TLValue::PrivacyValueDisallowUsers:
-        *this >> result.users;
+        *this >> privacyRuleValue.users;
         break;
     default:
         break;
     }
 
-    privacyRuleValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLReceivedNotifyMessage &receivedNotifyMessageValue)
 {
-    TLReceivedNotifyMessage result;
+    receivedNotifyMessageValue = TLReceivedNotifyMessage();
 
-    *this >> result.tlType;
+    *this >> receivedNotifyMessageValue.tlType;
 
-    switch (result.tlType) {
+    switch (receivedNotifyMessageValue.tlType) {
     case TLValue::ReceivedNotifyMessage:
-        *this >> result.id;
-        *this >> result.flags;
+        *this >> receivedNotifyMessageValue.id;
+        *this >> receivedNotifyMessageValue.flags;
         break;
     default:
         break;
     }
 
-    receivedNotifyMessageValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLSendMessageAction &sendMessageActionValue)
 {
-    TLSendMessageAction result;
+    sendMessageActionValue = TLSendMessageAction();
 
-    *this >> result.tlType;
+    *this >> sendMessageActionValue.tlType;
 
-    switch (result.tlType) {
+    switch (sendMessageActionValue.tlType) {
     case TLValue::SendMessageTypingAction:
         break;
     case TLValue::SendMessageCancelAction:
@@ -1641,18 +1586,18 @@ CTelegramStream &CTelegramStream::operator>>(TLSendMessageAction &sendMessageAct
     case TLValue::SendMessageRecordVideoAction:
         break;
     case TLValue::SendMessageUploadVideoAction:
-        *this >> result.progress;
+        *this >> sendMessageActionValue.progress;
         break;
     case TLValue::SendMessageRecordAudioAction:
         break;
     case TLValue::SendMessageUploadAudioAction:
-        *this >> result.progress;
+        *this >> sendMessageActionValue.progress;
         break;
     case TLValue::SendMessageUploadPhotoAction:
-        *this >> result.progress;
+        *this >> sendMessageActionValue.progress;
         break;
     case TLValue::SendMessageUploadDocumentAction:
-        *this >> result.progress;
+        *this >> sendMessageActionValue.progress;
         break;
     case TLValue::SendMessageGeoLocationAction:
         break;
@@ -1662,60 +1607,54 @@ CTelegramStream &CTelegramStream::operator>>(TLSendMessageAction &sendMessageAct
         break;
     }
 
-    sendMessageActionValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLStickerPack &stickerPackValue)
 {
-    TLStickerPack result;
+    stickerPackValue = TLStickerPack();
 
-    *this >> result.tlType;
+    *this >> stickerPackValue.tlType;
 
-    switch (result.tlType) {
+    switch (stickerPackValue.tlType) {
     case TLValue::StickerPack:
-        *this >> result.emoticon;
-        *this >> result.documents;
+        readInterned(stickerPackValue.emoticon);
+        *this >> stickerPackValue.documents;
         break;
     default:
         break;
     }
 
-    stickerPackValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLStickerSet &stickerSetValue)
 {
-    TLStickerSet result;
+    stickerSetValue = TLStickerSet();
 
-    *this >> result.tlType;
+    *this >> stickerSetValue.tlType;
 
-    switch (result.tlType) {
+    switch (stickerSetValue.tlType) {
     case TLValue::StickerSet:
-        *this >> result.id;
-        *this >> result.accessHash;
-        *this >> result.title;
-        *this >> result.shortName;
+        *this >> stickerSetValue.id;
+        *this >> stickerSetValue.accessHash;
+        *this >> stickerSetValue.title;
+        *this >> stickerSetValue.shortName;
         break;
     default:
         break;
     }
 
-    stickerSetValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLStorageFileType &storageFileTypeValue)
 {
-    TLStorageFileType result;
+    storageFileTypeValue = TLStorageFileType();
 
-    *this >> result.tlType;
+    *this >> storageFileTypeValue.tlType;
 
-    switch (result.tlType) {
+    switch (storageFileTypeValue.tlType) {
     case TLValue::StorageFileUnknown:
         break;
     case TLValue::StorageFileJpeg:
@@ -1740,92 +1679,84 @@ CTelegramStream &CTelegramStream::operator>>(TLStorageFileType &storageFileTypeV
         break;
     }
 
-    storageFileTypeValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLUpdatesState &updatesStateValue)
 {
-    TLUpdatesState result;
+    updatesStateValue = TLUpdatesState();
 
-    *this >> result.tlType;
+    *this >> updatesStateValue.tlType;
 
-    switch (result.tlType) {
+    switch (updatesStateValue.tlType) {
     case TLValue::UpdatesState:
-        *this >> result.pts;
-        *this >> result.qts;
-        *this >> result.date;
-        *this >> result.seq;
-        *this >> result.unreadCount;
+        *this >> updatesStateValue.pts;
+        *this >> updatesStateValue.qts;
+        *this >> updatesStateValue.date;
+        *this >> updatesStateValue.seq;
+        *this >> updatesStateValue.unreadCount;
         break;
     default:
         break;
     }
 
-    updatesStateValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLUploadFile &uploadFileValue)
 {
-    TLUploadFile result;
+    uploadFileValue = TLUploadFile();
 
-    *this >> result.tlType;
+    *this >> uploadFileValue.tlType;
 
-    switch (result.tlType) {
+    switch (uploadFileValue.tlType) {
     case TLValue::UploadFile:
-        *this >> result.type;
-        *this >> result.mtime;
-        *this >> result.bytes;
+        *this >> uploadFileValue.type;
+        *this >> uploadFileValue.mtime;
+        *this >> uploadFileValue.bytes;
         break;
     default:
         break;
     }
 
-    uploadFileValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLUserProfilePhoto &userProfilePhotoValue)
 {
-    TLUserProfilePhoto result;
+    userProfilePhotoValue = TLUserProfilePhoto();
 
-    *this >> result.tlType;
+    *this >> userProfilePhotoValue.tlType;
 
-    switch (result.tlType) {
+    switch (userProfilePhotoValue.tlType) {
     case TLValue::UserProfilePhotoEmpty:
         break;
     case TLValue::UserProfilePhoto:
-        *this >> result.photoId;
-        *this >> result.photoSmall;
-        *this >> result.photoBig;
+        *this >> userProfilePhotoValue.photoId;
+        *this >> userProfilePhotoValue.photoSmall;
+        *this >> userProfilePhotoValue.photoBig;
         break;
     default:
         break;
     }
 
-    userProfilePhotoValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLUserStatus &userStatusValue)
 {
-    TLUserStatus result;
+    userStatusValue = TLUserStatus();
 
-    *this >> result.tlType;
+    *this >> userStatusValue.tlType;
 
-    switch (result.tlType) {
+    switch (userStatusValue.tlType) {
     case TLValue::UserStatusEmpty:
         break;
     case TLValue::UserStatusOnline:
-        *this >> result.expires;
+        *this >> userStatusValue.expires;
         break;
     case TLValue::UserStatusOffline:
-        *this >> result.wasOnline;
+        *this >> userStatusValue.wasOnline;
         break;
     case TLValue::UserStatusRecently:
         break;
@@ -1837,344 +1768,322 @@ CTelegramStream &CTelegramStream::operator>>(TLUserStatus &userStatusValue)
         break;
     }
 
-    userStatusValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLVideo &videoValue)
 {
-    TLVideo result;
+    videoValue = TLVideo();
 
-    *this >> result.tlType;
+    *this >> videoValue.tlType;
 
-    switch (result.tlType) {
+    switch (videoValue.tlType) {
     case TLValue::VideoEmpty:
-        *this >> result.id;
+        *this >> videoValue.id;
         break;
     case TLValue::Video:
-        *this >> result.id;
-        *this >> result.accessHash;
-        *this >> result.userId;
-        *this >> result.date;
-        *this >> result.duration;
-        *this >> result.size;
-        *this >> result.thumb;
-        *this >> result.dcId;
-        *this >> result.w;
-        *this >> result.h;
+        *this >> videoValue.id;
+        *this >> videoValue.accessHash;
+        *this >> videoValue.userId;
+        *this >> videoValue.date;
+        *this >> videoValue.duration;
+        *this >> videoValue.size;
+        *this >> videoValue.thumb;
+        *this >> videoValue.dcId;
+        *this >> videoValue.w;
+        *this >> videoValue.h;
         break;
     default:
         break;
     }
 
-    videoValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLWallPaper &wallPaperValue)
 {
-    TLWallPaper result;
+    wallPaperValue = TLWallPaper();
 
-    *this >> result.tlType;
+    *this >> wallPaperValue.tlType;
 
-    switch (result.tlType) {
+    switch (wallPaperValue.tlType) {
     case TLValue::WallPaper:
-        *this >> result.id;
-        *this >> result.title;
-        *this >> result.sizes;
-        *this >> result.color;
+        *this >> wallPaperValue.id;
+        *this >> wallPaperValue.title;
+        *this >> wallPaperValue.sizes;
+        *this >> wallPaperValue.color;
         break;
     case TLValue::WallPaperSolid:
-        *this >> result.id;
-        *this >> result.title;
-        *this >> result.bgColor;
-        *this >> result.color;
+        *this >> wallPaperValue.id;
+        *this >> wallPaperValue.title;
+        *this >> wallPaperValue.bgColor;
+        *this >> wallPaperValue.color;
         break;
     default:
         break;
     }
 
-    wallPaperValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAccountAuthorizations &accountAuthorizationsValue)
 {
-    TLAccountAuthorizations result;
+    accountAuthorizationsValue = TLAccountAuthorizations();
 
-    *this >> result.tlType;
+    *this >> accountAuthorizationsValue.tlType;
 
-    switch (result.tlType) {
+    switch (accountAuthorizationsValue.tlType) {
     case TLValue::AccountAuthorizations:
-        *this >> result.authorizations;
+        *this >> accountAuthorizationsValue.authorizations;
         break;
     default:
         break;
     }
 
-    accountAuthorizationsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLChatPhoto &chatPhotoValue)
 {
-    TLChatPhoto result;
+    chatPhotoValue = TLChatPhoto();
 
-    *this >> result.tlType;
+    *this >> chatPhotoValue.tlType;
 
-    switch (result.tlType) {
+    switch (chatPhotoValue.tlType) {
     case TLValue::ChatPhotoEmpty:
         break;
     case TLValue::ChatPhoto:
-        *this >> result.photoSmall;
-        *this >> result.photoBig;
+        *this >> chatPhotoValue.photoSmall;
+        *this >> chatPhotoValue.photoBig;
         break;
     default:
         break;
     }
 
-    chatPhotoValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLConfig &configValue)
 {
-    TLConfig result;
+    configValue = TLConfig();
 
-    *this >> result.tlType;
+    *this >> configValue.tlType;
 
-    switch (result.tlType) {
+    switch (configValue.tlType) {
     case TLValue::Config:
-        *this >> result.date;
-        *this >> result.expires;
-        *this >> result.testMode;
-        *this >> result.thisDc;
-        *this >> result.dcOptions;
-        *this >> result.chatSizeMax;
-        *this >> result.broadcastSizeMax;
-        *this >> result.forwardedCountMax;
-        *this >> result.onlineUpdatePeriodMs;
-        *this >> result.offlineBlurTimeoutMs;
-        *this >> result.offlineIdleTimeoutMs;
-        *this >> result.onlineCloudTimeoutMs;
-        *this >> result.notifyCloudDelayMs;
-        *this >> result.notifyDefaultDelayMs;
-        *this >> result.chatBigSize;
-        *this >> result.pushChatPeriodMs;
-        *this >> result.pushChatLimit;
-        *this >> result.disabledFeatures;
+        *this >> configValue.date;
+        *this >> configValue.expires;
+        *this >> configValue.testMode;
+        *this >> configValue.thisDc;
+        *this >> configValue.dcOptions;
+        *this >> configValue.chatSizeMax;
+        *this >> configValue.broadcastSizeMax;
+        *this >> configValue.forwardedCountMax;
+        *this >> configValue.onlineUpdatePeriodMs;
+        *this >> configValue.offlineBlurTimeoutMs;
+        *this >> configValue.offlineIdleTimeoutMs;
+        *this >> configValue.onlineCloudTimeoutMs;
+        *this >> configValue.notifyCloudDelayMs;
+        *this >> configValue.notifyDefaultDelayMs;
+        *this >> configValue.chatBigSize;
+        *this >> configValue.pushChatPeriodMs;
+        *this >> configValue.pushChatLimit;
+        *this >> configValue.disabledFeatures;
         break;
     default:
         break;
     }
 
-    configValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContactStatus &contactStatusValue)
 {
-    TLContactStatus result;
+    contactStatusValue = TLContactStatus();
 
-    *this >> result.tlType;
+    *this >> contactStatusValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactStatusValue.tlType) {
     case TLValue::ContactStatus:
-        *this >> result.userId;
-        *this >> result.status;
+        *this >> contactStatusValue.userId;
+        *this >> contactStatusValue.status;
         break;
     default:
         break;
     }
 
-    contactStatusValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLDialog &dialogValue)
 {
-    TLDialog result;
+    dialogValue = TLDialog();
 
-    *this >> result.tlType;
+    *this >> dialogValue.tlType;
 
-    switch (result.tlType) {
+    switch (dialogValue.tlType) {
     case TLValue::Dialog:
-        *this >> result.peer;
-        *this >> result.topMessage;
-        *this >> result.readInboxMaxId;
-        *this >> result.unreadCount;
-        *this >> result.notifySettings;
+        *this >> dialogValue.peer;
+        *this >> dialogValue.topMessage;
+        *this >> dialogValue.readInboxMaxId;
+        *this >> dialogValue.unreadCount;
+        *this >> dialogValue.notifySettings;
         break;
     default:
         break;
     }
 
-    dialogValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLDocumentAttribute &documentAttributeValue)
 {
-    TLDocumentAttribute result;
+    documentAttributeValue = TLDocumentAttribute();
 
-    *this >> result.tlType;
+    *this >> documentAttributeValue.tlType;
 
-    switch (result.tlType) {
+    switch (documentAttributeValue.tlType) {
     case TLValue::DocumentAttributeImageSize:
-        *this >> result.w;
-        *this >> result.h;
+        *this >> documentAttributeValue.w;
+        *this >> documentAttributeValue.h;
         break;
     case TLValue::DocumentAttributeAnimated:
         break;
     case TLValue::DocumentAttributeSticker:
-        *this >> result.alt;
-        *this >> result.stickerset;
+        readInterned(documentAttributeValue.alt);
+        *this >> documentAttributeValue.stickerset;
         break;
     case TLValue::DocumentAttributeVideo:
-        *this >> result.duration;
-        *this >> result.w;
-        *this >> result.h;
+        *this >> documentAttributeValue.duration;
+        *this >> documentAttributeValue.w;
+        *this >> documentAttributeValue.h;
         break;
     case TLValue::DocumentAttributeAudio:
-        *this >> result.duration;
+        *this >> documentAttributeValue.duration;
         break;
     case TLValue::DocumentAttributeFilename:
-        *this >> result.fileName;
+        *this >> documentAttributeValue.fileName;
         break;
     default:
         break;
     }
 
-    documentAttributeValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputChatPhoto &inputChatPhotoValue)
 {
-    TLInputChatPhoto result;
+    inputChatPhotoValue = TLInputChatPhoto();
 
-    *this >> result.tlType;
+    *this >> inputChatPhotoValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputChatPhotoValue.tlType) {
     case TLValue::InputChatPhotoEmpty:
         break;
     case TLValue::InputChatUploadedPhoto:
-        *this >> result.file;
-        *this >> result.crop;
+        *this >> inputChatPhotoValue.file;
+        *this >> inputChatPhotoValue.crop;
         break;
     case TLValue::InputChatPhoto:
-        *this >> result.id;
-        *this >> result.crop;
+        *this >> inputChatPhotoValue.id;
+        *this >> inputChatPhotoValue.crop;
         break;
     default:
         break;
     }
 
-    inputChatPhotoValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputMedia &inputMediaValue)
 {
-    TLInputMedia result;
+    inputMediaValue = TLInputMedia();
 
-    *this >> result.tlType;
+    *this >> inputMediaValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputMediaValue.tlType) {
     case TLValue::InputMediaEmpty:
         break;
     case TLValue::InputMediaUploadedPhoto:
-        *this >> result.file;
-        *this >> result.caption;
+        *this >> inputMediaValue.file;
+        *this >> inputMediaValue.caption;
         break;
     case TLValue::InputMediaPhoto:
-        *this >> result.idInputPhoto;
-        *this >> result.caption;
+        *this >> inputMediaValue.idInputPhoto;
+        *this >> inputMediaValue.caption;
         break;
     case TLValue::InputMediaGeoPoint:
-        *this >> result.geoPoint;
+        *this >> inputMediaValue.geoPoint;
         break;
     case TLValue::InputMediaContact:
-        *this >> result.phoneNumber;
-        *this >> result.firstName;
-        *this >> result.lastName;
+        *this >> inputMediaValue.phoneNumber;
+        *this >> inputMediaValue.firstName;
+        *this >> inputMediaValue.lastName;
         break;
     case TLValue::InputMediaUploadedVideo:
-        *this >> result.file;
-        *this >> result.duration;
-        *this >> result.w;
-        *this >> result.h;
-        *this >> result.caption;
+        *this >> inputMediaValue.file;
+        *this >> inputMediaValue.duration;
+        *this >> inputMediaValue.w;
+        *this >> inputMediaValue.h;
+        *this >> inputMediaValue.caption;
         break;
     case TLValue::InputMediaUploadedThumbVideo:
-        *this >> result.file;
-        *this >> result.thumb;
-        *this >> result.duration;
-        *this >> result.w;
-        *this >> result.h;
-        *this >> result.caption;
+        *this >> inputMediaValue.file;
+        *this >> inputMediaValue.thumb;
+        *this >> inputMediaValue.duration;
+        *this >> inputMediaValue.w;
+        *this >> inputMediaValue.h;
+        *this >> inputMediaValue.caption;
         break;
     case TLValue::InputMediaVideo:
-        *this >> result.idInputVeo;
-        *this >> result.caption;
+        *this >> inputMediaValue.idInputVeo;
+        *this >> inputMediaValue.caption;
         break;
     case TLValue::InputMediaUploadedAudio:
-        *this >> result.file;
-        *this >> result.duration;
-        *this >> result.mimeType;
+        *this >> inputMediaValue.file;
+        *this >> inputMediaValue.duration;
+        readInterned(inputMediaValue.mimeType);
         break;
     case TLValue::InputMediaAudio:
-        *this >> result.idInputAudio;
+        *this >> inputMediaValue.idInputAudio;
         break;
     case TLValue::InputMediaUploadedDocument:
-        *this >> result.file;
-        *this >> result.mimeType;
-        *this >> result.attributes;
+        *this >> inputMediaValue.file;
+        readInterned(inputMediaValue.mimeType);
+        *this >> inputMediaValue.attributes;
         break;
     case TLValue::InputMediaUploadedThumbDocument:
-        *this >> result.file;
-        *this >> result.thumb;
-        *this >> result.mimeType;
-        *this >> result.attributes;
+        *this >> inputMediaValue.file;
+        *this >> inputMediaValue.thumb;
+        readInterned(inputMediaValue.mimeType);
+        *this >> inputMediaValue.attributes;
         break;
     case TLValue::InputMediaDocument:
-        *this >> result.idInputDocument;
+        *this >> inputMediaValue.idInputDocument;
         break;
     case TLValue::InputMediaVenue:
-        *this >> result.geoPoint;
-        *this >> result.title;
-        *this >> result.address;
-        *this >> result.provider;
-        *this >> result.venueId;
+        *this >> inputMediaValue.geoPoint;
+        *this >> inputMediaValue.title;
+        *this >> inputMediaValue.address;
+        readInterned(inputMediaValue.provider);
+        *this >> inputMediaValue.venueId;
         break;
     default:
         break;
     }
 
-    inputMediaValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputNotifyPeer &inputNotifyPeerValue)
 {
-    TLInputNotifyPeer result;
+    inputNotifyPeerValue = TLInputNotifyPeer();
 
-    *this >> result.tlType;
+    *this >> inputNotifyPeerValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputNotifyPeerValue.tlType) {
     case TLValue::InputNotifyPeer:
-        *this >> result.peerInput;
+        *this >> inputNotifyPeerValue.peerInput;
         break;
     case TLValue::InputNotifyUsers:
         break;
@@ -2183,56 +2092,52 @@ CTelegramStream &CTelegramStream::operator>>(TLInputNotifyPeer &inputNotifyPeerV
     case TLValue::InputNotifyAll:
         break;
     case TLValue::InputNotifyGeoChatPeer:
-        *this >> result.peerInputGeoChat;
+        *this >> inputNotifyPeerValue.peerInputGeoChat;
         break;
     default:
         break;
     }
 
-    inputNotifyPeerValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLInputPrivacyRule &inputPrivacyRuleValue)
 {
-    TLInputPrivacyRule result;
+    inputPrivacyRuleValue = TLInputPrivacyRule();
 
-    *this >> result.tlType;
+    *this >> inputPrivacyRuleValue.tlType;
 
-    switch (result.tlType) {
+    switch (inputPrivacyRuleValue.tlType) {
     case TLValue::InputPrivacyValueAllowContacts:
         break;
     case TLValue::InputPrivacyValueAllowAll:
         break;
     case TLValue::InputPrivacyValueAllowUsers:
-        *this >> result.users;
+        *this >> inputPrivacyRuleValue.users;
         break;
     case TLValue::InputPrivacyValueDisallowContacts:
         break;
     case TLValue::InputPrivacyValueDisallowAll:
         break;
     case TLValue::InputPrivacyValueDisallowUsers:
-        *this >> result.users;
+        *this >> inputPrivacyRuleValue.users;
         break;
     default:
         break;
     }
 
-    inputPrivacyRuleValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLNotifyPeer &notifyPeerValue)
 {
-    TLNotifyPeer result;
+    notifyPeerValue = TLNotifyPeer();
 
-    *this >> result.tlType;
+    *this >> notifyPeerValue.tlType;
 
-    switch (result.tlType) {
+    switch (notifyPeerValue.tlType) {
     case TLValue::NotifyPeer:
-        *this >> result.peer;
+        *this >> notifyPeerValue.peer;
         break;
     case TLValue::NotifyUsers:
         break;
@@ -2244,1304 +2149,1236 @@ CTelegramStream &CTelegramStream::operator>>(TLNotifyPeer &notifyPeerValue)
         break;
     }
 
-    notifyPeerValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLPhoto &photoValue)
 {
-    TLPhoto result;
+    photoValue = TLPhoto();
 
-    *this >> result.tlType;
+    *this >> photoValue.tlType;
 
-    switch (result.tlType) {
+    switch (photoValue.tlType) {
     case TLValue::PhotoEmpty:
-        *this >> result.id;
+        *this >> photoValue.id;
         break;
     case TLValue::Photo:
-        *this >> result.id;
-        *this >> result.accessHash;
-        *this >> result.userId;
-        *this >> result.date;
-        *this >> result.geo;
-        *this >> result.sizes;
+        *this >> photoValue.id;
+        *this >> photoValue.accessHash;
+        *this >> photoValue.userId;
+        *this >> photoValue.date;
+        *this >> photoValue.geo;
+        *this >> photoValue.sizes;
         break;
     default:
         break;
     }
 
-    photoValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLUser &userValue)
 {
-    TLUser result;
+    userValue = TLUser();
 
-    *this >> result.tlType;
+    *this >> userValue.tlType;
 
-    switch (result.tlType) {
+    switch (userValue.tlType) {
     case TLValue::UserEmpty:
-        *this >> result.id;
+        *this >> userValue.id;
         break;
     case TLValue::UserSelf:
-        *this >> result.id;
-        *this >> result.firstName;
-        *this >> result.lastName;
-        *this >> result.username;
-        *this >> result.phone;
-        *this >> result.photo;
-        *this >> result.status;
+        *this >> userValue.id;
+        *this >> userValue.firstName;
+        *this >> userValue.lastName;
+        *this >> userValue.username;
+        *this >> userValue.phone;
+        *this >> userValue.photo;
+        *this >> userValue.status;
         break;
     case TLValue::UserContact:
-        *this >> result.id;
-        *this >> result.firstName;
-        *this >> result.lastName;
-        *this >> result.username;
-        *this >> result.accessHash;
-        *this >> result.phone;
-        *this >> result.photo;
-        *this >> result.status;
+        *this >> userValue.id;
+        *this >> userValue.firstName;
+        *this >> userValue.lastName;
+        *this >> userValue.username;
+        *this >> userValue.accessHash;
+        *this >> userValue.phone;
+        *this >> userValue.photo;
+        *this >> userValue.status;
         break;
     case TLValue::UserRequest:
-        *this >> result.id;
-        *this >> result.firstName;
-        *this >> result.lastName;
-        *this >> result.username;
-        *this >> result.accessHash;
-        *this >> result.phone;
-        *this >> result.photo;
-        *this >> result.status;
+        *this >> userValue.id;
+        *this >> userValue.firstName;
+        *this >> userValue.lastName;
+        *this >> userValue.username;
+        *this >> userValue.accessHash;
+        *this >> userValue.phone;
+        *this >> userValue.photo;
+        *this >> userValue.status;
         break;
     case TLValue::UserForeign:
-        *this >> result.id;
-        *this >> result.firstName;
-        *this >> result.lastName;
-        *this >> result.username;
-        *this >> result.accessHash;
-        *this >> result.photo;
-        *this >> result.status;
+        *this >> userValue.id;
+        *this >> userValue.firstName;
+        *this >> userValue.lastName;
+        *this >> userValue.username;
+        *this >> userValue.accessHash;
+        *this >> userValue.photo;
+        *this >> userValue.status;
         break;
     case TLValue::UserDeleted:
-        *this >> result.id;
-        *this >> result.firstName;
-        *this >> result.lastName;
-        *this >> result.username;
+        *this >> userValue.id;
+        *this >> userValue.firstName;
+        *this >> userValue.lastName;
+        *this >> userValue.username;
         break;
     default:
         break;
     }
 
-    userValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLWebPage &webPageValue)
 {
-    TLWebPage result;
+    webPageValue = TLWebPage();
 
-    *this >> result.tlType;
+    *this >> webPageValue.tlType;
 
-    switch (result.tlType) {
+    switch (webPageValue.tlType) {
     case TLValue::WebPageEmpty:
-        *this >> result.id;
+        *this >> webPageValue.id;
         break;
     case TLValue::WebPagePending:
-        *this >> result.id;
-        *this >> result.date;
+        *this >> webPageValue.id;
+        *this >> webPageValue.date;
         break;
     case TLValue::WebPage:
-        *this >> result.flags;
-        *this >> result.id;
-        *this >> result.url;
-        *this >> result.displayUrl;
-        if (result.flags & 1 << 0) {
-            *this >> result.type;
+        *this >> webPageValue.flags;
+        *this >> webPageValue.id;
+        *this >> webPageValue.url;
+        *this >> webPageValue.displayUrl;
+        if (webPageValue.flags & 1 << 0) {
+            *this >> webPageValue.type;
         }
-        if (result.flags & 1 << 1) {
-            *this >> result.siteName;
+        if (webPageValue.flags & 1 << 1) {
+            readInterned(webPageValue.siteName);
         }
-        if (result.flags & 1 << 2) {
-            *this >> result.title;
+        if (webPageValue.flags & 1 << 2) {
+            *this >> webPageValue.title;
         }
-        if (result.flags & 1 << 3) {
-            *this >> result.description;
+        if (webPageValue.flags & 1 << 3) {
+            *this >> webPageValue.description;
         }
-        if (result.flags & 1 << 4) {
-            *this >> result.photo;
+        if (webPageValue.flags & 1 << 4) {
+            *this >> webPageValue.photo;
         }
-        if (result.flags & 1 << 5) {
-            *this >> result.embedUrl;
+        if (webPageValue.flags & 1 << 5) {
+            *this >> webPageValue.embedUrl;
         }
-        if (result.flags & 1 << 5) {
-            *this >> result.embedType;
+        if (webPageValue.flags & 1 << 5) {
+            readInterned(webPageValue.embedType);
         }
-        if (result.flags & 1 << 6) {
-            *this >> result.embedWidth;
+        if (webPageValue.flags & 1 << 6) {
+            *this >> webPageValue.embedWidth;
         }
-        if (result.flags & 1 << 6) {
-            *this >> result.embedHeight;
+        if (webPageValue.flags & 1 << 6) {
+            *this >> webPageValue.embedHeight;
         }
-        if (result.flags & 1 << 7) {
-            *this >> result.duration;
+        if (webPageValue.flags & 1 << 7) {
+            *this >> webPageValue.duration;
         }
-        if (result.flags & 1 << 8) {
-            *this >> result.author;
+        if (webPageValue.flags & 1 << 8) {
+            *this >> webPageValue.author;
         }
         break;
     default:
         break;
     }
 
-    webPageValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAccountPrivacyRules &accountPrivacyRulesValue)
 {
-    TLAccountPrivacyRules result;
+    accountPrivacyRulesValue = TLAccountPrivacyRules();
 
-    *this >> result.tlType;
+    *this >> accountPrivacyRulesValue.tlType;
 
-    switch (result.tlType) {
+    switch (accountPrivacyRulesValue.tlType) {
     case TLValue::AccountPrivacyRules:
-        *this >> result.rules;
-        *this >> result.users;
+        *this >> accountPrivacyRulesValue.rules;
+        *this >> accountPrivacyRulesValue.users;
         break;
     default:
         break;
     }
 
-    accountPrivacyRulesValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLAuthAuthorization &authAuthorizationValue)
 {
-    TLAuthAuthorization result;
+    authAuthorizationValue = TLAuthAuthorization();
 
-    *this >> result.tlType;
+    *this >> authAuthorizationValue.tlType;
 
-    switch (result.tlType) {
+    switch (authAuthorizationValue.tlType) {
     case TLValue::AuthAuthorization:
-        *this >> result.expires;
-        *this >> result.user;
+        *this >> authAuthorizationValue.expires;
+        *this >> authAuthorizationValue.user;
         break;
     default:
         break;
     }
 
-    authAuthorizationValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLChat &chatValue)
 {
-    TLChat result;
+    chatValue = TLChat();
 
-    *this >> result.tlType;
+    *this >> chatValue.tlType;
 
-    switch (result.tlType) {
+    switch (chatValue.tlType) {
     case TLValue::ChatEmpty:
-        *this >> result.id;
+        *this >> chatValue.id;
         break;
     case TLValue::Chat:
-        *this >> result.id;
-        *this >> result.title;
-        *this >> result.photo;
-        *this >> result.participantsCount;
-        *this >> result.date;
-        *this >> result.left;
-        *this >> result.version;
+        *this >> chatValue.id;
+        *this >> chatValue.title;
+        *this >> chatValue.photo;
+        *this >> chatValue.participantsCount;
+        *this >> chatValue.date;
+        *this >> chatValue.left;
+        *this >> chatValue.version;
         break;
     case TLValue::ChatForbidden:
-        *this >> result.id;
-        *this >> result.title;
-        *this >> result.date;
+        *this >> chatValue.id;
+        *this >> chatValue.title;
+        *this >> chatValue.date;
         break;
     case TLValue::GeoChat:
-        *this >> result.id;
-        *this >> result.accessHash;
-        *this >> result.title;
-        *this >> result.address;
-        *this >> result.venue;
-        *this >> result.geo;
-        *this >> result.photo;
-        *this >> result.participantsCount;
-        *this >> result.date;
-        *this >> result.checkedIn;
-        *this >> result.version;
+        *this >> chatValue.id;
+        *this >> chatValue.accessHash;
+        *this >> chatValue.title;
+        *this >> chatValue.address;
+        *this >> chatValue.venue;
+        *this >> chatValue.geo;
+        *this >> chatValue.photo;
+        *this >> chatValue.participantsCount;
+        *this >> chatValue.date;
+        *this >> chatValue.checkedIn;
+        *this >> chatValue.version;
         break;
     default:
         break;
     }
 
-    chatValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLChatFull &chatFullValue)
 {
-    TLChatFull result;
+    chatFullValue = TLChatFull();
 
-    *this >> result.tlType;
+    *this >> chatFullValue.tlType;
 
-    switch (result.tlType) {
+    switch (chatFullValue.tlType) {
     case TLValue::ChatFull:
-        *this >> result.id;
-        *this >> result.participants;
-        *this >> result.chatPhoto;
-        *this >> result.notifySettings;
-        *this >> result.exportedInvite;
+        *this >> chatFullValue.id;
+        *this >> chatFullValue.participants;
+        *this >> chatFullValue.chatPhoto;
+        *this >> chatFullValue.notifySettings;
+        *this >> chatFullValue.exportedInvite;
         break;
     default:
         break;
     }
 
-    chatFullValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLChatInvite &chatInviteValue)
 {
-    TLChatInvite result;
+    chatInviteValue = TLChatInvite();
 
-    *this >> result.tlType;
+    *this >> chatInviteValue.tlType;
 
-    switch (result.tlType) {
+    switch (chatInviteValue.tlType) {
     case TLValue::ChatInviteAlready:
-        *this >> result.chat;
+        *this >> chatInviteValue.chat;
         break;
     case TLValue::ChatInvite:
-        *this >> result.title;
+        *this >> chatInviteValue.title;
         break;
     default:
         break;
     }
 
-    chatInviteValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContactsBlocked &contactsBlockedValue)
 {
-    TLContactsBlocked result;
+    contactsBlockedValue = TLContactsBlocked();
 
-    *this >> result.tlType;
+    *this >> contactsBlockedValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactsBlockedValue.tlType) {
     case TLValue::ContactsBlocked:
-        *this >> result.blocked;
-        *this >> result.users;
+        *this >> contactsBlockedValue.blocked;
+        *this >> contactsBlockedValue.users;
         break;
     case TLValue::ContactsBlockedSlice:
-        *this >> result.count;
-        *this >> result.blocked;
-        *this >> result.users;
+        *this >> contactsBlockedValue.count;
+        *this >> contactsBlockedValue.blocked;
+        *this >> contactsBlockedValue.users;
         break;
     default:
         break;
     }
 
-    contactsBlockedValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContactsContacts &contactsContactsValue)
 {
-    TLContactsContacts result;
+    contactsContactsValue = TLContactsContacts();
 
-    *this >> result.tlType;
+    *this >> contactsContactsValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactsContactsValue.tlType) {
     case TLValue::ContactsContactsNotModified:
         break;
     case TLValue::ContactsContacts:
-        *this >> result.contacts;
-        *this >> result.users;
+        *this >> contactsContactsValue.contacts;
+        *this >> contactsContactsValue.users;
         break;
     default:
         break;
     }
 
-    contactsContactsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContactsFound &contactsFoundValue)
 {
-    TLContactsFound result;
+    contactsFoundValue = TLContactsFound();
 
-    *this >> result.tlType;
+    *this >> contactsFoundValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactsFoundValue.tlType) {
     case TLValue::ContactsFound:
-        *this >> result.results;
-        *this >> result.users;
+        *this >> contactsFoundValue.results;
+        *this >> contactsFoundValue.users;
         break;
     default:
         break;
     }
 
-    contactsFoundValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContactsImportedContacts &contactsImportedContactsValue)
 {
-    TLContactsImportedContacts result;
+    contactsImportedContactsValue = TLContactsImportedContacts();
 
-    *this >> result.tlType;
+    *this >> contactsImportedContactsValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactsImportedContactsValue.tlType) {
     case TLValue::ContactsImportedContacts:
-        *this >> result.imported;
-        *this >> result.retryContacts;
-        *this >> result.users;
+        *this >> contactsImportedContactsValue.imported;
+        *this >> contactsImportedContactsValue.retryContacts;
+        *this >> contactsImportedContactsValue.users;
         break;
     default:
         break;
     }
 
-    contactsImportedContactsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContactsLink &contactsLinkValue)
 {
-    TLContactsLink result;
+    contactsLinkValue = TLContactsLink();
 
-    *this >> result.tlType;
+    *this >> contactsLinkValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactsLinkValue.tlType) {
     case TLValue::ContactsLink:
-        *this >> result.myLink;
-        *this >> result.foreignLink;
-        *this >> result.user;
+        *this >> contactsLinkValue.myLink;
+        *this >> contactsLinkValue.foreignLink;
+        *this >> contactsLinkValue.user;
         break;
     default:
         break;
     }
 
-    contactsLinkValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLContactsSuggested &contactsSuggestedValue)
 {
-    TLContactsSuggested result;
+    contactsSuggestedValue = TLContactsSuggested();
 
-    *this >> result.tlType;
+    *this >> contactsSuggestedValue.tlType;
 
-    switch (result.tlType) {
+    switch (contactsSuggestedValue.tlType) {
     case TLValue::ContactsSuggested:
-        *this >> result.results;
-        *this >> result.users;
+        *this >> contactsSuggestedValue.results;
+        *this >> contactsSuggestedValue.users;
         break;
     default:
         break;
     }
 
-    contactsSuggestedValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLDocument &documentValue)
 {
-    TLDocument result;
+    documentValue = TLDocument();
 
-    *this >> result.tlType;
+    *this >> documentValue.tlType;
 
-    switch (result.tlType) {
+    switch (documentValue.tlType) {
     case TLValue::DocumentEmpty:
-        *this >> result.id;
+        *this >> documentValue.id;
         break;
     case TLValue::Document:
-        *this >> result.id;
-        *this >> result.accessHash;
-        *this >> result.date;
-        *this >> result.mimeType;
-        *this >> result.size;
-        *this >> result.thumb;
-        *this >> result.dcId;
-        *this >> result.attributes;
+        *this >> documentValue.id;
+        *this >> documentValue.accessHash;
+        *this >> documentValue.date;
+        readInterned(documentValue.mimeType);
+        *this >> documentValue.size;
+        *this >> documentValue.thumb;
+        *this >> documentValue.dcId;
+        *this >> documentValue.attributes;
         break;
     default:
         break;
     }
 
-    documentValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLHelpSupport &helpSupportValue)
 {
-    TLHelpSupport result;
+    helpSupportValue = TLHelpSupport();
 
-    *this >> result.tlType;
+    *this >> helpSupportValue.tlType;
 
-    switch (result.tlType) {
+    switch (helpSupportValue.tlType) {
     case TLValue::HelpSupport:
-        *this >> result.phoneNumber;
-        *this >> result.user;
+        *this >> helpSupportValue.phoneNumber;
+        *this >> helpSupportValue.user;
         break;
     default:
         break;
     }
 
-    helpSupportValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessageAction &messageActionValue)
 {
-    TLMessageAction result;
+    messageActionValue = TLMessageAction();
 
-    *this >> result.tlType;
+    *this >> messageActionValue.tlType;
 
-    switch (result.tlType) {
+    switch (messageActionValue.tlType) {
     case TLValue::MessageActionEmpty:
         break;
     case TLValue::MessageActionChatCreate:
-        *this >> result.title;
-        *this >> result.users;
+        *this >> messageActionValue.title;
+        *this >> messageActionValue.users;
         break;
     case TLValue::MessageActionChatEditTitle:
-        *this >> result.title;
+        *this >> messageActionValue.title;
         break;
     case TLValue::MessageActionChatEditPhoto:
-        *this >> result.photo;
+        *this >> messageActionValue.photo;
         break;
     case TLValue::MessageActionChatDeletePhoto:
         break;
     case TLValue::MessageActionChatAddUser:
-        *this >> result.userId;
+        *this >> messageActionValue.userId;
         break;
     case TLValue::MessageActionChatDeleteUser:
-        *this >> result.userId;
+        *this >> messageActionValue.userId;
         break;
     case TLValue::MessageActionGeoChatCreate:
-        *this >> result.title;
-        *this >> result.address;
+        *this >> messageActionValue.title;
+        *this >> messageActionValue.address;
         break;
     case TLValue::MessageActionGeoChatCheckin:
         break;
     case TLValue::MessageActionChatJoinedByLink:
-        *this >> result.inviterId;
+        *this >> messageActionValue.inviterId;
         break;
     default:
         break;
     }
 
-    messageActionValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessageMedia &messageMediaValue)
 {
-    TLMessageMedia result;
+    messageMediaValue = TLMessageMedia();
 
-    *this >> result.tlType;
+    *this >> messageMediaValue.tlType;
 
-    switch (result.tlType) {
+    switch (messageMediaValue.tlType) {
     case TLValue::MessageMediaEmpty:
         break;
     case TLValue::MessageMediaPhoto:
-        *this >> result.photo;
-        *this >> result.caption;
+        *this >> messageMediaValue.photo;
+        *this >> messageMediaValue.caption;
         break;
     case TLValue::MessageMediaVideo:
-        *this >> result.video;
-        *this >> result.caption;
+        *this >> messageMediaValue.video;
+        *this >> messageMediaValue.caption;
         break;
     case TLValue::MessageMediaGeo:
-        *this >> result.geo;
+        *this >> messageMediaValue.geo;
         break;
     case TLValue::MessageMediaContact:
-        *this >> result.phoneNumber;
-        *this >> result.firstName;
-        *this >> result.lastName;
-        *this >> result.userId;
+        *this >> messageMediaValue.phoneNumber;
+        *this >> messageMediaValue.firstName;
+        *this >> messageMediaValue.lastName;
+        *this >> messageMediaValue.userId;
         break;
     case TLValue::MessageMediaUnsupported:
         break;
     case TLValue::MessageMediaDocument:
-        *this >> result.document;
+        *this >> messageMediaValue.document;
         break;
     case TLValue::MessageMediaAudio:
-        *this >> result.audio;
+        *this >> messageMediaValue.audio;
         break;
     case TLValue::MessageMediaWebPage:
-        *this >> result.webpage;
+        *this >> messageMediaValue.webpage;
         break;
     case TLValue::MessageMediaVenue:
-        *this >> result.geo;
-        *this >> result.title;
-        *this >> result.address;
-        *this >> result.provider;
-        *this >> result.venueId;
+        *this >> messageMediaValue.geo;
+        *this >> messageMediaValue.title;
+        *this >> messageMediaValue.address;
+        readInterned(messageMediaValue.provider);
+        *this >> messageMediaValue.venueId;
         break;
     default:
         break;
     }
 
-    messageMediaValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesAllStickers &messagesAllStickersValue)
 {
-    TLMessagesAllStickers result;
+    messagesAllStickersValue = TLMessagesAllStickers();
 
-    *this >> result.tlType;
+    *this >> messagesAllStickersValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesAllStickersValue.tlType) {
     case TLValue::MessagesAllStickersNotModified:
         break;
     case TLValue::MessagesAllStickers:
-        *this >> result.hash;
-        *this >> result.packs;
-        *this >> result.sets;
-        *this >> result.documents;
+        *this >> messagesAllStickersValue.hash;
+        *this >> messagesAllStickersValue.packs;
+        *this >> messagesAllStickersValue.sets;
+        *this >> messagesAllStickersValue.documents;
         break;
     default:
         break;
     }
 
-    messagesAllStickersValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesChatFull &messagesChatFullValue)
 {
-    TLMessagesChatFull result;
+    messagesChatFullValue = TLMessagesChatFull();
 
-    *this >> result.tlType;
+    *this >> messagesChatFullValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesChatFullValue.tlType) {
     case TLValue::MessagesChatFull:
-        *this >> result.fullChat;
-        *this >> result.chats;
-        *this >> result.users;
+        *this >> messagesChatFullValue.fullChat;
+        *this >> messagesChatFullValue.chats;
+        *this >> messagesChatFullValue.users;
         break;
     default:
         break;
     }
 
-    messagesChatFullValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesChats &messagesChatsValue)
 {
-    TLMessagesChats result;
+    messagesChatsValue = TLMessagesChats();
 
-    *this >> result.tlType;
+    *this >> messagesChatsValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesChatsValue.tlType) {
     case TLValue::MessagesChats:
-        *this >> result.chats;
+        *this >> messagesChatsValue.chats;
         break;
     default:
         break;
     }
 
-    messagesChatsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesSentMessage &messagesSentMessageValue)
 {
-    TLMessagesSentMessage result;
+    messagesSentMessageValue = TLMessagesSentMessage();
 
-    *this >> result.tlType;
+    *this >> messagesSentMessageValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesSentMessageValue.tlType) {
     case TLValue::MessagesSentMessage:
-        *this >> result.id;
-        *this >> result.date;
-        *this >> result.media;
-        *this >> result.pts;
-        *this >> result.ptsCount;
+        *this >> messagesSentMessageValue.id;
+        *this >> messagesSentMessageValue.date;
+        *this >> messagesSentMessageValue.media;
+        *this >> messagesSentMessageValue.pts;
+        *this >> messagesSentMessageValue.ptsCount;
         break;
     case TLValue::MessagesSentMessageLink:
-        *this >> result.id;
-        *this >> result.date;
-        *this >> result.media;
-        *this >> result.pts;
-        *this >> result.ptsCount;
-        *this >> result.links;
-        *this >> result.seq;
+        *this >> messagesSentMessageValue.id;
+        *this >> messagesSentMessageValue.date;
+        *this >> messagesSentMessageValue.media;
+        *this >> messagesSentMessageValue.pts;
+        *this >> messagesSentMessageValue.ptsCount;
+        *this >> messagesSentMessageValue.links;
+        *this >> messagesSentMessageValue.seq;
         break;
     default:
         break;
     }
 
-    messagesSentMessageValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesStickerSet &messagesStickerSetValue)
 {
-    TLMessagesStickerSet result;
+    messagesStickerSetValue = TLMessagesStickerSet();
 
-    *this >> result.tlType;
+    *this >> messagesStickerSetValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesStickerSetValue.tlType) {
     case TLValue::MessagesStickerSet:
-        *this >> result.set;
-        *this >> result.packs;
-        *this >> result.documents;
+        *this >> messagesStickerSetValue.set;
+        *this >> messagesStickerSetValue.packs;
+        *this >> messagesStickerSetValue.documents;
         break;
     default:
         break;
     }
 
-    messagesStickerSetValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesStickers &messagesStickersValue)
 {
-    TLMessagesStickers result;
+    messagesStickersValue = TLMessagesStickers();
 
-    *this >> result.tlType;
+    *this >> messagesStickersValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesStickersValue.tlType) {
     case TLValue::MessagesStickersNotModified:
         break;
     case TLValue::MessagesStickers:
-        *this >> result.hash;
-        *this >> result.stickers;
+        *this >> messagesStickersValue.hash;
+        *this >> messagesStickersValue.stickers;
         break;
     default:
         break;
     }
 
-    messagesStickersValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLPhotosPhoto &photosPhotoValue)
 {
-    TLPhotosPhoto result;
+    photosPhotoValue = TLPhotosPhoto();
 
-    *this >> result.tlType;
+    *this >> photosPhotoValue.tlType;
 
-    switch (result.tlType) {
+    switch (photosPhotoValue.tlType) {
     case TLValue::PhotosPhoto:
-        *this >> result.photo;
-        *this >> result.users;
+        *this >> photosPhotoValue.photo;
+        *this >> photosPhotoValue.users;
         break;
     default:
         break;
     }
 
-    photosPhotoValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLPhotosPhotos &photosPhotosValue)
 {
-    TLPhotosPhotos result;
+    photosPhotosValue = TLPhotosPhotos();
 
-    *this >> result.tlType;
+    *this >> photosPhotosValue.tlType;
 
-    switch (result.tlType) {
+    switch (photosPhotosValue.tlType) {
     case TLValue::PhotosPhotos:
-        *this >> result.photos;
-        *this >> result.users;
+        *this >> photosPhotosValue.photos;
+        *this >> photosPhotosValue.users;
         break;
     case TLValue::PhotosPhotosSlice:
-        *this >> result.count;
-        *this >> result.photos;
-        *this >> result.users;
+        *this >> photosPhotosValue.count;
+        *this >> photosPhotosValue.photos;
+        *this >> photosPhotosValue.users;
         break;
     default:
         break;
     }
 
-    photosPhotosValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLUserFull &userFullValue)
 {
-    TLUserFull result;
+    userFullValue = TLUserFull();
 
-    *this >> result.tlType;
+    *this >> userFullValue.tlType;
 
-    switch (result.tlType) {
+    switch (userFullValue.tlType) {
     case TLValue::UserFull:
-        *this >> result.user;
-        *this >> result.link;
-        *this >> result.profilePhoto;
-        *this >> result.notifySettings;
-        *this >> result.blocked;
-        *this >> result.realFirstName;
-        *this >> result.realLastName;
+        *this >> userFullValue.user;
+        *this >> userFullValue.link;
+        *this >> userFullValue.profilePhoto;
+        *this >> userFullValue.notifySettings;
+        *this >> userFullValue.blocked;
+        *this >> userFullValue.realFirstName;
+        *this >> userFullValue.realLastName;
         break;
     default:
         break;
     }
 
-    userFullValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLGeoChatMessage &geoChatMessageValue)
 {
-    TLGeoChatMessage result;
+    geoChatMessageValue = TLGeoChatMessage();
 
-    *this >> result.tlType;
+    *this >> geoChatMessageValue.tlType;
 
-    switch (result.tlType) {
+    switch (geoChatMessageValue.tlType) {
     case TLValue::GeoChatMessageEmpty:
-        *this >> result.chatId;
-        *this >> result.id;
+        *this >> geoChatMessageValue.chatId;
+        *this >> geoChatMessageValue.id;
         break;
     case TLValue::GeoChatMessage:
-        *this >> result.chatId;
-        *this >> result.id;
-        *this >> result.fromId;
-        *this >> result.date;
-        *this >> result.message;
-        *this >> result.media;
+        *this >> geoChatMessageValue.chatId;
+        *this >> geoChatMessageValue.id;
+        *this >> geoChatMessageValue.fromId;
+        *this >> geoChatMessageValue.date;
+        *this >> geoChatMessageValue.message;
+        *this >> geoChatMessageValue.media;
         break;
     case TLValue::GeoChatMessageService:
-        *this >> result.chatId;
-        *this >> result.id;
-        *this >> result.fromId;
-        *this >> result.date;
-        *this >> result.action;
+        *this >> geoChatMessageValue.chatId;
+        *this >> geoChatMessageValue.id;
+        *this >> geoChatMessageValue.fromId;
+        *this >> geoChatMessageValue.date;
+        *this >> geoChatMessageValue.action;
         break;
     default:
         break;
     }
 
-    geoChatMessageValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLGeochatsLocated &geochatsLocatedValue)
 {
-    TLGeochatsLocated result;
+    geochatsLocatedValue = TLGeochatsLocated();
 
-    *this >> result.tlType;
+    *this >> geochatsLocatedValue.tlType;
 
-    switch (result.tlType) {
+    switch (geochatsLocatedValue.tlType) {
     case TLValue::GeochatsLocated:
-        *this >> result.results;
-        *this >> result.messages;
-        *this >> result.chats;
-        *this >> result.users;
+        *this >> geochatsLocatedValue.results;
+        *this >> geochatsLocatedValue.messages;
+        *this >> geochatsLocatedValue.chats;
+        *this >> geochatsLocatedValue.users;
         break;
     default:
         break;
     }
 
-    geochatsLocatedValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLGeochatsMessages &geochatsMessagesValue)
 {
-    TLGeochatsMessages result;
+    geochatsMessagesValue = TLGeochatsMessages();
 
-    *this >> result.tlType;
+    *this >> geochatsMessagesValue.tlType;
 
-    switch (result.tlType) {
+    switch (geochatsMessagesValue.tlType) {
     case TLValue::GeochatsMessages:
-        *this >> result.messages;
-        *this >> result.chats;
-        *this >> result.users;
+        *this >> geochatsMessagesValue.messages;
+        *this >> geochatsMessagesValue.chats;
+        *this >> geochatsMessagesValue.users;
         break;
     case TLValue::GeochatsMessagesSlice:
-        *this >> result.count;
-        *this >> result.messages;
-        *this >> result.chats;
-        *this >> result.users;
+        *this >> geochatsMessagesValue.count;
+        *this >> geochatsMessagesValue.messages;
+        *this >> geochatsMessagesValue.chats;
+        *this >> geochatsMessagesValue.users;
         break;
     default:
         break;
     }
 
-    geochatsMessagesValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLGeochatsStatedMessage &geochatsStatedMessageValue)
 {
-    TLGeochatsStatedMessage result;
+    geochatsStatedMessageValue = TLGeochatsStatedMessage();
 
-    *this >> result.tlType;
+    *this >> geochatsStatedMessageValue.tlType;
 
-    switch (result.tlType) {
+    switch (geochatsStatedMessageValue.tlType) {
     case TLValue::GeochatsStatedMessage:
-        *this >> result.message;
-        *this >> result.chats;
-        *this >> result.users;
-        *this >> result.seq;
+        *this >> geochatsStatedMessageValue.message;
+        *this >> geochatsStatedMessageValue.chats;
+        *this >> geochatsStatedMessageValue.users;
+        *this >> geochatsStatedMessageValue.seq;
         break;
     default:
         break;
     }
 
-    geochatsStatedMessageValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessage &messageValue)
 {
-    TLMessage result;
+    messageValue = TLMessage();
 
-    *this >> result.tlType;
+    *this >> messageValue.tlType;
 
-    switch (result.tlType) {
+    switch (messageValue.tlType) {
     case TLValue::MessageEmpty:
-        *this >> result.id;
+        *this >> messageValue.id;
         break;
     case TLValue::Message:
-        *this >> result.flags;
-        *this >> result.id;
-        *this >> result.fromId;
-        *this >> result.toId;
-        if (result.flags & 1 << 2) {
-            *this >> result.fwdFromId;
+        *this >> messageValue.flags;
+        *this >> messageValue.id;
+        *this >> messageValue.fromId;
+        *this >> messageValue.toId;
+        if (messageValue.flags & 1 << 2) {
+            *this >> messageValue.fwdFromId;
         }
-        if (result.flags & 1 << 2) {
-            *this >> result.fwdDate;
+        if (messageValue.flags & 1 << 2) {
+            *this >> messageValue.fwdDate;
         }
-        if (result.flags & 1 << 3) {
-            *this >> result.replyToMsgId;
+        if (messageValue.flags & 1 << 3) {
+            *this >> messageValue.replyToMsgId;
         }
-        *this >> result.date;
-        *this >> result.message;
-        *this >> result.media;
+        *this >> messageValue.date;
+        *this >> messageValue.message;
+        *this >> messageValue.media;
         break;
     case TLValue::MessageService:
-        *this >> result.flags;
-        *this >> result.id;
-        *this >> result.fromId;
-        *this >> result.toId;
-        *this >> result.date;
-        *this >> result.action;
+        *this >> messageValue.flags;
+        *this >> messageValue.id;
+        *this >> messageValue.fromId;
+        *this >> messageValue.toId;
+        *this >> messageValue.date;
+        *this >> messageValue.action;
         break;
     default:
         break;
     }
 
-    messageValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesDialogs &messagesDialogsValue)
 {
-    TLMessagesDialogs result;
+    messagesDialogsValue = TLMessagesDialogs();
 
-    *this >> result.tlType;
+    *this >> messagesDialogsValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesDialogsValue.tlType) {
     case TLValue::MessagesDialogs:
-        *this >> result.dialogs;
-        *this >> result.messages;
-        *this >> result.chats;
-        *this >> result.users;
+        *this >> messagesDialogsValue.dialogs;
+        *this >> messagesDialogsValue.messages;
+        *this >> messagesDialogsValue.chats;
+        *this >> messagesDialogsValue.users;
         break;
     case TLValue::MessagesDialogsSlice:
-        *this >> result.count;
-        *this >> result.dialogs;
-        *this >> result.messages;
-        *this >> result.chats;
-        *this >> result.users;
+        *this >> messagesDialogsValue.count;
+        *this >> messagesDialogsValue.dialogs;
+        *this >> messagesDialogsValue.messages;
+        *this >> messagesDialogsValue.chats;
+        *this >> messagesDialogsValue.users;
         break;
     default:
         break;
     }
 
-    messagesDialogsValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLMessagesMessages &messagesMessagesValue)
 {
-    TLMessagesMessages result;
+    messagesMessagesValue = TLMessagesMessages();
 
-    *this >> result.tlType;
+    *this >> messagesMessagesValue.tlType;
 
-    switch (result.tlType) {
+    switch (messagesMessagesValue.tlType) {
     case TLValue::MessagesMessages:
-        *this >> result.messages;
-        *this >> result.chats;
-        *this >> result.users;
+        *this >> messagesMessagesValue.messages;
+        *this >> messagesMessagesValue.chats;
+        *this >> messagesMessagesValue.users;
         break;
     case TLValue::MessagesMessagesSlice:
-        *this >> result.count;
-        *this >> result.messages;
-        *this >> result.chats;
-        *this >> result.users;
+        *this >> messagesMessagesValue.count;
+        *this >> messagesMessagesValue.messages;
+        *this >> messagesMessagesValue.chats;
+        *this >> messagesMessagesValue.users;
         break;
     default:
         break;
     }
 
-    messagesMessagesValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLUpdate &updateValue)
 {
-    TLUpdate result;
+    updateValue = TLUpdate();
 
-    *this >> result.tlType;
+    *this >> updateValue.tlType;
 
-    switch (result.tlType) {
+    switch (updateValue.tlType) {
     case TLValue::UpdateNewMessage:
-        *this >> result.message;
-        *this >> result.pts;
-        *this >> result.ptsCount;
+        *this >> updateValue.message;
+        *this >> updateValue.pts;
+        *this >> updateValue.ptsCount;
         break;
     case TLValue::UpdateMessageID:
-        *this >> result.id;
-        *this >> result.randomId;
+        *this >> updateValue.id;
+        *this >> updateValue.randomId;
         break;
     case TLValue::UpdateDeleteMessages:
-        *this >> result.messages;
-        *this >> result.pts;
-        *this >> result.ptsCount;
+        *this >> updateValue.messages;
+        *this >> updateValue.pts;
+        *this >> updateValue.ptsCount;
         break;
     case TLValue::UpdateUserTyping:
-        *this >> result.userId;
-        *this >> result.action;
+        *this >> updateValue.userId;
+        *this >> updateValue.action;
         break;
     case TLValue::UpdateChatUserTyping:
-        *this >> result.chatId;
-        *this >> result.userId;
-        *this >> result.action;
+        *this >> updateValue.chatId;
+        *this >> updateValue.userId;
+        *this >> updateValue.action;
         break;
     case TLValue::UpdateChatParticipants:
-        *this >> result.participants;
+        *this >> updateValue.participants;
         break;
     case TLValue::UpdateUserStatus:
-        *this >> result.userId;
-        *this >> result.status;
+        *this >> updateValue.userId;
+        *this >> updateValue.status;
         break;
     case TLValue::UpdateUserName:
-        *this >> result.userId;
-        *this >> result.firstName;
-        *this >> result.lastName;
-        *this >> result.username;
+        *this >> updateValue.userId;
+        *this >> updateValue.firstName;
+        *this >> updateValue.lastName;
+        *this >> updateValue.username;
         break;
     case TLValue::UpdateUserPhoto:
-        *this >> result.userId;
-        *this >> result.date;
-        *this >> result.photo;
-        *this >> result.previous;
+        *this >> updateValue.userId;
+        *this >> updateValue.date;
+        *this >> updateValue.photo;
+        *this >> updateValue.previous;
         break;
     case TLValue::UpdateContactRegistered:
-        *this >> result.userId;
-        *this >> result.date;
+        *this >> updateValue.userId;
+        *this >> updateValue.date;
         break;
     case TLValue::UpdateContactLink:
-        *this >> result.userId;
-        *this >> result.myLink;
-        *this >> result.foreignLink;
+        *this >> updateValue.userId;
+        *this >> updateValue.myLink;
+        *this >> updateValue.foreignLink;
         break;
     case TLValue::UpdateNewAuthorization:
-        *this >> result.authKeyId;
-        *this >> result.date;
-        *this >> result.device;
-        *this >> result.location;
+        *this >> updateValue.authKeyId;
+        *this >> updateValue.date;
+        *this >> updateValue.device;
+        *this >> updateValue.location;
         break;
     case TLValue::UpdateNewGeoChatMessage:
-        *this >> result.messageGeoChat;
+        *this >> updateValue.messageGeoChat;
         break;
     case TLValue::UpdateNewEncryptedMessage:
-        *this >> result.messageEncrypted;
-        *this >> result.qts;
+        *this >> updateValue.messageEncrypted;
+        *this >> updateValue.qts;
         break;
     case TLValue::UpdateEncryptedChatTyping:
-        *this >> result.chatId;
+        *this >> updateValue.chatId;
         break;
     case TLValue::UpdateEncryption:
-        *this >> result.chat;
-        *this >> result.date;
+        *this >> updateValue.chat;
+        *this >> updateValue.date;
         break;
     case TLValue::UpdateEncryptedMessagesRead:
-        *this >> result.chatId;
-        *this >> result.maxDate;
-        *this >> result.date;
+        *this >> updateValue.chatId;
+        *this >> updateValue.maxDate;
+        *this >> updateValue.date;
         break;
     case TLValue::UpdateChatParticipantAdd:
-        *this >> result.chatId;
-        *this >> result.userId;
-        *this >> result.inviterId;
-        *this >> result.version;
+        *this >> updateValue.chatId;
+        *this >> updateValue.userId;
+        *this >> updateValue.inviterId;
+        *this >> updateValue.version;
         break;
     case TLValue::UpdateChatParticipantDelete:
-        *this >> result.chatId;
-        *this >> result.userId;
-        *this >> result.version;
+        *this >> updateValue.chatId;
+        *this >> updateValue.userId;
+        *this >> updateValue.version;
         break;
     case TLValue::UpdateDcOptions:
-        *this >> result.dcOptions;
+        *this >> updateValue.dcOptions;
         break;
     case TLValue::UpdateUserBlocked:
-        *this >> result.userId;
-        *this >> result.blocked;
+        *this >> updateValue.userId;
+        *this >> updateValue.blocked;
         break;
     case TLValue::UpdateNotifySettings:
-        *this >> result.peerNotify;
-        *this >> result.notifySettings;
+        *this >> updateValue.peerNotify;
+        *this >> updateValue.notifySettings;
         break;
     case TLValue::UpdateServiceNotification:
-        *this >> result.type;
-        *this >> result.messageQString;
-        *this >> result.media;
-        *this >> result.popup;
+        *this >> updateValue.type;
+        *this >> updateValue.messageQString;
+        *this >> updateValue.media;
+        *this >> updateValue.popup;
         break;
     case TLValue::UpdatePrivacy:
-        *this >> result.key;
-        *this >> result.rules;
+        *this >> updateValue.key;
+        *this >> updateValue.rules;
         break;
     case TLValue::UpdateUserPhone:
-        *this >> result.userId;
-        *this >> result.phone;
+        *this >> updateValue.userId;
+        *this >> updateValue.phone;
         break;
     case TLValue::UpdateReadHistoryInbox:
-        *this >> result.peer;
-        *this >> result.maxId;
-        *this >> result.pts;
-        *this >> result.ptsCount;
+        *this >> updateValue.peer;
+        *this >> updateValue.maxId;
+        *this >> updateValue.pts;
+        *this >> updateValue.ptsCount;
         break;
     case TLValue::UpdateReadHistoryOutbox:
-        *this >> result.peer;
-        *this >> result.maxId;
-        *this >> result.pts;
-        *this >> result.ptsCount;
+        *this >> updateValue.peer;
+        *this >> updateValue.maxId;
+        *this >> updateValue.pts;
+        *this >> updateValue.ptsCount;
         break;
     case TLValue::UpdateWebPage:
-        *this >> result.webpage;
+        *this >> updateValue.webpage;
         break;
     case TLValue::UpdateReadMessagesContents:
-        *this >> result.messages;
-        *this >> result.pts;
-        *this >> result.ptsCount;
+        *this >> updateValue.messages;
+        *this >> updateValue.pts;
+        *this >> updateValue.ptsCount;
         break;
     default:
         break;
     }
 
-    updateValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLUpdates &updatesValue)
 {
-    TLUpdates result;
+    updatesValue = TLUpdates();
 
-    *this >> result.tlType;
+    *this >> updatesValue.tlType;
 
-    switch (result.tlType) {
+    switch (updatesValue.tlType) {
     case TLValue::UpdatesTooLong:
         break;
     case TLValue::UpdateShortMessage:
-        *this >> result.flags;
-        *this >> result.id;
-        *this >> result.userId;
-        *this >> result.message;
-        *this >> result.pts;
-        *this >> result.ptsCount;
-        *this >> result.date;
-        if (result.flags & 1 << 2) {
-            *this >> result.fwdFromId;
+        *this >> updatesValue.flags;
+        *this >> updatesValue.id;
+        *this >> updatesValue.userId;
+        *this >> updatesValue.message;
+        *this >> updatesValue.pts;
+        *this >> updatesValue.ptsCount;
+        *this >> updatesValue.date;
+        if (updatesValue.flags & 1 << 2) {
+            *this >> updatesValue.fwdFromId;
         }
-        if (result.flags & 1 << 2) {
-            *this >> result.fwdDate;
+        if (updatesValue.flags & 1 << 2) {
+            *this >> updatesValue.fwdDate;
         }
-        if (result.flags & 1 << 3) {
-            *this >> result.replyToMsgId;
+        if (updatesValue.flags & 1 << 3) {
+            *this >> updatesValue.replyToMsgId;
         }
         break;
     case TLValue::UpdateShortChatMessage:
-        *this >> result.flags;
-        *this >> result.id;
-        *this >> result.fromId;
-        *this >> result.chatId;
-        *this >> result.message;
-        *this >> result.pts;
-        *this >> result.ptsCount;
-        *this >> result.date;
-        if (result.flags & 1 << 2) {
-            *this >> result.fwdFromId;
+        *this >> updatesValue.flags;
+        *this >> updatesValue.id;
+        *this >> updatesValue.fromId;
+        *this >> updatesValue.chatId;
+        *this >> updatesValue.message;
+        *this >> updatesValue.pts;
+        *this >> updatesValue.ptsCount;
+        *this >> updatesValue.date;
+        if (updatesValue.flags & 1 << 2) {
+            *this >> updatesValue.fwdFromId;
         }
-        if (result.flags & 1 << 2) {
-            *this >> result.fwdDate;
+        if (updatesValue.flags & 1 << 2) {
+            *this >> updatesValue.fwdDate;
         }
-        if (result.flags & 1 << 3) {
-            *this >> result.replyToMsgId;
+        if (updatesValue.flags & 1 << 3) {
+            *this >> updatesValue.replyToMsgId;
         }
         break;
     case TLValue::UpdateShort:
-        *this >> result.update;
-        *this >> result.date;
+        *this >> updatesValue.update;
+        *this >> updatesValue.date;
         break;
     case TLValue::UpdatesCombined:
-        *this >> result.updates;
-        *this >> result.users;
-        *this >> result.chats;
-        *this >> result.date;
-        *this >> result.seqStart;
-        *this >> result.seq;
+        *this >> updatesValue.updates;
+        *this >> updatesValue.users;
+        *this >> updatesValue.chats;
+        *this >> updatesValue.date;
+        *this >> updatesValue.seqStart;
+        *this >> updatesValue.seq;
         break;
     case TLValue::Updates:
-        *this >> result.updates;
-        *this >> result.users;
-        *this >> result.chats;
-        *this >> result.date;
-        *this >> result.seq;
+        *this >> updatesValue.updates;
+        *this >> updatesValue.users;
+        *this >> updatesValue.chats;
+        *this >> updatesValue.date;
+        *this >> updatesValue.seq;
         break;
     default:
         break;
     }
 
-    updatesValue = result;
-
     return *this;
 }
 
 CTelegramStream &CTelegramStream::operator>>(TLUpdatesDifference &updatesDifferenceValue)
 {
-    TLUpdatesDifference result;
+    updatesDifferenceValue = TLUpdatesDifference();
 
-    *this >> result.tlType;
+    *this >> updatesDifferenceValue.tlType;
 
-    switch (result.tlType) {
+    switch (updatesDifferenceValue.tlType) {
     case TLValue::UpdatesDifferenceEmpty:
-        *this >> result.date;
-        *this >> result.seq;
+        *this >> updatesDifferenceValue.date;
+        *this >> updatesDifferenceValue.seq;
         break;
     case TLValue::UpdatesDifference:
-        *this >> result.newMessages;
-        *this >> result.newEncryptedMessages;
-        *this >> result.otherUpdates;
-        *this >> result.chats;
-        *this >> result.users;
-        *this >> result.state;
+        *this >> updatesDifferenceValue.newMessages;
+        *this >> updatesDifferenceValue.newEncryptedMessages;
+        *this >> updatesDifferenceValue.otherUpdates;
+        *this >> updatesDifferenceValue.chats;
+        *this >> updatesDifferenceValue.users;
+        *this >> updatesDifferenceValue.state;
         break;
     case TLValue::UpdatesDifferenceSlice:
-        *this >> result.newMessages;
-        *this >> result.newEncryptedMessages;
-        *this >> result.otherUpdates;
-        *this >> result.chats;
-        *this >> result.users;
-        *this >> result.intermediateState;
+        *this >> updatesDifferenceValue.newMessages;
+        *this >> updatesDifferenceValue.newEncryptedMessages;
+        *this >> updatesDifferenceValue.otherUpdates;
+        *this >> updatesDifferenceValue.chats;
+        *this >> updatesDifferenceValue.users;
+        *this >> updatesDifferenceValue.intermediateState;
         break;
     default:
         break;
     }
 
-    updatesDifferenceValue = result;
-
     return *this;
 }
 
 // End of generated read operators implementation
+#endif // TELEGRAMQT_SCHEMA_CODEC
 
-template <typename T>
-CTelegramStream &CTelegramStream::operator<<(const TLVector<T> &v)
+// Generated skip functions implementation
+CTelegramStream &CTelegramStream::skipValue(const TLAccountDaysTTL *)
 {
-    *this << v.tlType;
+    TLValue tlType;
 
-    if (v.tlType == TLValue::Vector) {
-        *this << quint32(v.count());
+    *this >> tlType;
 
-        for (int i = 0; i < v.count(); ++i) {
-            *this << v.at(i);
-        }
+    switch (tlType) {
+    case TLValue::AccountDaysTTL:
+        skip<quint32>();
+        break;
+    default:
+        break;
     }
 
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const QByteArray &data)
+CTelegramStream &CTelegramStream::skipValue(const TLAccountPassword *)
 {
-    quint32 length = data.size();
+    TLValue tlType;
 
-    if (length < 0xfe) {
-        const char lengthToWrite = length;
-        write(&lengthToWrite, 1);
-        write(data.constData(), data.size());
-        length += 1;
-    } else {
-        *this << quint32((length << 8) + 0xfe);
-        write(data.constData(), data.size());
-        length += 4;
-    }
+    *this >> tlType;
 
-    if (length & 3) {
-        write(s_nulls, 4 - (length & 3));
+    switch (tlType) {
+    case TLValue::AccountNoPassword:
+        skip<QByteArray>();
+        skip<QString>();
+        break;
+    case TLValue::AccountPassword:
+        skip<QByteArray>();
+        skip<QByteArray>();
+        skip<QString>();
+        skip<bool>();
+        skip<QString>();
+        break;
+    default:
+        break;
     }
 
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLDcOption &dcOption)
+CTelegramStream &CTelegramStream::skipValue(const TLAccountPasswordInputSettings *)
 {
-    *this << dcOption.tlType;
+    TLValue tlType;
+    quint32 flags = 0;
 
-    *this << dcOption.id;
-    *this << dcOption.hostname;
-    *this << dcOption.ipAddress;
-    *this << dcOption.port;
+    *this >> tlType;
 
-    return *this;
-}
-
-// Generated write operators implementation
-CTelegramStream &CTelegramStream::operator<<(const TLAccountDaysTTL &accountDaysTTLValue)
-{
-    *this << accountDaysTTLValue.tlType;
-
-    switch (accountDaysTTLValue.tlType) {
-    case TLValue::AccountDaysTTL:
-        *this << accountDaysTTLValue.days;
+    switch (tlType) {
+    case TLValue::AccountPasswordInputSettings:
+        *this >> flags;
+        if (flags & 1 << 0) {
+            skip<QByteArray>();
+        }
+        if (flags & 1 << 0) {
+            skip<QByteArray>();
+        }
+        if (flags & 1 << 0) {
+            skip<QString>();
+        }
+        if (flags & 1 << 1) {
+            skip<QString>();
+        }
         break;
     default:
         break;
@@ -3550,25 +3387,15 @@ CTelegramStream &CTelegramStream::operator<<(const TLAccountDaysTTL &accountDays
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLAccountPasswordInputSettings &accountPasswordInputSettingsValue)
+CTelegramStream &CTelegramStream::skipValue(const TLAccountPasswordSettings *)
 {
-    *this << accountPasswordInputSettingsValue.tlType;
+    TLValue tlType;
 
-    switch (accountPasswordInputSettingsValue.tlType) {
-    case TLValue::AccountPasswordInputSettings:
-        *this << accountPasswordInputSettingsValue.flags;
-        if (accountPasswordInputSettingsValue.flags & 1 << 0) {
-            *this << accountPasswordInputSettingsValue.newSalt;
-        }
-        if (accountPasswordInputSettingsValue.flags & 1 << 0) {
-            *this << accountPasswordInputSettingsValue.newPasswordHash;
-        }
-        if (accountPasswordInputSettingsValue.flags & 1 << 0) {
-            *this << accountPasswordInputSettingsValue.hint;
-        }
-        if (accountPasswordInputSettingsValue.flags & 1 << 1) {
-            *this << accountPasswordInputSettingsValue.email;
-        }
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AccountPasswordSettings:
+        skip<QString>();
         break;
     default:
         break;
@@ -3577,16 +3404,16 @@ CTelegramStream &CTelegramStream::operator<<(const TLAccountPasswordInputSetting
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLInputAppEvent &inputAppEventValue)
+CTelegramStream &CTelegramStream::skipValue(const TLAccountSentChangePhoneCode *)
 {
-    *this << inputAppEventValue.tlType;
+    TLValue tlType;
 
-    switch (inputAppEventValue.tlType) {
-    case TLValue::InputAppEvent:
-        *this << inputAppEventValue.time;
-        *this << inputAppEventValue.type;
-        *this << inputAppEventValue.peer;
-        *this << inputAppEventValue.data;
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AccountSentChangePhoneCode:
+        skip<QString>();
+        skip<quint32>();
         break;
     default:
         break;
@@ -3595,16 +3422,25 @@ CTelegramStream &CTelegramStream::operator<<(const TLInputAppEvent &inputAppEven
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLInputAudio &inputAudioValue)
+CTelegramStream &CTelegramStream::skipValue(const TLAudio *)
 {
-    *this << inputAudioValue.tlType;
+    TLValue tlType;
 
-    switch (inputAudioValue.tlType) {
-    case TLValue::InputAudioEmpty:
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AudioEmpty:
+        skip<quint64>();
         break;
-    case TLValue::InputAudio:
-        *this << inputAudioValue.id;
-        *this << inputAudioValue.accessHash;
+    case TLValue::Audio:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
         break;
     default:
         break;
@@ -3613,16 +3449,15 @@ CTelegramStream &CTelegramStream::operator<<(const TLInputAudio &inputAudioValue
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLInputContact &inputContactValue)
+CTelegramStream &CTelegramStream::skipValue(const TLAuthCheckedPhone *)
 {
-    *this << inputContactValue.tlType;
+    TLValue tlType;
 
-    switch (inputContactValue.tlType) {
-    case TLValue::InputPhoneContact:
-        *this << inputContactValue.clientId;
-        *this << inputContactValue.phone;
-        *this << inputContactValue.firstName;
-        *this << inputContactValue.lastName;
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AuthCheckedPhone:
+        skip<bool>();
         break;
     default:
         break;
@@ -3631,16 +3466,16 @@ CTelegramStream &CTelegramStream::operator<<(const TLInputContact &inputContactV
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLInputDocument &inputDocumentValue)
+CTelegramStream &CTelegramStream::skipValue(const TLAuthExportedAuthorization *)
 {
-    *this << inputDocumentValue.tlType;
+    TLValue tlType;
 
-    switch (inputDocumentValue.tlType) {
-    case TLValue::InputDocumentEmpty:
-        break;
-    case TLValue::InputDocument:
-        *this << inputDocumentValue.id;
-        *this << inputDocumentValue.accessHash;
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AuthExportedAuthorization:
+        skip<quint32>();
+        skip<QByteArray>();
         break;
     default:
         break;
@@ -3649,14 +3484,15 @@ CTelegramStream &CTelegramStream::operator<<(const TLInputDocument &inputDocumen
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLInputEncryptedChat &inputEncryptedChatValue)
+CTelegramStream &CTelegramStream::skipValue(const TLAuthPasswordRecovery *)
 {
-    *this << inputEncryptedChatValue.tlType;
+    TLValue tlType;
 
-    switch (inputEncryptedChatValue.tlType) {
-    case TLValue::InputEncryptedChat:
-        *this << inputEncryptedChatValue.chatId;
-        *this << inputEncryptedChatValue.accessHash;
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AuthPasswordRecovery:
+        skip<QString>();
         break;
     default:
         break;
@@ -3665,27 +3501,24 @@ CTelegramStream &CTelegramStream::operator<<(const TLInputEncryptedChat &inputEn
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLInputEncryptedFile &inputEncryptedFileValue)
+CTelegramStream &CTelegramStream::skipValue(const TLAuthSentCode *)
 {
-    *this << inputEncryptedFileValue.tlType;
+    TLValue tlType;
 
-    switch (inputEncryptedFileValue.tlType) {
-    case TLValue::InputEncryptedFileEmpty:
-        break;
-    case TLValue::InputEncryptedFileUploaded:
-        *this << inputEncryptedFileValue.id;
-        *this << inputEncryptedFileValue.parts;
-        *this << inputEncryptedFileValue.md5Checksum;
-        *this << inputEncryptedFileValue.keyFingerprint;
-        break;
-    case TLValue::InputEncryptedFile:
-        *this << inputEncryptedFileValue.id;
-        *this << inputEncryptedFileValue.accessHash;
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AuthSentCode:
+        skip<bool>();
+        skip<QString>();
+        skip<quint32>();
+        skip<bool>();
         break;
-    case TLValue::InputEncryptedFileBigUploaded:
-        *this << inputEncryptedFileValue.id;
-        *this << inputEncryptedFileValue.parts;
-        *this << inputEncryptedFileValue.keyFingerprint;
+    case TLValue::AuthSentAppCode:
+        skip<bool>();
+        skip<QString>();
+        skip<quint32>();
+        skip<bool>();
         break;
     default:
         break;
@@ -3694,21 +3527,27 @@ CTelegramStream &CTelegramStream::operator<<(const TLInputEncryptedFile &inputEn
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLInputFile &inputFileValue)
+CTelegramStream &CTelegramStream::skipValue(const TLAuthorization *)
 {
-    *this << inputFileValue.tlType;
+    TLValue tlType;
 
-    switch (inputFileValue.tlType) {
-    case TLValue::InputFile:
-        *this << inputFileValue.id;
-        *this << inputFileValue.parts;
-        *this << inputFileValue.name;
-        *this << inputFileValue.md5Checksum;
-        break;
-    case TLValue::InputFileBig:
-        *this << inputFileValue.id;
-        *this << inputFileValue.parts;
-        *this << inputFileValue.name;
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::Authorization:
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
         break;
     default:
         break;
@@ -3717,31 +3556,16 @@ CTelegramStream &CTelegramStream::operator<<(const TLInputFile &inputFileValue)
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLInputFileLocation &inputFileLocationValue)
+CTelegramStream &CTelegramStream::skipValue(const TLChatLocated *)
 {
-    *this << inputFileLocationValue.tlType;
+    TLValue tlType;
 
-    switch (inputFileLocationValue.tlType) {
-    case TLValue::InputFileLocation:
-        *this << inputFileLocationValue.volumeId;
-        *this << inputFileLocationValue.localId;
-        *this << inputFileLocationValue.secret;
-        break;
-    case TLValue::InputVideoFileLocation:
-        *this << inputFileLocationValue.id;
-        *this << inputFileLocationValue.accessHash;
-        break;
-    case TLValue::InputEncryptedFileLocation:
-        *this << inputFileLocationValue.id;
-        *this << inputFileLocationValue.accessHash;
-        break;
-    case TLValue::InputAudioFileLocation:
-        *this << inputFileLocationValue.id;
-        *this << inputFileLocationValue.accessHash;
-        break;
-    case TLValue::InputDocumentFileLocation:
-        *this << inputFileLocationValue.id;
-        *this << inputFileLocationValue.accessHash;
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChatLocated:
+        skip<quint32>();
+        skip<quint32>();
         break;
     default:
         break;
@@ -3750,14 +3574,17 @@ CTelegramStream &CTelegramStream::operator<<(const TLInputFileLocation &inputFil
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLInputGeoChat &inputGeoChatValue)
+CTelegramStream &CTelegramStream::skipValue(const TLChatParticipant *)
 {
-    *this << inputGeoChatValue.tlType;
+    TLValue tlType;
 
-    switch (inputGeoChatValue.tlType) {
-    case TLValue::InputGeoChat:
-        *this << inputGeoChatValue.chatId;
-        *this << inputGeoChatValue.accessHash;
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChatParticipant:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
         break;
     default:
         break;
@@ -3766,16 +3593,21 @@ CTelegramStream &CTelegramStream::operator<<(const TLInputGeoChat &inputGeoChatV
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLInputGeoPoint &inputGeoPointValue)
+CTelegramStream &CTelegramStream::skipValue(const TLChatParticipants *)
 {
-    *this << inputGeoPointValue.tlType;
+    TLValue tlType;
 
-    switch (inputGeoPointValue.tlType) {
-    case TLValue::InputGeoPointEmpty:
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChatParticipantsForbidden:
+        skip<quint32>();
         break;
-    case TLValue::InputGeoPoint:
-        *this << inputGeoPointValue.latitude;
-        *this << inputGeoPointValue.longitude;
+    case TLValue::ChatParticipants:
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLVector<TLChatParticipant> >();
+        skip<quint32>();
         break;
     default:
         break;
@@ -3784,24 +3616,16 @@ CTelegramStream &CTelegramStream::operator<<(const TLInputGeoPoint &inputGeoPoin
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLInputPeer &inputPeerValue)
+CTelegramStream &CTelegramStream::skipValue(const TLContact *)
 {
-    *this << inputPeerValue.tlType;
+    TLValue tlType;
 
-    switch (inputPeerValue.tlType) {
-    case TLValue::InputPeerEmpty:
-        break;
-    case TLValue::InputPeerSelf:
-        break;
-    case TLValue::InputPeerContact:
-        *this << inputPeerValue.userId;
-        break;
-    case TLValue::InputPeerForeign:
-        *this << inputPeerValue.userId;
-        *this << inputPeerValue.accessHash;
-        break;
-    case TLValue::InputPeerChat:
-        *this << inputPeerValue.chatId;
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::Contact:
+        skip<quint32>();
+        skip<bool>();
         break;
     default:
         break;
@@ -3810,16 +3634,16 @@ CTelegramStream &CTelegramStream::operator<<(const TLInputPeer &inputPeerValue)
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLInputPeerNotifySettings &inputPeerNotifySettingsValue)
+CTelegramStream &CTelegramStream::skipValue(const TLContactBlocked *)
 {
-    *this << inputPeerNotifySettingsValue.tlType;
+    TLValue tlType;
 
-    switch (inputPeerNotifySettingsValue.tlType) {
-    case TLValue::InputPeerNotifySettings:
-        *this << inputPeerNotifySettingsValue.muteUntil;
-        *this << inputPeerNotifySettingsValue.sound;
-        *this << inputPeerNotifySettingsValue.showPreviews;
-        *this << inputPeerNotifySettingsValue.eventsMask;
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactBlocked:
+        skip<quint32>();
+        skip<quint32>();
         break;
     default:
         break;
@@ -3828,16 +3652,15 @@ CTelegramStream &CTelegramStream::operator<<(const TLInputPeerNotifySettings &in
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLInputPhoto &inputPhotoValue)
+CTelegramStream &CTelegramStream::skipValue(const TLContactFound *)
 {
-    *this << inputPhotoValue.tlType;
+    TLValue tlType;
 
-    switch (inputPhotoValue.tlType) {
-    case TLValue::InputPhotoEmpty:
-        break;
-    case TLValue::InputPhoto:
-        *this << inputPhotoValue.id;
-        *this << inputPhotoValue.accessHash;
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactFound:
+        skip<quint32>();
         break;
     default:
         break;
@@ -3846,17 +3669,20 @@ CTelegramStream &CTelegramStream::operator<<(const TLInputPhoto &inputPhotoValue
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLInputPhotoCrop &inputPhotoCropValue)
+CTelegramStream &CTelegramStream::skipValue(const TLContactLink *)
 {
-    *this << inputPhotoCropValue.tlType;
+    TLValue tlType;
 
-    switch (inputPhotoCropValue.tlType) {
-    case TLValue::InputPhotoCropAuto:
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactLinkUnknown:
         break;
-    case TLValue::InputPhotoCrop:
-        *this << inputPhotoCropValue.cropLeft;
-        *this << inputPhotoCropValue.cropTop;
-        *this << inputPhotoCropValue.cropWidth;
+    case TLValue::ContactLinkNone:
+        break;
+    case TLValue::ContactLinkHasPhone:
+        break;
+    case TLValue::ContactLinkContact:
         break;
     default:
         break;
@@ -3865,12 +3691,16 @@ CTelegramStream &CTelegramStream::operator<<(const TLInputPhotoCrop &inputPhotoC
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLInputPrivacyKey &inputPrivacyKeyValue)
+CTelegramStream &CTelegramStream::skipValue(const TLContactSuggested *)
 {
-    *this << inputPrivacyKeyValue.tlType;
+    TLValue tlType;
 
-    switch (inputPrivacyKeyValue.tlType) {
-    case TLValue::InputPrivacyKeyStatusTimestamp:
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactSuggested:
+        skip<quint32>();
+        skip<quint32>();
         break;
     default:
         break;
@@ -3879,19 +3709,36 @@ CTelegramStream &CTelegramStream::operator<<(const TLInputPrivacyKey &inputPriva
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLInputStickerSet &inputStickerSetValue)
+CTelegramStream &CTelegramStream::skipValue(const TLDcOption *)
 {
-    *this << inputStickerSetValue.tlType;
+    TLValue tlType;
 
-    switch (inputStickerSetValue.tlType) {
-    case TLValue::InputStickerSetEmpty:
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::DcOption:
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
         break;
-    case TLValue::InputStickerSetID:
-        *this << inputStickerSetValue.id;
-        *this << inputStickerSetValue.accessHash;
+    default:
         break;
-    case TLValue::InputStickerSetShortName:
-        *this << inputStickerSetValue.shortName;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLDisabledFeature *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::DisabledFeature:
+        skip<QString>();
+        skip<QString>();
         break;
     default:
         break;
@@ -3900,21 +3747,42 @@ CTelegramStream &CTelegramStream::operator<<(const TLInputStickerSet &inputStick
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLInputUser &inputUserValue)
+CTelegramStream &CTelegramStream::skipValue(const TLEncryptedChat *)
 {
-    *this << inputUserValue.tlType;
+    TLValue tlType;
 
-    switch (inputUserValue.tlType) {
-    case TLValue::InputUserEmpty:
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::EncryptedChatEmpty:
+        skip<quint32>();
         break;
-    case TLValue::InputUserSelf:
+    case TLValue::EncryptedChatWaiting:
+        skip<quint32>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
         break;
-    case TLValue::InputUserContact:
-        *this << inputUserValue.userId;
+    case TLValue::EncryptedChatRequested:
+        skip<quint32>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
         break;
-    case TLValue::InputUserForeign:
-        *this << inputUserValue.userId;
-        *this << inputUserValue.accessHash;
+    case TLValue::EncryptedChat:
+        skip<quint32>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        skip<quint64>();
+        break;
+    case TLValue::EncryptedChatDiscarded:
+        skip<quint32>();
         break;
     default:
         break;
@@ -3923,16 +3791,21 @@ CTelegramStream &CTelegramStream::operator<<(const TLInputUser &inputUserValue)
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLInputVideo &inputVideoValue)
+CTelegramStream &CTelegramStream::skipValue(const TLEncryptedFile *)
 {
-    *this << inputVideoValue.tlType;
+    TLValue tlType;
 
-    switch (inputVideoValue.tlType) {
-    case TLValue::InputVideoEmpty:
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::EncryptedFileEmpty:
         break;
-    case TLValue::InputVideo:
-        *this << inputVideoValue.id;
-        *this << inputVideoValue.accessHash;
+    case TLValue::EncryptedFile:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
         break;
     default:
         break;
@@ -3941,24 +3814,43 @@ CTelegramStream &CTelegramStream::operator<<(const TLInputVideo &inputVideoValue
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLMessagesFilter &messagesFilterValue)
+CTelegramStream &CTelegramStream::skipValue(const TLEncryptedMessage *)
 {
-    *this << messagesFilterValue.tlType;
+    TLValue tlType;
 
-    switch (messagesFilterValue.tlType) {
-    case TLValue::InputMessagesFilterEmpty:
-        break;
-    case TLValue::InputMessagesFilterPhotos:
-        break;
-    case TLValue::InputMessagesFilterVideo:
-        break;
-    case TLValue::InputMessagesFilterPhotoVideo:
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::EncryptedMessage:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        skip<TLEncryptedFile>();
         break;
-    case TLValue::InputMessagesFilterPhotoVideoDocuments:
+    case TLValue::EncryptedMessageService:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
         break;
-    case TLValue::InputMessagesFilterDocument:
+    default:
         break;
-    case TLValue::InputMessagesFilterAudio:
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLError *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::Error:
+        skip<quint32>();
+        skip<QString>();
         break;
     default:
         break;
@@ -3967,34 +3859,62 @@ CTelegramStream &CTelegramStream::operator<<(const TLMessagesFilter &messagesFil
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLSendMessageAction &sendMessageActionValue)
+CTelegramStream &CTelegramStream::skipValue(const TLExportedChatInvite *)
 {
-    *this << sendMessageActionValue.tlType;
+    TLValue tlType;
 
-    switch (sendMessageActionValue.tlType) {
-    case TLValue::SendMessageTypingAction:
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChatInviteEmpty:
         break;
-    case TLValue::SendMessageCancelAction:
+    case TLValue::ChatInviteExported:
+        skip<QString>();
         break;
-    case TLValue::SendMessageRecordVideoAction:
-        break;
-    case TLValue::SendMessageUploadVideoAction:
-        *this << sendMessageActionValue.progress;
-        break;
-    case TLValue::SendMessageRecordAudioAction:
+    default:
         break;
-    case TLValue::SendMessageUploadAudioAction:
-        *this << sendMessageActionValue.progress;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLFileLocation *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::FileLocationUnavailable:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint64>();
         break;
-    case TLValue::SendMessageUploadPhotoAction:
-        *this << sendMessageActionValue.progress;
+    case TLValue::FileLocation:
+        skip<quint32>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint64>();
         break;
-    case TLValue::SendMessageUploadDocumentAction:
-        *this << sendMessageActionValue.progress;
+    default:
         break;
-    case TLValue::SendMessageGeoLocationAction:
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLGeoPoint *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::GeoPointEmpty:
         break;
-    case TLValue::SendMessageChooseContactAction:
+    case TLValue::GeoPoint:
+        skip<double>();
+        skip<double>();
         break;
     default:
         break;
@@ -4003,31 +3923,55 @@ CTelegramStream &CTelegramStream::operator<<(const TLSendMessageAction &sendMess
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLDocumentAttribute &documentAttributeValue)
+CTelegramStream &CTelegramStream::skipValue(const TLHelpAppUpdate *)
 {
-    *this << documentAttributeValue.tlType;
+    TLValue tlType;
 
-    switch (documentAttributeValue.tlType) {
-    case TLValue::DocumentAttributeImageSize:
-        *this << documentAttributeValue.w;
-        *this << documentAttributeValue.h;
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::HelpAppUpdate:
+        skip<quint32>();
+        skip<bool>();
+        skip<QString>();
+        skip<QString>();
         break;
-    case TLValue::DocumentAttributeAnimated:
+    case TLValue::HelpNoAppUpdate:
         break;
-    case TLValue::DocumentAttributeSticker:
-        *this << documentAttributeValue.alt;
-        *this << documentAttributeValue.stickerset;
+    default:
         break;
-    case TLValue::DocumentAttributeVideo:
-        *this << documentAttributeValue.duration;
-        *this << documentAttributeValue.w;
-        *this << documentAttributeValue.h;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLHelpInviteText *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::HelpInviteText:
+        skip<QString>();
         break;
-    case TLValue::DocumentAttributeAudio:
-        *this << documentAttributeValue.duration;
+    default:
         break;
-    case TLValue::DocumentAttributeFilename:
-        *this << documentAttributeValue.fileName;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLImportedContact *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ImportedContact:
+        skip<quint32>();
+        skip<quint64>();
         break;
     default:
         break;
@@ -4036,20 +3980,38 @@ CTelegramStream &CTelegramStream::operator<<(const TLDocumentAttribute &document
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLInputChatPhoto &inputChatPhotoValue)
+CTelegramStream &CTelegramStream::skipValue(const TLInputAppEvent *)
 {
-    *this << inputChatPhotoValue.tlType;
+    TLValue tlType;
 
-    switch (inputChatPhotoValue.tlType) {
-    case TLValue::InputChatPhotoEmpty:
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputAppEvent:
+        skip<double>();
+        skip<QString>();
+        skip<quint64>();
+        skip<QString>();
         break;
-    case TLValue::InputChatUploadedPhoto:
-        *this << inputChatPhotoValue.file;
-        *this << inputChatPhotoValue.crop;
+    default:
         break;
-    case TLValue::InputChatPhoto:
-        *this << inputChatPhotoValue.id;
-        *this << inputChatPhotoValue.crop;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLInputAudio *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputAudioEmpty:
+        break;
+    case TLValue::InputAudio:
+        skip<quint64>();
+        skip<quint64>();
         break;
     default:
         break;
@@ -4058,76 +4020,112 @@ CTelegramStream &CTelegramStream::operator<<(const TLInputChatPhoto &inputChatPh
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLInputMedia &inputMediaValue)
+CTelegramStream &CTelegramStream::skipValue(const TLInputContact *)
 {
-    *this << inputMediaValue.tlType;
+    TLValue tlType;
 
-    switch (inputMediaValue.tlType) {
-    case TLValue::InputMediaEmpty:
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPhoneContact:
+        skip<quint64>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
         break;
-    case TLValue::InputMediaUploadedPhoto:
-        *this << inputMediaValue.file;
-        *this << inputMediaValue.caption;
+    default:
         break;
-    case TLValue::InputMediaPhoto:
-        *this << inputMediaValue.idInputPhoto;
-        *this << inputMediaValue.caption;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLInputDocument *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputDocumentEmpty:
         break;
-    case TLValue::InputMediaGeoPoint:
-        *this << inputMediaValue.geoPoint;
+    case TLValue::InputDocument:
+        skip<quint64>();
+        skip<quint64>();
         break;
-    case TLValue::InputMediaContact:
-        *this << inputMediaValue.phoneNumber;
-        *this << inputMediaValue.firstName;
-        *this << inputMediaValue.lastName;
+    default:
         break;
-    case TLValue::InputMediaUploadedVideo:
-        *this << inputMediaValue.file;
-        *this << inputMediaValue.duration;
-        *this << inputMediaValue.w;
-        *this << inputMediaValue.h;
-        *this << inputMediaValue.caption;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLInputEncryptedChat *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputEncryptedChat:
+        skip<quint32>();
+        skip<quint64>();
         break;
-    case TLValue::InputMediaUploadedThumbVideo:
-        *this << inputMediaValue.file;
-        *this << inputMediaValue.thumb;
-        *this << inputMediaValue.duration;
-        *this << inputMediaValue.w;
-        *this << inputMediaValue.h;
-        *this << inputMediaValue.caption;
+    default:
         break;
-    case TLValue::InputMediaVideo:
-        *this << inputMediaValue.idInputVeo;
-        *this << inputMediaValue.caption;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLInputEncryptedFile *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputEncryptedFileEmpty:
         break;
-    case TLValue::InputMediaUploadedAudio:
-        *this << inputMediaValue.file;
-        *this << inputMediaValue.duration;
-        *this << inputMediaValue.mimeType;
+    case TLValue::InputEncryptedFileUploaded:
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
         break;
-    case TLValue::InputMediaAudio:
-        *this << inputMediaValue.idInputAudio;
+    case TLValue::InputEncryptedFile:
+        skip<quint64>();
+        skip<quint64>();
         break;
-    case TLValue::InputMediaUploadedDocument:
-        *this << inputMediaValue.file;
-        *this << inputMediaValue.mimeType;
-        *this << inputMediaValue.attributes;
+    case TLValue::InputEncryptedFileBigUploaded:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
         break;
-    case TLValue::InputMediaUploadedThumbDocument:
-        *this << inputMediaValue.file;
-        *this << inputMediaValue.thumb;
-        *this << inputMediaValue.mimeType;
-        *this << inputMediaValue.attributes;
+    default:
         break;
-    case TLValue::InputMediaDocument:
-        *this << inputMediaValue.idInputDocument;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLInputFile *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputFile:
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
         break;
-    case TLValue::InputMediaVenue:
-        *this << inputMediaValue.geoPoint;
-        *this << inputMediaValue.title;
-        *this << inputMediaValue.address;
-        *this << inputMediaValue.provider;
-        *this << inputMediaValue.venueId;
+    case TLValue::InputFileBig:
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
         break;
     default:
         break;
@@ -4136,22 +4134,33 @@ CTelegramStream &CTelegramStream::operator<<(const TLInputMedia &inputMediaValue
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLInputNotifyPeer &inputNotifyPeerValue)
+CTelegramStream &CTelegramStream::skipValue(const TLInputFileLocation *)
 {
-    *this << inputNotifyPeerValue.tlType;
+    TLValue tlType;
 
-    switch (inputNotifyPeerValue.tlType) {
-    case TLValue::InputNotifyPeer:
-        *this << inputNotifyPeerValue.peerInput;
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputFileLocation:
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint64>();
         break;
-    case TLValue::InputNotifyUsers:
+    case TLValue::InputVideoFileLocation:
+        skip<quint64>();
+        skip<quint64>();
         break;
-    case TLValue::InputNotifyChats:
+    case TLValue::InputEncryptedFileLocation:
+        skip<quint64>();
+        skip<quint64>();
         break;
-    case TLValue::InputNotifyAll:
+    case TLValue::InputAudioFileLocation:
+        skip<quint64>();
+        skip<quint64>();
         break;
-    case TLValue::InputNotifyGeoChatPeer:
-        *this << inputNotifyPeerValue.peerInputGeoChat;
+    case TLValue::InputDocumentFileLocation:
+        skip<quint64>();
+        skip<quint64>();
         break;
     default:
         break;
@@ -4160,24 +4169,36 @@ CTelegramStream &CTelegramStream::operator<<(const TLInputNotifyPeer &inputNotif
     return *this;
 }
 
-CTelegramStream &CTelegramStream::operator<<(const TLInputPrivacyRule &inputPrivacyRuleValue)
+CTelegramStream &CTelegramStream::skipValue(const TLInputGeoChat *)
 {
-    *this << inputPrivacyRuleValue.tlType;
+    TLValue tlType;
 
-    switch (inputPrivacyRuleValue.tlType) {
-    case TLValue::InputPrivacyValueAllowContacts:
-        break;
-    case TLValue::InputPrivacyValueAllowAll:
-        break;
-    case TLValue::InputPrivacyValueAllowUsers:
-        *this << inputPrivacyRuleValue.users;
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputGeoChat:
+        skip<quint32>();
+        skip<quint64>();
         break;
-    case TLValue::InputPrivacyValueDisallowContacts:
+    default:
         break;
-    case TLValue::InputPrivacyValueDisallowAll:
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLInputGeoPoint *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputGeoPointEmpty:
         break;
-    case TLValue::InputPrivacyValueDisallowUsers:
-        *this << inputPrivacyRuleValue.users;
+    case TLValue::InputGeoPoint:
+        skip<double>();
+        skip<double>();
         break;
     default:
         break;
@@ -4186,4 +4207,7623 @@ CTelegramStream &CTelegramStream::operator<<(const TLInputPrivacyRule &inputPriv
     return *this;
 }
 
-// End of generated write operators implementation
+CTelegramStream &CTelegramStream::skipValue(const TLInputPeer *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPeerEmpty:
+        break;
+    case TLValue::InputPeerSelf:
+        break;
+    case TLValue::InputPeerContact:
+        skip<quint32>();
+        break;
+    case TLValue::InputPeerForeign:
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    case TLValue::InputPeerChat:
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLInputPeerNotifyEvents *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPeerNotifyEventsEmpty:
+        break;
+    case TLValue::InputPeerNotifyEventsAll:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLInputPeerNotifySettings *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPeerNotifySettings:
+        skip<quint32>();
+        skip<QString>();
+        skip<bool>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLInputPhoto *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPhotoEmpty:
+        break;
+    case TLValue::InputPhoto:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLInputPhotoCrop *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPhotoCropAuto:
+        break;
+    case TLValue::InputPhotoCrop:
+        skip<double>();
+        skip<double>();
+        skip<double>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLInputPrivacyKey *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPrivacyKeyStatusTimestamp:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLInputStickerSet *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputStickerSetEmpty:
+        break;
+    case TLValue::InputStickerSetID:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    case TLValue::InputStickerSetShortName:
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLInputUser *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputUserEmpty:
+        break;
+    case TLValue::InputUserSelf:
+        break;
+    case TLValue::InputUserContact:
+        skip<quint32>();
+        break;
+    case TLValue::InputUserForeign:
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLInputVideo *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputVideoEmpty:
+        break;
+    case TLValue::InputVideo:
+        skip<quint64>();
+        skip<quint64>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLMessagesAffectedHistory *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesAffectedHistory:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLMessagesAffectedMessages *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesAffectedMessages:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLMessagesDhConfig *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesDhConfigNotModified:
+        skip<QByteArray>();
+        break;
+    case TLValue::MessagesDhConfig:
+        skip<quint32>();
+        skip<QByteArray>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLMessagesFilter *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputMessagesFilterEmpty:
+        break;
+    case TLValue::InputMessagesFilterPhotos:
+        break;
+    case TLValue::InputMessagesFilterVideo:
+        break;
+    case TLValue::InputMessagesFilterPhotoVideo:
+        break;
+    case TLValue::InputMessagesFilterPhotoVideoDocuments:
+        break;
+    case TLValue::InputMessagesFilterDocument:
+        break;
+    case TLValue::InputMessagesFilterAudio:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLMessagesSentEncryptedMessage *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesSentEncryptedMessage:
+        skip<quint32>();
+        break;
+    case TLValue::MessagesSentEncryptedFile:
+        skip<quint32>();
+        skip<TLEncryptedFile>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLNearestDc *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::NearestDc:
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLPeer *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PeerUser:
+        skip<quint32>();
+        break;
+    case TLValue::PeerChat:
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLPeerNotifyEvents *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PeerNotifyEventsEmpty:
+        break;
+    case TLValue::PeerNotifyEventsAll:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLPeerNotifySettings *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PeerNotifySettingsEmpty:
+        break;
+    case TLValue::PeerNotifySettings:
+        skip<quint32>();
+        skip<QString>();
+        skip<bool>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLPhotoSize *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PhotoSizeEmpty:
+        skip<QString>();
+        break;
+    case TLValue::PhotoSize:
+        skip<QString>();
+        skip<TLFileLocation>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::PhotoCachedSize:
+        skip<QString>();
+        skip<TLFileLocation>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLPrivacyKey *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PrivacyKeyStatusTimestamp:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLPrivacyRule *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PrivacyValueAllowContacts:
+        break;
+    case TLValue::PrivacyValueAllowAll:
+        break;
+    case TLValue::PrivacyValueAllowUsers:
+        skip<TLVector<quint32> >();
+        break;
+    case TLValue::PrivacyValueDisallowContacts:
+        break;
+    case TLValue::PrivacyValueDisallowAll:
+        break;
+    case TLValue::PrivacyValueDisallowUsers:
+        skip<TLVector<quint32> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLReceivedNotifyMessage *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ReceivedNotifyMessage:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLSendMessageAction *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::SendMessageTypingAction:
+        break;
+    case TLValue::SendMessageCancelAction:
+        break;
+    case TLValue::SendMessageRecordVideoAction:
+        break;
+    case TLValue::SendMessageUploadVideoAction:
+        skip<quint32>();
+        break;
+    case TLValue::SendMessageRecordAudioAction:
+        break;
+    case TLValue::SendMessageUploadAudioAction:
+        skip<quint32>();
+        break;
+    case TLValue::SendMessageUploadPhotoAction:
+        skip<quint32>();
+        break;
+    case TLValue::SendMessageUploadDocumentAction:
+        skip<quint32>();
+        break;
+    case TLValue::SendMessageGeoLocationAction:
+        break;
+    case TLValue::SendMessageChooseContactAction:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLStickerPack *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::StickerPack:
+        skip<QString>();
+        skip<TLVector<quint64> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLStickerSet *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::StickerSet:
+        skip<quint64>();
+        skip<quint64>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLStorageFileType *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::StorageFileUnknown:
+        break;
+    case TLValue::StorageFileJpeg:
+        break;
+    case TLValue::StorageFileGif:
+        break;
+    case TLValue::StorageFilePng:
+        break;
+    case TLValue::StorageFilePdf:
+        break;
+    case TLValue::StorageFileMp3:
+        break;
+    case TLValue::StorageFileMov:
+        break;
+    case TLValue::StorageFilePartial:
+        break;
+    case TLValue::StorageFileMp4:
+        break;
+    case TLValue::StorageFileWebp:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLUpdatesState *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UpdatesState:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLUploadFile *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UploadFile:
+        skip<TLStorageFileType>();
+        skip<quint32>();
+        skip<QByteArray>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLUserProfilePhoto *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UserProfilePhotoEmpty:
+        break;
+    case TLValue::UserProfilePhoto:
+        skip<quint64>();
+        skip<TLFileLocation>();
+        skip<TLFileLocation>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLUserStatus *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UserStatusEmpty:
+        break;
+    case TLValue::UserStatusOnline:
+        skip<quint32>();
+        break;
+    case TLValue::UserStatusOffline:
+        skip<quint32>();
+        break;
+    case TLValue::UserStatusRecently:
+        break;
+    case TLValue::UserStatusLastWeek:
+        break;
+    case TLValue::UserStatusLastMonth:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLVideo *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::VideoEmpty:
+        skip<quint64>();
+        break;
+    case TLValue::Video:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLPhotoSize>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLWallPaper *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::WallPaper:
+        skip<quint32>();
+        skip<QString>();
+        skip<TLVector<TLPhotoSize> >();
+        skip<quint32>();
+        break;
+    case TLValue::WallPaperSolid:
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLAccountAuthorizations *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AccountAuthorizations:
+        skip<TLVector<TLAuthorization> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLChatPhoto *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChatPhotoEmpty:
+        break;
+    case TLValue::ChatPhoto:
+        skip<TLFileLocation>();
+        skip<TLFileLocation>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLConfig *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::Config:
+        skip<quint32>();
+        skip<quint32>();
+        skip<bool>();
+        skip<quint32>();
+        skip<TLVector<TLDcOption> >();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLVector<TLDisabledFeature> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLContactStatus *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactStatus:
+        skip<quint32>();
+        skip<TLUserStatus>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLDialog *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::Dialog:
+        skip<TLPeer>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLPeerNotifySettings>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLDocumentAttribute *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::DocumentAttributeImageSize:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::DocumentAttributeAnimated:
+        break;
+    case TLValue::DocumentAttributeSticker:
+        skip<QString>();
+        skip<TLInputStickerSet>();
+        break;
+    case TLValue::DocumentAttributeVideo:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::DocumentAttributeAudio:
+        skip<quint32>();
+        break;
+    case TLValue::DocumentAttributeFilename:
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLInputChatPhoto *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputChatPhotoEmpty:
+        break;
+    case TLValue::InputChatUploadedPhoto:
+        skip<TLInputFile>();
+        skip<TLInputPhotoCrop>();
+        break;
+    case TLValue::InputChatPhoto:
+        skip<TLInputPhoto>();
+        skip<TLInputPhotoCrop>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLInputMedia *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputMediaEmpty:
+        break;
+    case TLValue::InputMediaUploadedPhoto:
+        skip<TLInputFile>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaPhoto:
+        skip<TLInputPhoto>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaGeoPoint:
+        skip<TLInputGeoPoint>();
+        break;
+    case TLValue::InputMediaContact:
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaUploadedVideo:
+        skip<TLInputFile>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaUploadedThumbVideo:
+        skip<TLInputFile>();
+        skip<TLInputFile>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaVideo:
+        skip<TLInputVideo>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaUploadedAudio:
+        skip<TLInputFile>();
+        skip<quint32>();
+        skip<QString>();
+        break;
+    case TLValue::InputMediaAudio:
+        skip<TLInputAudio>();
+        break;
+    case TLValue::InputMediaUploadedDocument:
+        skip<TLInputFile>();
+        skip<QString>();
+        skip<TLVector<TLDocumentAttribute> >();
+        break;
+    case TLValue::InputMediaUploadedThumbDocument:
+        skip<TLInputFile>();
+        skip<TLInputFile>();
+        skip<QString>();
+        skip<TLVector<TLDocumentAttribute> >();
+        break;
+    case TLValue::InputMediaDocument:
+        skip<TLInputDocument>();
+        break;
+    case TLValue::InputMediaVenue:
+        skip<TLInputGeoPoint>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLInputNotifyPeer *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputNotifyPeer:
+        skip<TLInputPeer>();
+        break;
+    case TLValue::InputNotifyUsers:
+        break;
+    case TLValue::InputNotifyChats:
+        break;
+    case TLValue::InputNotifyAll:
+        break;
+    case TLValue::InputNotifyGeoChatPeer:
+        skip<TLInputGeoChat>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLInputPrivacyRule *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::InputPrivacyValueAllowContacts:
+        break;
+    case TLValue::InputPrivacyValueAllowAll:
+        break;
+    case TLValue::InputPrivacyValueAllowUsers:
+        skip<TLVector<TLInputUser> >();
+        break;
+    case TLValue::InputPrivacyValueDisallowContacts:
+        break;
+    case TLValue::InputPrivacyValueDisallowAll:
+        break;
+    case TLValue::InputPrivacyValueDisallowUsers:
+        skip<TLVector<TLInputUser> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLNotifyPeer *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::NotifyPeer:
+        skip<TLPeer>();
+        break;
+    case TLValue::NotifyUsers:
+        break;
+    case TLValue::NotifyChats:
+        break;
+    case TLValue::NotifyAll:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLPhoto *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PhotoEmpty:
+        skip<quint64>();
+        break;
+    case TLValue::Photo:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLGeoPoint>();
+        skip<TLVector<TLPhotoSize> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLUser *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UserEmpty:
+        skip<quint32>();
+        break;
+    case TLValue::UserSelf:
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<TLUserProfilePhoto>();
+        skip<TLUserStatus>();
+        break;
+    case TLValue::UserContact:
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint64>();
+        skip<QString>();
+        skip<TLUserProfilePhoto>();
+        skip<TLUserStatus>();
+        break;
+    case TLValue::UserRequest:
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint64>();
+        skip<QString>();
+        skip<TLUserProfilePhoto>();
+        skip<TLUserStatus>();
+        break;
+    case TLValue::UserForeign:
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint64>();
+        skip<TLUserProfilePhoto>();
+        skip<TLUserStatus>();
+        break;
+    case TLValue::UserDeleted:
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLWebPage *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::WebPageEmpty:
+        skip<quint64>();
+        break;
+    case TLValue::WebPagePending:
+        skip<quint64>();
+        skip<quint32>();
+        break;
+    case TLValue::WebPage:
+        *this >> flags;
+        skip<quint64>();
+        skip<QString>();
+        skip<QString>();
+        if (flags & 1 << 0) {
+            skip<QString>();
+        }
+        if (flags & 1 << 1) {
+            skip<QString>();
+        }
+        if (flags & 1 << 2) {
+            skip<QString>();
+        }
+        if (flags & 1 << 3) {
+            skip<QString>();
+        }
+        if (flags & 1 << 4) {
+            skip<TLPhoto>();
+        }
+        if (flags & 1 << 5) {
+            skip<QString>();
+        }
+        if (flags & 1 << 5) {
+            skip<QString>();
+        }
+        if (flags & 1 << 6) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 6) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 7) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 8) {
+            skip<QString>();
+        }
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLAccountPrivacyRules *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AccountPrivacyRules:
+        skip<TLVector<TLPrivacyRule> >();
+        skip<TLVector<TLUser> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLAuthAuthorization *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::AuthAuthorization:
+        skip<quint32>();
+        skip<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLChat *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChatEmpty:
+        skip<quint32>();
+        break;
+    case TLValue::Chat:
+        skip<quint32>();
+        skip<QString>();
+        skip<TLChatPhoto>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<bool>();
+        skip<quint32>();
+        break;
+    case TLValue::ChatForbidden:
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        break;
+    case TLValue::GeoChat:
+        skip<quint32>();
+        skip<quint64>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<TLGeoPoint>();
+        skip<TLChatPhoto>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<bool>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLChatFull *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChatFull:
+        skip<quint32>();
+        skip<TLChatParticipants>();
+        skip<TLPhoto>();
+        skip<TLPeerNotifySettings>();
+        skip<TLExportedChatInvite>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLChatInvite *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChatInviteAlready:
+        skip<TLChat>();
+        break;
+    case TLValue::ChatInvite:
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLContactsBlocked *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactsBlocked:
+        skip<TLVector<TLContactBlocked> >();
+        skip<TLVector<TLUser> >();
+        break;
+    case TLValue::ContactsBlockedSlice:
+        skip<quint32>();
+        skip<TLVector<TLContactBlocked> >();
+        skip<TLVector<TLUser> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLContactsContacts *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactsContactsNotModified:
+        break;
+    case TLValue::ContactsContacts:
+        skip<TLVector<TLContact> >();
+        skip<TLVector<TLUser> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLContactsFound *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactsFound:
+        skip<TLVector<TLContactFound> >();
+        skip<TLVector<TLUser> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLContactsImportedContacts *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactsImportedContacts:
+        skip<TLVector<TLImportedContact> >();
+        skip<TLVector<quint64> >();
+        skip<TLVector<TLUser> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLContactsLink *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactsLink:
+        skip<TLContactLink>();
+        skip<TLContactLink>();
+        skip<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLContactsSuggested *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::ContactsSuggested:
+        skip<TLVector<TLContactSuggested> >();
+        skip<TLVector<TLUser> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLDocument *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::DocumentEmpty:
+        skip<quint64>();
+        break;
+    case TLValue::Document:
+        skip<quint64>();
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        skip<TLPhotoSize>();
+        skip<quint32>();
+        skip<TLVector<TLDocumentAttribute> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLHelpSupport *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::HelpSupport:
+        skip<QString>();
+        skip<TLUser>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLMessageAction *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessageActionEmpty:
+        break;
+    case TLValue::MessageActionChatCreate:
+        skip<QString>();
+        skip<TLVector<quint32> >();
+        break;
+    case TLValue::MessageActionChatEditTitle:
+        skip<QString>();
+        break;
+    case TLValue::MessageActionChatEditPhoto:
+        skip<TLPhoto>();
+        break;
+    case TLValue::MessageActionChatDeletePhoto:
+        break;
+    case TLValue::MessageActionChatAddUser:
+        skip<quint32>();
+        break;
+    case TLValue::MessageActionChatDeleteUser:
+        skip<quint32>();
+        break;
+    case TLValue::MessageActionGeoChatCreate:
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::MessageActionGeoChatCheckin:
+        break;
+    case TLValue::MessageActionChatJoinedByLink:
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLMessageMedia *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessageMediaEmpty:
+        break;
+    case TLValue::MessageMediaPhoto:
+        skip<TLPhoto>();
+        skip<QString>();
+        break;
+    case TLValue::MessageMediaVideo:
+        skip<TLVideo>();
+        skip<QString>();
+        break;
+    case TLValue::MessageMediaGeo:
+        skip<TLGeoPoint>();
+        break;
+    case TLValue::MessageMediaContact:
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<quint32>();
+        break;
+    case TLValue::MessageMediaUnsupported:
+        break;
+    case TLValue::MessageMediaDocument:
+        skip<TLDocument>();
+        break;
+    case TLValue::MessageMediaAudio:
+        skip<TLAudio>();
+        break;
+    case TLValue::MessageMediaWebPage:
+        skip<TLWebPage>();
+        break;
+    case TLValue::MessageMediaVenue:
+        skip<TLGeoPoint>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLMessagesAllStickers *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesAllStickersNotModified:
+        break;
+    case TLValue::MessagesAllStickers:
+        skip<QString>();
+        skip<TLVector<TLStickerPack> >();
+        skip<TLVector<TLStickerSet> >();
+        skip<TLVector<TLDocument> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLMessagesChatFull *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesChatFull:
+        skip<TLChatFull>();
+        skip<TLVector<TLChat> >();
+        skip<TLVector<TLUser> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLMessagesChats *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesChats:
+        skip<TLVector<TLChat> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLMessagesSentMessage *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesSentMessage:
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLMessageMedia>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::MessagesSentMessageLink:
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLMessageMedia>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLVector<TLContactsLink> >();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLMessagesStickerSet *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesStickerSet:
+        skip<TLStickerSet>();
+        skip<TLVector<TLStickerPack> >();
+        skip<TLVector<TLDocument> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLMessagesStickers *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesStickersNotModified:
+        break;
+    case TLValue::MessagesStickers:
+        skip<QString>();
+        skip<TLVector<TLDocument> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLPhotosPhoto *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PhotosPhoto:
+        skip<TLPhoto>();
+        skip<TLVector<TLUser> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLPhotosPhotos *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::PhotosPhotos:
+        skip<TLVector<TLPhoto> >();
+        skip<TLVector<TLUser> >();
+        break;
+    case TLValue::PhotosPhotosSlice:
+        skip<quint32>();
+        skip<TLVector<TLPhoto> >();
+        skip<TLVector<TLUser> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLUserFull *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UserFull:
+        skip<TLUser>();
+        skip<TLContactsLink>();
+        skip<TLPhoto>();
+        skip<TLPeerNotifySettings>();
+        skip<bool>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLGeoChatMessage *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::GeoChatMessageEmpty:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::GeoChatMessage:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        skip<TLMessageMedia>();
+        break;
+    case TLValue::GeoChatMessageService:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLMessageAction>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLGeochatsLocated *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::GeochatsLocated:
+        skip<TLVector<TLChatLocated> >();
+        skip<TLVector<TLGeoChatMessage> >();
+        skip<TLVector<TLChat> >();
+        skip<TLVector<TLUser> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLGeochatsMessages *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::GeochatsMessages:
+        skip<TLVector<TLGeoChatMessage> >();
+        skip<TLVector<TLChat> >();
+        skip<TLVector<TLUser> >();
+        break;
+    case TLValue::GeochatsMessagesSlice:
+        skip<quint32>();
+        skip<TLVector<TLGeoChatMessage> >();
+        skip<TLVector<TLChat> >();
+        skip<TLVector<TLUser> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLGeochatsStatedMessage *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::GeochatsStatedMessage:
+        skip<TLGeoChatMessage>();
+        skip<TLVector<TLChat> >();
+        skip<TLVector<TLUser> >();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLMessage *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessageEmpty:
+        skip<quint32>();
+        break;
+    case TLValue::Message:
+        *this >> flags;
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLPeer>();
+        if (flags & 1 << 2) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 2) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 3) {
+            skip<quint32>();
+        }
+        skip<quint32>();
+        skip<QString>();
+        skip<TLMessageMedia>();
+        break;
+    case TLValue::MessageService:
+        *this >> flags;
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLPeer>();
+        skip<quint32>();
+        skip<TLMessageAction>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLMessagesDialogs *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesDialogs:
+        skip<TLVector<TLDialog> >();
+        skip<TLVector<TLMessage> >();
+        skip<TLVector<TLChat> >();
+        skip<TLVector<TLUser> >();
+        break;
+    case TLValue::MessagesDialogsSlice:
+        skip<quint32>();
+        skip<TLVector<TLDialog> >();
+        skip<TLVector<TLMessage> >();
+        skip<TLVector<TLChat> >();
+        skip<TLVector<TLUser> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLMessagesMessages *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessagesMessages:
+        skip<TLVector<TLMessage> >();
+        skip<TLVector<TLChat> >();
+        skip<TLVector<TLUser> >();
+        break;
+    case TLValue::MessagesMessagesSlice:
+        skip<quint32>();
+        skip<TLVector<TLMessage> >();
+        skip<TLVector<TLChat> >();
+        skip<TLVector<TLUser> >();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLUpdate *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UpdateNewMessage:
+        skip<TLMessage>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateMessageID:
+        skip<quint32>();
+        skip<quint64>();
+        break;
+    case TLValue::UpdateDeleteMessages:
+        skip<TLVector<quint32> >();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateUserTyping:
+        skip<quint32>();
+        skip<TLSendMessageAction>();
+        break;
+    case TLValue::UpdateChatUserTyping:
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLSendMessageAction>();
+        break;
+    case TLValue::UpdateChatParticipants:
+        skip<TLChatParticipants>();
+        break;
+    case TLValue::UpdateUserStatus:
+        skip<quint32>();
+        skip<TLUserStatus>();
+        break;
+    case TLValue::UpdateUserName:
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::UpdateUserPhoto:
+        skip<quint32>();
+        skip<quint32>();
+        skip<TLUserProfilePhoto>();
+        skip<bool>();
+        break;
+    case TLValue::UpdateContactRegistered:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateContactLink:
+        skip<quint32>();
+        skip<TLContactLink>();
+        skip<TLContactLink>();
+        break;
+    case TLValue::UpdateNewAuthorization:
+        skip<quint64>();
+        skip<quint32>();
+        skip<QString>();
+        skip<QString>();
+        break;
+    case TLValue::UpdateNewGeoChatMessage:
+        skip<TLGeoChatMessage>();
+        break;
+    case TLValue::UpdateNewEncryptedMessage:
+        skip<TLEncryptedMessage>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateEncryptedChatTyping:
+        skip<quint32>();
+        break;
+    case TLValue::UpdateEncryption:
+        skip<TLEncryptedChat>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateEncryptedMessagesRead:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateChatParticipantAdd:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateChatParticipantDelete:
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateDcOptions:
+        skip<TLVector<TLDcOption> >();
+        break;
+    case TLValue::UpdateUserBlocked:
+        skip<quint32>();
+        skip<bool>();
+        break;
+    case TLValue::UpdateNotifySettings:
+        skip<TLNotifyPeer>();
+        skip<TLPeerNotifySettings>();
+        break;
+    case TLValue::UpdateServiceNotification:
+        skip<QString>();
+        skip<QString>();
+        skip<TLMessageMedia>();
+        skip<bool>();
+        break;
+    case TLValue::UpdatePrivacy:
+        skip<TLPrivacyKey>();
+        skip<TLVector<TLPrivacyRule> >();
+        break;
+    case TLValue::UpdateUserPhone:
+        skip<quint32>();
+        skip<QString>();
+        break;
+    case TLValue::UpdateReadHistoryInbox:
+        skip<TLPeer>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateReadHistoryOutbox:
+        skip<TLPeer>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdateWebPage:
+        skip<TLWebPage>();
+        break;
+    case TLValue::UpdateReadMessagesContents:
+        skip<TLVector<quint32> >();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLUpdates *)
+{
+    TLValue tlType;
+    quint32 flags = 0;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UpdatesTooLong:
+        break;
+    case TLValue::UpdateShortMessage:
+        *this >> flags;
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        if (flags & 1 << 2) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 2) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 3) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::UpdateShortChatMessage:
+        *this >> flags;
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<QString>();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        if (flags & 1 << 2) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 2) {
+            skip<quint32>();
+        }
+        if (flags & 1 << 3) {
+            skip<quint32>();
+        }
+        break;
+    case TLValue::UpdateShort:
+        skip<TLUpdate>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdatesCombined:
+        skip<TLVector<TLUpdate> >();
+        skip<TLVector<TLUser> >();
+        skip<TLVector<TLChat> >();
+        skip<quint32>();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::Updates:
+        skip<TLVector<TLUpdate> >();
+        skip<TLVector<TLUser> >();
+        skip<TLVector<TLChat> >();
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::skipValue(const TLUpdatesDifference *)
+{
+    TLValue tlType;
+
+    *this >> tlType;
+
+    switch (tlType) {
+    case TLValue::UpdatesDifferenceEmpty:
+        skip<quint32>();
+        skip<quint32>();
+        break;
+    case TLValue::UpdatesDifference:
+        skip<TLVector<TLMessage> >();
+        skip<TLVector<TLEncryptedMessage> >();
+        skip<TLVector<TLUpdate> >();
+        skip<TLVector<TLChat> >();
+        skip<TLVector<TLUser> >();
+        skip<TLUpdatesState>();
+        break;
+    case TLValue::UpdatesDifferenceSlice:
+        skip<TLVector<TLMessage> >();
+        skip<TLVector<TLEncryptedMessage> >();
+        skip<TLVector<TLUpdate> >();
+        skip<TLVector<TLChat> >();
+        skip<TLVector<TLUser> >();
+        skip<TLUpdatesState>();
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+// End of generated skip functions implementation
+
+template <typename T>
+CTelegramStream &CTelegramStream::operator<<(const TLVector<T> &v)
+{
+    *this << v.tlType;
+
+    if (v.tlType == TLValue::Vector) {
+        *this << quint32(v.count());
+
+        for (int i = 0; i < v.count(); ++i) {
+            *this << v.at(i);
+        }
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const QByteArray &data)
+{
+    quint32 length = data.size();
+
+    if (length < 0xfe) {
+        const char lengthToWrite = length;
+        write(&lengthToWrite, 1);
+        write(data.constData(), data.size());
+        length += 1;
+    } else {
+        *this << quint32((length << 8) + 0xfe);
+        write(data.constData(), data.size());
+        length += 4;
+    }
+
+    if (length & 3) {
+        write(s_nulls, 4 - (length & 3));
+    }
+
+    return *this;
+}
+
+#ifndef TELEGRAMQT_SCHEMA_CODEC
+// Generated write operators implementation
+CTelegramStream &CTelegramStream::operator<<(const TLAccountDaysTTL &accountDaysTTLValue)
+{
+    *this << accountDaysTTLValue.tlType;
+
+    switch (accountDaysTTLValue.tlType) {
+    case TLValue::AccountDaysTTL:
+        *this << accountDaysTTLValue.days;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLAccountPassword &accountPasswordValue)
+{
+    *this << accountPasswordValue.tlType;
+
+    switch (accountPasswordValue.tlType) {
+    case TLValue::AccountNoPassword:
+        *this << accountPasswordValue.newSalt;
+        *this << accountPasswordValue.emailUnconfirmedPattern;
+        break;
+    case TLValue::AccountPassword:
+        *this << accountPasswordValue.currentSalt;
+        *this << accountPasswordValue.newSalt;
+        *this << accountPasswordValue.hint;
+        *this << accountPasswordValue.hasRecovery;
+        *this << accountPasswordValue.emailUnconfirmedPattern;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLAccountPasswordInputSettings &accountPasswordInputSettingsValue)
+{
+    *this << accountPasswordInputSettingsValue.tlType;
+
+    switch (accountPasswordInputSettingsValue.tlType) {
+    case TLValue::AccountPasswordInputSettings:
+        *this << accountPasswordInputSettingsValue.flags;
+        if (accountPasswordInputSettingsValue.flags & 1 << 0) {
+            *this << accountPasswordInputSettingsValue.newSalt;
+        }
+        if (accountPasswordInputSettingsValue.flags & 1 << 0) {
+            *this << accountPasswordInputSettingsValue.newPasswordHash;
+        }
+        if (accountPasswordInputSettingsValue.flags & 1 << 0) {
+            *this << accountPasswordInputSettingsValue.hint;
+        }
+        if (accountPasswordInputSettingsValue.flags & 1 << 1) {
+            *this << accountPasswordInputSettingsValue.email;
+        }
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLAccountPasswordSettings &accountPasswordSettingsValue)
+{
+    *this << accountPasswordSettingsValue.tlType;
+
+    switch (accountPasswordSettingsValue.tlType) {
+    case TLValue::AccountPasswordSettings:
+        *this << accountPasswordSettingsValue.email;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLAccountSentChangePhoneCode &accountSentChangePhoneCodeValue)
+{
+    *this << accountSentChangePhoneCodeValue.tlType;
+
+    switch (accountSentChangePhoneCodeValue.tlType) {
+    case TLValue::AccountSentChangePhoneCode:
+        *this << accountSentChangePhoneCodeValue.phoneCodeHash;
+        *this << accountSentChangePhoneCodeValue.sendCallTimeout;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLAudio &audioValue)
+{
+    *this << audioValue.tlType;
+
+    switch (audioValue.tlType) {
+    case TLValue::AudioEmpty:
+        *this << audioValue.id;
+        break;
+    case TLValue::Audio:
+        *this << audioValue.id;
+        *this << audioValue.accessHash;
+        *this << audioValue.userId;
+        *this << audioValue.date;
+        *this << audioValue.duration;
+        *this << audioValue.mimeType;
+        *this << audioValue.size;
+        *this << audioValue.dcId;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLAuthCheckedPhone &authCheckedPhoneValue)
+{
+    *this << authCheckedPhoneValue.tlType;
+
+    switch (authCheckedPhoneValue.tlType) {
+    case TLValue::AuthCheckedPhone:
+        *this << authCheckedPhoneValue.phoneRegistered;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLAuthExportedAuthorization &authExportedAuthorizationValue)
+{
+    *this << authExportedAuthorizationValue.tlType;
+
+    switch (authExportedAuthorizationValue.tlType) {
+    case TLValue::AuthExportedAuthorization:
+        *this << authExportedAuthorizationValue.id;
+        *this << authExportedAuthorizationValue.bytes;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLAuthPasswordRecovery &authPasswordRecoveryValue)
+{
+    *this << authPasswordRecoveryValue.tlType;
+
+    switch (authPasswordRecoveryValue.tlType) {
+    case TLValue::AuthPasswordRecovery:
+        *this << authPasswordRecoveryValue.emailPattern;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLAuthSentCode &authSentCodeValue)
+{
+    *this << authSentCodeValue.tlType;
+
+    switch (authSentCodeValue.tlType) {
+    case TLValue::AuthSentCode:
+        *this << authSentCodeValue.phoneRegistered;
+        *this << authSentCodeValue.phoneCodeHash;
+        *this << authSentCodeValue.sendCallTimeout;
+        *this << authSentCodeValue.isPassword;
+        break;
+    case TLValue::AuthSentAppCode:
+        *this << authSentCodeValue.phoneRegistered;
+        *this << authSentCodeValue.phoneCodeHash;
+        *this << authSentCodeValue.sendCallTimeout;
+        *this << authSentCodeValue.isPassword;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLAuthorization &authorizationValue)
+{
+    *this << authorizationValue.tlType;
+
+    switch (authorizationValue.tlType) {
+    case TLValue::Authorization:
+        *this << authorizationValue.hash;
+        *this << authorizationValue.flags;
+        *this << authorizationValue.deviceModel;
+        *this << authorizationValue.platform;
+        *this << authorizationValue.systemVersion;
+        *this << authorizationValue.apiId;
+        *this << authorizationValue.appName;
+        *this << authorizationValue.appVersion;
+        *this << authorizationValue.dateCreated;
+        *this << authorizationValue.dateActive;
+        *this << authorizationValue.ip;
+        *this << authorizationValue.country;
+        *this << authorizationValue.region;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLChatLocated &chatLocatedValue)
+{
+    *this << chatLocatedValue.tlType;
+
+    switch (chatLocatedValue.tlType) {
+    case TLValue::ChatLocated:
+        *this << chatLocatedValue.chatId;
+        *this << chatLocatedValue.distance;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLChatParticipant &chatParticipantValue)
+{
+    *this << chatParticipantValue.tlType;
+
+    switch (chatParticipantValue.tlType) {
+    case TLValue::ChatParticipant:
+        *this << chatParticipantValue.userId;
+        *this << chatParticipantValue.inviterId;
+        *this << chatParticipantValue.date;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLChatParticipants &chatParticipantsValue)
+{
+    *this << chatParticipantsValue.tlType;
+
+    switch (chatParticipantsValue.tlType) {
+    case TLValue::ChatParticipantsForbidden:
+        *this << chatParticipantsValue.chatId;
+        break;
+    case TLValue::ChatParticipants:
+        *this << chatParticipantsValue.chatId;
+        *this << chatParticipantsValue.adminId;
+        *this << chatParticipantsValue.participants;
+        *this << chatParticipantsValue.version;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLContact &contactValue)
+{
+    *this << contactValue.tlType;
+
+    switch (contactValue.tlType) {
+    case TLValue::Contact:
+        *this << contactValue.userId;
+        *this << contactValue.mutual;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLContactBlocked &contactBlockedValue)
+{
+    *this << contactBlockedValue.tlType;
+
+    switch (contactBlockedValue.tlType) {
+    case TLValue::ContactBlocked:
+        *this << contactBlockedValue.userId;
+        *this << contactBlockedValue.date;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLContactFound &contactFoundValue)
+{
+    *this << contactFoundValue.tlType;
+
+    switch (contactFoundValue.tlType) {
+    case TLValue::ContactFound:
+        *this << contactFoundValue.userId;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLContactLink &contactLinkValue)
+{
+    *this << contactLinkValue.tlType;
+
+    switch (contactLinkValue.tlType) {
+    case TLValue::ContactLinkUnknown:
+        break;
+    case TLValue::ContactLinkNone:
+        break;
+    case TLValue::ContactLinkHasPhone:
+        break;
+    case TLValue::ContactLinkContact:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLContactSuggested &contactSuggestedValue)
+{
+    *this << contactSuggestedValue.tlType;
+
+    switch (contactSuggestedValue.tlType) {
+    case TLValue::ContactSuggested:
+        *this << contactSuggestedValue.userId;
+        *this << contactSuggestedValue.mutualContacts;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLDcOption &dcOptionValue)
+{
+    *this << dcOptionValue.tlType;
+
+    switch (dcOptionValue.tlType) {
+    case TLValue::DcOption:
+        *this << dcOptionValue.id;
+        *this << dcOptionValue.hostname;
+        *this << dcOptionValue.ipAddress;
+        *this << dcOptionValue.port;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLDisabledFeature &disabledFeatureValue)
+{
+    *this << disabledFeatureValue.tlType;
+
+    switch (disabledFeatureValue.tlType) {
+    case TLValue::DisabledFeature:
+        *this << disabledFeatureValue.feature;
+        *this << disabledFeatureValue.description;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLEncryptedChat &encryptedChatValue)
+{
+    *this << encryptedChatValue.tlType;
+
+    switch (encryptedChatValue.tlType) {
+    case TLValue::EncryptedChatEmpty:
+        *this << encryptedChatValue.id;
+        break;
+    case TLValue::EncryptedChatWaiting:
+        *this << encryptedChatValue.id;
+        *this << encryptedChatValue.accessHash;
+        *this << encryptedChatValue.date;
+        *this << encryptedChatValue.adminId;
+        *this << encryptedChatValue.participantId;
+        break;
+    case TLValue::EncryptedChatRequested:
+        *this << encryptedChatValue.id;
+        *this << encryptedChatValue.accessHash;
+        *this << encryptedChatValue.date;
+        *this << encryptedChatValue.adminId;
+        *this << encryptedChatValue.participantId;
+        *this << encryptedChatValue.gA;
+        break;
+    case TLValue::EncryptedChat:
+        *this << encryptedChatValue.id;
+        *this << encryptedChatValue.accessHash;
+        *this << encryptedChatValue.date;
+        *this << encryptedChatValue.adminId;
+        *this << encryptedChatValue.participantId;
+        *this << encryptedChatValue.gAOrB;
+        *this << encryptedChatValue.keyFingerprint;
+        break;
+    case TLValue::EncryptedChatDiscarded:
+        *this << encryptedChatValue.id;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLEncryptedFile &encryptedFileValue)
+{
+    *this << encryptedFileValue.tlType;
+
+    switch (encryptedFileValue.tlType) {
+    case TLValue::EncryptedFileEmpty:
+        break;
+    case TLValue::EncryptedFile:
+        *this << encryptedFileValue.id;
+        *this << encryptedFileValue.accessHash;
+        *this << encryptedFileValue.size;
+        *this << encryptedFileValue.dcId;
+        *this << encryptedFileValue.keyFingerprint;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLEncryptedMessage &encryptedMessageValue)
+{
+    *this << encryptedMessageValue.tlType;
+
+    switch (encryptedMessageValue.tlType) {
+    case TLValue::EncryptedMessage:
+        *this << encryptedMessageValue.randomId;
+        *this << encryptedMessageValue.chatId;
+        *this << encryptedMessageValue.date;
+        *this << encryptedMessageValue.bytes;
+        *this << encryptedMessageValue.file;
+        break;
+    case TLValue::EncryptedMessageService:
+        *this << encryptedMessageValue.randomId;
+        *this << encryptedMessageValue.chatId;
+        *this << encryptedMessageValue.date;
+        *this << encryptedMessageValue.bytes;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLError &errorValue)
+{
+    *this << errorValue.tlType;
+
+    switch (errorValue.tlType) {
+    case TLValue::Error:
+        *this << errorValue.code;
+        *this << errorValue.text;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLExportedChatInvite &exportedChatInviteValue)
+{
+    *this << exportedChatInviteValue.tlType;
+
+    switch (exportedChatInviteValue.tlType) {
+    case TLValue::ChatInviteEmpty:
+        break;
+    case TLValue::ChatInviteExported:
+        *this << exportedChatInviteValue.link;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLFileLocation &fileLocationValue)
+{
+    *this << fileLocationValue.tlType;
+
+    switch (fileLocationValue.tlType) {
+    case TLValue::FileLocationUnavailable:
+        *this << fileLocationValue.volumeId;
+        *this << fileLocationValue.localId;
+        *this << fileLocationValue.secret;
+        break;
+    case TLValue::FileLocation:
+        *this << fileLocationValue.dcId;
+        *this << fileLocationValue.volumeId;
+        *this << fileLocationValue.localId;
+        *this << fileLocationValue.secret;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLGeoPoint &geoPointValue)
+{
+    *this << geoPointValue.tlType;
+
+    switch (geoPointValue.tlType) {
+    case TLValue::GeoPointEmpty:
+        break;
+    case TLValue::GeoPoint:
+        *this << geoPointValue.longitude;
+        *this << geoPointValue.latitude;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLHelpAppUpdate &helpAppUpdateValue)
+{
+    *this << helpAppUpdateValue.tlType;
+
+    switch (helpAppUpdateValue.tlType) {
+    case TLValue::HelpAppUpdate:
+        *this << helpAppUpdateValue.id;
+        *this << helpAppUpdateValue.critical;
+        *this << helpAppUpdateValue.url;
+        *this << helpAppUpdateValue.text;
+        break;
+    case TLValue::HelpNoAppUpdate:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLHelpInviteText &helpInviteTextValue)
+{
+    *this << helpInviteTextValue.tlType;
+
+    switch (helpInviteTextValue.tlType) {
+    case TLValue::HelpInviteText:
+        *this << helpInviteTextValue.message;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLImportedContact &importedContactValue)
+{
+    *this << importedContactValue.tlType;
+
+    switch (importedContactValue.tlType) {
+    case TLValue::ImportedContact:
+        *this << importedContactValue.userId;
+        *this << importedContactValue.clientId;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLInputAppEvent &inputAppEventValue)
+{
+    *this << inputAppEventValue.tlType;
+
+    switch (inputAppEventValue.tlType) {
+    case TLValue::InputAppEvent:
+        *this << inputAppEventValue.time;
+        *this << inputAppEventValue.type;
+        *this << inputAppEventValue.peer;
+        *this << inputAppEventValue.data;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLInputAudio &inputAudioValue)
+{
+    *this << inputAudioValue.tlType;
+
+    switch (inputAudioValue.tlType) {
+    case TLValue::InputAudioEmpty:
+        break;
+    case TLValue::InputAudio:
+        *this << inputAudioValue.id;
+        *this << inputAudioValue.accessHash;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLInputContact &inputContactValue)
+{
+    *this << inputContactValue.tlType;
+
+    switch (inputContactValue.tlType) {
+    case TLValue::InputPhoneContact:
+        *this << inputContactValue.clientId;
+        *this << inputContactValue.phone;
+        *this << inputContactValue.firstName;
+        *this << inputContactValue.lastName;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLInputDocument &inputDocumentValue)
+{
+    *this << inputDocumentValue.tlType;
+
+    switch (inputDocumentValue.tlType) {
+    case TLValue::InputDocumentEmpty:
+        break;
+    case TLValue::InputDocument:
+        *this << inputDocumentValue.id;
+        *this << inputDocumentValue.accessHash;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLInputEncryptedChat &inputEncryptedChatValue)
+{
+    *this << inputEncryptedChatValue.tlType;
+
+    switch (inputEncryptedChatValue.tlType) {
+    case TLValue::InputEncryptedChat:
+        *this << inputEncryptedChatValue.chatId;
+        *this << inputEncryptedChatValue.accessHash;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLInputEncryptedFile &inputEncryptedFileValue)
+{
+    *this << inputEncryptedFileValue.tlType;
+
+    switch (inputEncryptedFileValue.tlType) {
+    case TLValue::InputEncryptedFileEmpty:
+        break;
+    case TLValue::InputEncryptedFileUploaded:
+        *this << inputEncryptedFileValue.id;
+        *this << inputEncryptedFileValue.parts;
+        *this << inputEncryptedFileValue.md5Checksum;
+        *this << inputEncryptedFileValue.keyFingerprint;
+        break;
+    case TLValue::InputEncryptedFile:
+        *this << inputEncryptedFileValue.id;
+        *this << inputEncryptedFileValue.accessHash;
+        break;
+    case TLValue::InputEncryptedFileBigUploaded:
+        *this << inputEncryptedFileValue.id;
+        *this << inputEncryptedFileValue.parts;
+        *this << inputEncryptedFileValue.keyFingerprint;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLInputFile &inputFileValue)
+{
+    *this << inputFileValue.tlType;
+
+    switch (inputFileValue.tlType) {
+    case TLValue::InputFile:
+        *this << inputFileValue.id;
+        *this << inputFileValue.parts;
+        *this << inputFileValue.name;
+        *this << inputFileValue.md5Checksum;
+        break;
+    case TLValue::InputFileBig:
+        *this << inputFileValue.id;
+        *this << inputFileValue.parts;
+        *this << inputFileValue.name;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLInputFileLocation &inputFileLocationValue)
+{
+    *this << inputFileLocationValue.tlType;
+
+    switch (inputFileLocationValue.tlType) {
+    case TLValue::InputFileLocation:
+        *this << inputFileLocationValue.volumeId;
+        *this << inputFileLocationValue.localId;
+        *this << inputFileLocationValue.secret;
+        break;
+    case TLValue::InputVideoFileLocation:
+        *this << inputFileLocationValue.id;
+        *this << inputFileLocationValue.accessHash;
+        break;
+    case TLValue::InputEncryptedFileLocation:
+        *this << inputFileLocationValue.id;
+        *this << inputFileLocationValue.accessHash;
+        break;
+    case TLValue::InputAudioFileLocation:
+        *this << inputFileLocationValue.id;
+        *this << inputFileLocationValue.accessHash;
+        break;
+    case TLValue::InputDocumentFileLocation:
+        *this << inputFileLocationValue.id;
+        *this << inputFileLocationValue.accessHash;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLInputGeoChat &inputGeoChatValue)
+{
+    *this << inputGeoChatValue.tlType;
+
+    switch (inputGeoChatValue.tlType) {
+    case TLValue::InputGeoChat:
+        *this << inputGeoChatValue.chatId;
+        *this << inputGeoChatValue.accessHash;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLInputGeoPoint &inputGeoPointValue)
+{
+    *this << inputGeoPointValue.tlType;
+
+    switch (inputGeoPointValue.tlType) {
+    case TLValue::InputGeoPointEmpty:
+        break;
+    case TLValue::InputGeoPoint:
+        *this << inputGeoPointValue.latitude;
+        *this << inputGeoPointValue.longitude;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLInputPeer &inputPeerValue)
+{
+    *this << inputPeerValue.tlType;
+
+    switch (inputPeerValue.tlType) {
+    case TLValue::InputPeerEmpty:
+        break;
+    case TLValue::InputPeerSelf:
+        break;
+    case TLValue::InputPeerContact:
+        *this << inputPeerValue.userId;
+        break;
+    case TLValue::InputPeerForeign:
+        *this << inputPeerValue.userId;
+        *this << inputPeerValue.accessHash;
+        break;
+    case TLValue::InputPeerChat:
+        *this << inputPeerValue.chatId;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLInputPeerNotifyEvents &inputPeerNotifyEventsValue)
+{
+    *this << inputPeerNotifyEventsValue.tlType;
+
+    switch (inputPeerNotifyEventsValue.tlType) {
+    case TLValue::InputPeerNotifyEventsEmpty:
+        break;
+    case TLValue::InputPeerNotifyEventsAll:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLInputPeerNotifySettings &inputPeerNotifySettingsValue)
+{
+    *this << inputPeerNotifySettingsValue.tlType;
+
+    switch (inputPeerNotifySettingsValue.tlType) {
+    case TLValue::InputPeerNotifySettings:
+        *this << inputPeerNotifySettingsValue.muteUntil;
+        *this << inputPeerNotifySettingsValue.sound;
+        *this << inputPeerNotifySettingsValue.showPreviews;
+        *this << inputPeerNotifySettingsValue.eventsMask;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLInputPhoto &inputPhotoValue)
+{
+    *this << inputPhotoValue.tlType;
+
+    switch (inputPhotoValue.tlType) {
+    case TLValue::InputPhotoEmpty:
+        break;
+    case TLValue::InputPhoto:
+        *this << inputPhotoValue.id;
+        *this << inputPhotoValue.accessHash;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLInputPhotoCrop &inputPhotoCropValue)
+{
+    *this << inputPhotoCropValue.tlType;
+
+    switch (inputPhotoCropValue.tlType) {
+    case TLValue::InputPhotoCropAuto:
+        break;
+    case TLValue::InputPhotoCrop:
+        *this << inputPhotoCropValue.cropLeft;
+        *this << inputPhotoCropValue.cropTop;
+        *this << inputPhotoCropValue.cropWidth;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLInputPrivacyKey &inputPrivacyKeyValue)
+{
+    *this << inputPrivacyKeyValue.tlType;
+
+    switch (inputPrivacyKeyValue.tlType) {
+    case TLValue::InputPrivacyKeyStatusTimestamp:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLInputStickerSet &inputStickerSetValue)
+{
+    *this << inputStickerSetValue.tlType;
+
+    switch (inputStickerSetValue.tlType) {
+    case TLValue::InputStickerSetEmpty:
+        break;
+    case TLValue::InputStickerSetID:
+        *this << inputStickerSetValue.id;
+        *this << inputStickerSetValue.accessHash;
+        break;
+    case TLValue::InputStickerSetShortName:
+        *this << inputStickerSetValue.shortName;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLInputUser &inputUserValue)
+{
+    *this << inputUserValue.tlType;
+
+    switch (inputUserValue.tlType) {
+    case TLValue::InputUserEmpty:
+        break;
+    case TLValue::InputUserSelf:
+        break;
+    case TLValue::InputUserContact:
+        *this << inputUserValue.userId;
+        break;
+    case TLValue::InputUserForeign:
+        *this << inputUserValue.userId;
+        *this << inputUserValue.accessHash;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLInputVideo &inputVideoValue)
+{
+    *this << inputVideoValue.tlType;
+
+    switch (inputVideoValue.tlType) {
+    case TLValue::InputVideoEmpty:
+        break;
+    case TLValue::InputVideo:
+        *this << inputVideoValue.id;
+        *this << inputVideoValue.accessHash;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesAffectedHistory &messagesAffectedHistoryValue)
+{
+    *this << messagesAffectedHistoryValue.tlType;
+
+    switch (messagesAffectedHistoryValue.tlType) {
+    case TLValue::MessagesAffectedHistory:
+        *this << messagesAffectedHistoryValue.pts;
+        *this << messagesAffectedHistoryValue.ptsCount;
+        *this << messagesAffectedHistoryValue.offset;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesAffectedMessages &messagesAffectedMessagesValue)
+{
+    *this << messagesAffectedMessagesValue.tlType;
+
+    switch (messagesAffectedMessagesValue.tlType) {
+    case TLValue::MessagesAffectedMessages:
+        *this << messagesAffectedMessagesValue.pts;
+        *this << messagesAffectedMessagesValue.ptsCount;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesDhConfig &messagesDhConfigValue)
+{
+    *this << messagesDhConfigValue.tlType;
+
+    switch (messagesDhConfigValue.tlType) {
+    case TLValue::MessagesDhConfigNotModified:
+        *this << messagesDhConfigValue.random;
+        break;
+    case TLValue::MessagesDhConfig:
+        *this << messagesDhConfigValue.g;
+        *this << messagesDhConfigValue.p;
+        *this << messagesDhConfigValue.version;
+        *this << messagesDhConfigValue.random;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesFilter &messagesFilterValue)
+{
+    *this << messagesFilterValue.tlType;
+
+    switch (messagesFilterValue.tlType) {
+    case TLValue::InputMessagesFilterEmpty:
+        break;
+    case TLValue::InputMessagesFilterPhotos:
+        break;
+    case TLValue::InputMessagesFilterVideo:
+        break;
+    case TLValue::InputMessagesFilterPhotoVideo:
+        break;
+    case TLValue::InputMessagesFilterPhotoVideoDocuments:
+        break;
+    case TLValue::InputMessagesFilterDocument:
+        break;
+    case TLValue::InputMessagesFilterAudio:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesSentEncryptedMessage &messagesSentEncryptedMessageValue)
+{
+    *this << messagesSentEncryptedMessageValue.tlType;
+
+    switch (messagesSentEncryptedMessageValue.tlType) {
+    case TLValue::MessagesSentEncryptedMessage:
+        *this << messagesSentEncryptedMessageValue.date;
+        break;
+    case TLValue::MessagesSentEncryptedFile:
+        *this << messagesSentEncryptedMessageValue.date;
+        *this << messagesSentEncryptedMessageValue.file;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLNearestDc &nearestDcValue)
+{
+    *this << nearestDcValue.tlType;
+
+    switch (nearestDcValue.tlType) {
+    case TLValue::NearestDc:
+        *this << nearestDcValue.country;
+        *this << nearestDcValue.thisDc;
+        *this << nearestDcValue.nearestDc;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLPeer &peerValue)
+{
+    *this << peerValue.tlType;
+
+    switch (peerValue.tlType) {
+    case TLValue::PeerUser:
+        *this << peerValue.userId;
+        break;
+    case TLValue::PeerChat:
+        *this << peerValue.chatId;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLPeerNotifyEvents &peerNotifyEventsValue)
+{
+    *this << peerNotifyEventsValue.tlType;
+
+    switch (peerNotifyEventsValue.tlType) {
+    case TLValue::PeerNotifyEventsEmpty:
+        break;
+    case TLValue::PeerNotifyEventsAll:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLPeerNotifySettings &peerNotifySettingsValue)
+{
+    *this << peerNotifySettingsValue.tlType;
+
+    switch (peerNotifySettingsValue.tlType) {
+    case TLValue::PeerNotifySettingsEmpty:
+        break;
+    case TLValue::PeerNotifySettings:
+        *this << peerNotifySettingsValue.muteUntil;
+        *this << peerNotifySettingsValue.sound;
+        *this << peerNotifySettingsValue.showPreviews;
+        *this << peerNotifySettingsValue.eventsMask;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLPhotoSize &photoSizeValue)
+{
+    *this << photoSizeValue.tlType;
+
+    switch (photoSizeValue.tlType) {
+    case TLValue::PhotoSizeEmpty:
+        *this << photoSizeValue.type;
+        break;
+    case TLValue::PhotoSize:
+        *this << photoSizeValue.type;
+        *this << photoSizeValue.location;
+        *this << photoSizeValue.w;
+        *this << photoSizeValue.h;
+        *this << photoSizeValue.size;
+        break;
+    case TLValue::PhotoCachedSize:
+        *this << photoSizeValue.type;
+        *this << photoSizeValue.location;
+        *this << photoSizeValue.w;
+        *this << photoSizeValue.h;
+        *this << photoSizeValue.bytes;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLPrivacyKey &privacyKeyValue)
+{
+    *this << privacyKeyValue.tlType;
+
+    switch (privacyKeyValue.tlType) {
+    case TLValue::PrivacyKeyStatusTimestamp:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLPrivacyRule &privacyRuleValue)
+{
+    *this << privacyRuleValue.tlType;
+
+    switch (privacyRuleValue.tlType) {
+    case TLValue::PrivacyValueAllowContacts:
+        break;
+    case TLValue::PrivacyValueAllowAll:
+        break;
+    case TLValue::PrivacyValueAllowUsers:
+        *this << privacyRuleValue.users;
+        break;
+    case TLValue::PrivacyValueDisallowContacts:
+        break;
+    case TLValue::PrivacyValueDisallowAll:
+        break;
+    case TLValue::PrivacyValueDisallowUsers:
+        *this << privacyRuleValue.users;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLReceivedNotifyMessage &receivedNotifyMessageValue)
+{
+    *this << receivedNotifyMessageValue.tlType;
+
+    switch (receivedNotifyMessageValue.tlType) {
+    case TLValue::ReceivedNotifyMessage:
+        *this << receivedNotifyMessageValue.id;
+        *this << receivedNotifyMessageValue.flags;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLSendMessageAction &sendMessageActionValue)
+{
+    *this << sendMessageActionValue.tlType;
+
+    switch (sendMessageActionValue.tlType) {
+    case TLValue::SendMessageTypingAction:
+        break;
+    case TLValue::SendMessageCancelAction:
+        break;
+    case TLValue::SendMessageRecordVideoAction:
+        break;
+    case TLValue::SendMessageUploadVideoAction:
+        *this << sendMessageActionValue.progress;
+        break;
+    case TLValue::SendMessageRecordAudioAction:
+        break;
+    case TLValue::SendMessageUploadAudioAction:
+        *this << sendMessageActionValue.progress;
+        break;
+    case TLValue::SendMessageUploadPhotoAction:
+        *this << sendMessageActionValue.progress;
+        break;
+    case TLValue::SendMessageUploadDocumentAction:
+        *this << sendMessageActionValue.progress;
+        break;
+    case TLValue::SendMessageGeoLocationAction:
+        break;
+    case TLValue::SendMessageChooseContactAction:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLStickerPack &stickerPackValue)
+{
+    *this << stickerPackValue.tlType;
+
+    switch (stickerPackValue.tlType) {
+    case TLValue::StickerPack:
+        *this << stickerPackValue.emoticon;
+        *this << stickerPackValue.documents;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLStickerSet &stickerSetValue)
+{
+    *this << stickerSetValue.tlType;
+
+    switch (stickerSetValue.tlType) {
+    case TLValue::StickerSet:
+        *this << stickerSetValue.id;
+        *this << stickerSetValue.accessHash;
+        *this << stickerSetValue.title;
+        *this << stickerSetValue.shortName;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLStorageFileType &storageFileTypeValue)
+{
+    *this << storageFileTypeValue.tlType;
+
+    switch (storageFileTypeValue.tlType) {
+    case TLValue::StorageFileUnknown:
+        break;
+    case TLValue::StorageFileJpeg:
+        break;
+    case TLValue::StorageFileGif:
+        break;
+    case TLValue::StorageFilePng:
+        break;
+    case TLValue::StorageFilePdf:
+        break;
+    case TLValue::StorageFileMp3:
+        break;
+    case TLValue::StorageFileMov:
+        break;
+    case TLValue::StorageFilePartial:
+        break;
+    case TLValue::StorageFileMp4:
+        break;
+    case TLValue::StorageFileWebp:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLUpdatesState &updatesStateValue)
+{
+    *this << updatesStateValue.tlType;
+
+    switch (updatesStateValue.tlType) {
+    case TLValue::UpdatesState:
+        *this << updatesStateValue.pts;
+        *this << updatesStateValue.qts;
+        *this << updatesStateValue.date;
+        *this << updatesStateValue.seq;
+        *this << updatesStateValue.unreadCount;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLUploadFile &uploadFileValue)
+{
+    *this << uploadFileValue.tlType;
+
+    switch (uploadFileValue.tlType) {
+    case TLValue::UploadFile:
+        *this << uploadFileValue.type;
+        *this << uploadFileValue.mtime;
+        *this << uploadFileValue.bytes;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLUserProfilePhoto &userProfilePhotoValue)
+{
+    *this << userProfilePhotoValue.tlType;
+
+    switch (userProfilePhotoValue.tlType) {
+    case TLValue::UserProfilePhotoEmpty:
+        break;
+    case TLValue::UserProfilePhoto:
+        *this << userProfilePhotoValue.photoId;
+        *this << userProfilePhotoValue.photoSmall;
+        *this << userProfilePhotoValue.photoBig;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLUserStatus &userStatusValue)
+{
+    *this << userStatusValue.tlType;
+
+    switch (userStatusValue.tlType) {
+    case TLValue::UserStatusEmpty:
+        break;
+    case TLValue::UserStatusOnline:
+        *this << userStatusValue.expires;
+        break;
+    case TLValue::UserStatusOffline:
+        *this << userStatusValue.wasOnline;
+        break;
+    case TLValue::UserStatusRecently:
+        break;
+    case TLValue::UserStatusLastWeek:
+        break;
+    case TLValue::UserStatusLastMonth:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLVideo &videoValue)
+{
+    *this << videoValue.tlType;
+
+    switch (videoValue.tlType) {
+    case TLValue::VideoEmpty:
+        *this << videoValue.id;
+        break;
+    case TLValue::Video:
+        *this << videoValue.id;
+        *this << videoValue.accessHash;
+        *this << videoValue.userId;
+        *this << videoValue.date;
+        *this << videoValue.duration;
+        *this << videoValue.size;
+        *this << videoValue.thumb;
+        *this << videoValue.dcId;
+        *this << videoValue.w;
+        *this << videoValue.h;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLWallPaper &wallPaperValue)
+{
+    *this << wallPaperValue.tlType;
+
+    switch (wallPaperValue.tlType) {
+    case TLValue::WallPaper:
+        *this << wallPaperValue.id;
+        *this << wallPaperValue.title;
+        *this << wallPaperValue.sizes;
+        *this << wallPaperValue.color;
+        break;
+    case TLValue::WallPaperSolid:
+        *this << wallPaperValue.id;
+        *this << wallPaperValue.title;
+        *this << wallPaperValue.bgColor;
+        *this << wallPaperValue.color;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLAccountAuthorizations &accountAuthorizationsValue)
+{
+    *this << accountAuthorizationsValue.tlType;
+
+    switch (accountAuthorizationsValue.tlType) {
+    case TLValue::AccountAuthorizations:
+        *this << accountAuthorizationsValue.authorizations;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLChatPhoto &chatPhotoValue)
+{
+    *this << chatPhotoValue.tlType;
+
+    switch (chatPhotoValue.tlType) {
+    case TLValue::ChatPhotoEmpty:
+        break;
+    case TLValue::ChatPhoto:
+        *this << chatPhotoValue.photoSmall;
+        *this << chatPhotoValue.photoBig;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLConfig &configValue)
+{
+    *this << configValue.tlType;
+
+    switch (configValue.tlType) {
+    case TLValue::Config:
+        *this << configValue.date;
+        *this << configValue.expires;
+        *this << configValue.testMode;
+        *this << configValue.thisDc;
+        *this << configValue.dcOptions;
+        *this << configValue.chatSizeMax;
+        *this << configValue.broadcastSizeMax;
+        *this << configValue.forwardedCountMax;
+        *this << configValue.onlineUpdatePeriodMs;
+        *this << configValue.offlineBlurTimeoutMs;
+        *this << configValue.offlineIdleTimeoutMs;
+        *this << configValue.onlineCloudTimeoutMs;
+        *this << configValue.notifyCloudDelayMs;
+        *this << configValue.notifyDefaultDelayMs;
+        *this << configValue.chatBigSize;
+        *this << configValue.pushChatPeriodMs;
+        *this << configValue.pushChatLimit;
+        *this << configValue.disabledFeatures;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLContactStatus &contactStatusValue)
+{
+    *this << contactStatusValue.tlType;
+
+    switch (contactStatusValue.tlType) {
+    case TLValue::ContactStatus:
+        *this << contactStatusValue.userId;
+        *this << contactStatusValue.status;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLDialog &dialogValue)
+{
+    *this << dialogValue.tlType;
+
+    switch (dialogValue.tlType) {
+    case TLValue::Dialog:
+        *this << dialogValue.peer;
+        *this << dialogValue.topMessage;
+        *this << dialogValue.readInboxMaxId;
+        *this << dialogValue.unreadCount;
+        *this << dialogValue.notifySettings;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLDocumentAttribute &documentAttributeValue)
+{
+    *this << documentAttributeValue.tlType;
+
+    switch (documentAttributeValue.tlType) {
+    case TLValue::DocumentAttributeImageSize:
+        *this << documentAttributeValue.w;
+        *this << documentAttributeValue.h;
+        break;
+    case TLValue::DocumentAttributeAnimated:
+        break;
+    case TLValue::DocumentAttributeSticker:
+        *this << documentAttributeValue.alt;
+        *this << documentAttributeValue.stickerset;
+        break;
+    case TLValue::DocumentAttributeVideo:
+        *this << documentAttributeValue.duration;
+        *this << documentAttributeValue.w;
+        *this << documentAttributeValue.h;
+        break;
+    case TLValue::DocumentAttributeAudio:
+        *this << documentAttributeValue.duration;
+        break;
+    case TLValue::DocumentAttributeFilename:
+        *this << documentAttributeValue.fileName;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLInputChatPhoto &inputChatPhotoValue)
+{
+    *this << inputChatPhotoValue.tlType;
+
+    switch (inputChatPhotoValue.tlType) {
+    case TLValue::InputChatPhotoEmpty:
+        break;
+    case TLValue::InputChatUploadedPhoto:
+        *this << inputChatPhotoValue.file;
+        *this << inputChatPhotoValue.crop;
+        break;
+    case TLValue::InputChatPhoto:
+        *this << inputChatPhotoValue.id;
+        *this << inputChatPhotoValue.crop;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLInputMedia &inputMediaValue)
+{
+    *this << inputMediaValue.tlType;
+
+    switch (inputMediaValue.tlType) {
+    case TLValue::InputMediaEmpty:
+        break;
+    case TLValue::InputMediaUploadedPhoto:
+        *this << inputMediaValue.file;
+        *this << inputMediaValue.caption;
+        break;
+    case TLValue::InputMediaPhoto:
+        *this << inputMediaValue.idInputPhoto;
+        *this << inputMediaValue.caption;
+        break;
+    case TLValue::InputMediaGeoPoint:
+        *this << inputMediaValue.geoPoint;
+        break;
+    case TLValue::InputMediaContact:
+        *this << inputMediaValue.phoneNumber;
+        *this << inputMediaValue.firstName;
+        *this << inputMediaValue.lastName;
+        break;
+    case TLValue::InputMediaUploadedVideo:
+        *this << inputMediaValue.file;
+        *this << inputMediaValue.duration;
+        *this << inputMediaValue.w;
+        *this << inputMediaValue.h;
+        *this << inputMediaValue.caption;
+        break;
+    case TLValue::InputMediaUploadedThumbVideo:
+        *this << inputMediaValue.file;
+        *this << inputMediaValue.thumb;
+        *this << inputMediaValue.duration;
+        *this << inputMediaValue.w;
+        *this << inputMediaValue.h;
+        *this << inputMediaValue.caption;
+        break;
+    case TLValue::InputMediaVideo:
+        *this << inputMediaValue.idInputVeo;
+        *this << inputMediaValue.caption;
+        break;
+    case TLValue::InputMediaUploadedAudio:
+        *this << inputMediaValue.file;
+        *this << inputMediaValue.duration;
+        *this << inputMediaValue.mimeType;
+        break;
+    case TLValue::InputMediaAudio:
+        *this << inputMediaValue.idInputAudio;
+        break;
+    case TLValue::InputMediaUploadedDocument:
+        *this << inputMediaValue.file;
+        *this << inputMediaValue.mimeType;
+        *this << inputMediaValue.attributes;
+        break;
+    case TLValue::InputMediaUploadedThumbDocument:
+        *this << inputMediaValue.file;
+        *this << inputMediaValue.thumb;
+        *this << inputMediaValue.mimeType;
+        *this << inputMediaValue.attributes;
+        break;
+    case TLValue::InputMediaDocument:
+        *this << inputMediaValue.idInputDocument;
+        break;
+    case TLValue::InputMediaVenue:
+        *this << inputMediaValue.geoPoint;
+        *this << inputMediaValue.title;
+        *this << inputMediaValue.address;
+        *this << inputMediaValue.provider;
+        *this << inputMediaValue.venueId;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLInputNotifyPeer &inputNotifyPeerValue)
+{
+    *this << inputNotifyPeerValue.tlType;
+
+    switch (inputNotifyPeerValue.tlType) {
+    case TLValue::InputNotifyPeer:
+        *this << inputNotifyPeerValue.peerInput;
+        break;
+    case TLValue::InputNotifyUsers:
+        break;
+    case TLValue::InputNotifyChats:
+        break;
+    case TLValue::InputNotifyAll:
+        break;
+    case TLValue::InputNotifyGeoChatPeer:
+        *this << inputNotifyPeerValue.peerInputGeoChat;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLInputPrivacyRule &inputPrivacyRuleValue)
+{
+    *this << inputPrivacyRuleValue.tlType;
+
+    switch (inputPrivacyRuleValue.tlType) {
+    case TLValue::InputPrivacyValueAllowContacts:
+        break;
+    case TLValue::InputPrivacyValueAllowAll:
+        break;
+    case TLValue::InputPrivacyValueAllowUsers:
+        *this << inputPrivacyRuleValue.users;
+        break;
+    case TLValue::InputPrivacyValueDisallowContacts:
+        break;
+    case TLValue::InputPrivacyValueDisallowAll:
+        break;
+    case TLValue::InputPrivacyValueDisallowUsers:
+        *this << inputPrivacyRuleValue.users;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLNotifyPeer &notifyPeerValue)
+{
+    *this << notifyPeerValue.tlType;
+
+    switch (notifyPeerValue.tlType) {
+    case TLValue::NotifyPeer:
+        *this << notifyPeerValue.peer;
+        break;
+    case TLValue::NotifyUsers:
+        break;
+    case TLValue::NotifyChats:
+        break;
+    case TLValue::NotifyAll:
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLPhoto &photoValue)
+{
+    *this << photoValue.tlType;
+
+    switch (photoValue.tlType) {
+    case TLValue::PhotoEmpty:
+        *this << photoValue.id;
+        break;
+    case TLValue::Photo:
+        *this << photoValue.id;
+        *this << photoValue.accessHash;
+        *this << photoValue.userId;
+        *this << photoValue.date;
+        *this << photoValue.geo;
+        *this << photoValue.sizes;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLUser &userValue)
+{
+    *this << userValue.tlType;
+
+    switch (userValue.tlType) {
+    case TLValue::UserEmpty:
+        *this << userValue.id;
+        break;
+    case TLValue::UserSelf:
+        *this << userValue.id;
+        *this << userValue.firstName;
+        *this << userValue.lastName;
+        *this << userValue.username;
+        *this << userValue.phone;
+        *this << userValue.photo;
+        *this << userValue.status;
+        break;
+    case TLValue::UserContact:
+        *this << userValue.id;
+        *this << userValue.firstName;
+        *this << userValue.lastName;
+        *this << userValue.username;
+        *this << userValue.accessHash;
+        *this << userValue.phone;
+        *this << userValue.photo;
+        *this << userValue.status;
+        break;
+    case TLValue::UserRequest:
+        *this << userValue.id;
+        *this << userValue.firstName;
+        *this << userValue.lastName;
+        *this << userValue.username;
+        *this << userValue.accessHash;
+        *this << userValue.phone;
+        *this << userValue.photo;
+        *this << userValue.status;
+        break;
+    case TLValue::UserForeign:
+        *this << userValue.id;
+        *this << userValue.firstName;
+        *this << userValue.lastName;
+        *this << userValue.username;
+        *this << userValue.accessHash;
+        *this << userValue.photo;
+        *this << userValue.status;
+        break;
+    case TLValue::UserDeleted:
+        *this << userValue.id;
+        *this << userValue.firstName;
+        *this << userValue.lastName;
+        *this << userValue.username;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLWebPage &webPageValue)
+{
+    *this << webPageValue.tlType;
+
+    switch (webPageValue.tlType) {
+    case TLValue::WebPageEmpty:
+        *this << webPageValue.id;
+        break;
+    case TLValue::WebPagePending:
+        *this << webPageValue.id;
+        *this << webPageValue.date;
+        break;
+    case TLValue::WebPage:
+        *this << webPageValue.flags;
+        *this << webPageValue.id;
+        *this << webPageValue.url;
+        *this << webPageValue.displayUrl;
+        if (webPageValue.flags & 1 << 0) {
+            *this << webPageValue.type;
+        }
+        if (webPageValue.flags & 1 << 1) {
+            *this << webPageValue.siteName;
+        }
+        if (webPageValue.flags & 1 << 2) {
+            *this << webPageValue.title;
+        }
+        if (webPageValue.flags & 1 << 3) {
+            *this << webPageValue.description;
+        }
+        if (webPageValue.flags & 1 << 4) {
+            *this << webPageValue.photo;
+        }
+        if (webPageValue.flags & 1 << 5) {
+            *this << webPageValue.embedUrl;
+        }
+        if (webPageValue.flags & 1 << 5) {
+            *this << webPageValue.embedType;
+        }
+        if (webPageValue.flags & 1 << 6) {
+            *this << webPageValue.embedWidth;
+        }
+        if (webPageValue.flags & 1 << 6) {
+            *this << webPageValue.embedHeight;
+        }
+        if (webPageValue.flags & 1 << 7) {
+            *this << webPageValue.duration;
+        }
+        if (webPageValue.flags & 1 << 8) {
+            *this << webPageValue.author;
+        }
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLAccountPrivacyRules &accountPrivacyRulesValue)
+{
+    *this << accountPrivacyRulesValue.tlType;
+
+    switch (accountPrivacyRulesValue.tlType) {
+    case TLValue::AccountPrivacyRules:
+        *this << accountPrivacyRulesValue.rules;
+        *this << accountPrivacyRulesValue.users;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLAuthAuthorization &authAuthorizationValue)
+{
+    *this << authAuthorizationValue.tlType;
+
+    switch (authAuthorizationValue.tlType) {
+    case TLValue::AuthAuthorization:
+        *this << authAuthorizationValue.expires;
+        *this << authAuthorizationValue.user;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLChat &chatValue)
+{
+    *this << chatValue.tlType;
+
+    switch (chatValue.tlType) {
+    case TLValue::ChatEmpty:
+        *this << chatValue.id;
+        break;
+    case TLValue::Chat:
+        *this << chatValue.id;
+        *this << chatValue.title;
+        *this << chatValue.photo;
+        *this << chatValue.participantsCount;
+        *this << chatValue.date;
+        *this << chatValue.left;
+        *this << chatValue.version;
+        break;
+    case TLValue::ChatForbidden:
+        *this << chatValue.id;
+        *this << chatValue.title;
+        *this << chatValue.date;
+        break;
+    case TLValue::GeoChat:
+        *this << chatValue.id;
+        *this << chatValue.accessHash;
+        *this << chatValue.title;
+        *this << chatValue.address;
+        *this << chatValue.venue;
+        *this << chatValue.geo;
+        *this << chatValue.photo;
+        *this << chatValue.participantsCount;
+        *this << chatValue.date;
+        *this << chatValue.checkedIn;
+        *this << chatValue.version;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLChatFull &chatFullValue)
+{
+    *this << chatFullValue.tlType;
+
+    switch (chatFullValue.tlType) {
+    case TLValue::ChatFull:
+        *this << chatFullValue.id;
+        *this << chatFullValue.participants;
+        *this << chatFullValue.chatPhoto;
+        *this << chatFullValue.notifySettings;
+        *this << chatFullValue.exportedInvite;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLChatInvite &chatInviteValue)
+{
+    *this << chatInviteValue.tlType;
+
+    switch (chatInviteValue.tlType) {
+    case TLValue::ChatInviteAlready:
+        *this << chatInviteValue.chat;
+        break;
+    case TLValue::ChatInvite:
+        *this << chatInviteValue.title;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLContactsBlocked &contactsBlockedValue)
+{
+    *this << contactsBlockedValue.tlType;
+
+    switch (contactsBlockedValue.tlType) {
+    case TLValue::ContactsBlocked:
+        *this << contactsBlockedValue.blocked;
+        *this << contactsBlockedValue.users;
+        break;
+    case TLValue::ContactsBlockedSlice:
+        *this << contactsBlockedValue.count;
+        *this << contactsBlockedValue.blocked;
+        *this << contactsBlockedValue.users;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLContactsContacts &contactsContactsValue)
+{
+    *this << contactsContactsValue.tlType;
+
+    switch (contactsContactsValue.tlType) {
+    case TLValue::ContactsContactsNotModified:
+        break;
+    case TLValue::ContactsContacts:
+        *this << contactsContactsValue.contacts;
+        *this << contactsContactsValue.users;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLContactsFound &contactsFoundValue)
+{
+    *this << contactsFoundValue.tlType;
+
+    switch (contactsFoundValue.tlType) {
+    case TLValue::ContactsFound:
+        *this << contactsFoundValue.results;
+        *this << contactsFoundValue.users;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLContactsImportedContacts &contactsImportedContactsValue)
+{
+    *this << contactsImportedContactsValue.tlType;
+
+    switch (contactsImportedContactsValue.tlType) {
+    case TLValue::ContactsImportedContacts:
+        *this << contactsImportedContactsValue.imported;
+        *this << contactsImportedContactsValue.retryContacts;
+        *this << contactsImportedContactsValue.users;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLContactsLink &contactsLinkValue)
+{
+    *this << contactsLinkValue.tlType;
+
+    switch (contactsLinkValue.tlType) {
+    case TLValue::ContactsLink:
+        *this << contactsLinkValue.myLink;
+        *this << contactsLinkValue.foreignLink;
+        *this << contactsLinkValue.user;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLContactsSuggested &contactsSuggestedValue)
+{
+    *this << contactsSuggestedValue.tlType;
+
+    switch (contactsSuggestedValue.tlType) {
+    case TLValue::ContactsSuggested:
+        *this << contactsSuggestedValue.results;
+        *this << contactsSuggestedValue.users;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLDocument &documentValue)
+{
+    *this << documentValue.tlType;
+
+    switch (documentValue.tlType) {
+    case TLValue::DocumentEmpty:
+        *this << documentValue.id;
+        break;
+    case TLValue::Document:
+        *this << documentValue.id;
+        *this << documentValue.accessHash;
+        *this << documentValue.date;
+        *this << documentValue.mimeType;
+        *this << documentValue.size;
+        *this << documentValue.thumb;
+        *this << documentValue.dcId;
+        *this << documentValue.attributes;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLHelpSupport &helpSupportValue)
+{
+    *this << helpSupportValue.tlType;
+
+    switch (helpSupportValue.tlType) {
+    case TLValue::HelpSupport:
+        *this << helpSupportValue.phoneNumber;
+        *this << helpSupportValue.user;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLMessageAction &messageActionValue)
+{
+    *this << messageActionValue.tlType;
+
+    switch (messageActionValue.tlType) {
+    case TLValue::MessageActionEmpty:
+        break;
+    case TLValue::MessageActionChatCreate:
+        *this << messageActionValue.title;
+        *this << messageActionValue.users;
+        break;
+    case TLValue::MessageActionChatEditTitle:
+        *this << messageActionValue.title;
+        break;
+    case TLValue::MessageActionChatEditPhoto:
+        *this << messageActionValue.photo;
+        break;
+    case TLValue::MessageActionChatDeletePhoto:
+        break;
+    case TLValue::MessageActionChatAddUser:
+        *this << messageActionValue.userId;
+        break;
+    case TLValue::MessageActionChatDeleteUser:
+        *this << messageActionValue.userId;
+        break;
+    case TLValue::MessageActionGeoChatCreate:
+        *this << messageActionValue.title;
+        *this << messageActionValue.address;
+        break;
+    case TLValue::MessageActionGeoChatCheckin:
+        break;
+    case TLValue::MessageActionChatJoinedByLink:
+        *this << messageActionValue.inviterId;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLMessageMedia &messageMediaValue)
+{
+    *this << messageMediaValue.tlType;
+
+    switch (messageMediaValue.tlType) {
+    case TLValue::MessageMediaEmpty:
+        break;
+    case TLValue::MessageMediaPhoto:
+        *this << messageMediaValue.photo;
+        *this << messageMediaValue.caption;
+        break;
+    case TLValue::MessageMediaVideo:
+        *this << messageMediaValue.video;
+        *this << messageMediaValue.caption;
+        break;
+    case TLValue::MessageMediaGeo:
+        *this << messageMediaValue.geo;
+        break;
+    case TLValue::MessageMediaContact:
+        *this << messageMediaValue.phoneNumber;
+        *this << messageMediaValue.firstName;
+        *this << messageMediaValue.lastName;
+        *this << messageMediaValue.userId;
+        break;
+    case TLValue::MessageMediaUnsupported:
+        break;
+    case TLValue::MessageMediaDocument:
+        *this << messageMediaValue.document;
+        break;
+    case TLValue::MessageMediaAudio:
+        *this << messageMediaValue.audio;
+        break;
+    case TLValue::MessageMediaWebPage:
+        *this << messageMediaValue.webpage;
+        break;
+    case TLValue::MessageMediaVenue:
+        *this << messageMediaValue.geo;
+        *this << messageMediaValue.title;
+        *this << messageMediaValue.address;
+        *this << messageMediaValue.provider;
+        *this << messageMediaValue.venueId;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesAllStickers &messagesAllStickersValue)
+{
+    *this << messagesAllStickersValue.tlType;
+
+    switch (messagesAllStickersValue.tlType) {
+    case TLValue::MessagesAllStickersNotModified:
+        break;
+    case TLValue::MessagesAllStickers:
+        *this << messagesAllStickersValue.hash;
+        *this << messagesAllStickersValue.packs;
+        *this << messagesAllStickersValue.sets;
+        *this << messagesAllStickersValue.documents;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesChatFull &messagesChatFullValue)
+{
+    *this << messagesChatFullValue.tlType;
+
+    switch (messagesChatFullValue.tlType) {
+    case TLValue::MessagesChatFull:
+        *this << messagesChatFullValue.fullChat;
+        *this << messagesChatFullValue.chats;
+        *this << messagesChatFullValue.users;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesChats &messagesChatsValue)
+{
+    *this << messagesChatsValue.tlType;
+
+    switch (messagesChatsValue.tlType) {
+    case TLValue::MessagesChats:
+        *this << messagesChatsValue.chats;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesSentMessage &messagesSentMessageValue)
+{
+    *this << messagesSentMessageValue.tlType;
+
+    switch (messagesSentMessageValue.tlType) {
+    case TLValue::MessagesSentMessage:
+        *this << messagesSentMessageValue.id;
+        *this << messagesSentMessageValue.date;
+        *this << messagesSentMessageValue.media;
+        *this << messagesSentMessageValue.pts;
+        *this << messagesSentMessageValue.ptsCount;
+        break;
+    case TLValue::MessagesSentMessageLink:
+        *this << messagesSentMessageValue.id;
+        *this << messagesSentMessageValue.date;
+        *this << messagesSentMessageValue.media;
+        *this << messagesSentMessageValue.pts;
+        *this << messagesSentMessageValue.ptsCount;
+        *this << messagesSentMessageValue.links;
+        *this << messagesSentMessageValue.seq;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesStickerSet &messagesStickerSetValue)
+{
+    *this << messagesStickerSetValue.tlType;
+
+    switch (messagesStickerSetValue.tlType) {
+    case TLValue::MessagesStickerSet:
+        *this << messagesStickerSetValue.set;
+        *this << messagesStickerSetValue.packs;
+        *this << messagesStickerSetValue.documents;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesStickers &messagesStickersValue)
+{
+    *this << messagesStickersValue.tlType;
+
+    switch (messagesStickersValue.tlType) {
+    case TLValue::MessagesStickersNotModified:
+        break;
+    case TLValue::MessagesStickers:
+        *this << messagesStickersValue.hash;
+        *this << messagesStickersValue.stickers;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLPhotosPhoto &photosPhotoValue)
+{
+    *this << photosPhotoValue.tlType;
+
+    switch (photosPhotoValue.tlType) {
+    case TLValue::PhotosPhoto:
+        *this << photosPhotoValue.photo;
+        *this << photosPhotoValue.users;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLPhotosPhotos &photosPhotosValue)
+{
+    *this << photosPhotosValue.tlType;
+
+    switch (photosPhotosValue.tlType) {
+    case TLValue::PhotosPhotos:
+        *this << photosPhotosValue.photos;
+        *this << photosPhotosValue.users;
+        break;
+    case TLValue::PhotosPhotosSlice:
+        *this << photosPhotosValue.count;
+        *this << photosPhotosValue.photos;
+        *this << photosPhotosValue.users;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLUserFull &userFullValue)
+{
+    *this << userFullValue.tlType;
+
+    switch (userFullValue.tlType) {
+    case TLValue::UserFull:
+        *this << userFullValue.user;
+        *this << userFullValue.link;
+        *this << userFullValue.profilePhoto;
+        *this << userFullValue.notifySettings;
+        *this << userFullValue.blocked;
+        *this << userFullValue.realFirstName;
+        *this << userFullValue.realLastName;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLGeoChatMessage &geoChatMessageValue)
+{
+    *this << geoChatMessageValue.tlType;
+
+    switch (geoChatMessageValue.tlType) {
+    case TLValue::GeoChatMessageEmpty:
+        *this << geoChatMessageValue.chatId;
+        *this << geoChatMessageValue.id;
+        break;
+    case TLValue::GeoChatMessage:
+        *this << geoChatMessageValue.chatId;
+        *this << geoChatMessageValue.id;
+        *this << geoChatMessageValue.fromId;
+        *this << geoChatMessageValue.date;
+        *this << geoChatMessageValue.message;
+        *this << geoChatMessageValue.media;
+        break;
+    case TLValue::GeoChatMessageService:
+        *this << geoChatMessageValue.chatId;
+        *this << geoChatMessageValue.id;
+        *this << geoChatMessageValue.fromId;
+        *this << geoChatMessageValue.date;
+        *this << geoChatMessageValue.action;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLGeochatsLocated &geochatsLocatedValue)
+{
+    *this << geochatsLocatedValue.tlType;
+
+    switch (geochatsLocatedValue.tlType) {
+    case TLValue::GeochatsLocated:
+        *this << geochatsLocatedValue.results;
+        *this << geochatsLocatedValue.messages;
+        *this << geochatsLocatedValue.chats;
+        *this << geochatsLocatedValue.users;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLGeochatsMessages &geochatsMessagesValue)
+{
+    *this << geochatsMessagesValue.tlType;
+
+    switch (geochatsMessagesValue.tlType) {
+    case TLValue::GeochatsMessages:
+        *this << geochatsMessagesValue.messages;
+        *this << geochatsMessagesValue.chats;
+        *this << geochatsMessagesValue.users;
+        break;
+    case TLValue::GeochatsMessagesSlice:
+        *this << geochatsMessagesValue.count;
+        *this << geochatsMessagesValue.messages;
+        *this << geochatsMessagesValue.chats;
+        *this << geochatsMessagesValue.users;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLGeochatsStatedMessage &geochatsStatedMessageValue)
+{
+    *this << geochatsStatedMessageValue.tlType;
+
+    switch (geochatsStatedMessageValue.tlType) {
+    case TLValue::GeochatsStatedMessage:
+        *this << geochatsStatedMessageValue.message;
+        *this << geochatsStatedMessageValue.chats;
+        *this << geochatsStatedMessageValue.users;
+        *this << geochatsStatedMessageValue.seq;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLMessage &messageValue)
+{
+    *this << messageValue.tlType;
+
+    switch (messageValue.tlType) {
+    case TLValue::MessageEmpty:
+        *this << messageValue.id;
+        break;
+    case TLValue::Message:
+        *this << messageValue.flags;
+        *this << messageValue.id;
+        *this << messageValue.fromId;
+        *this << messageValue.toId;
+        if (messageValue.flags & 1 << 2) {
+            *this << messageValue.fwdFromId;
+        }
+        if (messageValue.flags & 1 << 2) {
+            *this << messageValue.fwdDate;
+        }
+        if (messageValue.flags & 1 << 3) {
+            *this << messageValue.replyToMsgId;
+        }
+        *this << messageValue.date;
+        *this << messageValue.message;
+        *this << messageValue.media;
+        break;
+    case TLValue::MessageService:
+        *this << messageValue.flags;
+        *this << messageValue.id;
+        *this << messageValue.fromId;
+        *this << messageValue.toId;
+        *this << messageValue.date;
+        *this << messageValue.action;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesDialogs &messagesDialogsValue)
+{
+    *this << messagesDialogsValue.tlType;
+
+    switch (messagesDialogsValue.tlType) {
+    case TLValue::MessagesDialogs:
+        *this << messagesDialogsValue.dialogs;
+        *this << messagesDialogsValue.messages;
+        *this << messagesDialogsValue.chats;
+        *this << messagesDialogsValue.users;
+        break;
+    case TLValue::MessagesDialogsSlice:
+        *this << messagesDialogsValue.count;
+        *this << messagesDialogsValue.dialogs;
+        *this << messagesDialogsValue.messages;
+        *this << messagesDialogsValue.chats;
+        *this << messagesDialogsValue.users;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLMessagesMessages &messagesMessagesValue)
+{
+    *this << messagesMessagesValue.tlType;
+
+    switch (messagesMessagesValue.tlType) {
+    case TLValue::MessagesMessages:
+        *this << messagesMessagesValue.messages;
+        *this << messagesMessagesValue.chats;
+        *this << messagesMessagesValue.users;
+        break;
+    case TLValue::MessagesMessagesSlice:
+        *this << messagesMessagesValue.count;
+        *this << messagesMessagesValue.messages;
+        *this << messagesMessagesValue.chats;
+        *this << messagesMessagesValue.users;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLUpdate &updateValue)
+{
+    *this << updateValue.tlType;
+
+    switch (updateValue.tlType) {
+    case TLValue::UpdateNewMessage:
+        *this << updateValue.message;
+        *this << updateValue.pts;
+        *this << updateValue.ptsCount;
+        break;
+    case TLValue::UpdateMessageID:
+        *this << updateValue.id;
+        *this << updateValue.randomId;
+        break;
+    case TLValue::UpdateDeleteMessages:
+        *this << updateValue.messages;
+        *this << updateValue.pts;
+        *this << updateValue.ptsCount;
+        break;
+    case TLValue::UpdateUserTyping:
+        *this << updateValue.userId;
+        *this << updateValue.action;
+        break;
+    case TLValue::UpdateChatUserTyping:
+        *this << updateValue.chatId;
+        *this << updateValue.userId;
+        *this << updateValue.action;
+        break;
+    case TLValue::UpdateChatParticipants:
+        *this << updateValue.participants;
+        break;
+    case TLValue::UpdateUserStatus:
+        *this << updateValue.userId;
+        *this << updateValue.status;
+        break;
+    case TLValue::UpdateUserName:
+        *this << updateValue.userId;
+        *this << updateValue.firstName;
+        *this << updateValue.lastName;
+        *this << updateValue.username;
+        break;
+    case TLValue::UpdateUserPhoto:
+        *this << updateValue.userId;
+        *this << updateValue.date;
+        *this << updateValue.photo;
+        *this << updateValue.previous;
+        break;
+    case TLValue::UpdateContactRegistered:
+        *this << updateValue.userId;
+        *this << updateValue.date;
+        break;
+    case TLValue::UpdateContactLink:
+        *this << updateValue.userId;
+        *this << updateValue.myLink;
+        *this << updateValue.foreignLink;
+        break;
+    case TLValue::UpdateNewAuthorization:
+        *this << updateValue.authKeyId;
+        *this << updateValue.date;
+        *this << updateValue.device;
+        *this << updateValue.location;
+        break;
+    case TLValue::UpdateNewGeoChatMessage:
+        *this << updateValue.messageGeoChat;
+        break;
+    case TLValue::UpdateNewEncryptedMessage:
+        *this << updateValue.messageEncrypted;
+        *this << updateValue.qts;
+        break;
+    case TLValue::UpdateEncryptedChatTyping:
+        *this << updateValue.chatId;
+        break;
+    case TLValue::UpdateEncryption:
+        *this << updateValue.chat;
+        *this << updateValue.date;
+        break;
+    case TLValue::UpdateEncryptedMessagesRead:
+        *this << updateValue.chatId;
+        *this << updateValue.maxDate;
+        *this << updateValue.date;
+        break;
+    case TLValue::UpdateChatParticipantAdd:
+        *this << updateValue.chatId;
+        *this << updateValue.userId;
+        *this << updateValue.inviterId;
+        *this << updateValue.version;
+        break;
+    case TLValue::UpdateChatParticipantDelete:
+        *this << updateValue.chatId;
+        *this << updateValue.userId;
+        *this << updateValue.version;
+        break;
+    case TLValue::UpdateDcOptions:
+        *this << updateValue.dcOptions;
+        break;
+    case TLValue::UpdateUserBlocked:
+        *this << updateValue.userId;
+        *this << updateValue.blocked;
+        break;
+    case TLValue::UpdateNotifySettings:
+        *this << updateValue.peerNotify;
+        *this << updateValue.notifySettings;
+        break;
+    case TLValue::UpdateServiceNotification:
+        *this << updateValue.type;
+        *this << updateValue.messageQString;
+        *this << updateValue.media;
+        *this << updateValue.popup;
+        break;
+    case TLValue::UpdatePrivacy:
+        *this << updateValue.key;
+        *this << updateValue.rules;
+        break;
+    case TLValue::UpdateUserPhone:
+        *this << updateValue.userId;
+        *this << updateValue.phone;
+        break;
+    case TLValue::UpdateReadHistoryInbox:
+        *this << updateValue.peer;
+        *this << updateValue.maxId;
+        *this << updateValue.pts;
+        *this << updateValue.ptsCount;
+        break;
+    case TLValue::UpdateReadHistoryOutbox:
+        *this << updateValue.peer;
+        *this << updateValue.maxId;
+        *this << updateValue.pts;
+        *this << updateValue.ptsCount;
+        break;
+    case TLValue::UpdateWebPage:
+        *this << updateValue.webpage;
+        break;
+    case TLValue::UpdateReadMessagesContents:
+        *this << updateValue.messages;
+        *this << updateValue.pts;
+        *this << updateValue.ptsCount;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLUpdates &updatesValue)
+{
+    *this << updatesValue.tlType;
+
+    switch (updatesValue.tlType) {
+    case TLValue::UpdatesTooLong:
+        break;
+    case TLValue::UpdateShortMessage:
+        *this << updatesValue.flags;
+        *this << updatesValue.id;
+        *this << updatesValue.userId;
+        *this << updatesValue.message;
+        *this << updatesValue.pts;
+        *this << updatesValue.ptsCount;
+        *this << updatesValue.date;
+        if (updatesValue.flags & 1 << 2) {
+            *this << updatesValue.fwdFromId;
+        }
+        if (updatesValue.flags & 1 << 2) {
+            *this << updatesValue.fwdDate;
+        }
+        if (updatesValue.flags & 1 << 3) {
+            *this << updatesValue.replyToMsgId;
+        }
+        break;
+    case TLValue::UpdateShortChatMessage:
+        *this << updatesValue.flags;
+        *this << updatesValue.id;
+        *this << updatesValue.fromId;
+        *this << updatesValue.chatId;
+        *this << updatesValue.message;
+        *this << updatesValue.pts;
+        *this << updatesValue.ptsCount;
+        *this << updatesValue.date;
+        if (updatesValue.flags & 1 << 2) {
+            *this << updatesValue.fwdFromId;
+        }
+        if (updatesValue.flags & 1 << 2) {
+            *this << updatesValue.fwdDate;
+        }
+        if (updatesValue.flags & 1 << 3) {
+            *this << updatesValue.replyToMsgId;
+        }
+        break;
+    case TLValue::UpdateShort:
+        *this << updatesValue.update;
+        *this << updatesValue.date;
+        break;
+    case TLValue::UpdatesCombined:
+        *this << updatesValue.updates;
+        *this << updatesValue.users;
+        *this << updatesValue.chats;
+        *this << updatesValue.date;
+        *this << updatesValue.seqStart;
+        *this << updatesValue.seq;
+        break;
+    case TLValue::Updates:
+        *this << updatesValue.updates;
+        *this << updatesValue.users;
+        *this << updatesValue.chats;
+        *this << updatesValue.date;
+        *this << updatesValue.seq;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+CTelegramStream &CTelegramStream::operator<<(const TLUpdatesDifference &updatesDifferenceValue)
+{
+    *this << updatesDifferenceValue.tlType;
+
+    switch (updatesDifferenceValue.tlType) {
+    case TLValue::UpdatesDifferenceEmpty:
+        *this << updatesDifferenceValue.date;
+        *this << updatesDifferenceValue.seq;
+        break;
+    case TLValue::UpdatesDifference:
+        *this << updatesDifferenceValue.newMessages;
+        *this << updatesDifferenceValue.newEncryptedMessages;
+        *this << updatesDifferenceValue.otherUpdates;
+        *this << updatesDifferenceValue.chats;
+        *this << updatesDifferenceValue.users;
+        *this << updatesDifferenceValue.state;
+        break;
+    case TLValue::UpdatesDifferenceSlice:
+        *this << updatesDifferenceValue.newMessages;
+        *this << updatesDifferenceValue.newEncryptedMessages;
+        *this << updatesDifferenceValue.otherUpdates;
+        *this << updatesDifferenceValue.chats;
+        *this << updatesDifferenceValue.users;
+        *this << updatesDifferenceValue.intermediateState;
+        break;
+    default:
+        break;
+    }
+
+    return *this;
+}
+
+// End of generated write operators implementation
+#endif // TELEGRAMQT_SCHEMA_CODEC
+
+static int bytesSerializedSize(int length)
+{
+    // One or four bytes of the length, the data and the padding to four bytes
+    const int size = length < 0xfe ? length + 1 : length + 4;
+    return (size + 3) & ~3;
+}
+
+int CTelegramStream::serializedSize(const QByteArray &data)
+{
+    return bytesSerializedSize(data.size());
+}
+
+int CTelegramStream::serializedSize(const QString &str)
+{
+    // Length of UTF-8 representation, calculated without the conversion
+    int length = 0;
+    const QChar *data = str.constData();
+    const int size = str.size();
+
+    for (int i = 0; i < size; ++i) {
+        const ushort c = data[i].unicode();
+
+        if (c < 0x80) {
+            length += 1;
+        } else if (c < 0x800) {
+            length += 2;
+        } else if (QChar::isHighSurrogate(c) && (i + 1 < size) && QChar::isLowSurrogate(data[i + 1].unicode())) {
+            length += 4;
+            ++i;
+        } else {
+            length += 3;
+        }
+    }
+
+    return bytesSerializedSize(length);
+}
+
+// Generated serialized size implementation
+int CTelegramStream::serializedSize(const TLAccountPassword &accountPasswordValue)
+{
+    int size = serializedSize(accountPasswordValue.tlType);
+
+    switch (accountPasswordValue.tlType) {
+    case TLValue::AccountNoPassword:
+        size += serializedSize(accountPasswordValue.newSalt);
+        size += serializedSize(accountPasswordValue.emailUnconfirmedPattern);
+        break;
+    case TLValue::AccountPassword:
+        size += serializedSize(accountPasswordValue.currentSalt);
+        size += serializedSize(accountPasswordValue.newSalt);
+        size += serializedSize(accountPasswordValue.hint);
+        size += serializedSize(accountPasswordValue.hasRecovery);
+        size += serializedSize(accountPasswordValue.emailUnconfirmedPattern);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLAccountPasswordInputSettings &accountPasswordInputSettingsValue)
+{
+    int size = serializedSize(accountPasswordInputSettingsValue.tlType);
+
+    switch (accountPasswordInputSettingsValue.tlType) {
+    case TLValue::AccountPasswordInputSettings:
+        size += serializedSize(accountPasswordInputSettingsValue.flags);
+        if (accountPasswordInputSettingsValue.flags & 1 << 0) {
+            size += serializedSize(accountPasswordInputSettingsValue.newSalt);
+        }
+        if (accountPasswordInputSettingsValue.flags & 1 << 0) {
+            size += serializedSize(accountPasswordInputSettingsValue.newPasswordHash);
+        }
+        if (accountPasswordInputSettingsValue.flags & 1 << 0) {
+            size += serializedSize(accountPasswordInputSettingsValue.hint);
+        }
+        if (accountPasswordInputSettingsValue.flags & 1 << 1) {
+            size += serializedSize(accountPasswordInputSettingsValue.email);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLAccountPasswordSettings &accountPasswordSettingsValue)
+{
+    int size = serializedSize(accountPasswordSettingsValue.tlType);
+
+    switch (accountPasswordSettingsValue.tlType) {
+    case TLValue::AccountPasswordSettings:
+        size += serializedSize(accountPasswordSettingsValue.email);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLAccountSentChangePhoneCode &accountSentChangePhoneCodeValue)
+{
+    int size = serializedSize(accountSentChangePhoneCodeValue.tlType);
+
+    switch (accountSentChangePhoneCodeValue.tlType) {
+    case TLValue::AccountSentChangePhoneCode:
+        size += serializedSize(accountSentChangePhoneCodeValue.phoneCodeHash);
+        size += serializedSize(accountSentChangePhoneCodeValue.sendCallTimeout);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLAudio &audioValue)
+{
+    int size = serializedSize(audioValue.tlType);
+
+    switch (audioValue.tlType) {
+    case TLValue::AudioEmpty:
+        size += serializedSize(audioValue.id);
+        break;
+    case TLValue::Audio:
+        size += serializedSize(audioValue.id);
+        size += serializedSize(audioValue.accessHash);
+        size += serializedSize(audioValue.userId);
+        size += serializedSize(audioValue.date);
+        size += serializedSize(audioValue.duration);
+        size += serializedSize(audioValue.mimeType);
+        size += serializedSize(audioValue.size);
+        size += serializedSize(audioValue.dcId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLAuthExportedAuthorization &authExportedAuthorizationValue)
+{
+    int size = serializedSize(authExportedAuthorizationValue.tlType);
+
+    switch (authExportedAuthorizationValue.tlType) {
+    case TLValue::AuthExportedAuthorization:
+        size += serializedSize(authExportedAuthorizationValue.id);
+        size += serializedSize(authExportedAuthorizationValue.bytes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLAuthPasswordRecovery &authPasswordRecoveryValue)
+{
+    int size = serializedSize(authPasswordRecoveryValue.tlType);
+
+    switch (authPasswordRecoveryValue.tlType) {
+    case TLValue::AuthPasswordRecovery:
+        size += serializedSize(authPasswordRecoveryValue.emailPattern);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLAuthSentCode &authSentCodeValue)
+{
+    int size = serializedSize(authSentCodeValue.tlType);
+
+    switch (authSentCodeValue.tlType) {
+    case TLValue::AuthSentCode:
+        size += serializedSize(authSentCodeValue.phoneRegistered);
+        size += serializedSize(authSentCodeValue.phoneCodeHash);
+        size += serializedSize(authSentCodeValue.sendCallTimeout);
+        size += serializedSize(authSentCodeValue.isPassword);
+        break;
+    case TLValue::AuthSentAppCode:
+        size += serializedSize(authSentCodeValue.phoneRegistered);
+        size += serializedSize(authSentCodeValue.phoneCodeHash);
+        size += serializedSize(authSentCodeValue.sendCallTimeout);
+        size += serializedSize(authSentCodeValue.isPassword);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLAuthorization &authorizationValue)
+{
+    int size = serializedSize(authorizationValue.tlType);
+
+    switch (authorizationValue.tlType) {
+    case TLValue::Authorization:
+        size += serializedSize(authorizationValue.hash);
+        size += serializedSize(authorizationValue.flags);
+        size += serializedSize(authorizationValue.deviceModel);
+        size += serializedSize(authorizationValue.platform);
+        size += serializedSize(authorizationValue.systemVersion);
+        size += serializedSize(authorizationValue.apiId);
+        size += serializedSize(authorizationValue.appName);
+        size += serializedSize(authorizationValue.appVersion);
+        size += serializedSize(authorizationValue.dateCreated);
+        size += serializedSize(authorizationValue.dateActive);
+        size += serializedSize(authorizationValue.ip);
+        size += serializedSize(authorizationValue.country);
+        size += serializedSize(authorizationValue.region);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLChatParticipants &chatParticipantsValue)
+{
+    int size = serializedSize(chatParticipantsValue.tlType);
+
+    switch (chatParticipantsValue.tlType) {
+    case TLValue::ChatParticipantsForbidden:
+        size += serializedSize(chatParticipantsValue.chatId);
+        break;
+    case TLValue::ChatParticipants:
+        size += serializedSize(chatParticipantsValue.chatId);
+        size += serializedSize(chatParticipantsValue.adminId);
+        size += serializedSize(chatParticipantsValue.participants);
+        size += serializedSize(chatParticipantsValue.version);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLDcOption &dcOptionValue)
+{
+    int size = serializedSize(dcOptionValue.tlType);
+
+    switch (dcOptionValue.tlType) {
+    case TLValue::DcOption:
+        size += serializedSize(dcOptionValue.id);
+        size += serializedSize(dcOptionValue.hostname);
+        size += serializedSize(dcOptionValue.ipAddress);
+        size += serializedSize(dcOptionValue.port);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLDisabledFeature &disabledFeatureValue)
+{
+    int size = serializedSize(disabledFeatureValue.tlType);
+
+    switch (disabledFeatureValue.tlType) {
+    case TLValue::DisabledFeature:
+        size += serializedSize(disabledFeatureValue.feature);
+        size += serializedSize(disabledFeatureValue.description);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLEncryptedChat &encryptedChatValue)
+{
+    int size = serializedSize(encryptedChatValue.tlType);
+
+    switch (encryptedChatValue.tlType) {
+    case TLValue::EncryptedChatEmpty:
+        size += serializedSize(encryptedChatValue.id);
+        break;
+    case TLValue::EncryptedChatWaiting:
+        size += serializedSize(encryptedChatValue.id);
+        size += serializedSize(encryptedChatValue.accessHash);
+        size += serializedSize(encryptedChatValue.date);
+        size += serializedSize(encryptedChatValue.adminId);
+        size += serializedSize(encryptedChatValue.participantId);
+        break;
+    case TLValue::EncryptedChatRequested:
+        size += serializedSize(encryptedChatValue.id);
+        size += serializedSize(encryptedChatValue.accessHash);
+        size += serializedSize(encryptedChatValue.date);
+        size += serializedSize(encryptedChatValue.adminId);
+        size += serializedSize(encryptedChatValue.participantId);
+        size += serializedSize(encryptedChatValue.gA);
+        break;
+    case TLValue::EncryptedChat:
+        size += serializedSize(encryptedChatValue.id);
+        size += serializedSize(encryptedChatValue.accessHash);
+        size += serializedSize(encryptedChatValue.date);
+        size += serializedSize(encryptedChatValue.adminId);
+        size += serializedSize(encryptedChatValue.participantId);
+        size += serializedSize(encryptedChatValue.gAOrB);
+        size += serializedSize(encryptedChatValue.keyFingerprint);
+        break;
+    case TLValue::EncryptedChatDiscarded:
+        size += serializedSize(encryptedChatValue.id);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLEncryptedFile &encryptedFileValue)
+{
+    int size = serializedSize(encryptedFileValue.tlType);
+
+    switch (encryptedFileValue.tlType) {
+    case TLValue::EncryptedFileEmpty:
+        break;
+    case TLValue::EncryptedFile:
+        size += serializedSize(encryptedFileValue.id);
+        size += serializedSize(encryptedFileValue.accessHash);
+        size += serializedSize(encryptedFileValue.size);
+        size += serializedSize(encryptedFileValue.dcId);
+        size += serializedSize(encryptedFileValue.keyFingerprint);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLEncryptedMessage &encryptedMessageValue)
+{
+    int size = serializedSize(encryptedMessageValue.tlType);
+
+    switch (encryptedMessageValue.tlType) {
+    case TLValue::EncryptedMessage:
+        size += serializedSize(encryptedMessageValue.randomId);
+        size += serializedSize(encryptedMessageValue.chatId);
+        size += serializedSize(encryptedMessageValue.date);
+        size += serializedSize(encryptedMessageValue.bytes);
+        size += serializedSize(encryptedMessageValue.file);
+        break;
+    case TLValue::EncryptedMessageService:
+        size += serializedSize(encryptedMessageValue.randomId);
+        size += serializedSize(encryptedMessageValue.chatId);
+        size += serializedSize(encryptedMessageValue.date);
+        size += serializedSize(encryptedMessageValue.bytes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLError &errorValue)
+{
+    int size = serializedSize(errorValue.tlType);
+
+    switch (errorValue.tlType) {
+    case TLValue::Error:
+        size += serializedSize(errorValue.code);
+        size += serializedSize(errorValue.text);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLExportedChatInvite &exportedChatInviteValue)
+{
+    int size = serializedSize(exportedChatInviteValue.tlType);
+
+    switch (exportedChatInviteValue.tlType) {
+    case TLValue::ChatInviteEmpty:
+        break;
+    case TLValue::ChatInviteExported:
+        size += serializedSize(exportedChatInviteValue.link);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLFileLocation &fileLocationValue)
+{
+    int size = serializedSize(fileLocationValue.tlType);
+
+    switch (fileLocationValue.tlType) {
+    case TLValue::FileLocationUnavailable:
+        size += serializedSize(fileLocationValue.volumeId);
+        size += serializedSize(fileLocationValue.localId);
+        size += serializedSize(fileLocationValue.secret);
+        break;
+    case TLValue::FileLocation:
+        size += serializedSize(fileLocationValue.dcId);
+        size += serializedSize(fileLocationValue.volumeId);
+        size += serializedSize(fileLocationValue.localId);
+        size += serializedSize(fileLocationValue.secret);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLGeoPoint &geoPointValue)
+{
+    int size = serializedSize(geoPointValue.tlType);
+
+    switch (geoPointValue.tlType) {
+    case TLValue::GeoPointEmpty:
+        break;
+    case TLValue::GeoPoint:
+        size += serializedSize(geoPointValue.longitude);
+        size += serializedSize(geoPointValue.latitude);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLHelpAppUpdate &helpAppUpdateValue)
+{
+    int size = serializedSize(helpAppUpdateValue.tlType);
+
+    switch (helpAppUpdateValue.tlType) {
+    case TLValue::HelpAppUpdate:
+        size += serializedSize(helpAppUpdateValue.id);
+        size += serializedSize(helpAppUpdateValue.critical);
+        size += serializedSize(helpAppUpdateValue.url);
+        size += serializedSize(helpAppUpdateValue.text);
+        break;
+    case TLValue::HelpNoAppUpdate:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLHelpInviteText &helpInviteTextValue)
+{
+    int size = serializedSize(helpInviteTextValue.tlType);
+
+    switch (helpInviteTextValue.tlType) {
+    case TLValue::HelpInviteText:
+        size += serializedSize(helpInviteTextValue.message);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLInputAppEvent &inputAppEventValue)
+{
+    int size = serializedSize(inputAppEventValue.tlType);
+
+    switch (inputAppEventValue.tlType) {
+    case TLValue::InputAppEvent:
+        size += serializedSize(inputAppEventValue.time);
+        size += serializedSize(inputAppEventValue.type);
+        size += serializedSize(inputAppEventValue.peer);
+        size += serializedSize(inputAppEventValue.data);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLInputAudio &inputAudioValue)
+{
+    int size = serializedSize(inputAudioValue.tlType);
+
+    switch (inputAudioValue.tlType) {
+    case TLValue::InputAudioEmpty:
+        break;
+    case TLValue::InputAudio:
+        size += serializedSize(inputAudioValue.id);
+        size += serializedSize(inputAudioValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLInputContact &inputContactValue)
+{
+    int size = serializedSize(inputContactValue.tlType);
+
+    switch (inputContactValue.tlType) {
+    case TLValue::InputPhoneContact:
+        size += serializedSize(inputContactValue.clientId);
+        size += serializedSize(inputContactValue.phone);
+        size += serializedSize(inputContactValue.firstName);
+        size += serializedSize(inputContactValue.lastName);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLInputDocument &inputDocumentValue)
+{
+    int size = serializedSize(inputDocumentValue.tlType);
+
+    switch (inputDocumentValue.tlType) {
+    case TLValue::InputDocumentEmpty:
+        break;
+    case TLValue::InputDocument:
+        size += serializedSize(inputDocumentValue.id);
+        size += serializedSize(inputDocumentValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLInputEncryptedFile &inputEncryptedFileValue)
+{
+    int size = serializedSize(inputEncryptedFileValue.tlType);
+
+    switch (inputEncryptedFileValue.tlType) {
+    case TLValue::InputEncryptedFileEmpty:
+        break;
+    case TLValue::InputEncryptedFileUploaded:
+        size += serializedSize(inputEncryptedFileValue.id);
+        size += serializedSize(inputEncryptedFileValue.parts);
+        size += serializedSize(inputEncryptedFileValue.md5Checksum);
+        size += serializedSize(inputEncryptedFileValue.keyFingerprint);
+        break;
+    case TLValue::InputEncryptedFile:
+        size += serializedSize(inputEncryptedFileValue.id);
+        size += serializedSize(inputEncryptedFileValue.accessHash);
+        break;
+    case TLValue::InputEncryptedFileBigUploaded:
+        size += serializedSize(inputEncryptedFileValue.id);
+        size += serializedSize(inputEncryptedFileValue.parts);
+        size += serializedSize(inputEncryptedFileValue.keyFingerprint);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLInputFile &inputFileValue)
+{
+    int size = serializedSize(inputFileValue.tlType);
+
+    switch (inputFileValue.tlType) {
+    case TLValue::InputFile:
+        size += serializedSize(inputFileValue.id);
+        size += serializedSize(inputFileValue.parts);
+        size += serializedSize(inputFileValue.name);
+        size += serializedSize(inputFileValue.md5Checksum);
+        break;
+    case TLValue::InputFileBig:
+        size += serializedSize(inputFileValue.id);
+        size += serializedSize(inputFileValue.parts);
+        size += serializedSize(inputFileValue.name);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLInputFileLocation &inputFileLocationValue)
+{
+    int size = serializedSize(inputFileLocationValue.tlType);
+
+    switch (inputFileLocationValue.tlType) {
+    case TLValue::InputFileLocation:
+        size += serializedSize(inputFileLocationValue.volumeId);
+        size += serializedSize(inputFileLocationValue.localId);
+        size += serializedSize(inputFileLocationValue.secret);
+        break;
+    case TLValue::InputVideoFileLocation:
+        size += serializedSize(inputFileLocationValue.id);
+        size += serializedSize(inputFileLocationValue.accessHash);
+        break;
+    case TLValue::InputEncryptedFileLocation:
+        size += serializedSize(inputFileLocationValue.id);
+        size += serializedSize(inputFileLocationValue.accessHash);
+        break;
+    case TLValue::InputAudioFileLocation:
+        size += serializedSize(inputFileLocationValue.id);
+        size += serializedSize(inputFileLocationValue.accessHash);
+        break;
+    case TLValue::InputDocumentFileLocation:
+        size += serializedSize(inputFileLocationValue.id);
+        size += serializedSize(inputFileLocationValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLInputGeoPoint &inputGeoPointValue)
+{
+    int size = serializedSize(inputGeoPointValue.tlType);
+
+    switch (inputGeoPointValue.tlType) {
+    case TLValue::InputGeoPointEmpty:
+        break;
+    case TLValue::InputGeoPoint:
+        size += serializedSize(inputGeoPointValue.latitude);
+        size += serializedSize(inputGeoPointValue.longitude);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLInputPeer &inputPeerValue)
+{
+    int size = serializedSize(inputPeerValue.tlType);
+
+    switch (inputPeerValue.tlType) {
+    case TLValue::InputPeerEmpty:
+        break;
+    case TLValue::InputPeerSelf:
+        break;
+    case TLValue::InputPeerContact:
+        size += serializedSize(inputPeerValue.userId);
+        break;
+    case TLValue::InputPeerForeign:
+        size += serializedSize(inputPeerValue.userId);
+        size += serializedSize(inputPeerValue.accessHash);
+        break;
+    case TLValue::InputPeerChat:
+        size += serializedSize(inputPeerValue.chatId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLInputPeerNotifySettings &inputPeerNotifySettingsValue)
+{
+    int size = serializedSize(inputPeerNotifySettingsValue.tlType);
+
+    switch (inputPeerNotifySettingsValue.tlType) {
+    case TLValue::InputPeerNotifySettings:
+        size += serializedSize(inputPeerNotifySettingsValue.muteUntil);
+        size += serializedSize(inputPeerNotifySettingsValue.sound);
+        size += serializedSize(inputPeerNotifySettingsValue.showPreviews);
+        size += serializedSize(inputPeerNotifySettingsValue.eventsMask);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLInputPhoto &inputPhotoValue)
+{
+    int size = serializedSize(inputPhotoValue.tlType);
+
+    switch (inputPhotoValue.tlType) {
+    case TLValue::InputPhotoEmpty:
+        break;
+    case TLValue::InputPhoto:
+        size += serializedSize(inputPhotoValue.id);
+        size += serializedSize(inputPhotoValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLInputPhotoCrop &inputPhotoCropValue)
+{
+    int size = serializedSize(inputPhotoCropValue.tlType);
+
+    switch (inputPhotoCropValue.tlType) {
+    case TLValue::InputPhotoCropAuto:
+        break;
+    case TLValue::InputPhotoCrop:
+        size += serializedSize(inputPhotoCropValue.cropLeft);
+        size += serializedSize(inputPhotoCropValue.cropTop);
+        size += serializedSize(inputPhotoCropValue.cropWidth);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLInputStickerSet &inputStickerSetValue)
+{
+    int size = serializedSize(inputStickerSetValue.tlType);
+
+    switch (inputStickerSetValue.tlType) {
+    case TLValue::InputStickerSetEmpty:
+        break;
+    case TLValue::InputStickerSetID:
+        size += serializedSize(inputStickerSetValue.id);
+        size += serializedSize(inputStickerSetValue.accessHash);
+        break;
+    case TLValue::InputStickerSetShortName:
+        size += serializedSize(inputStickerSetValue.shortName);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLInputUser &inputUserValue)
+{
+    int size = serializedSize(inputUserValue.tlType);
+
+    switch (inputUserValue.tlType) {
+    case TLValue::InputUserEmpty:
+        break;
+    case TLValue::InputUserSelf:
+        break;
+    case TLValue::InputUserContact:
+        size += serializedSize(inputUserValue.userId);
+        break;
+    case TLValue::InputUserForeign:
+        size += serializedSize(inputUserValue.userId);
+        size += serializedSize(inputUserValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLInputVideo &inputVideoValue)
+{
+    int size = serializedSize(inputVideoValue.tlType);
+
+    switch (inputVideoValue.tlType) {
+    case TLValue::InputVideoEmpty:
+        break;
+    case TLValue::InputVideo:
+        size += serializedSize(inputVideoValue.id);
+        size += serializedSize(inputVideoValue.accessHash);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLMessagesDhConfig &messagesDhConfigValue)
+{
+    int size = serializedSize(messagesDhConfigValue.tlType);
+
+    switch (messagesDhConfigValue.tlType) {
+    case TLValue::MessagesDhConfigNotModified:
+        size += serializedSize(messagesDhConfigValue.random);
+        break;
+    case TLValue::MessagesDhConfig:
+        size += serializedSize(messagesDhConfigValue.g);
+        size += serializedSize(messagesDhConfigValue.p);
+        size += serializedSize(messagesDhConfigValue.version);
+        size += serializedSize(messagesDhConfigValue.random);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLMessagesSentEncryptedMessage &messagesSentEncryptedMessageValue)
+{
+    int size = serializedSize(messagesSentEncryptedMessageValue.tlType);
+
+    switch (messagesSentEncryptedMessageValue.tlType) {
+    case TLValue::MessagesSentEncryptedMessage:
+        size += serializedSize(messagesSentEncryptedMessageValue.date);
+        break;
+    case TLValue::MessagesSentEncryptedFile:
+        size += serializedSize(messagesSentEncryptedMessageValue.date);
+        size += serializedSize(messagesSentEncryptedMessageValue.file);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLNearestDc &nearestDcValue)
+{
+    int size = serializedSize(nearestDcValue.tlType);
+
+    switch (nearestDcValue.tlType) {
+    case TLValue::NearestDc:
+        size += serializedSize(nearestDcValue.country);
+        size += serializedSize(nearestDcValue.thisDc);
+        size += serializedSize(nearestDcValue.nearestDc);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLPeerNotifySettings &peerNotifySettingsValue)
+{
+    int size = serializedSize(peerNotifySettingsValue.tlType);
+
+    switch (peerNotifySettingsValue.tlType) {
+    case TLValue::PeerNotifySettingsEmpty:
+        break;
+    case TLValue::PeerNotifySettings:
+        size += serializedSize(peerNotifySettingsValue.muteUntil);
+        size += serializedSize(peerNotifySettingsValue.sound);
+        size += serializedSize(peerNotifySettingsValue.showPreviews);
+        size += serializedSize(peerNotifySettingsValue.eventsMask);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLPhotoSize &photoSizeValue)
+{
+    int size = serializedSize(photoSizeValue.tlType);
+
+    switch (photoSizeValue.tlType) {
+    case TLValue::PhotoSizeEmpty:
+        size += serializedSize(photoSizeValue.type);
+        break;
+    case TLValue::PhotoSize:
+        size += serializedSize(photoSizeValue.type);
+        size += serializedSize(photoSizeValue.location);
+        size += serializedSize(photoSizeValue.w);
+        size += serializedSize(photoSizeValue.h);
+        size += serializedSize(photoSizeValue.size);
+        break;
+    case TLValue::PhotoCachedSize:
+        size += serializedSize(photoSizeValue.type);
+        size += serializedSize(photoSizeValue.location);
+        size += serializedSize(photoSizeValue.w);
+        size += serializedSize(photoSizeValue.h);
+        size += serializedSize(photoSizeValue.bytes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLPrivacyRule &privacyRuleValue)
+{
+    int size = serializedSize(privacyRuleValue.tlType);
+
+    switch (privacyRuleValue.tlType) {
+    case TLValue::PrivacyValueAllowContacts:
+        break;
+    case TLValue::PrivacyValueAllowAll:
+        break;
+    case TLValue::PrivacyValueAllowUsers:
+        size += serializedSize(privacyRuleValue.users);
+        break;
+    case TLValue::PrivacyValueDisallowContacts:
+        break;
+    case TLValue::PrivacyValueDisallowAll:
+        break;
+    case TLValue::PrivacyValueDisallowUsers:
+        size += serializedSize(privacyRuleValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLSendMessageAction &sendMessageActionValue)
+{
+    int size = serializedSize(sendMessageActionValue.tlType);
+
+    switch (sendMessageActionValue.tlType) {
+    case TLValue::SendMessageTypingAction:
+        break;
+    case TLValue::SendMessageCancelAction:
+        break;
+    case TLValue::SendMessageRecordVideoAction:
+        break;
+    case TLValue::SendMessageUploadVideoAction:
+        size += serializedSize(sendMessageActionValue.progress);
+        break;
+    case TLValue::SendMessageRecordAudioAction:
+        break;
+    case TLValue::SendMessageUploadAudioAction:
+        size += serializedSize(sendMessageActionValue.progress);
+        break;
+    case TLValue::SendMessageUploadPhotoAction:
+        size += serializedSize(sendMessageActionValue.progress);
+        break;
+    case TLValue::SendMessageUploadDocumentAction:
+        size += serializedSize(sendMessageActionValue.progress);
+        break;
+    case TLValue::SendMessageGeoLocationAction:
+        break;
+    case TLValue::SendMessageChooseContactAction:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLStickerPack &stickerPackValue)
+{
+    int size = serializedSize(stickerPackValue.tlType);
+
+    switch (stickerPackValue.tlType) {
+    case TLValue::StickerPack:
+        size += serializedSize(stickerPackValue.emoticon);
+        size += serializedSize(stickerPackValue.documents);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLStickerSet &stickerSetValue)
+{
+    int size = serializedSize(stickerSetValue.tlType);
+
+    switch (stickerSetValue.tlType) {
+    case TLValue::StickerSet:
+        size += serializedSize(stickerSetValue.id);
+        size += serializedSize(stickerSetValue.accessHash);
+        size += serializedSize(stickerSetValue.title);
+        size += serializedSize(stickerSetValue.shortName);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLUploadFile &uploadFileValue)
+{
+    int size = serializedSize(uploadFileValue.tlType);
+
+    switch (uploadFileValue.tlType) {
+    case TLValue::UploadFile:
+        size += serializedSize(uploadFileValue.type);
+        size += serializedSize(uploadFileValue.mtime);
+        size += serializedSize(uploadFileValue.bytes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLUserProfilePhoto &userProfilePhotoValue)
+{
+    int size = serializedSize(userProfilePhotoValue.tlType);
+
+    switch (userProfilePhotoValue.tlType) {
+    case TLValue::UserProfilePhotoEmpty:
+        break;
+    case TLValue::UserProfilePhoto:
+        size += serializedSize(userProfilePhotoValue.photoId);
+        size += serializedSize(userProfilePhotoValue.photoSmall);
+        size += serializedSize(userProfilePhotoValue.photoBig);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLUserStatus &userStatusValue)
+{
+    int size = serializedSize(userStatusValue.tlType);
+
+    switch (userStatusValue.tlType) {
+    case TLValue::UserStatusEmpty:
+        break;
+    case TLValue::UserStatusOnline:
+        size += serializedSize(userStatusValue.expires);
+        break;
+    case TLValue::UserStatusOffline:
+        size += serializedSize(userStatusValue.wasOnline);
+        break;
+    case TLValue::UserStatusRecently:
+        break;
+    case TLValue::UserStatusLastWeek:
+        break;
+    case TLValue::UserStatusLastMonth:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLVideo &videoValue)
+{
+    int size = serializedSize(videoValue.tlType);
+
+    switch (videoValue.tlType) {
+    case TLValue::VideoEmpty:
+        size += serializedSize(videoValue.id);
+        break;
+    case TLValue::Video:
+        size += serializedSize(videoValue.id);
+        size += serializedSize(videoValue.accessHash);
+        size += serializedSize(videoValue.userId);
+        size += serializedSize(videoValue.date);
+        size += serializedSize(videoValue.duration);
+        size += serializedSize(videoValue.size);
+        size += serializedSize(videoValue.thumb);
+        size += serializedSize(videoValue.dcId);
+        size += serializedSize(videoValue.w);
+        size += serializedSize(videoValue.h);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLWallPaper &wallPaperValue)
+{
+    int size = serializedSize(wallPaperValue.tlType);
+
+    switch (wallPaperValue.tlType) {
+    case TLValue::WallPaper:
+        size += serializedSize(wallPaperValue.id);
+        size += serializedSize(wallPaperValue.title);
+        size += serializedSize(wallPaperValue.sizes);
+        size += serializedSize(wallPaperValue.color);
+        break;
+    case TLValue::WallPaperSolid:
+        size += serializedSize(wallPaperValue.id);
+        size += serializedSize(wallPaperValue.title);
+        size += serializedSize(wallPaperValue.bgColor);
+        size += serializedSize(wallPaperValue.color);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLAccountAuthorizations &accountAuthorizationsValue)
+{
+    int size = serializedSize(accountAuthorizationsValue.tlType);
+
+    switch (accountAuthorizationsValue.tlType) {
+    case TLValue::AccountAuthorizations:
+        size += serializedSize(accountAuthorizationsValue.authorizations);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLChatPhoto &chatPhotoValue)
+{
+    int size = serializedSize(chatPhotoValue.tlType);
+
+    switch (chatPhotoValue.tlType) {
+    case TLValue::ChatPhotoEmpty:
+        break;
+    case TLValue::ChatPhoto:
+        size += serializedSize(chatPhotoValue.photoSmall);
+        size += serializedSize(chatPhotoValue.photoBig);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLConfig &configValue)
+{
+    int size = serializedSize(configValue.tlType);
+
+    switch (configValue.tlType) {
+    case TLValue::Config:
+        size += serializedSize(configValue.date);
+        size += serializedSize(configValue.expires);
+        size += serializedSize(configValue.testMode);
+        size += serializedSize(configValue.thisDc);
+        size += serializedSize(configValue.dcOptions);
+        size += serializedSize(configValue.chatSizeMax);
+        size += serializedSize(configValue.broadcastSizeMax);
+        size += serializedSize(configValue.forwardedCountMax);
+        size += serializedSize(configValue.onlineUpdatePeriodMs);
+        size += serializedSize(configValue.offlineBlurTimeoutMs);
+        size += serializedSize(configValue.offlineIdleTimeoutMs);
+        size += serializedSize(configValue.onlineCloudTimeoutMs);
+        size += serializedSize(configValue.notifyCloudDelayMs);
+        size += serializedSize(configValue.notifyDefaultDelayMs);
+        size += serializedSize(configValue.chatBigSize);
+        size += serializedSize(configValue.pushChatPeriodMs);
+        size += serializedSize(configValue.pushChatLimit);
+        size += serializedSize(configValue.disabledFeatures);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLContactStatus &contactStatusValue)
+{
+    int size = serializedSize(contactStatusValue.tlType);
+
+    switch (contactStatusValue.tlType) {
+    case TLValue::ContactStatus:
+        size += serializedSize(contactStatusValue.userId);
+        size += serializedSize(contactStatusValue.status);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLDialog &dialogValue)
+{
+    int size = serializedSize(dialogValue.tlType);
+
+    switch (dialogValue.tlType) {
+    case TLValue::Dialog:
+        size += serializedSize(dialogValue.peer);
+        size += serializedSize(dialogValue.topMessage);
+        size += serializedSize(dialogValue.readInboxMaxId);
+        size += serializedSize(dialogValue.unreadCount);
+        size += serializedSize(dialogValue.notifySettings);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLDocumentAttribute &documentAttributeValue)
+{
+    int size = serializedSize(documentAttributeValue.tlType);
+
+    switch (documentAttributeValue.tlType) {
+    case TLValue::DocumentAttributeImageSize:
+        size += serializedSize(documentAttributeValue.w);
+        size += serializedSize(documentAttributeValue.h);
+        break;
+    case TLValue::DocumentAttributeAnimated:
+        break;
+    case TLValue::DocumentAttributeSticker:
+        size += serializedSize(documentAttributeValue.alt);
+        size += serializedSize(documentAttributeValue.stickerset);
+        break;
+    case TLValue::DocumentAttributeVideo:
+        size += serializedSize(documentAttributeValue.duration);
+        size += serializedSize(documentAttributeValue.w);
+        size += serializedSize(documentAttributeValue.h);
+        break;
+    case TLValue::DocumentAttributeAudio:
+        size += serializedSize(documentAttributeValue.duration);
+        break;
+    case TLValue::DocumentAttributeFilename:
+        size += serializedSize(documentAttributeValue.fileName);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLInputChatPhoto &inputChatPhotoValue)
+{
+    int size = serializedSize(inputChatPhotoValue.tlType);
+
+    switch (inputChatPhotoValue.tlType) {
+    case TLValue::InputChatPhotoEmpty:
+        break;
+    case TLValue::InputChatUploadedPhoto:
+        size += serializedSize(inputChatPhotoValue.file);
+        size += serializedSize(inputChatPhotoValue.crop);
+        break;
+    case TLValue::InputChatPhoto:
+        size += serializedSize(inputChatPhotoValue.id);
+        size += serializedSize(inputChatPhotoValue.crop);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLInputMedia &inputMediaValue)
+{
+    int size = serializedSize(inputMediaValue.tlType);
+
+    switch (inputMediaValue.tlType) {
+    case TLValue::InputMediaEmpty:
+        break;
+    case TLValue::InputMediaUploadedPhoto:
+        size += serializedSize(inputMediaValue.file);
+        size += serializedSize(inputMediaValue.caption);
+        break;
+    case TLValue::InputMediaPhoto:
+        size += serializedSize(inputMediaValue.idInputPhoto);
+        size += serializedSize(inputMediaValue.caption);
+        break;
+    case TLValue::InputMediaGeoPoint:
+        size += serializedSize(inputMediaValue.geoPoint);
+        break;
+    case TLValue::InputMediaContact:
+        size += serializedSize(inputMediaValue.phoneNumber);
+        size += serializedSize(inputMediaValue.firstName);
+        size += serializedSize(inputMediaValue.lastName);
+        break;
+    case TLValue::InputMediaUploadedVideo:
+        size += serializedSize(inputMediaValue.file);
+        size += serializedSize(inputMediaValue.duration);
+        size += serializedSize(inputMediaValue.w);
+        size += serializedSize(inputMediaValue.h);
+        size += serializedSize(inputMediaValue.caption);
+        break;
+    case TLValue::InputMediaUploadedThumbVideo:
+        size += serializedSize(inputMediaValue.file);
+        size += serializedSize(inputMediaValue.thumb);
+        size += serializedSize(inputMediaValue.duration);
+        size += serializedSize(inputMediaValue.w);
+        size += serializedSize(inputMediaValue.h);
+        size += serializedSize(inputMediaValue.caption);
+        break;
+    case TLValue::InputMediaVideo:
+        size += serializedSize(inputMediaValue.idInputVeo);
+        size += serializedSize(inputMediaValue.caption);
+        break;
+    case TLValue::InputMediaUploadedAudio:
+        size += serializedSize(inputMediaValue.file);
+        size += serializedSize(inputMediaValue.duration);
+        size += serializedSize(inputMediaValue.mimeType);
+        break;
+    case TLValue::InputMediaAudio:
+        size += serializedSize(inputMediaValue.idInputAudio);
+        break;
+    case TLValue::InputMediaUploadedDocument:
+        size += serializedSize(inputMediaValue.file);
+        size += serializedSize(inputMediaValue.mimeType);
+        size += serializedSize(inputMediaValue.attributes);
+        break;
+    case TLValue::InputMediaUploadedThumbDocument:
+        size += serializedSize(inputMediaValue.file);
+        size += serializedSize(inputMediaValue.thumb);
+        size += serializedSize(inputMediaValue.mimeType);
+        size += serializedSize(inputMediaValue.attributes);
+        break;
+    case TLValue::InputMediaDocument:
+        size += serializedSize(inputMediaValue.idInputDocument);
+        break;
+    case TLValue::InputMediaVenue:
+        size += serializedSize(inputMediaValue.geoPoint);
+        size += serializedSize(inputMediaValue.title);
+        size += serializedSize(inputMediaValue.address);
+        size += serializedSize(inputMediaValue.provider);
+        size += serializedSize(inputMediaValue.venueId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLInputNotifyPeer &inputNotifyPeerValue)
+{
+    int size = serializedSize(inputNotifyPeerValue.tlType);
+
+    switch (inputNotifyPeerValue.tlType) {
+    case TLValue::InputNotifyPeer:
+        size += serializedSize(inputNotifyPeerValue.peerInput);
+        break;
+    case TLValue::InputNotifyUsers:
+        break;
+    case TLValue::InputNotifyChats:
+        break;
+    case TLValue::InputNotifyAll:
+        break;
+    case TLValue::InputNotifyGeoChatPeer:
+        size += serializedSize(inputNotifyPeerValue.peerInputGeoChat);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLInputPrivacyRule &inputPrivacyRuleValue)
+{
+    int size = serializedSize(inputPrivacyRuleValue.tlType);
+
+    switch (inputPrivacyRuleValue.tlType) {
+    case TLValue::InputPrivacyValueAllowContacts:
+        break;
+    case TLValue::InputPrivacyValueAllowAll:
+        break;
+    case TLValue::InputPrivacyValueAllowUsers:
+        size += serializedSize(inputPrivacyRuleValue.users);
+        break;
+    case TLValue::InputPrivacyValueDisallowContacts:
+        break;
+    case TLValue::InputPrivacyValueDisallowAll:
+        break;
+    case TLValue::InputPrivacyValueDisallowUsers:
+        size += serializedSize(inputPrivacyRuleValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLNotifyPeer &notifyPeerValue)
+{
+    int size = serializedSize(notifyPeerValue.tlType);
+
+    switch (notifyPeerValue.tlType) {
+    case TLValue::NotifyPeer:
+        size += serializedSize(notifyPeerValue.peer);
+        break;
+    case TLValue::NotifyUsers:
+        break;
+    case TLValue::NotifyChats:
+        break;
+    case TLValue::NotifyAll:
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLPhoto &photoValue)
+{
+    int size = serializedSize(photoValue.tlType);
+
+    switch (photoValue.tlType) {
+    case TLValue::PhotoEmpty:
+        size += serializedSize(photoValue.id);
+        break;
+    case TLValue::Photo:
+        size += serializedSize(photoValue.id);
+        size += serializedSize(photoValue.accessHash);
+        size += serializedSize(photoValue.userId);
+        size += serializedSize(photoValue.date);
+        size += serializedSize(photoValue.geo);
+        size += serializedSize(photoValue.sizes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLUser &userValue)
+{
+    int size = serializedSize(userValue.tlType);
+
+    switch (userValue.tlType) {
+    case TLValue::UserEmpty:
+        size += serializedSize(userValue.id);
+        break;
+    case TLValue::UserSelf:
+        size += serializedSize(userValue.id);
+        size += serializedSize(userValue.firstName);
+        size += serializedSize(userValue.lastName);
+        size += serializedSize(userValue.username);
+        size += serializedSize(userValue.phone);
+        size += serializedSize(userValue.photo);
+        size += serializedSize(userValue.status);
+        break;
+    case TLValue::UserContact:
+        size += serializedSize(userValue.id);
+        size += serializedSize(userValue.firstName);
+        size += serializedSize(userValue.lastName);
+        size += serializedSize(userValue.username);
+        size += serializedSize(userValue.accessHash);
+        size += serializedSize(userValue.phone);
+        size += serializedSize(userValue.photo);
+        size += serializedSize(userValue.status);
+        break;
+    case TLValue::UserRequest:
+        size += serializedSize(userValue.id);
+        size += serializedSize(userValue.firstName);
+        size += serializedSize(userValue.lastName);
+        size += serializedSize(userValue.username);
+        size += serializedSize(userValue.accessHash);
+        size += serializedSize(userValue.phone);
+        size += serializedSize(userValue.photo);
+        size += serializedSize(userValue.status);
+        break;
+    case TLValue::UserForeign:
+        size += serializedSize(userValue.id);
+        size += serializedSize(userValue.firstName);
+        size += serializedSize(userValue.lastName);
+        size += serializedSize(userValue.username);
+        size += serializedSize(userValue.accessHash);
+        size += serializedSize(userValue.photo);
+        size += serializedSize(userValue.status);
+        break;
+    case TLValue::UserDeleted:
+        size += serializedSize(userValue.id);
+        size += serializedSize(userValue.firstName);
+        size += serializedSize(userValue.lastName);
+        size += serializedSize(userValue.username);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLWebPage &webPageValue)
+{
+    int size = serializedSize(webPageValue.tlType);
+
+    switch (webPageValue.tlType) {
+    case TLValue::WebPageEmpty:
+        size += serializedSize(webPageValue.id);
+        break;
+    case TLValue::WebPagePending:
+        size += serializedSize(webPageValue.id);
+        size += serializedSize(webPageValue.date);
+        break;
+    case TLValue::WebPage:
+        size += serializedSize(webPageValue.flags);
+        size += serializedSize(webPageValue.id);
+        size += serializedSize(webPageValue.url);
+        size += serializedSize(webPageValue.displayUrl);
+        if (webPageValue.flags & 1 << 0) {
+            size += serializedSize(webPageValue.type);
+        }
+        if (webPageValue.flags & 1 << 1) {
+            size += serializedSize(webPageValue.siteName);
+        }
+        if (webPageValue.flags & 1 << 2) {
+            size += serializedSize(webPageValue.title);
+        }
+        if (webPageValue.flags & 1 << 3) {
+            size += serializedSize(webPageValue.description);
+        }
+        if (webPageValue.flags & 1 << 4) {
+            size += serializedSize(webPageValue.photo);
+        }
+        if (webPageValue.flags & 1 << 5) {
+            size += serializedSize(webPageValue.embedUrl);
+        }
+        if (webPageValue.flags & 1 << 5) {
+            size += serializedSize(webPageValue.embedType);
+        }
+        if (webPageValue.flags & 1 << 6) {
+            size += serializedSize(webPageValue.embedWidth);
+        }
+        if (webPageValue.flags & 1 << 6) {
+            size += serializedSize(webPageValue.embedHeight);
+        }
+        if (webPageValue.flags & 1 << 7) {
+            size += serializedSize(webPageValue.duration);
+        }
+        if (webPageValue.flags & 1 << 8) {
+            size += serializedSize(webPageValue.author);
+        }
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLAccountPrivacyRules &accountPrivacyRulesValue)
+{
+    int size = serializedSize(accountPrivacyRulesValue.tlType);
+
+    switch (accountPrivacyRulesValue.tlType) {
+    case TLValue::AccountPrivacyRules:
+        size += serializedSize(accountPrivacyRulesValue.rules);
+        size += serializedSize(accountPrivacyRulesValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLAuthAuthorization &authAuthorizationValue)
+{
+    int size = serializedSize(authAuthorizationValue.tlType);
+
+    switch (authAuthorizationValue.tlType) {
+    case TLValue::AuthAuthorization:
+        size += serializedSize(authAuthorizationValue.expires);
+        size += serializedSize(authAuthorizationValue.user);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLChat &chatValue)
+{
+    int size = serializedSize(chatValue.tlType);
+
+    switch (chatValue.tlType) {
+    case TLValue::ChatEmpty:
+        size += serializedSize(chatValue.id);
+        break;
+    case TLValue::Chat:
+        size += serializedSize(chatValue.id);
+        size += serializedSize(chatValue.title);
+        size += serializedSize(chatValue.photo);
+        size += serializedSize(chatValue.participantsCount);
+        size += serializedSize(chatValue.date);
+        size += serializedSize(chatValue.left);
+        size += serializedSize(chatValue.version);
+        break;
+    case TLValue::ChatForbidden:
+        size += serializedSize(chatValue.id);
+        size += serializedSize(chatValue.title);
+        size += serializedSize(chatValue.date);
+        break;
+    case TLValue::GeoChat:
+        size += serializedSize(chatValue.id);
+        size += serializedSize(chatValue.accessHash);
+        size += serializedSize(chatValue.title);
+        size += serializedSize(chatValue.address);
+        size += serializedSize(chatValue.venue);
+        size += serializedSize(chatValue.geo);
+        size += serializedSize(chatValue.photo);
+        size += serializedSize(chatValue.participantsCount);
+        size += serializedSize(chatValue.date);
+        size += serializedSize(chatValue.checkedIn);
+        size += serializedSize(chatValue.version);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLChatFull &chatFullValue)
+{
+    int size = serializedSize(chatFullValue.tlType);
+
+    switch (chatFullValue.tlType) {
+    case TLValue::ChatFull:
+        size += serializedSize(chatFullValue.id);
+        size += serializedSize(chatFullValue.participants);
+        size += serializedSize(chatFullValue.chatPhoto);
+        size += serializedSize(chatFullValue.notifySettings);
+        size += serializedSize(chatFullValue.exportedInvite);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLChatInvite &chatInviteValue)
+{
+    int size = serializedSize(chatInviteValue.tlType);
+
+    switch (chatInviteValue.tlType) {
+    case TLValue::ChatInviteAlready:
+        size += serializedSize(chatInviteValue.chat);
+        break;
+    case TLValue::ChatInvite:
+        size += serializedSize(chatInviteValue.title);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLContactsBlocked &contactsBlockedValue)
+{
+    int size = serializedSize(contactsBlockedValue.tlType);
+
+    switch (contactsBlockedValue.tlType) {
+    case TLValue::ContactsBlocked:
+        size += serializedSize(contactsBlockedValue.blocked);
+        size += serializedSize(contactsBlockedValue.users);
+        break;
+    case TLValue::ContactsBlockedSlice:
+        size += serializedSize(contactsBlockedValue.count);
+        size += serializedSize(contactsBlockedValue.blocked);
+        size += serializedSize(contactsBlockedValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLContactsContacts &contactsContactsValue)
+{
+    int size = serializedSize(contactsContactsValue.tlType);
+
+    switch (contactsContactsValue.tlType) {
+    case TLValue::ContactsContactsNotModified:
+        break;
+    case TLValue::ContactsContacts:
+        size += serializedSize(contactsContactsValue.contacts);
+        size += serializedSize(contactsContactsValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLContactsFound &contactsFoundValue)
+{
+    int size = serializedSize(contactsFoundValue.tlType);
+
+    switch (contactsFoundValue.tlType) {
+    case TLValue::ContactsFound:
+        size += serializedSize(contactsFoundValue.results);
+        size += serializedSize(contactsFoundValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLContactsImportedContacts &contactsImportedContactsValue)
+{
+    int size = serializedSize(contactsImportedContactsValue.tlType);
+
+    switch (contactsImportedContactsValue.tlType) {
+    case TLValue::ContactsImportedContacts:
+        size += serializedSize(contactsImportedContactsValue.imported);
+        size += serializedSize(contactsImportedContactsValue.retryContacts);
+        size += serializedSize(contactsImportedContactsValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLContactsLink &contactsLinkValue)
+{
+    int size = serializedSize(contactsLinkValue.tlType);
+
+    switch (contactsLinkValue.tlType) {
+    case TLValue::ContactsLink:
+        size += serializedSize(contactsLinkValue.myLink);
+        size += serializedSize(contactsLinkValue.foreignLink);
+        size += serializedSize(contactsLinkValue.user);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLContactsSuggested &contactsSuggestedValue)
+{
+    int size = serializedSize(contactsSuggestedValue.tlType);
+
+    switch (contactsSuggestedValue.tlType) {
+    case TLValue::ContactsSuggested:
+        size += serializedSize(contactsSuggestedValue.results);
+        size += serializedSize(contactsSuggestedValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLDocument &documentValue)
+{
+    int size = serializedSize(documentValue.tlType);
+
+    switch (documentValue.tlType) {
+    case TLValue::DocumentEmpty:
+        size += serializedSize(documentValue.id);
+        break;
+    case TLValue::Document:
+        size += serializedSize(documentValue.id);
+        size += serializedSize(documentValue.accessHash);
+        size += serializedSize(documentValue.date);
+        size += serializedSize(documentValue.mimeType);
+        size += serializedSize(documentValue.size);
+        size += serializedSize(documentValue.thumb);
+        size += serializedSize(documentValue.dcId);
+        size += serializedSize(documentValue.attributes);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLHelpSupport &helpSupportValue)
+{
+    int size = serializedSize(helpSupportValue.tlType);
+
+    switch (helpSupportValue.tlType) {
+    case TLValue::HelpSupport:
+        size += serializedSize(helpSupportValue.phoneNumber);
+        size += serializedSize(helpSupportValue.user);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLMessageAction &messageActionValue)
+{
+    int size = serializedSize(messageActionValue.tlType);
+
+    switch (messageActionValue.tlType) {
+    case TLValue::MessageActionEmpty:
+        break;
+    case TLValue::MessageActionChatCreate:
+        size += serializedSize(messageActionValue.title);
+        size += serializedSize(messageActionValue.users);
+        break;
+    case TLValue::MessageActionChatEditTitle:
+        size += serializedSize(messageActionValue.title);
+        break;
+    case TLValue::MessageActionChatEditPhoto:
+        size += serializedSize(messageActionValue.photo);
+        break;
+    case TLValue::MessageActionChatDeletePhoto:
+        break;
+    case TLValue::MessageActionChatAddUser:
+        size += serializedSize(messageActionValue.userId);
+        break;
+    case TLValue::MessageActionChatDeleteUser:
+        size += serializedSize(messageActionValue.userId);
+        break;
+    case TLValue::MessageActionGeoChatCreate:
+        size += serializedSize(messageActionValue.title);
+        size += serializedSize(messageActionValue.address);
+        break;
+    case TLValue::MessageActionGeoChatCheckin:
+        break;
+    case TLValue::MessageActionChatJoinedByLink:
+        size += serializedSize(messageActionValue.inviterId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLMessageMedia &messageMediaValue)
+{
+    int size = serializedSize(messageMediaValue.tlType);
+
+    switch (messageMediaValue.tlType) {
+    case TLValue::MessageMediaEmpty:
+        break;
+    case TLValue::MessageMediaPhoto:
+        size += serializedSize(messageMediaValue.photo);
+        size += serializedSize(messageMediaValue.caption);
+        break;
+    case TLValue::MessageMediaVideo:
+        size += serializedSize(messageMediaValue.video);
+        size += serializedSize(messageMediaValue.caption);
+        break;
+    case TLValue::MessageMediaGeo:
+        size += serializedSize(messageMediaValue.geo);
+        break;
+    case TLValue::MessageMediaContact:
+        size += serializedSize(messageMediaValue.phoneNumber);
+        size += serializedSize(messageMediaValue.firstName);
+        size += serializedSize(messageMediaValue.lastName);
+        size += serializedSize(messageMediaValue.userId);
+        break;
+    case TLValue::MessageMediaUnsupported:
+        break;
+    case TLValue::MessageMediaDocument:
+        size += serializedSize(messageMediaValue.document);
+        break;
+    case TLValue::MessageMediaAudio:
+        size += serializedSize(messageMediaValue.audio);
+        break;
+    case TLValue::MessageMediaWebPage:
+        size += serializedSize(messageMediaValue.webpage);
+        break;
+    case TLValue::MessageMediaVenue:
+        size += serializedSize(messageMediaValue.geo);
+        size += serializedSize(messageMediaValue.title);
+        size += serializedSize(messageMediaValue.address);
+        size += serializedSize(messageMediaValue.provider);
+        size += serializedSize(messageMediaValue.venueId);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLMessagesAllStickers &messagesAllStickersValue)
+{
+    int size = serializedSize(messagesAllStickersValue.tlType);
+
+    switch (messagesAllStickersValue.tlType) {
+    case TLValue::MessagesAllStickersNotModified:
+        break;
+    case TLValue::MessagesAllStickers:
+        size += serializedSize(messagesAllStickersValue.hash);
+        size += serializedSize(messagesAllStickersValue.packs);
+        size += serializedSize(messagesAllStickersValue.sets);
+        size += serializedSize(messagesAllStickersValue.documents);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLMessagesChatFull &messagesChatFullValue)
+{
+    int size = serializedSize(messagesChatFullValue.tlType);
+
+    switch (messagesChatFullValue.tlType) {
+    case TLValue::MessagesChatFull:
+        size += serializedSize(messagesChatFullValue.fullChat);
+        size += serializedSize(messagesChatFullValue.chats);
+        size += serializedSize(messagesChatFullValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLMessagesChats &messagesChatsValue)
+{
+    int size = serializedSize(messagesChatsValue.tlType);
+
+    switch (messagesChatsValue.tlType) {
+    case TLValue::MessagesChats:
+        size += serializedSize(messagesChatsValue.chats);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLMessagesSentMessage &messagesSentMessageValue)
+{
+    int size = serializedSize(messagesSentMessageValue.tlType);
+
+    switch (messagesSentMessageValue.tlType) {
+    case TLValue::MessagesSentMessage:
+        size += serializedSize(messagesSentMessageValue.id);
+        size += serializedSize(messagesSentMessageValue.date);
+        size += serializedSize(messagesSentMessageValue.media);
+        size += serializedSize(messagesSentMessageValue.pts);
+        size += serializedSize(messagesSentMessageValue.ptsCount);
+        break;
+    case TLValue::MessagesSentMessageLink:
+        size += serializedSize(messagesSentMessageValue.id);
+        size += serializedSize(messagesSentMessageValue.date);
+        size += serializedSize(messagesSentMessageValue.media);
+        size += serializedSize(messagesSentMessageValue.pts);
+        size += serializedSize(messagesSentMessageValue.ptsCount);
+        size += serializedSize(messagesSentMessageValue.links);
+        size += serializedSize(messagesSentMessageValue.seq);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLMessagesStickerSet &messagesStickerSetValue)
+{
+    int size = serializedSize(messagesStickerSetValue.tlType);
+
+    switch (messagesStickerSetValue.tlType) {
+    case TLValue::MessagesStickerSet:
+        size += serializedSize(messagesStickerSetValue.set);
+        size += serializedSize(messagesStickerSetValue.packs);
+        size += serializedSize(messagesStickerSetValue.documents);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLMessagesStickers &messagesStickersValue)
+{
+    int size = serializedSize(messagesStickersValue.tlType);
+
+    switch (messagesStickersValue.tlType) {
+    case TLValue::MessagesStickersNotModified:
+        break;
+    case TLValue::MessagesStickers:
+        size += serializedSize(messagesStickersValue.hash);
+        size += serializedSize(messagesStickersValue.stickers);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLPhotosPhoto &photosPhotoValue)
+{
+    int size = serializedSize(photosPhotoValue.tlType);
+
+    switch (photosPhotoValue.tlType) {
+    case TLValue::PhotosPhoto:
+        size += serializedSize(photosPhotoValue.photo);
+        size += serializedSize(photosPhotoValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLPhotosPhotos &photosPhotosValue)
+{
+    int size = serializedSize(photosPhotosValue.tlType);
+
+    switch (photosPhotosValue.tlType) {
+    case TLValue::PhotosPhotos:
+        size += serializedSize(photosPhotosValue.photos);
+        size += serializedSize(photosPhotosValue.users);
+        break;
+    case TLValue::PhotosPhotosSlice:
+        size += serializedSize(photosPhotosValue.count);
+        size += serializedSize(photosPhotosValue.photos);
+        size += serializedSize(photosPhotosValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLUserFull &userFullValue)
+{
+    int size = serializedSize(userFullValue.tlType);
+
+    switch (userFullValue.tlType) {
+    case TLValue::UserFull:
+        size += serializedSize(userFullValue.user);
+        size += serializedSize(userFullValue.link);
+        size += serializedSize(userFullValue.profilePhoto);
+        size += serializedSize(userFullValue.notifySettings);
+        size += serializedSize(userFullValue.blocked);
+        size += serializedSize(userFullValue.realFirstName);
+        size += serializedSize(userFullValue.realLastName);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLGeoChatMessage &geoChatMessageValue)
+{
+    int size = serializedSize(geoChatMessageValue.tlType);
+
+    switch (geoChatMessageValue.tlType) {
+    case TLValue::GeoChatMessageEmpty:
+        size += serializedSize(geoChatMessageValue.chatId);
+        size += serializedSize(geoChatMessageValue.id);
+        break;
+    case TLValue::GeoChatMessage:
+        size += serializedSize(geoChatMessageValue.chatId);
+        size += serializedSize(geoChatMessageValue.id);
+        size += serializedSize(geoChatMessageValue.fromId);
+        size += serializedSize(geoChatMessageValue.date);
+        size += serializedSize(geoChatMessageValue.message);
+        size += serializedSize(geoChatMessageValue.media);
+        break;
+    case TLValue::GeoChatMessageService:
+        size += serializedSize(geoChatMessageValue.chatId);
+        size += serializedSize(geoChatMessageValue.id);
+        size += serializedSize(geoChatMessageValue.fromId);
+        size += serializedSize(geoChatMessageValue.date);
+        size += serializedSize(geoChatMessageValue.action);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLGeochatsLocated &geochatsLocatedValue)
+{
+    int size = serializedSize(geochatsLocatedValue.tlType);
+
+    switch (geochatsLocatedValue.tlType) {
+    case TLValue::GeochatsLocated:
+        size += serializedSize(geochatsLocatedValue.results);
+        size += serializedSize(geochatsLocatedValue.messages);
+        size += serializedSize(geochatsLocatedValue.chats);
+        size += serializedSize(geochatsLocatedValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLGeochatsMessages &geochatsMessagesValue)
+{
+    int size = serializedSize(geochatsMessagesValue.tlType);
+
+    switch (geochatsMessagesValue.tlType) {
+    case TLValue::GeochatsMessages:
+        size += serializedSize(geochatsMessagesValue.messages);
+        size += serializedSize(geochatsMessagesValue.chats);
+        size += serializedSize(geochatsMessagesValue.users);
+        break;
+    case TLValue::GeochatsMessagesSlice:
+        size += serializedSize(geochatsMessagesValue.count);
+        size += serializedSize(geochatsMessagesValue.messages);
+        size += serializedSize(geochatsMessagesValue.chats);
+        size += serializedSize(geochatsMessagesValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLGeochatsStatedMessage &geochatsStatedMessageValue)
+{
+    int size = serializedSize(geochatsStatedMessageValue.tlType);
+
+    switch (geochatsStatedMessageValue.tlType) {
+    case TLValue::GeochatsStatedMessage:
+        size += serializedSize(geochatsStatedMessageValue.message);
+        size += serializedSize(geochatsStatedMessageValue.chats);
+        size += serializedSize(geochatsStatedMessageValue.users);
+        size += serializedSize(geochatsStatedMessageValue.seq);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLMessage &messageValue)
+{
+    int size = serializedSize(messageValue.tlType);
+
+    switch (messageValue.tlType) {
+    case TLValue::MessageEmpty:
+        size += serializedSize(messageValue.id);
+        break;
+    case TLValue::Message:
+        size += serializedSize(messageValue.flags);
+        size += serializedSize(messageValue.id);
+        size += serializedSize(messageValue.fromId);
+        size += serializedSize(messageValue.toId);
+        if (messageValue.flags & 1 << 2) {
+            size += serializedSize(messageValue.fwdFromId);
+        }
+        if (messageValue.flags & 1 << 2) {
+            size += serializedSize(messageValue.fwdDate);
+        }
+        if (messageValue.flags & 1 << 3) {
+            size += serializedSize(messageValue.replyToMsgId);
+        }
+        size += serializedSize(messageValue.date);
+        size += serializedSize(messageValue.message);
+        size += serializedSize(messageValue.media);
+        break;
+    case TLValue::MessageService:
+        size += serializedSize(messageValue.flags);
+        size += serializedSize(messageValue.id);
+        size += serializedSize(messageValue.fromId);
+        size += serializedSize(messageValue.toId);
+        size += serializedSize(messageValue.date);
+        size += serializedSize(messageValue.action);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLMessagesDialogs &messagesDialogsValue)
+{
+    int size = serializedSize(messagesDialogsValue.tlType);
+
+    switch (messagesDialogsValue.tlType) {
+    case TLValue::MessagesDialogs:
+        size += serializedSize(messagesDialogsValue.dialogs);
+        size += serializedSize(messagesDialogsValue.messages);
+        size += serializedSize(messagesDialogsValue.chats);
+        size += serializedSize(messagesDialogsValue.users);
+        break;
+    case TLValue::MessagesDialogsSlice:
+        size += serializedSize(messagesDialogsValue.count);
+        size += serializedSize(messagesDialogsValue.dialogs);
+        size += serializedSize(messagesDialogsValue.messages);
+        size += serializedSize(messagesDialogsValue.chats);
+        size += serializedSize(messagesDialogsValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLMessagesMessages &messagesMessagesValue)
+{
+    int size = serializedSize(messagesMessagesValue.tlType);
+
+    switch (messagesMessagesValue.tlType) {
+    case TLValue::MessagesMessages:
+        size += serializedSize(messagesMessagesValue.messages);
+        size += serializedSize(messagesMessagesValue.chats);
+        size += serializedSize(messagesMessagesValue.users);
+        break;
+    case TLValue::MessagesMessagesSlice:
+        size += serializedSize(messagesMessagesValue.count);
+        size += serializedSize(messagesMessagesValue.messages);
+        size += serializedSize(messagesMessagesValue.chats);
+        size += serializedSize(messagesMessagesValue.users);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLUpdate &updateValue)
+{
+    int size = serializedSize(updateValue.tlType);
+
+    switch (updateValue.tlType) {
+    case TLValue::UpdateNewMessage:
+        size += serializedSize(updateValue.message);
+        size += serializedSize(updateValue.pts);
+        size += serializedSize(updateValue.ptsCount);
+        break;
+    case TLValue::UpdateMessageID:
+        size += serializedSize(updateValue.id);
+        size += serializedSize(updateValue.randomId);
+        break;
+    case TLValue::UpdateDeleteMessages:
+        size += serializedSize(updateValue.messages);
+        size += serializedSize(updateValue.pts);
+        size += serializedSize(updateValue.ptsCount);
+        break;
+    case TLValue::UpdateUserTyping:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.action);
+        break;
+    case TLValue::UpdateChatUserTyping:
+        size += serializedSize(updateValue.chatId);
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.action);
+        break;
+    case TLValue::UpdateChatParticipants:
+        size += serializedSize(updateValue.participants);
+        break;
+    case TLValue::UpdateUserStatus:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.status);
+        break;
+    case TLValue::UpdateUserName:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.firstName);
+        size += serializedSize(updateValue.lastName);
+        size += serializedSize(updateValue.username);
+        break;
+    case TLValue::UpdateUserPhoto:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.date);
+        size += serializedSize(updateValue.photo);
+        size += serializedSize(updateValue.previous);
+        break;
+    case TLValue::UpdateContactRegistered:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.date);
+        break;
+    case TLValue::UpdateContactLink:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.myLink);
+        size += serializedSize(updateValue.foreignLink);
+        break;
+    case TLValue::UpdateNewAuthorization:
+        size += serializedSize(updateValue.authKeyId);
+        size += serializedSize(updateValue.date);
+        size += serializedSize(updateValue.device);
+        size += serializedSize(updateValue.location);
+        break;
+    case TLValue::UpdateNewGeoChatMessage:
+        size += serializedSize(updateValue.messageGeoChat);
+        break;
+    case TLValue::UpdateNewEncryptedMessage:
+        size += serializedSize(updateValue.messageEncrypted);
+        size += serializedSize(updateValue.qts);
+        break;
+    case TLValue::UpdateEncryptedChatTyping:
+        size += serializedSize(updateValue.chatId);
+        break;
+    case TLValue::UpdateEncryption:
+        size += serializedSize(updateValue.chat);
+        size += serializedSize(updateValue.date);
+        break;
+    case TLValue::UpdateEncryptedMessagesRead:
+        size += serializedSize(updateValue.chatId);
+        size += serializedSize(updateValue.maxDate);
+        size += serializedSize(updateValue.date);
+        break;
+    case TLValue::UpdateChatParticipantAdd:
+        size += serializedSize(updateValue.chatId);
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.inviterId);
+        size += serializedSize(updateValue.version);
+        break;
+    case TLValue::UpdateChatParticipantDelete:
+        size += serializedSize(updateValue.chatId);
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.version);
+        break;
+    case TLValue::UpdateDcOptions:
+        size += serializedSize(updateValue.dcOptions);
+        break;
+    case TLValue::UpdateUserBlocked:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.blocked);
+        break;
+    case TLValue::UpdateNotifySettings:
+        size += serializedSize(updateValue.peerNotify);
+        size += serializedSize(updateValue.notifySettings);
+        break;
+    case TLValue::UpdateServiceNotification:
+        size += serializedSize(updateValue.type);
+        size += serializedSize(updateValue.messageQString);
+        size += serializedSize(updateValue.media);
+        size += serializedSize(updateValue.popup);
+        break;
+    case TLValue::UpdatePrivacy:
+        size += serializedSize(updateValue.key);
+        size += serializedSize(updateValue.rules);
+        break;
+    case TLValue::UpdateUserPhone:
+        size += serializedSize(updateValue.userId);
+        size += serializedSize(updateValue.phone);
+        break;
+    case TLValue::UpdateReadHistoryInbox:
+        size += serializedSize(updateValue.peer);
+        size += serializedSize(updateValue.maxId);
+        size += serializedSize(updateValue.pts);
+        size += serializedSize(updateValue.ptsCount);
+        break;
+    case TLValue::UpdateReadHistoryOutbox:
+        size += serializedSize(updateValue.peer);
+        size += serializedSize(updateValue.maxId);
+        size += serializedSize(updateValue.pts);
+        size += serializedSize(updateValue.ptsCount);
+        break;
+    case TLValue::UpdateWebPage:
+        size += serializedSize(updateValue.webpage);
+        break;
+    case TLValue::UpdateReadMessagesContents:
+        size += serializedSize(updateValue.messages);
+        size += serializedSize(updateValue.pts);
+        size += serializedSize(updateValue.ptsCount);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLUpdates &updatesValue)
+{
+    int size = serializedSize(updatesValue.tlType);
+
+    switch (updatesValue.tlType) {
+    case TLValue::UpdatesTooLong:
+        break;
+    case TLValue::UpdateShortMessage:
+        size += serializedSize(updatesValue.flags);
+        size += serializedSize(updatesValue.id);
+        size += serializedSize(updatesValue.userId);
+        size += serializedSize(updatesValue.message);
+        size += serializedSize(updatesValue.pts);
+        size += serializedSize(updatesValue.ptsCount);
+        size += serializedSize(updatesValue.date);
+        if (updatesValue.flags & 1 << 2) {
+            size += serializedSize(updatesValue.fwdFromId);
+        }
+        if (updatesValue.flags & 1 << 2) {
+            size += serializedSize(updatesValue.fwdDate);
+        }
+        if (updatesValue.flags & 1 << 3) {
+            size += serializedSize(updatesValue.replyToMsgId);
+        }
+        break;
+    case TLValue::UpdateShortChatMessage:
+        size += serializedSize(updatesValue.flags);
+        size += serializedSize(updatesValue.id);
+        size += serializedSize(updatesValue.fromId);
+        size += serializedSize(updatesValue.chatId);
+        size += serializedSize(updatesValue.message);
+        size += serializedSize(updatesValue.pts);
+        size += serializedSize(updatesValue.ptsCount);
+        size += serializedSize(updatesValue.date);
+        if (updatesValue.flags & 1 << 2) {
+            size += serializedSize(updatesValue.fwdFromId);
+        }
+        if (updatesValue.flags & 1 << 2) {
+            size += serializedSize(updatesValue.fwdDate);
+        }
+        if (updatesValue.flags & 1 << 3) {
+            size += serializedSize(updatesValue.replyToMsgId);
+        }
+        break;
+    case TLValue::UpdateShort:
+        size += serializedSize(updatesValue.update);
+        size += serializedSize(updatesValue.date);
+        break;
+    case TLValue::UpdatesCombined:
+        size += serializedSize(updatesValue.updates);
+        size += serializedSize(updatesValue.users);
+        size += serializedSize(updatesValue.chats);
+        size += serializedSize(updatesValue.date);
+        size += serializedSize(updatesValue.seqStart);
+        size += serializedSize(updatesValue.seq);
+        break;
+    case TLValue::Updates:
+        size += serializedSize(updatesValue.updates);
+        size += serializedSize(updatesValue.users);
+        size += serializedSize(updatesValue.chats);
+        size += serializedSize(updatesValue.date);
+        size += serializedSize(updatesValue.seq);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+int CTelegramStream::serializedSize(const TLUpdatesDifference &updatesDifferenceValue)
+{
+    int size = serializedSize(updatesDifferenceValue.tlType);
+
+    switch (updatesDifferenceValue.tlType) {
+    case TLValue::UpdatesDifferenceEmpty:
+        size += serializedSize(updatesDifferenceValue.date);
+        size += serializedSize(updatesDifferenceValue.seq);
+        break;
+    case TLValue::UpdatesDifference:
+        size += serializedSize(updatesDifferenceValue.newMessages);
+        size += serializedSize(updatesDifferenceValue.newEncryptedMessages);
+        size += serializedSize(updatesDifferenceValue.otherUpdates);
+        size += serializedSize(updatesDifferenceValue.chats);
+        size += serializedSize(updatesDifferenceValue.users);
+        size += serializedSize(updatesDifferenceValue.state);
+        break;
+    case TLValue::UpdatesDifferenceSlice:
+        size += serializedSize(updatesDifferenceValue.newMessages);
+        size += serializedSize(updatesDifferenceValue.newEncryptedMessages);
+        size += serializedSize(updatesDifferenceValue.otherUpdates);
+        size += serializedSize(updatesDifferenceValue.chats);
+        size += serializedSize(updatesDifferenceValue.users);
+        size += serializedSize(updatesDifferenceValue.intermediateState);
+        break;
+    default:
+        break;
+    }
+
+    return size;
+}
+
+// End of generated serialized size implementation
@@ -22,8 +22,76 @@
 #include <QString>
 
 #include "CRawStream.hpp"
+#include "CTelegramStringPool.hpp"
 #include "TLTypes.hpp"
 
+/* Receives items of the decoded vectors (see CTelegramStream::setVisitor()).
+ * A callback returns true if it consumed the item; such item is not added to the vector,
+ * so big responses can be processed item by item without the whole tree in memory. */
+class CTelegramStreamVisitor
+{
+public:
+    virtual ~CTelegramStreamVisitor() { }
+
+    template <typename T>
+    bool visit(const T &) { return false; }
+
+    // Generated visitor callbacks
+    bool visit(const TLChatParticipant &chatParticipant) { return onChatParticipant(chatParticipant); }
+    virtual bool onChatParticipant(const TLChatParticipant &chatParticipant) { Q_UNUSED(chatParticipant); return false; }
+    bool visit(const TLPhotoSize &photoSize) { return onPhotoSize(photoSize); }
+    virtual bool onPhotoSize(const TLPhotoSize &photoSize) { Q_UNUSED(photoSize); return false; }
+    bool visit(const TLAuthorization &authorization) { return onAuthorization(authorization); }
+    virtual bool onAuthorization(const TLAuthorization &authorization) { Q_UNUSED(authorization); return false; }
+    bool visit(const TLDcOption &dcOption) { return onDcOption(dcOption); }
+    virtual bool onDcOption(const TLDcOption &dcOption) { Q_UNUSED(dcOption); return false; }
+    bool visit(const TLDisabledFeature &disabledFeature) { return onDisabledFeature(disabledFeature); }
+    virtual bool onDisabledFeature(const TLDisabledFeature &disabledFeature) { Q_UNUSED(disabledFeature); return false; }
+    bool visit(const TLDocumentAttribute &documentAttribute) { return onDocumentAttribute(documentAttribute); }
+    virtual bool onDocumentAttribute(const TLDocumentAttribute &documentAttribute) { Q_UNUSED(documentAttribute); return false; }
+    bool visit(const TLInputUser &inputUser) { return onInputUser(inputUser); }
+    virtual bool onInputUser(const TLInputUser &inputUser) { Q_UNUSED(inputUser); return false; }
+    bool visit(const TLPrivacyRule &privacyRule) { return onPrivacyRule(privacyRule); }
+    virtual bool onPrivacyRule(const TLPrivacyRule &privacyRule) { Q_UNUSED(privacyRule); return false; }
+    bool visit(const TLUser &user) { return onUser(user); }
+    virtual bool onUser(const TLUser &user) { Q_UNUSED(user); return false; }
+    bool visit(const TLContactBlocked &contactBlocked) { return onContactBlocked(contactBlocked); }
+    virtual bool onContactBlocked(const TLContactBlocked &contactBlocked) { Q_UNUSED(contactBlocked); return false; }
+    bool visit(const TLContact &contact) { return onContact(contact); }
+    virtual bool onContact(const TLContact &contact) { Q_UNUSED(contact); return false; }
+    bool visit(const TLContactFound &contactFound) { return onContactFound(contactFound); }
+    virtual bool onContactFound(const TLContactFound &contactFound) { Q_UNUSED(contactFound); return false; }
+    bool visit(const TLImportedContact &importedContact) { return onImportedContact(importedContact); }
+    virtual bool onImportedContact(const TLImportedContact &importedContact) { Q_UNUSED(importedContact); return false; }
+    bool visit(const TLContactSuggested &contactSuggested) { return onContactSuggested(contactSuggested); }
+    virtual bool onContactSuggested(const TLContactSuggested &contactSuggested) { Q_UNUSED(contactSuggested); return false; }
+    bool visit(const TLStickerPack &stickerPack) { return onStickerPack(stickerPack); }
+    virtual bool onStickerPack(const TLStickerPack &stickerPack) { Q_UNUSED(stickerPack); return false; }
+    bool visit(const TLStickerSet &stickerSet) { return onStickerSet(stickerSet); }
+    virtual bool onStickerSet(const TLStickerSet &stickerSet) { Q_UNUSED(stickerSet); return false; }
+    bool visit(const TLDocument &document) { return onDocument(document); }
+    virtual bool onDocument(const TLDocument &document) { Q_UNUSED(document); return false; }
+    bool visit(const TLChat &chat) { return onChat(chat); }
+    virtual bool onChat(const TLChat &chat) { Q_UNUSED(chat); return false; }
+    bool visit(const TLContactsLink &contactsLink) { return onContactsLink(contactsLink); }
+    virtual bool onContactsLink(const TLContactsLink &contactsLink) { Q_UNUSED(contactsLink); return false; }
+    bool visit(const TLPhoto &photo) { return onPhoto(photo); }
+    virtual bool onPhoto(const TLPhoto &photo) { Q_UNUSED(photo); return false; }
+    bool visit(const TLChatLocated &chatLocated) { return onChatLocated(chatLocated); }
+    virtual bool onChatLocated(const TLChatLocated &chatLocated) { Q_UNUSED(chatLocated); return false; }
+    bool visit(const TLGeoChatMessage &geoChatMessage) { return onGeoChatMessage(geoChatMessage); }
+    virtual bool onGeoChatMessage(const TLGeoChatMessage &geoChatMessage) { Q_UNUSED(geoChatMessage); return false; }
+    bool visit(const TLDialog &dialog) { return onDialog(dialog); }
+    virtual bool onDialog(const TLDialog &dialog) { Q_UNUSED(dialog); return false; }
+    bool visit(const TLMessage &message) { return onMessage(message); }
+    virtual bool onMessage(const TLMessage &message) { Q_UNUSED(message); return false; }
+    bool visit(const TLUpdate &update) { return onUpdate(update); }
+    virtual bool onUpdate(const TLUpdate &update) { Q_UNUSED(update); return false; }
+    bool visit(const TLEncryptedMessage &encryptedMessage) { return onEncryptedMessage(encryptedMessage); }
+    virtual bool onEncryptedMessage(const TLEncryptedMessage &encryptedMessage) { Q_UNUSED(encryptedMessage); return false; }
+    // End of generated visitor callbacks
+};
+
 class CTelegramStream : public CRawStream
 {
 public:
@@ -32,17 +100,179 @@ public:
 
     explicit CTelegramStream(QIODevice *d = 0);
 
+    bool isSharedBytesEnabled() const { return m_sharedBytesEnabled; }
+    void setSharedBytesEnabled(bool enabled);
+
+    CTelegramStreamVisitor *visitor() const { return m_visitor; }
+    void setVisitor(CTelegramStreamVisitor *visitor) { m_visitor = visitor; }
+
+    // The pool for the low-cardinality string members (such as mimeType), which are read with readInterned().
+    CTelegramStringPool *stringPool() const { return m_stringPool; }
+    void setStringPool(CTelegramStringPool *pool) { m_stringPool = pool; }
+
     using CRawStream::operator <<;
     using CRawStream::operator >>;
 
     CTelegramStream &operator>>(QByteArray &data);
     CTelegramStream &operator>>(QString &str);
+    CTelegramStream &readInterned(QString &str);
 
     CTelegramStream &operator>>(bool &data);
 
     template <typename T>
     CTelegramStream &operator>>(TLVector<T> &v);
 
+    template <typename T>
+    CTelegramStream &operator>>(TLBox<T> &box);
+
+    CTelegramStream &operator>>(TLLazyString &str);
+
+    // Step over a value of type T without its construction
+    template <typename T>
+    CTelegramStream &skip() { return skipValue(static_cast<const T *>(0)); }
+
+    CTelegramStream &skipValue(const quint32 *) { skipBytes(4); return *this; }
+    CTelegramStream &skipValue(const quint64 *) { skipBytes(8); return *this; }
+    CTelegramStream &skipValue(const double *) { skipBytes(8); return *this; }
+    CTelegramStream &skipValue(const bool *) { skipBytes(4); return *this; }
+    CTelegramStream &skipValue(const TLValue *) { skipBytes(4); return *this; }
+    CTelegramStream &skipValue(const QByteArray *);
+    CTelegramStream &skipValue(const QString *) { return skipValue(static_cast<const QByteArray *>(0)); }
+
+    template <int Size>
+    CTelegramStream &skipValue(const TLNumbers<Size> *) { skipBytes(Size / 8); return *this; }
+
+    template <typename T>
+    CTelegramStream &skipValue(const TLVector<T> *);
+
+    // Read the serialized form of a value of type T as is (e.g. for a TLView)
+    template <typename T>
+    QByteArray readRawValue();
+
+    // Generated skip functions
+    CTelegramStream &skipValue(const TLAccountDaysTTL *);
+    CTelegramStream &skipValue(const TLAccountPassword *);
+    CTelegramStream &skipValue(const TLAccountPasswordInputSettings *);
+    CTelegramStream &skipValue(const TLAccountPasswordSettings *);
+    CTelegramStream &skipValue(const TLAccountSentChangePhoneCode *);
+    CTelegramStream &skipValue(const TLAudio *);
+    CTelegramStream &skipValue(const TLAuthCheckedPhone *);
+    CTelegramStream &skipValue(const TLAuthExportedAuthorization *);
+    CTelegramStream &skipValue(const TLAuthPasswordRecovery *);
+    CTelegramStream &skipValue(const TLAuthSentCode *);
+    CTelegramStream &skipValue(const TLAuthorization *);
+    CTelegramStream &skipValue(const TLChatLocated *);
+    CTelegramStream &skipValue(const TLChatParticipant *);
+    CTelegramStream &skipValue(const TLChatParticipants *);
+    CTelegramStream &skipValue(const TLContact *);
+    CTelegramStream &skipValue(const TLContactBlocked *);
+    CTelegramStream &skipValue(const TLContactFound *);
+    CTelegramStream &skipValue(const TLContactLink *);
+    CTelegramStream &skipValue(const TLContactSuggested *);
+    CTelegramStream &skipValue(const TLDcOption *);
+    CTelegramStream &skipValue(const TLDisabledFeature *);
+    CTelegramStream &skipValue(const TLEncryptedChat *);
+    CTelegramStream &skipValue(const TLEncryptedFile *);
+    CTelegramStream &skipValue(const TLEncryptedMessage *);
+    CTelegramStream &skipValue(const TLError *);
+    CTelegramStream &skipValue(const TLExportedChatInvite *);
+    CTelegramStream &skipValue(const TLFileLocation *);
+    CTelegramStream &skipValue(const TLGeoPoint *);
+    CTelegramStream &skipValue(const TLHelpAppUpdate *);
+    CTelegramStream &skipValue(const TLHelpInviteText *);
+    CTelegramStream &skipValue(const TLImportedContact *);
+    CTelegramStream &skipValue(const TLInputAppEvent *);
+    CTelegramStream &skipValue(const TLInputAudio *);
+    CTelegramStream &skipValue(const TLInputContact *);
+    CTelegramStream &skipValue(const TLInputDocument *);
+    CTelegramStream &skipValue(const TLInputEncryptedChat *);
+    CTelegramStream &skipValue(const TLInputEncryptedFile *);
+    CTelegramStream &skipValue(const TLInputFile *);
+    CTelegramStream &skipValue(const TLInputFileLocation *);
+    CTelegramStream &skipValue(const TLInputGeoChat *);
+    CTelegramStream &skipValue(const TLInputGeoPoint *);
+    CTelegramStream &skipValue(const TLInputPeer *);
+    CTelegramStream &skipValue(const TLInputPeerNotifyEvents *);
+    CTelegramStream &skipValue(const TLInputPeerNotifySettings *);
+    CTelegramStream &skipValue(const TLInputPhoto *);
+    CTelegramStream &skipValue(const TLInputPhotoCrop *);
+    CTelegramStream &skipValue(const TLInputPrivacyKey *);
+    CTelegramStream &skipValue(const TLInputStickerSet *);
+    CTelegramStream &skipValue(const TLInputUser *);
+    CTelegramStream &skipValue(const TLInputVideo *);
+    CTelegramStream &skipValue(const TLMessagesAffectedHistory *);
+    CTelegramStream &skipValue(const TLMessagesAffectedMessages *);
+    CTelegramStream &skipValue(const TLMessagesDhConfig *);
+    CTelegramStream &skipValue(const TLMessagesFilter *);
+    CTelegramStream &skipValue(const TLMessagesSentEncryptedMessage *);
+    CTelegramStream &skipValue(const TLNearestDc *);
+    CTelegramStream &skipValue(const TLPeer *);
+    CTelegramStream &skipValue(const TLPeerNotifyEvents *);
+    CTelegramStream &skipValue(const TLPeerNotifySettings *);
+    CTelegramStream &skipValue(const TLPhotoSize *);
+    CTelegramStream &skipValue(const TLPrivacyKey *);
+    CTelegramStream &skipValue(const TLPrivacyRule *);
+    CTelegramStream &skipValue(const TLReceivedNotifyMessage *);
+    CTelegramStream &skipValue(const TLSendMessageAction *);
+    CTelegramStream &skipValue(const TLStickerPack *);
+    CTelegramStream &skipValue(const TLStickerSet *);
+    CTelegramStream &skipValue(const TLStorageFileType *);
+    CTelegramStream &skipValue(const TLUpdatesState *);
+    CTelegramStream &skipValue(const TLUploadFile *);
+    CTelegramStream &skipValue(const TLUserProfilePhoto *);
+    CTelegramStream &skipValue(const TLUserStatus *);
+    CTelegramStream &skipValue(const TLVideo *);
+    CTelegramStream &skipValue(const TLWallPaper *);
+    CTelegramStream &skipValue(const TLAccountAuthorizations *);
+    CTelegramStream &skipValue(const TLChatPhoto *);
+    CTelegramStream &skipValue(const TLConfig *);
+    CTelegramStream &skipValue(const TLContactStatus *);
+    CTelegramStream &skipValue(const TLDialog *);
+    CTelegramStream &skipValue(const TLDocumentAttribute *);
+    CTelegramStream &skipValue(const TLInputChatPhoto *);
+    CTelegramStream &skipValue(const TLInputMedia *);
+    CTelegramStream &skipValue(const TLInputNotifyPeer *);
+    CTelegramStream &skipValue(const TLInputPrivacyRule *);
+    CTelegramStream &skipValue(const TLNotifyPeer *);
+    CTelegramStream &skipValue(const TLPhoto *);
+    CTelegramStream &skipValue(const TLUser *);
+    CTelegramStream &skipValue(const TLWebPage *);
+    CTelegramStream &skipValue(const TLAccountPrivacyRules *);
+    CTelegramStream &skipValue(const TLAuthAuthorization *);
+    CTelegramStream &skipValue(const TLChat *);
+    CTelegramStream &skipValue(const TLChatFull *);
+    CTelegramStream &skipValue(const TLChatInvite *);
+    CTelegramStream &skipValue(const TLContactsBlocked *);
+    CTelegramStream &skipValue(const TLContactsContacts *);
+    CTelegramStream &skipValue(const TLContactsFound *);
+    CTelegramStream &skipValue(const TLContactsImportedContacts *);
+    CTelegramStream &skipValue(const TLContactsLink *);
+    CTelegramStream &skipValue(const TLContactsSuggested *);
+    CTelegramStream &skipValue(const TLDocument *);
+    CTelegramStream &skipValue(const TLHelpSupport *);
+    CTelegramStream &skipValue(const TLMessageAction *);
+    CTelegramStream &skipValue(const TLMessageMedia *);
+    CTelegramStream &skipValue(const TLMessagesAllStickers *);
+    CTelegramStream &skipValue(const TLMessagesChatFull *);
+    CTelegramStream &skipValue(const TLMessagesChats *);
+    CTelegramStream &skipValue(const TLMessagesSentMessage *);
+    CTelegramStream &skipValue(const TLMessagesStickerSet *);
+    CTelegramStream &skipValue(const TLMessagesStickers *);
+    CTelegramStream &skipValue(const TLPhotosPhoto *);
+    CTelegramStream &skipValue(const TLPhotosPhotos *);
+    CTelegramStream &skipValue(const TLUserFull *);
+    CTelegramStream &skipValue(const TLGeoChatMessage *);
+    CTelegramStream &skipValue(const TLGeochatsLocated *);
+    CTelegramStream &skipValue(const TLGeochatsMessages *);
+    CTelegramStream &skipValue(const TLGeochatsStatedMessage *);
+    CTelegramStream &skipValue(const TLMessage *);
+    CTelegramStream &skipValue(const TLMessagesDialogs *);
+    CTelegramStream &skipValue(const TLMessagesMessages *);
+    CTelegramStream &skipValue(const TLUpdate *);
+    CTelegramStream &skipValue(const TLUpdates *);
+    CTelegramStream &skipValue(const TLUpdatesDifference *);
+    // End of generated skip functions
+
     // Generated read operators
     CTelegramStream &operator>>(TLAccountDaysTTL &accountDaysTTLValue);
     CTelegramStream &operator>>(TLAccountPassword &accountPasswordValue);
@@ -172,11 +402,38 @@ public:
 
     CTelegramStream &operator<<(const bool &data);
 
-    CTelegramStream &operator<<(const TLDcOption &dcOption);
-
     // Generated write operators
     CTelegramStream &operator<<(const TLAccountDaysTTL &accountDaysTTLValue);
+    CTelegramStream &operator<<(const TLAccountPassword &accountPasswordValue);
     CTelegramStream &operator<<(const TLAccountPasswordInputSettings &accountPasswordInputSettingsValue);
+    CTelegramStream &operator<<(const TLAccountPasswordSettings &accountPasswordSettingsValue);
+    CTelegramStream &operator<<(const TLAccountSentChangePhoneCode &accountSentChangePhoneCodeValue);
+    CTelegramStream &operator<<(const TLAudio &audioValue);
+    CTelegramStream &operator<<(const TLAuthCheckedPhone &authCheckedPhoneValue);
+    CTelegramStream &operator<<(const TLAuthExportedAuthorization &authExportedAuthorizationValue);
+    CTelegramStream &operator<<(const TLAuthPasswordRecovery &authPasswordRecoveryValue);
+    CTelegramStream &operator<<(const TLAuthSentCode &authSentCodeValue);
+    CTelegramStream &operator<<(const TLAuthorization &authorizationValue);
+    CTelegramStream &operator<<(const TLChatLocated &chatLocatedValue);
+    CTelegramStream &operator<<(const TLChatParticipant &chatParticipantValue);
+    CTelegramStream &operator<<(const TLChatParticipants &chatParticipantsValue);
+    CTelegramStream &operator<<(const TLContact &contactValue);
+    CTelegramStream &operator<<(const TLContactBlocked &contactBlockedValue);
+    CTelegramStream &operator<<(const TLContactFound &contactFoundValue);
+    CTelegramStream &operator<<(const TLContactLink &contactLinkValue);
+    CTelegramStream &operator<<(const TLContactSuggested &contactSuggestedValue);
+    CTelegramStream &operator<<(const TLDcOption &dcOptionValue);
+    CTelegramStream &operator<<(const TLDisabledFeature &disabledFeatureValue);
+    CTelegramStream &operator<<(const TLEncryptedChat &encryptedChatValue);
+    CTelegramStream &operator<<(const TLEncryptedFile &encryptedFileValue);
+    CTelegramStream &operator<<(const TLEncryptedMessage &encryptedMessageValue);
+    CTelegramStream &operator<<(const TLError &errorValue);
+    CTelegramStream &operator<<(const TLExportedChatInvite &exportedChatInviteValue);
+    CTelegramStream &operator<<(const TLFileLocation &fileLocationValue);
+    CTelegramStream &operator<<(const TLGeoPoint &geoPointValue);
+    CTelegramStream &operator<<(const TLHelpAppUpdate &helpAppUpdateValue);
+    CTelegramStream &operator<<(const TLHelpInviteText &helpInviteTextValue);
+    CTelegramStream &operator<<(const TLImportedContact &importedContactValue);
     CTelegramStream &operator<<(const TLInputAppEvent &inputAppEventValue);
     CTelegramStream &operator<<(const TLInputAudio &inputAudioValue);
     CTelegramStream &operator<<(const TLInputContact &inputContactValue);
@@ -188,6 +445,7 @@ public:
     CTelegramStream &operator<<(const TLInputGeoChat &inputGeoChatValue);
     CTelegramStream &operator<<(const TLInputGeoPoint &inputGeoPointValue);
     CTelegramStream &operator<<(const TLInputPeer &inputPeerValue);
+    CTelegramStream &operator<<(const TLInputPeerNotifyEvents &inputPeerNotifyEventsValue);
     CTelegramStream &operator<<(const TLInputPeerNotifySettings &inputPeerNotifySettingsValue);
     CTelegramStream &operator<<(const TLInputPhoto &inputPhotoValue);
     CTelegramStream &operator<<(const TLInputPhotoCrop &inputPhotoCropValue);
@@ -195,28 +453,360 @@ public:
     CTelegramStream &operator<<(const TLInputStickerSet &inputStickerSetValue);
     CTelegramStream &operator<<(const TLInputUser &inputUserValue);
     CTelegramStream &operator<<(const TLInputVideo &inputVideoValue);
+    CTelegramStream &operator<<(const TLMessagesAffectedHistory &messagesAffectedHistoryValue);
+    CTelegramStream &operator<<(const TLMessagesAffectedMessages &messagesAffectedMessagesValue);
+    CTelegramStream &operator<<(const TLMessagesDhConfig &messagesDhConfigValue);
     CTelegramStream &operator<<(const TLMessagesFilter &messagesFilterValue);
+    CTelegramStream &operator<<(const TLMessagesSentEncryptedMessage &messagesSentEncryptedMessageValue);
+    CTelegramStream &operator<<(const TLNearestDc &nearestDcValue);
+    CTelegramStream &operator<<(const TLPeer &peerValue);
+    CTelegramStream &operator<<(const TLPeerNotifyEvents &peerNotifyEventsValue);
+    CTelegramStream &operator<<(const TLPeerNotifySettings &peerNotifySettingsValue);
+    CTelegramStream &operator<<(const TLPhotoSize &photoSizeValue);
+    CTelegramStream &operator<<(const TLPrivacyKey &privacyKeyValue);
+    CTelegramStream &operator<<(const TLPrivacyRule &privacyRuleValue);
+    CTelegramStream &operator<<(const TLReceivedNotifyMessage &receivedNotifyMessageValue);
     CTelegramStream &operator<<(const TLSendMessageAction &sendMessageActionValue);
+    CTelegramStream &operator<<(const TLStickerPack &stickerPackValue);
+    CTelegramStream &operator<<(const TLStickerSet &stickerSetValue);
+    CTelegramStream &operator<<(const TLStorageFileType &storageFileTypeValue);
+    CTelegramStream &operator<<(const TLUpdatesState &updatesStateValue);
+    CTelegramStream &operator<<(const TLUploadFile &uploadFileValue);
+    CTelegramStream &operator<<(const TLUserProfilePhoto &userProfilePhotoValue);
+    CTelegramStream &operator<<(const TLUserStatus &userStatusValue);
+    CTelegramStream &operator<<(const TLVideo &videoValue);
+    CTelegramStream &operator<<(const TLWallPaper &wallPaperValue);
+    CTelegramStream &operator<<(const TLAccountAuthorizations &accountAuthorizationsValue);
+    CTelegramStream &operator<<(const TLChatPhoto &chatPhotoValue);
+    CTelegramStream &operator<<(const TLConfig &configValue);
+    CTelegramStream &operator<<(const TLContactStatus &contactStatusValue);
+    CTelegramStream &operator<<(const TLDialog &dialogValue);
     CTelegramStream &operator<<(const TLDocumentAttribute &documentAttributeValue);
     CTelegramStream &operator<<(const TLInputChatPhoto &inputChatPhotoValue);
     CTelegramStream &operator<<(const TLInputMedia &inputMediaValue);
     CTelegramStream &operator<<(const TLInputNotifyPeer &inputNotifyPeerValue);
     CTelegramStream &operator<<(const TLInputPrivacyRule &inputPrivacyRuleValue);
+    CTelegramStream &operator<<(const TLNotifyPeer &notifyPeerValue);
+    CTelegramStream &operator<<(const TLPhoto &photoValue);
+    CTelegramStream &operator<<(const TLUser &userValue);
+    CTelegramStream &operator<<(const TLWebPage &webPageValue);
+    CTelegramStream &operator<<(const TLAccountPrivacyRules &accountPrivacyRulesValue);
+    CTelegramStream &operator<<(const TLAuthAuthorization &authAuthorizationValue);
+    CTelegramStream &operator<<(const TLChat &chatValue);
+    CTelegramStream &operator<<(const TLChatFull &chatFullValue);
+    CTelegramStream &operator<<(const TLChatInvite &chatInviteValue);
+    CTelegramStream &operator<<(const TLContactsBlocked &contactsBlockedValue);
+    CTelegramStream &operator<<(const TLContactsContacts &contactsContactsValue);
+    CTelegramStream &operator<<(const TLContactsFound &contactsFoundValue);
+    CTelegramStream &operator<<(const TLContactsImportedContacts &contactsImportedContactsValue);
+    CTelegramStream &operator<<(const TLContactsLink &contactsLinkValue);
+    CTelegramStream &operator<<(const TLContactsSuggested &contactsSuggestedValue);
+    CTelegramStream &operator<<(const TLDocument &documentValue);
+    CTelegramStream &operator<<(const TLHelpSupport &helpSupportValue);
+    CTelegramStream &operator<<(const TLMessageAction &messageActionValue);
+    CTelegramStream &operator<<(const TLMessageMedia &messageMediaValue);
+    CTelegramStream &operator<<(const TLMessagesAllStickers &messagesAllStickersValue);
+    CTelegramStream &operator<<(const TLMessagesChatFull &messagesChatFullValue);
+    CTelegramStream &operator<<(const TLMessagesChats &messagesChatsValue);
+    CTelegramStream &operator<<(const TLMessagesSentMessage &messagesSentMessageValue);
+    CTelegramStream &operator<<(const TLMessagesStickerSet &messagesStickerSetValue);
+    CTelegramStream &operator<<(const TLMessagesStickers &messagesStickersValue);
+    CTelegramStream &operator<<(const TLPhotosPhoto &photosPhotoValue);
+    CTelegramStream &operator<<(const TLPhotosPhotos &photosPhotosValue);
+    CTelegramStream &operator<<(const TLUserFull &userFullValue);
+    CTelegramStream &operator<<(const TLGeoChatMessage &geoChatMessageValue);
+    CTelegramStream &operator<<(const TLGeochatsLocated &geochatsLocatedValue);
+    CTelegramStream &operator<<(const TLGeochatsMessages &geochatsMessagesValue);
+    CTelegramStream &operator<<(const TLGeochatsStatedMessage &geochatsStatedMessageValue);
+    CTelegramStream &operator<<(const TLMessage &messageValue);
+    CTelegramStream &operator<<(const TLMessagesDialogs &messagesDialogsValue);
+    CTelegramStream &operator<<(const TLMessagesMessages &messagesMessagesValue);
+    CTelegramStream &operator<<(const TLUpdate &updateValue);
+    CTelegramStream &operator<<(const TLUpdates &updatesValue);
+    CTelegramStream &operator<<(const TLUpdatesDifference &updatesDifferenceValue);
     // End of generated write operators
 
     template <typename T>
     CTelegramStream &operator<<(const TLVector<T> &v);
 
+    template <typename T>
+    CTelegramStream &operator<<(const TLBox<T> &box);
+
+    CTelegramStream &operator<<(const TLLazyString &str);
+
+    // Size of the value serialized by the write operator
+    static Q_DECL_CONSTEXPR int serializedSize(qint32) { return 4; }
+    static Q_DECL_CONSTEXPR int serializedSize(quint32) { return 4; }
+    static Q_DECL_CONSTEXPR int serializedSize(qint64) { return 8; }
+    static Q_DECL_CONSTEXPR int serializedSize(quint64) { return 8; }
+    static Q_DECL_CONSTEXPR int serializedSize(double) { return 8; }
+    static Q_DECL_CONSTEXPR int serializedSize(bool) { return 4; }
+    static Q_DECL_CONSTEXPR int serializedSize(const TLValue &) { return 4; }
+
+    template <int Size>
+    static Q_DECL_CONSTEXPR int serializedSize(const TLNumbers<Size> &) { return Size / 8; }
+
+    static int serializedSize(const QByteArray &data);
+    static int serializedSize(const QString &str);
+
+    // Generated serialized size declarations
+    static Q_DECL_CONSTEXPR int serializedSize(const TLAccountDaysTTL &) { return 8; }
+    static int serializedSize(const TLAccountPassword &accountPasswordValue);
+    static int serializedSize(const TLAccountPasswordInputSettings &accountPasswordInputSettingsValue);
+    static int serializedSize(const TLAccountPasswordSettings &accountPasswordSettingsValue);
+    static int serializedSize(const TLAccountSentChangePhoneCode &accountSentChangePhoneCodeValue);
+    static int serializedSize(const TLAudio &audioValue);
+    static Q_DECL_CONSTEXPR int serializedSize(const TLAuthCheckedPhone &) { return 8; }
+    static int serializedSize(const TLAuthExportedAuthorization &authExportedAuthorizationValue);
+    static int serializedSize(const TLAuthPasswordRecovery &authPasswordRecoveryValue);
+    static int serializedSize(const TLAuthSentCode &authSentCodeValue);
+    static int serializedSize(const TLAuthorization &authorizationValue);
+    static Q_DECL_CONSTEXPR int serializedSize(const TLChatLocated &) { return 12; }
+    static Q_DECL_CONSTEXPR int serializedSize(const TLChatParticipant &) { return 16; }
+    static int serializedSize(const TLChatParticipants &chatParticipantsValue);
+    static Q_DECL_CONSTEXPR int serializedSize(const TLContact &) { return 12; }
+    static Q_DECL_CONSTEXPR int serializedSize(const TLContactBlocked &) { return 12; }
+    static Q_DECL_CONSTEXPR int serializedSize(const TLContactFound &) { return 8; }
+    static Q_DECL_CONSTEXPR int serializedSize(const TLContactLink &) { return 4; }
+    static Q_DECL_CONSTEXPR int serializedSize(const TLContactSuggested &) { return 12; }
+    static int serializedSize(const TLDcOption &dcOptionValue);
+    static int serializedSize(const TLDisabledFeature &disabledFeatureValue);
+    static int serializedSize(const TLEncryptedChat &encryptedChatValue);
+    static int serializedSize(const TLEncryptedFile &encryptedFileValue);
+    static int serializedSize(const TLEncryptedMessage &encryptedMessageValue);
+    static int serializedSize(const TLError &errorValue);
+    static int serializedSize(const TLExportedChatInvite &exportedChatInviteValue);
+    static int serializedSize(const TLFileLocation &fileLocationValue);
+    static int serializedSize(const TLGeoPoint &geoPointValue);
+    static int serializedSize(const TLHelpAppUpdate &helpAppUpdateValue);
+    static int serializedSize(const TLHelpInviteText &helpInviteTextValue);
+    static Q_DECL_CONSTEXPR int serializedSize(const TLImportedContact &) { return 16; }
+    static int serializedSize(const TLInputAppEvent &inputAppEventValue);
+    static int serializedSize(const TLInputAudio &inputAudioValue);
+    static int serializedSize(const TLInputContact &inputContactValue);
+    static int serializedSize(const TLInputDocument &inputDocumentValue);
+    static Q_DECL_CONSTEXPR int serializedSize(const TLInputEncryptedChat &) { return 16; }
+    static int serializedSize(const TLInputEncryptedFile &inputEncryptedFileValue);
+    static int serializedSize(const TLInputFile &inputFileValue);
+    static int serializedSize(const TLInputFileLocation &inputFileLocationValue);
+    static Q_DECL_CONSTEXPR int serializedSize(const TLInputGeoChat &) { return 16; }
+    static int serializedSize(const TLInputGeoPoint &inputGeoPointValue);
+    static int serializedSize(const TLInputPeer &inputPeerValue);
+    static Q_DECL_CONSTEXPR int serializedSize(const TLInputPeerNotifyEvents &) { return 4; }
+    static int serializedSize(const TLInputPeerNotifySettings &inputPeerNotifySettingsValue);
+    static int serializedSize(const TLInputPhoto &inputPhotoValue);
+    static int serializedSize(const TLInputPhotoCrop &inputPhotoCropValue);
+    static Q_DECL_CONSTEXPR int serializedSize(const TLInputPrivacyKey &) { return 4; }
+    static int serializedSize(const TLInputStickerSet &inputStickerSetValue);
+    static int serializedSize(const TLInputUser &inputUserValue);
+    static int serializedSize(const TLInputVideo &inputVideoValue);
+    static Q_DECL_CONSTEXPR int serializedSize(const TLMessagesAffectedHistory &) { return 16; }
+    static Q_DECL_CONSTEXPR int serializedSize(const TLMessagesAffectedMessages &) { return 12; }
+    static int serializedSize(const TLMessagesDhConfig &messagesDhConfigValue);
+    static Q_DECL_CONSTEXPR int serializedSize(const TLMessagesFilter &) { return 4; }
+    static int serializedSize(const TLMessagesSentEncryptedMessage &messagesSentEncryptedMessageValue);
+    static int serializedSize(const TLNearestDc &nearestDcValue);
+    static Q_DECL_CONSTEXPR int serializedSize(const TLPeer &) { return 8; }
+    static Q_DECL_CONSTEXPR int serializedSize(const TLPeerNotifyEvents &) { return 4; }
+    static int serializedSize(const TLPeerNotifySettings &peerNotifySettingsValue);
+    static int serializedSize(const TLPhotoSize &photoSizeValue);
+    static Q_DECL_CONSTEXPR int serializedSize(const TLPrivacyKey &) { return 4; }
+    static int serializedSize(const TLPrivacyRule &privacyRuleValue);
+    static Q_DECL_CONSTEXPR int serializedSize(const TLReceivedNotifyMessage &) { return 12; }
+    static int serializedSize(const TLSendMessageAction &sendMessageActionValue);
+    static int serializedSize(const TLStickerPack &stickerPackValue);
+    static int serializedSize(const TLStickerSet &stickerSetValue);
+    static Q_DECL_CONSTEXPR int serializedSize(const TLStorageFileType &) { return 4; }
+    static Q_DECL_CONSTEXPR int serializedSize(const TLUpdatesState &) { return 24; }
+    static int serializedSize(const TLUploadFile &uploadFileValue);
+    static int serializedSize(const TLUserProfilePhoto &userProfilePhotoValue);
+    static int serializedSize(const TLUserStatus &userStatusValue);
+    static int serializedSize(const TLVideo &videoValue);
+    static int serializedSize(const TLWallPaper &wallPaperValue);
+    static int serializedSize(const TLAccountAuthorizations &accountAuthorizationsValue);
+    static int serializedSize(const TLChatPhoto &chatPhotoValue);
+    static int serializedSize(const TLConfig &configValue);
+    static int serializedSize(const TLContactStatus &contactStatusValue);
+    static int serializedSize(const TLDialog &dialogValue);
+    static int serializedSize(const TLDocumentAttribute &documentAttributeValue);
+    static int serializedSize(const TLInputChatPhoto &inputChatPhotoValue);
+    static int serializedSize(const TLInputMedia &inputMediaValue);
+    static int serializedSize(const TLInputNotifyPeer &inputNotifyPeerValue);
+    static int serializedSize(const TLInputPrivacyRule &inputPrivacyRuleValue);
+    static int serializedSize(const TLNotifyPeer &notifyPeerValue);
+    static int serializedSize(const TLPhoto &photoValue);
+    static int serializedSize(const TLUser &userValue);
+    static int serializedSize(const TLWebPage &webPageValue);
+    static int serializedSize(const TLAccountPrivacyRules &accountPrivacyRulesValue);
+    static int serializedSize(const TLAuthAuthorization &authAuthorizationValue);
+    static int serializedSize(const TLChat &chatValue);
+    static int serializedSize(const TLChatFull &chatFullValue);
+    static int serializedSize(const TLChatInvite &chatInviteValue);
+    static int serializedSize(const TLContactsBlocked &contactsBlockedValue);
+    static int serializedSize(const TLContactsContacts &contactsContactsValue);
+    static int serializedSize(const TLContactsFound &contactsFoundValue);
+    static int serializedSize(const TLContactsImportedContacts &contactsImportedContactsValue);
+    static int serializedSize(const TLContactsLink &contactsLinkValue);
+    static int serializedSize(const TLContactsSuggested &contactsSuggestedValue);
+    static int serializedSize(const TLDocument &documentValue);
+    static int serializedSize(const TLHelpSupport &helpSupportValue);
+    static int serializedSize(const TLMessageAction &messageActionValue);
+    static int serializedSize(const TLMessageMedia &messageMediaValue);
+    static int serializedSize(const TLMessagesAllStickers &messagesAllStickersValue);
+    static int serializedSize(const TLMessagesChatFull &messagesChatFullValue);
+    static int serializedSize(const TLMessagesChats &messagesChatsValue);
+    static int serializedSize(const TLMessagesSentMessage &messagesSentMessageValue);
+    static int serializedSize(const TLMessagesStickerSet &messagesStickerSetValue);
+    static int serializedSize(const TLMessagesStickers &messagesStickersValue);
+    static int serializedSize(const TLPhotosPhoto &photosPhotoValue);
+    static int serializedSize(const TLPhotosPhotos &photosPhotosValue);
+    static int serializedSize(const TLUserFull &userFullValue);
+    static int serializedSize(const TLGeoChatMessage &geoChatMessageValue);
+    static int serializedSize(const TLGeochatsLocated &geochatsLocatedValue);
+    static int serializedSize(const TLGeochatsMessages &geochatsMessagesValue);
+    static int serializedSize(const TLGeochatsStatedMessage &geochatsStatedMessageValue);
+    static int serializedSize(const TLMessage &messageValue);
+    static int serializedSize(const TLMessagesDialogs &messagesDialogsValue);
+    static int serializedSize(const TLMessagesMessages &messagesMessagesValue);
+    static int serializedSize(const TLUpdate &updateValue);
+    static int serializedSize(const TLUpdates &updatesValue);
+    static int serializedSize(const TLUpdatesDifference &updatesDifferenceValue);
+    // End of generated serialized size declarations
+
+    template <typename T>
+    static int serializedSize(const TLVector<T> &v);
+
+    template <typename T>
+    static int serializedSize(const TLBox<T> &box);
+
+    static int serializedSize(const TLLazyString &str);
+
+protected:
+    void readBytesValue(QByteArray &data, bool shared);
+
+    bool m_sharedBytesEnabled;
+    CTelegramStreamVisitor *m_visitor;
+    CTelegramStringPool *m_stringPool;
+
 };
 
+inline void CTelegramStream::setSharedBytesEnabled(bool enabled)
+{
+    m_sharedBytesEnabled = enabled;
+}
+
+inline CTelegramStream &CTelegramStream::operator>>(QByteArray &data)
+{
+    readBytesValue(data, m_sharedBytesEnabled);
+    return *this;
+}
+
 inline CTelegramStream &CTelegramStream::operator>>(QString &str)
 {
     QByteArray data;
-    *this >> data;
+    // The data is converted right away, so there is no need to copy it from the stream.
+    readBytesValue(data, /* shared */ true);
     str = QString::fromUtf8(data);
     return *this;
 }
 
+inline CTelegramStream &CTelegramStream::readInterned(QString &str)
+{
+    *this >> str;
+
+    if (m_stringPool) {
+        str = m_stringPool->intern(str);
+    }
+
+    return *this;
+}
+
+template <typename T>
+CTelegramStream &CTelegramStream::skipValue(const TLVector<T> *)
+{
+    TLValue tlType;
+    *this >> tlType;
+
+    if (tlType == TLValue::Vector) {
+        quint32 length = 0;
+        *this >> length;
+
+        for (quint32 i = 0; (i < length) && !error(); ++i) {
+            skip<T>();
+        }
+    }
+
+    return *this;
+}
+
+template <typename T>
+QByteArray CTelegramStream::readRawValue()
+{
+    const int begin = position();
+    skip<T>();
+
+    if (error()) {
+        return QByteArray();
+    }
+
+    return bytesAt(begin, position() - begin);
+}
+
+template <typename T>
+inline CTelegramStream &CTelegramStream::operator>>(TLBox<T> &box)
+{
+    // Do not detach a shared value, which is going to be overwritten anyway.
+    box.reset();
+    return *this >> box.data();
+}
+
+template <typename T>
+inline CTelegramStream &CTelegramStream::operator<<(const TLBox<T> &box)
+{
+    return *this << box.value();
+}
+
+template <typename T>
+int CTelegramStream::serializedSize(const TLVector<T> &v)
+{
+    int size = serializedSize(v.tlType);
+
+    if (v.tlType == TLValue::Vector) {
+        size += serializedSize(quint32(v.count()));
+
+        for (int i = 0; i < v.count(); ++i) {
+            size += serializedSize(v.at(i));
+        }
+    }
+
+    return size;
+}
+
+template <typename T>
+inline int CTelegramStream::serializedSize(const TLBox<T> &box)
+{
+    return serializedSize(box.value());
+}
+
+inline CTelegramStream &CTelegramStream::operator>>(TLLazyString &str)
+{
+    // The text is kept as is and can outlive the stream data, so it always owns a copy (even if the bytes are shared).
+    QByteArray data;
+    readBytesValue(data, /* shared */ false);
+    str = TLLazyString::fromUtf8(data);
+    return *this;
+}
+
+inline CTelegramStream &CTelegramStream::operator<<(const TLLazyString &str)
+{
+    return *this << str.toUtf8();
+}
+
+inline int CTelegramStream::serializedSize(const TLLazyString &str)
+{
+    return str.isConverted() ? serializedSize(str.toString()) : serializedSize(str.toUtf8());
+}
+
 inline CTelegramStream &CTelegramStream::operator>>(bool &data)
 {
     TLValue val;
@@ -0,0 +1,38 @@
+/*
+   Copyright (C) 2014-2015 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#include "CTelegramStringPool.hpp"
+
+QString CTelegramStringPool::intern(const QString &str)
+{
+    if (str.isEmpty()) {
+        return QString();
+    }
+
+    QSet<QString>::const_iterator it = m_strings.constFind(str);
+
+    if (it != m_strings.constEnd()) {
+        return *it;
+    }
+
+    QString copy = str;
+    copy.detach();
+    m_strings.insert(copy);
+
+    return copy;
+}
@@ -0,0 +1,43 @@
+/*
+   Copyright (C) 2014-2015 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#ifndef CTELEGRAMSTRINGPOOL_HPP
+#define CTELEGRAMSTRINGPOOL_HPP
+
+#include <QSet>
+#include <QString>
+
+/* Keeps one shared copy of each string, so equal strings of many values share the same storage.
+ * It is intended for low-cardinality values, such as MIME types, language codes and first names. */
+class CTelegramStringPool
+{
+public:
+    // Returns the pooled string, which is equal to the given one. The pool keeps its own (detached) copy,
+    // so the given string can be a view of the stream data.
+    QString intern(const QString &str);
+
+    int count() const { return m_strings.count(); }
+    int capacity() const { return m_strings.capacity(); }
+    void clear() { m_strings.clear(); }
+
+private:
+    QSet<QString> m_strings;
+
+};
+
+#endif // CTELEGRAMSTRINGPOOL_HPP
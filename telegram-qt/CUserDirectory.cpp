@@ -0,0 +1,138 @@
+/*
+   Copyright (C) 2014-2015 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#include "CUserDirectory.hpp"
+
+static const int minimumSlotsCount = 16;
+
+void SUserRecord::setUser(const TLUser &user)
+{
+    id = user.id;
+    accessHash = user.accessHash;
+    firstName = user.firstName;
+    lastName = user.lastName;
+    username = user.username;
+    phone = user.phone;
+    status = user.status;
+    photoSmall = user.photo.photoSmall;
+    photoType = user.photo.tlType;
+    tlType = user.tlType;
+}
+
+TLUser SUserRecord::toUser() const
+{
+    TLUser user;
+    user.id = id;
+    user.accessHash = accessHash;
+    user.firstName = firstName;
+    user.lastName = lastName;
+    user.username = username;
+    user.phone = phone;
+    user.status = status;
+    user.photo.photoSmall = photoSmall;
+    user.photo.tlType = photoType;
+    user.tlType = tlType;
+    return user;
+}
+
+CUserDirectory::CUserDirectory()
+{
+}
+
+SUserRecord *CUserDirectory::insert(const TLUser &user, bool *isNew)
+{
+    int index = indexOf(user.id);
+
+    if (isNew) {
+        *isNew = index < 0;
+    }
+
+    if (index < 0) {
+        // Keep the load factor not above 1/2, so the probe sequences are short.
+        if ((m_records.count() + 1) * 2 > m_slots.count()) {
+            rehash(qMax(minimumSlotsCount, m_slots.count() * 2));
+        }
+
+        index = m_records.count();
+        m_records.append(SUserRecord());
+
+        const int mask = m_slots.count() - 1;
+        int i = slot(user.id, mask);
+        while (m_slots.at(i)) {
+            i = (i + 1) & mask;
+        }
+        m_slots[i] = index + 1;
+    }
+
+    SUserRecord *record = &m_records[index];
+    record->setUser(user);
+    return record;
+}
+
+void CUserDirectory::reserve(int count)
+{
+    m_records.reserve(count);
+
+    int slotsCount = minimumSlotsCount;
+    while (slotsCount < count * 2) {
+        slotsCount *= 2;
+    }
+
+    if (slotsCount > m_slots.count()) {
+        rehash(slotsCount);
+    }
+}
+
+void CUserDirectory::clear()
+{
+    m_records.clear();
+    m_slots.clear();
+}
+
+int CUserDirectory::indexOf(quint32 id) const
+{
+    if (m_slots.isEmpty()) {
+        return -1;
+    }
+
+    const int mask = m_slots.count() - 1;
+    const int *slotsData = m_slots.constData();
+
+    for (int i = slot(id, mask); slotsData[i]; i = (i + 1) & mask) {
+        const int index = slotsData[i] - 1;
+        if (m_records.at(index).id == id) {
+            return index;
+        }
+    }
+
+    return -1;
+}
+
+void CUserDirectory::rehash(int slotsCount)
+{
+    m_slots.fill(0, slotsCount);
+
+    const int mask = slotsCount - 1;
+    for (int index = 0; index < m_records.count(); ++index) {
+        int i = slot(m_records.at(index).id, mask);
+        while (m_slots.at(i)) {
+            i = (i + 1) & mask;
+        }
+        m_slots[i] = index + 1;
+    }
+}
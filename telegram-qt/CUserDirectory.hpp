@@ -0,0 +1,102 @@
+/*
+   Copyright (C) 2014-2015 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+
+#ifndef CUSERDIRECTORY_HPP
+#define CUSERDIRECTORY_HPP
+
+#include <QVector>
+
+#include "TLTypes.hpp"
+
+/* The part of TLUser, which is used by the dispatcher. The big photo location and the photo id are dropped. */
+struct SUserRecord {
+    SUserRecord() :
+        id(0),
+        accessHash(0),
+        photoType(TLValue::UserProfilePhotoEmpty),
+        tlType(TLValue::UserEmpty) { }
+
+    void setUser(const TLUser &user);
+    TLUser toUser() const;
+
+    quint32 id;
+    quint64 accessHash;
+    QString firstName;
+    QString lastName;
+    QString username;
+    QString phone;
+    TLUserStatus status;
+    TLFileLocation photoSmall;
+    TLValue photoType;
+    TLValue tlType;
+};
+
+/* Users, which are stored in a dense vector and found by an open addressing (linear probing) hash index.
+ * The users are never removed one by one, so the index does not need the deletion markers.
+ * Pointers to the records are valid until the next insert(). */
+class CUserDirectory
+{
+public:
+    CUserDirectory();
+
+    int count() const { return m_records.count(); }
+    bool contains(quint32 id) const { return indexOf(id) >= 0; }
+
+    const SUserRecord *user(quint32 id) const;
+    SUserRecord *user(quint32 id);
+
+    // Adds a new or updates the known user. isNew (if given) is set to true for a new user.
+    SUserRecord *insert(const TLUser &user, bool *isNew = 0);
+
+    const QVector<SUserRecord> &records() const { return m_records; }
+
+    void reserve(int count);
+    void clear();
+
+protected:
+    int indexOf(quint32 id) const;
+    void rehash(int slotsCount);
+
+    static int slot(quint32 id, int mask);
+
+private:
+    QVector<SUserRecord> m_records;
+    QVector<int> m_slots; // Index of the record plus one or zero for an empty slot; the size is a power of two
+
+};
+
+inline int CUserDirectory::slot(quint32 id, int mask)
+{
+    quint32 hash = id * 0x9e3779b1u;
+    hash ^= hash >> 16;
+    return hash & mask;
+}
+
+inline const SUserRecord *CUserDirectory::user(quint32 id) const
+{
+    const int index = indexOf(id);
+    return index < 0 ? 0 : &m_records.at(index);
+}
+
+inline SUserRecord *CUserDirectory::user(quint32 id)
+{
+    const int index = indexOf(id);
+    return index < 0 ? 0 : &m_records[index];
+}
+
+#endif // CUSERDIRECTORY_HPP
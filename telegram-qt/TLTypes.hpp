@@ -22,6 +22,8 @@
 
 #include <QMetaType>
 #include <QVector>
+#include <QSharedData>
+#include <QString>
 
 template <typename T>
 class TLVector : public QVector<T>
@@ -42,6 +44,88 @@ public:
     TLValue tlType;
 };
 
+/* Out of line storage of a member, which is used in the compact types layout (see GeneratorNG --compact-types).
+ * The box is null until the value is written; a null box reads as a default constructed value.
+ * Copies share the value until one of them is modified. */
+template <typename T>
+class TLBox
+{
+public:
+    inline TLBox() { }
+    inline TLBox(const T &value) : d(new Data(value)) { }
+
+    inline bool isNull() const { return !d; }
+    inline void reset() { d = 0; }
+
+    inline const T &value() const { return d ? d->value : defaultValue(); }
+    inline T &data() { if (!d) { d = new Data(); } return d->value; }
+
+    inline TLBox &operator=(const T &value) { data() = value; return *this; }
+
+    inline operator const T &() const { return value(); }
+    inline const T *operator->() const { return &value(); }
+    inline T *operator->() { return &data(); }
+
+private:
+    struct Data : public QSharedData {
+        Data() { }
+        explicit Data(const T &v) : value(v) { }
+
+        T value;
+    };
+
+    static const T &defaultValue() { static const T s_defaultValue; return s_defaultValue; }
+
+    QSharedDataPointer<Data> d;
+};
+
+/* Text member, which keeps the received UTF-8 data and converts it on the first access (see GeneratorNG --lazy-text).
+ * The converted string is cached and replaces the UTF-8 data, so a text is never kept twice.
+ * The cache is not synchronized: a value must not be accessed from different threads without a copy. */
+class TLLazyString
+{
+public:
+    inline TLLazyString() : m_converted(true) { }
+    inline TLLazyString(const QString &str) : m_string(str), m_converted(true) { }
+
+    static TLLazyString fromUtf8(const QByteArray &utf8);
+
+    inline bool isEmpty() const { return m_converted ? m_string.isEmpty() : m_utf8.isEmpty(); }
+    inline bool isConverted() const { return m_converted; }
+
+    inline QByteArray toUtf8() const { return m_converted ? m_string.toUtf8() : m_utf8; }
+    const QString &toString() const;
+
+    inline operator QString() const { return toString(); }
+
+    inline bool operator==(const TLLazyString &other) const { return toString() == other.toString(); }
+    inline bool operator!=(const TLLazyString &other) const { return !operator==(other); }
+
+private:
+    mutable QByteArray m_utf8;
+    mutable QString m_string;
+    mutable bool m_converted;
+};
+
+inline TLLazyString TLLazyString::fromUtf8(const QByteArray &utf8)
+{
+    TLLazyString result;
+    result.m_utf8 = utf8;
+    result.m_converted = utf8.isEmpty();
+    return result;
+}
+
+inline const QString &TLLazyString::toString() const
+{
+    if (!m_converted) {
+        m_string = QString::fromUtf8(m_utf8);
+        m_utf8.clear();
+        m_converted = true;
+    }
+
+    return m_string;
+}
+
 // Generated TLTypes
 struct TLAccountDaysTTL {
     TLAccountDaysTTL() :
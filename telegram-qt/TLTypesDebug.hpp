@@ -21,6 +21,17 @@
 #include <QDebug>
 #include "TLTypes.hpp"
 
+template <typename T>
+inline QDebug operator<<(QDebug d, const TLBox<T> &box)
+{
+    return d << box.value();
+}
+
+inline QDebug operator<<(QDebug d, const TLLazyString &str)
+{
+    return d << str.toString();
+}
+
 // Generated TLTypes debug operators
 QDebug operator<<(QDebug d, const TLAccountDaysTTL &accountDaysTTLValue);
 QDebug operator<<(QDebug d, const TLAccountPassword &accountPasswordValue);
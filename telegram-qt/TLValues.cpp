@@ -17,19 +17,554 @@
 
 #include "TLValues.hpp"
 
-#include <QMetaEnum>
+struct TLValueName {
+    quint32 value;
+    const char *name;
+};
 
-static const int ValueTypeEnumeratorIndex = TLValue::staticMetaObject.indexOfEnumerator("Value");
-static const QMetaEnum enumerator = TLValue::staticMetaObject.enumerator(ValueTypeEnumeratorIndex);
+// Sorted by value
+static const TLValueName s_protoValuesNames[] = {
+    { 0x04deb57d, "MsgsStateInfo" },
+    { 0x05162463, "ResPQ" },
+    { 0x0949d9dc, "FutureSalt" },
+    { 0x2144ca19, "RpcError" },
+    { 0x276d3ec6, "MsgDetailedInfo" },
+    { 0x3072cfa1, "GzipPacked" },
+    { 0x347773c5, "Pong" },
+    { 0x3bcbf734, "DhGenOk" },
+    { 0x46dc1fb9, "DhGenRetry" },
+    { 0x58e4a740, "RpcDropAnswer" },
+    { 0x5e2ad36e, "RpcAnswerUnknown" },
+    { 0x60469778, "ReqPq" },
+    { 0x62d350c9, "DestroySessionNone" },
+    { 0x62d6b459, "MsgsAck" },
+    { 0x6643b654, "ClientDHInnerData" },
+    { 0x73f1f8dc, "MsgContainer" },
+    { 0x79cb045d, "ServerDHParamsFail" },
+    { 0x7abe77ec, "Ping" },
+    { 0x7d861a08, "MsgResendReq" },
+    { 0x809db6df, "MsgNewDetailedInfo" },
+    { 0x83c95aec, "PQInnerData" },
+    { 0x8cc0d131, "MsgsAllInfo" },
+    { 0x9299359f, "HttpWait" },
+    { 0x9ec20908, "NewSessionCreated" },
+    { 0xa43ad8b7, "RpcAnswerDropped" },
+    { 0xa69dae02, "DhGenFail" },
+    { 0xa7eff811, "BadMsgNotification" },
+    { 0xae500895, "FutureSalts" },
+    { 0xb5890dba, "ServerDHInnerData" },
+    { 0xb921bd04, "GetFutureSalts" },
+    { 0xcd78e586, "RpcAnswerDroppedRunning" },
+    { 0xd0e8075c, "ServerDHParamsOk" },
+    { 0xd712e4be, "ReqDHParams" },
+    { 0xda69fb52, "MsgsStateReq" },
+    { 0xe06046b2, "MsgCopy" },
+    { 0xe22045fc, "DestroySessionOk" },
+    { 0xe7512126, "DestroySession" },
+    { 0xedab447b, "BadServerSalt" },
+    { 0xf3427b8c, "PingDelayDisconnect" },
+    { 0xf35c6d01, "RpcResult" },
+    { 0xf5045f1f, "SetClientDHParams" },
+};
+
+static const TLValueName s_valuesNames[] = {
+    // Generated TLValues names
+    { 0x007efe0e, "StorageFileJpeg" },
+    { 0x008c703f, "UserStatusOffline" },
+    { 0x00f49ca0, "UpdatesDifference" },
+    { 0x03c51564, "AuthSendCall" },
+    { 0x051448e5, "DocumentAttributeAudio" },
+    { 0x0566000e, "ContactsFound" },
+    { 0x05a954c0, "MessagesReceivedMessages" },
+    { 0x061b0044, "GeochatsSendMessage" },
+    { 0x075cf7a8, "UserForeign" },
+    { 0x07761198, "UpdateChatParticipants" },
+    { 0x07bf09fc, "UserStatusLastWeek" },
+    { 0x07e9f2ab, "MessagesSearch" },
+    { 0x08b8a729, "GeochatsSetTyping" },
+    { 0x08fc711d, "AccountGetAccountTTL" },
+    { 0x096a18d5, "UploadFile" },
+    { 0x09cb126e, "MessagesCreateChat" },
+    { 0x09d05049, "UserStatusEmpty" },
+    { 0x0a041495, "UpdatesGetDifference" },
+    { 0x0a4f63c0, "StorageFilePng" },
+    { 0x0a63011e, "AuthCheckPassword" },
+    { 0x0b446ae3, "MessagesMessagesSlice" },
+    { 0x0ba52007, "InputPrivacyValueDisallowContacts" },
+    { 0x0bf0131c, "ContactsResolveUsername" },
+    { 0x0c7d53de, "MessageActionGeoChatCheckin" },
+    { 0x0c7f49b7, "PrivacyValueDisallowUsers" },
+    { 0x0d09e07b, "InputPrivacyValueAllowContacts" },
+    { 0x0d91a548, "UsersGetUsers" },
+    { 0x0da9f3e8, "AuthSendSms" },
+    { 0x0e092e16, "GeochatsCreateGeoChat" },
+    { 0x0e17e23c, "PhotoSizeEmpty" },
+    { 0x0fd2bb8a, "ChatParticipantsForbidden" },
+    { 0x1023dbe8, "InputPeerContact" },
+    { 0x1081464c, "StorageFileWebp" },
+    { 0x1117dd5f, "GeoPointEmpty" },
+    { 0x11b58939, "DocumentAttributeAnimated" },
+    { 0x11f812d8, "ContactsSearch" },
+    { 0x1250abde, "AccountAuthorizations" },
+    { 0x12b299d4, "StickerPack" },
+    { 0x12b3ad31, "AccountGetNotifySettings" },
+    { 0x12b9417b, "UpdateUserPhone" },
+    { 0x12bcbd9a, "UpdateNewEncryptedMessage" },
+    { 0x131cc67f, "InputPrivacyValueAllowUsers" },
+    { 0x137948a5, "AuthPasswordRecovery" },
+    { 0x13d6dd27, "EncryptedChatDiscarded" },
+    { 0x14637196, "InputFileLocation" },
+    { 0x15051f54, "PhotosPhotosSlice" },
+    { 0x15590068, "DocumentAttributeFilename" },
+    { 0x15ba6c40, "MessagesDialogs" },
+    { 0x16bf744e, "SendMessageTypingAction" },
+    { 0x1710f156, "UpdateEncryptedChatTyping" },
+    { 0x176f8ba1, "SendMessageGeoLocationAction" },
+    { 0x179be863, "InputPeerChat" },
+    { 0x17b1578b, "GeochatsStatedMessage" },
+    { 0x17c6b5f6, "HelpSupport" },
+    { 0x1837c364, "InputEncryptedFileEmpty" },
+    { 0x184b35ce, "InputPrivacyValueAllowAll" },
+    { 0x18798952, "InputDocument" },
+    { 0x18cb9f78, "HelpInviteText" },
+    { 0x193b4417, "InputNotifyUsers" },
+    { 0x1b067634, "AuthSignUp" },
+    { 0x1bfbd823, "UpdateUserStatus" },
+    { 0x1c138d15, "ContactsBlocked" },
+    { 0x1c60e608, "UserSelf" },
+    { 0x1ca48f57, "InputChatPhotoEmpty" },
+    { 0x1cb5c415, "Vector" },
+    { 0x1cd7bf0d, "InputPhotoEmpty" },
+    { 0x1d86f70e, "MessageService" },
+    { 0x1f2b0afd, "UpdateNewMessage" },
+    { 0x1fb33026, "HelpGetNearestDc" },
+    { 0x200250ba, "UserEmpty" },
+    { 0x20212ca8, "PhotosPhoto" },
+    { 0x2049d70c, "GeoPoint" },
+    { 0x22c6aa08, "ContactsGetContacts" },
+    { 0x2331b22d, "PhotoEmpty" },
+    { 0x23734b06, "EncryptedMessageService" },
+    { 0x2442485e, "AccountSetAccountTTL" },
+    { 0x25223e24, "MessagesGetWebPagePreview" },
+    { 0x2575bbb9, "UpdateContactRegistered" },
+    { 0x2619a90e, "MessagesGetStickerSet" },
+    { 0x268f3f59, "ContactLinkHasPhone" },
+    { 0x26cf8950, "MessagesGetDhConfig" },
+    { 0x2714d86c, "AccountCheckUsername" },
+    { 0x2827a81a, "InputMediaVenue" },
+    { 0x2c221edd, "MessagesDhConfig" },
+    { 0x2cc36971, "UpdateWebPage" },
+    { 0x2d7923b1, "MessagesSendMedia" },
+    { 0x2dc173c8, "InputEncryptedFileBigUploaded" },
+    { 0x2ec2a43c, "DcOption" },
+    { 0x2f2f21bf, "UpdateReadHistoryOutbox" },
+    { 0x2fda2204, "MessageMediaDocument" },
+    { 0x32d439a4, "MessagesSendEncryptedService" },
+    { 0x332b49fc, "ContactsBlock" },
+    { 0x33963bf9, "MessagesForwardMessage" },
+    { 0x35a1a663, "MessagesSentMessageLink" },
+    { 0x35d81a95, "GeochatsEditChatPhoto" },
+    { 0x3631cf4c, "ChatLocated" },
+    { 0x36a73f77, "MessagesReadMessageContents" },
+    { 0x36f8c871, "DocumentEmpty" },
+    { 0x37c1011c, "ChatPhotoEmpty" },
+    { 0x382dd3e4, "UpdateServiceNotification" },
+    { 0x38df3532, "AccountUpdateDeviceLocked" },
+    { 0x38fe25b7, "UpdateEncryptedMessagesRead" },
+    { 0x3a0eeb22, "UpdateChatParticipantAdd" },
+    { 0x3a556302, "DocumentAttributeSticker" },
+    { 0x3ace484c, "ContactsLink" },
+    { 0x3b831c66, "MessagesGetFullChat" },
+    { 0x3bf703dc, "EncryptedChatWaiting" },
+    { 0x3c6aa187, "MessagesGetChats" },
+    { 0x3d0364ec, "InputVideoFileLocation" },
+    { 0x3d8ce53d, "MessageMediaPhoto" },
+    { 0x3dbc0415, "MessagesAcceptEncryption" },
+    { 0x3dc4b4f0, "InvokeAfterMsgs" },
+    { 0x3de191a1, "ContactSuggested" },
+    { 0x3ded6320, "MessageMediaEmpty" },
+    { 0x3e0bdd7c, "AccountUpdateUsername" },
+    { 0x3eadb1bb, "MessagesCheckChatInvite" },
+    { 0x3f4e0648, "MessagesMessageEmpty" },
+    { 0x40bc6f52, "StorageFilePartial" },
+    { 0x41481486, "InputMediaUploadedThumbDocument" },
+    { 0x418d4e0b, "AccountDeleteAccount" },
+    { 0x4222fa74, "MessagesGetMessages" },
+    { 0x446c712c, "AccountRegisterDevice" },
+    { 0x4505f8e1, "GeoChatMessage" },
+    { 0x46a2ce98, "InputPeerNotifySettings" },
+    { 0x48feb267, "GeochatsLocated" },
+    { 0x4a70994c, "EncryptedFile" },
+    { 0x4a95e84e, "InputNotifyChats" },
+    { 0x4b09ebbc, "StorageFileMov" },
+    { 0x4c3d47f3, "MessagesSentMessage" },
+    { 0x4c8e2273, "GeochatsEditChatTitle" },
+    { 0x4d5bbe0c, "PrivacyValueAllowUsers" },
+    { 0x4d8ddec8, "InputNotifyGeoChatPeer" },
+    { 0x4e32b894, "Config" },
+    { 0x4e45abe9, "InputDocumentFileLocation" },
+    { 0x4e498cab, "InputMediaUploadedAudio" },
+    { 0x4e90bfd6, "UpdateMessageID" },
+    { 0x4ea56e92, "AuthRecoverPassword" },
+    { 0x4f11bae1, "UserProfilePhotoEmpty" },
+    { 0x4f96cb18, "InputPrivacyKeyStatusTimestamp" },
+    { 0x4fe196fe, "ContactsImportCard" },
+    { 0x52238b3c, "UpdateShortChatMessage" },
+    { 0x528a0677, "StorageFileMp3" },
+    { 0x53d69076, "FileLocation" },
+    { 0x548a30f5, "AccountGetPassword" },
+    { 0x5508ec75, "InputVideoEmpty" },
+    { 0x554abb6f, "AccountPrivacyRules" },
+    { 0x55a5bb66, "MessagesReceivedQueue" },
+    { 0x55b3e8fb, "GeochatsCheckin" },
+    { 0x55e1728d, "MessagesForwardMessages" },
+    { 0x560f8935, "MessagesSentEncryptedMessage" },
+    { 0x561bc879, "ContactBlocked" },
+    { 0x5649dcc5, "ContactsSuggested" },
+    { 0x56730bcc, "Null" },
+    { 0x56e0d474, "MessageMediaGeo" },
+    { 0x56e9f0e4, "InputMessagesFilterPhotoVideo" },
+    { 0x5717da40, "AuthLogOut" },
+    { 0x57e2f66c, "InputMessagesFilterEmpty" },
+    { 0x586988d8, "AudioEmpty" },
+    { 0x5910cccb, "DocumentAttributeVideo" },
+    { 0x59ab389e, "ContactsDeleteContacts" },
+    { 0x5a17b5e5, "InputEncryptedFile" },
+    { 0x5a686d7c, "ChatInviteAlready" },
+    { 0x5a68e3f7, "UpdateNewGeoChatMessage" },
+    { 0x5bcf1675, "MessageMediaVideo" },
+    { 0x5c486927, "UpdateUserTyping" },
+    { 0x5ce352ec, "MessagesAllStickers" },
+    { 0x5d75a138, "UpdatesDifferenceEmpty" },
+    { 0x5e3cfc4b, "MessageActionChatAddUser" },
+    { 0x5e7d2f39, "MessageMediaContact" },
+    { 0x5f4f9247, "ContactLinkUnknown" },
+    { 0x60311a9b, "GeoChatMessageEmpty" },
+    { 0x6153276a, "ChatPhoto" },
+    { 0x628cbc6f, "SendMessageChooseContactAction" },
+    { 0x63117f24, "WallPaperSolid" },
+    { 0x64bd0306, "InputEncryptedFileUploaded" },
+    { 0x64ff9fd5, "MessagesChats" },
+    { 0x65427b82, "PrivacyValueAllowAll" },
+    { 0x655e74ff, "InputUserForeign" },
+    { 0x65c55b40, "AccountUnregisterDevice" },
+    { 0x6628562c, "AccountUpdateStatus" },
+    { 0x6722dd6f, "GeochatsGetFullChat" },
+    { 0x68c13933, "UpdateReadMessagesContents" },
+    { 0x69796de9, "InitConnection" },
+    { 0x69df3769, "ChatInviteEmpty" },
+    { 0x6c37c15c, "DocumentAttributeImageSize" },
+    { 0x6c50051c, "MessagesImportChatInvite" },
+    { 0x6d1ded88, "PeerNotifyEventsAll" },
+    { 0x6e5f8c22, "UpdateChatParticipantDelete" },
+    { 0x6e9c9bc7, "Chat" },
+    { 0x6f02f748, "HelpSaveAppLog" },
+    { 0x6f038ebc, "MessageActionGeoChatCreate" },
+    { 0x6f8b8cb2, "ContactsContacts" },
+    { 0x6fe51dfb, "AuthCheckPhone" },
+    { 0x70a68512, "PeerNotifySettingsEmpty" },
+    { 0x70c32edb, "AccountChangePhone" },
+    { 0x71e094f3, "MessagesDialogsSlice" },
+    { 0x725b04c3, "UpdatesCombined" },
+    { 0x72f0eaae, "InputDocumentEmpty" },
+    { 0x74ae4240, "Updates" },
+    { 0x74d07c60, "NotifyAll" },
+    { 0x74d456fa, "InputGeoChat" },
+    { 0x74dc404d, "InputAudioFileLocation" },
+    { 0x75eaea5a, "GeoChat" },
+    { 0x768d5f4d, "AuthSendCode" },
+    { 0x770656a8, "InputAppEvent" },
+    { 0x771095da, "UserFull" },
+    { 0x771c1d97, "AuthSendInvites" },
+    { 0x77bfb61b, "PhotoSize" },
+    { 0x77d440ff, "InputAudio" },
+    { 0x77ebc742, "UserStatusLastMonth" },
+    { 0x7841b415, "ChatParticipants" },
+    { 0x78d4dec1, "UpdateShort" },
+    { 0x7912b71f, "MessageMediaVenue" },
+    { 0x791451ed, "MessagesSetEncryptedTyping" },
+    { 0x7bf2e6f6, "Authorization" },
+    { 0x7c18141c, "AccountPassword" },
+    { 0x7c596b46, "FileLocationUnavailable" },
+    { 0x7d885289, "MessagesExportChatInvite" },
+    { 0x7da07ec9, "InputPeerSelf" },
+    { 0x7f192d8f, "GeochatsGetLocated" },
+    { 0x7f3b18ea, "InputPeerEmpty" },
+    { 0x7f4b690a, "MessagesReadEncryptedHistory" },
+    { 0x7fcb13a8, "MessageActionChatEditPhoto" },
+    { 0x80ece81a, "UpdateUserBlocked" },
+    { 0x811ea28e, "AuthCheckedPhone" },
+    { 0x83e5de54, "MessageEmpty" },
+    { 0x84be5b93, "AccountUpdateNotifySettings" },
+    { 0x84d19185, "MessagesAffectedMessages" },
+    { 0x84e53737, "ContactsExportCard" },
+    { 0x861cc8a0, "InputStickerSetShortName" },
+    { 0x86e94f65, "InputUserContact" },
+    { 0x87cf7f2f, "PhotosDeletePhotos" },
+    { 0x8987f311, "HelpAppUpdate" },
+    { 0x89938781, "InputMediaAudio" },
+    { 0x8a8ecd32, "MessagesStickers" },
+    { 0x8b73e763, "PrivacyValueDisallowAll" },
+    { 0x8c718e87, "MessagesMessages" },
+    { 0x8d5e11ee, "PeerNotifySettings" },
+    { 0x8dca6aa5, "PhotosPhotos" },
+    { 0x8e1a1775, "NearestDc" },
+    { 0x8e5e9873, "UpdateDcOptions" },
+    { 0x8e953744, "ContactsDeleteContact" },
+    { 0x8f06529a, "UpdateNewAuthorization" },
+    { 0x900802a1, "ContactsBlockedSlice" },
+    { 0x90110467, "InputPrivacyValueDisallowUsers" },
+    { 0x92a1df2f, "MessagesGetHistory" },
+    { 0x936a4ebd, "InputMediaVideo" },
+    { 0x94254732, "InputChatUploadedPhoto" },
+    { 0x9493ff32, "MessagesSentEncryptedFile" },
+    { 0x95313b0c, "UpdateUserPhoto" },
+    { 0x95e3fbef, "MessageActionChatDeletePhoto" },
+    { 0x9609a51c, "InputMessagesFilterPhotos" },
+    { 0x9664f57f, "InputMediaEmpty" },
+    { 0x96dabc18, "AccountNoPassword" },
+    { 0x96fb97dc, "InputMediaUploadedThumbVideo" },
+    { 0x9961fd5c, "UpdateReadHistoryInbox" },
+    { 0x997275b5, "BoolTrue" },
+    { 0x9a65ea1f, "UpdateChatUserTyping" },
+    { 0x9a901b66, "MessagesSendEncryptedFile" },
+    { 0x9add8f26, "MessagesSendMessage" },
+    { 0x9b447325, "InputPeerForeign" },
+    { 0x9ba2d800, "ChatEmpty" },
+    { 0x9cdf08cd, "HelpGetSupport" },
+    { 0x9d2e67c5, "UpdateContactLink" },
+    { 0x9db1bc6d, "PeerUser" },
+    { 0x9de7a269, "InputStickerSetID" },
+    { 0x9eddf188, "InputMessagesFilterDocument" },
+    { 0x9f84f49e, "MessageMediaUnsupported" },
+    { 0x9fab0d1a, "AuthResetAuthorizations" },
+    { 0x9fc00e65, "InputMessagesFilterVideo" },
+    { 0x9fd40bd8, "NotifyPeer" },
+    { 0xa187d66f, "SendMessageRecordVideoAction" },
+    { 0xa20db0e5, "UpdateDeleteMessages" },
+    { 0xa31ea0b5, "WebPage" },
+    { 0xa32dd600, "MessageMediaWebPage" },
+    { 0xa3825e50, "MessagesSetTyping" },
+    { 0xa384b779, "ReceivedNotifyMessage" },
+    { 0xa407a8f4, "AccountSendChangePhoneCode" },
+    { 0xa429b886, "InputNotifyAll" },
+    { 0xa4a95186, "HelpGetInviteText" },
+    { 0xa4f58c4c, "AccountSentChangePhoneCode" },
+    { 0xa56c2a3e, "UpdatesState" },
+    { 0xa5f18925, "MessagesDeleteMessages" },
+    { 0xa6638b9a, "MessageActionChatCreate" },
+    { 0xa6e45987, "InputMediaContact" },
+    { 0xa7332b73, "UpdateUserName" },
+    { 0xa7a43b17, "StickerSet" },
+    { 0xa7ab1991, "Message" },
+    { 0xa8fb1981, "UpdatesDifferenceSlice" },
+    { 0xa9776773, "MessagesSendEncrypted" },
+    { 0xaa0cd9e4, "SendMessageUploadDocumentAction" },
+    { 0xaa3bc868, "MessagesGetAllStickers" },
+    { 0xaa963b05, "StorageFileUnknown" },
+    { 0xab7ec0a0, "EncryptedChatEmpty" },
+    { 0xad524315, "ContactsImportedContacts" },
+    { 0xadd53cb3, "PeerNotifyEventsEmpty" },
+    { 0xade6b004, "InputPhotoCropAuto" },
+    { 0xae1e508d, "StorageFilePdf" },
+    { 0xae22e045, "MessagesGetStickers" },
+    { 0xae636f24, "DisabledFeature" },
+    { 0xb04f2510, "MessagesReadHistory" },
+    { 0xb2ae9b0c, "MessageActionChatDeleteUser" },
+    { 0xb2e1bf08, "InputChatPhoto" },
+    { 0xb304a621, "UploadSaveFilePart" },
+    { 0xb3cea0e4, "StorageFileMp4" },
+    { 0xb45c69d1, "MessagesAffectedHistory" },
+    { 0xb4a2e88d, "UpdateEncryption" },
+    { 0xb4c83b4c, "NotifyUsers" },
+    { 0xb53f7a68, "GeochatsGetHistory" },
+    { 0xb5a1ce5a, "MessageActionChatEditTitle" },
+    { 0xb60a24a6, "MessagesStickerSet" },
+    { 0xb6aef7b0, "MessageActionEmpty" },
+    { 0xb74ba9d2, "ContactsContactsNotModified" },
+    { 0xb7b72ab3, "AccountPasswordSettings" },
+    { 0xb7ee553c, "PhotosGetUserPhotos" },
+    { 0xb8bc5b0c, "InputNotifyPeer" },
+    { 0xb8d0afdf, "AccountDaysTTL" },
+    { 0xb8f0deff, "GeochatsSendMedia" },
+    { 0xb98886cf, "InputUserEmpty" },
+    { 0xbad0e5bb, "PeerChat" },
+    { 0xbc2eab30, "PrivacyKeyStatusTimestamp" },
+    { 0xbc5863e8, "GeochatsMessagesSlice" },
+    { 0xbc799737, "BoolFalse" },
+    { 0xbc8d11bb, "AccountGetPasswordSettings" },
+    { 0xbcd51581, "AuthSignIn" },
+    { 0xbcfc532c, "AccountPasswordInputSettings" },
+    { 0xbec268ef, "UpdateNotifySettings" },
+    { 0xbf73f4da, "MessagesSendBroadcast" },
+    { 0xbf9459b7, "InvokeWithoutUpdates" },
+    { 0xc007cec3, "NotifyChats" },
+    { 0xc04cfac2, "AccountGetWallPapers" },
+    { 0xc0e24635, "MessagesDhConfigNotModified" },
+    { 0xc10658a8, "VideoEmpty" },
+    { 0xc1dd804a, "Dialog" },
+    { 0xc21f497e, "EncryptedFileEmpty" },
+    { 0xc3838076, "Photo" },
+    { 0xc45a6536, "HelpNoAppUpdate" },
+    { 0xc4a353ee, "ContactsGetStatuses" },
+    { 0xc4b9f9bb, "Error" },
+    { 0xc4f9186b, "HelpGetConfig" },
+    { 0xc586da1c, "WebPagePending" },
+    { 0xc6b68300, "MessageMediaAudio" },
+    { 0xc7ac6496, "Audio" },
+    { 0xc812ac7e, "HelpGetAppUpdate" },
+    { 0xc878527e, "EncryptedChatRequested" },
+    { 0xc8d7493e, "ChatParticipant" },
+    { 0xc9f81ce8, "AccountSetPrivacy" },
+    { 0xca30a5b1, "UsersGetFullUser" },
+    { 0xca4c79d8, "MessagesEditChatPhoto" },
+    { 0xcab35e18, "UserContact" },
+    { 0xcade0791, "ChatFull" },
+    { 0xcae1aadf, "StorageFileGif" },
+    { 0xcb9f372d, "InvokeAfterMsg" },
+    { 0xccb03657, "WallPaper" },
+    { 0xcd773428, "ContactsGetSuggested" },
+    { 0xcdd42a05, "AuthBindTempAuthKey" },
+    { 0xce917dcd, "ChatInvite" },
+    { 0xcfc87522, "InputMessagesFilterAudio" },
+    { 0xcfcdc44d, "GeochatsSearch" },
+    { 0xd0028438, "ImportedContact" },
+    { 0xd1526db1, "GeochatsMessages" },
+    { 0xd184e841, "InputMediaDocument" },
+    { 0xd1d34a26, "SendMessageUploadPhotoAction" },
+    { 0xd34fa24e, "GeoChatMessageService" },
+    { 0xd3680c61, "ContactStatus" },
+    { 0xd502c2d0, "ContactLinkContact" },
+    { 0xd50f9c88, "PhotosUploadProfilePhoto" },
+    { 0xd52f73f7, "SendMessageRecordAudioAction" },
+    { 0xd559d8c8, "UserProfilePhoto" },
+    { 0xd6016d7a, "UserDeleted" },
+    { 0xd66b66c9, "InputPrivacyValueDisallowAll" },
+    { 0xd897bc66, "AuthRequestPasswordRecovery" },
+    { 0xd95adc84, "InputAudioEmpty" },
+    { 0xd95e73bb, "InputMessagesFilterPhotoVideoDocuments" },
+    { 0xd9915325, "InputPhotoCrop" },
+    { 0xd9ccc4ef, "UserRequest" },
+    { 0xda30b32d, "ContactsImportContacts" },
+    { 0xda9b0d0d, "InvokeWithLayer" },
+    { 0xdadbc950, "AccountGetPrivacy" },
+    { 0xdb7e1747, "AccountResetNotifySettings" },
+    { 0xdc452855, "MessagesEditChatTitle" },
+    { 0xde7b673d, "UploadSaveBigFilePart" },
+    { 0xdf77f3bc, "AccountResetAuthorization" },
+    { 0xdf969c2d, "AuthExportedAuthorization" },
+    { 0xe0611f16, "MessagesDeleteChatUser" },
+    { 0xe13fd4bc, "InputMediaUploadedVideo" },
+    { 0xe1427e6f, "GeochatsGetRecents" },
+    { 0xe26f42f1, "UserStatusRecently" },
+    { 0xe317af7e, "UpdatesTooLong" },
+    { 0xe320c158, "AccountGetAuthorizations" },
+    { 0xe325edcf, "AuthSentAppCode" },
+    { 0xe3a6cfb5, "UploadGetFile" },
+    { 0xe3ef9613, "AuthImportAuthorization" },
+    { 0xe4c123d6, "InputGeoPointEmpty" },
+    { 0xe54100bd, "ContactsUnblock" },
+    { 0xe5bfffcd, "AuthExportAuthorization" },
+    { 0xe5d7d19c, "MessagesChatFull" },
+    { 0xe86602c3, "MessagesAllStickersNotModified" },
+    { 0xe86a2c74, "InputPeerNotifyEventsAll" },
+    { 0xe9763aec, "SendMessageUploadVideoAction" },
+    { 0xe9a734fa, "PhotoCachedSize" },
+    { 0xe9bfb4f3, "InputMediaPhoto" },
+    { 0xea879f95, "ContactFound" },
+    { 0xeb1477e8, "WebPageEmpty" },
+    { 0xeccf1df6, "MessagesGetDialogs" },
+    { 0xed18c118, "EncryptedMessage" },
+    { 0xed5c2127, "UpdateShortMessage" },
+    { 0xedb93949, "UserStatusOnline" },
+    { 0xedd4882a, "UpdatesGetState" },
+    { 0xedd923c5, "MessagesDiscardEncryption" },
+    { 0xee3b272a, "UpdatePrivacy" },
+    { 0xee579652, "InputVideo" },
+    { 0xee9f4a4d, "Video" },
+    { 0xeef579a0, "PhotosUpdateProfilePhoto" },
+    { 0xefbbfae9, "MessagesInstallStickerSet" },
+    { 0xefed51d9, "AuthSentCode" },
+    { 0xf03064d8, "InputPeerNotifyEventsEmpty" },
+    { 0xf0888d68, "AccountUpdateProfile" },
+    { 0xf141b5e1, "InputEncryptedChat" },
+    { 0xf1749a22, "MessagesStickersNotModified" },
+    { 0xf351d7ab, "SendMessageUploadAudioAction" },
+    { 0xf392b7f4, "InputPhoneContact" },
+    { 0xf3b7acc9, "InputGeoPoint" },
+    { 0xf4f8fb61, "MessagesDeleteHistory" },
+    { 0xf5235d55, "InputEncryptedFileLocation" },
+    { 0xf52ff27f, "InputFile" },
+    { 0xf57c350f, "ContactsGetBlocked" },
+    { 0xf64daf43, "MessagesRequestEncryption" },
+    { 0xf6b673a4, "AuthAuthorization" },
+    { 0xf7aff1c0, "InputMediaUploadedPhoto" },
+    { 0xf7c1b13f, "InputUserSelf" },
+    { 0xf888fa1a, "PrivacyValueDisallowContacts" },
+    { 0xf89cf5e8, "MessageActionChatJoinedByLink" },
+    { 0xf911c994, "Contact" },
+    { 0xf96e55de, "MessagesUninstallStickerSet" },
+    { 0xf9a0aa09, "MessagesAddChatUser" },
+    { 0xf9a39f4f, "Document" },
+    { 0xf9c44144, "InputMediaGeoPoint" },
+    { 0xfa4f0bb5, "InputFileBig" },
+    { 0xfa56ce36, "EncryptedChat" },
+    { 0xfa7c4b86, "AccountUpdatePasswordSettings" },
+    { 0xfb0ccc41, "ChatForbidden" },
+    { 0xfb95c6c4, "InputPhoto" },
+    { 0xfc2e05bc, "ChatInviteExported" },
+    { 0xfd5ec8f5, "SendMessageCancelAction" },
+    { 0xfeedd3ad, "ContactLinkNone" },
+    { 0xffb62b95, "InputStickerSetEmpty" },
+    { 0xffe76b78, "InputMediaUploadedDocument" },
+    { 0xfffe1bac, "PrivacyValueAllowContacts" },
+    // End of generated TLValues names
+};
+
+static const char *findName(const TLValueName *names, int count, quint32 value)
+{
+    int begin = 0;
+    int end = count;
+
+    while (begin < end) {
+        const int middle = (begin + end) / 2;
+
+        if (names[middle].value == value) {
+            return names[middle].name;
+        } else if (names[middle].value < value) {
+            begin = middle + 1;
+        } else {
+            end = middle;
+        }
+    }
+
+    return 0;
+}
+
+static const char *valueName(quint32 value)
+{
+    const char *name = findName(s_valuesNames, sizeof(s_valuesNames) / sizeof(s_valuesNames[0]), value);
+
+    if (!name) {
+        name = findName(s_protoValuesNames, sizeof(s_protoValuesNames) / sizeof(s_protoValuesNames[0]), value);
+    }
+
+    return name;
+}
 
 bool TLValue::isValid() const
 {
-    return enumerator.valueToKey(m_value);
+    return valueName(m_value);
+}
+
+QLatin1String TLValue::name() const
+{
+    return QLatin1String(valueName(m_value));
 }
 
 QString TLValue::toString() const
 {
-    const char *value = enumerator.valueToKey(m_value);
+    const char *value = valueName(m_value);
     if (value) {
         return QString::fromLatin1(value);
     } else {
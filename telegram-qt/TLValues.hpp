@@ -546,6 +546,7 @@ public:
     }
 
     QString toString() const;
+    QLatin1String name() const; // Null for an unknown value
 #ifdef DEVELOPER_BUILD
     static TLValue firstFromArray(const QByteArray &data);
 #endif
@@ -0,0 +1,247 @@
+/*
+   Copyright (C) 2014-2015 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include "TLViews.hpp"
+
+// Generated views index
+void TLUserView::buildIndex() const
+{
+    CTelegramStream stream(m_data);
+    TLValue tlType;
+
+    m_offsets.fill(-1, 8);
+
+    stream >> tlType;
+
+    switch (tlType) {
+    case TLValue::UserEmpty:
+        m_offsets[0] = stream.position();
+        stream.skip<quint32>();
+        break;
+    case TLValue::UserSelf:
+        m_offsets[0] = stream.position();
+        stream.skip<quint32>();
+        m_offsets[1] = stream.position();
+        stream.skip<QString>();
+        m_offsets[2] = stream.position();
+        stream.skip<QString>();
+        m_offsets[3] = stream.position();
+        stream.skip<QString>();
+        m_offsets[4] = stream.position();
+        stream.skip<QString>();
+        m_offsets[5] = stream.position();
+        stream.skip<TLUserProfilePhoto>();
+        m_offsets[6] = stream.position();
+        stream.skip<TLUserStatus>();
+        break;
+    case TLValue::UserContact:
+        m_offsets[0] = stream.position();
+        stream.skip<quint32>();
+        m_offsets[1] = stream.position();
+        stream.skip<QString>();
+        m_offsets[2] = stream.position();
+        stream.skip<QString>();
+        m_offsets[3] = stream.position();
+        stream.skip<QString>();
+        m_offsets[7] = stream.position();
+        stream.skip<quint64>();
+        m_offsets[4] = stream.position();
+        stream.skip<QString>();
+        m_offsets[5] = stream.position();
+        stream.skip<TLUserProfilePhoto>();
+        m_offsets[6] = stream.position();
+        stream.skip<TLUserStatus>();
+        break;
+    case TLValue::UserRequest:
+        m_offsets[0] = stream.position();
+        stream.skip<quint32>();
+        m_offsets[1] = stream.position();
+        stream.skip<QString>();
+        m_offsets[2] = stream.position();
+        stream.skip<QString>();
+        m_offsets[3] = stream.position();
+        stream.skip<QString>();
+        m_offsets[7] = stream.position();
+        stream.skip<quint64>();
+        m_offsets[4] = stream.position();
+        stream.skip<QString>();
+        m_offsets[5] = stream.position();
+        stream.skip<TLUserProfilePhoto>();
+        m_offsets[6] = stream.position();
+        stream.skip<TLUserStatus>();
+        break;
+    case TLValue::UserForeign:
+        m_offsets[0] = stream.position();
+        stream.skip<quint32>();
+        m_offsets[1] = stream.position();
+        stream.skip<QString>();
+        m_offsets[2] = stream.position();
+        stream.skip<QString>();
+        m_offsets[3] = stream.position();
+        stream.skip<QString>();
+        m_offsets[7] = stream.position();
+        stream.skip<quint64>();
+        m_offsets[5] = stream.position();
+        stream.skip<TLUserProfilePhoto>();
+        m_offsets[6] = stream.position();
+        stream.skip<TLUserStatus>();
+        break;
+    case TLValue::UserDeleted:
+        m_offsets[0] = stream.position();
+        stream.skip<quint32>();
+        m_offsets[1] = stream.position();
+        stream.skip<QString>();
+        m_offsets[2] = stream.position();
+        stream.skip<QString>();
+        m_offsets[3] = stream.position();
+        stream.skip<QString>();
+        break;
+    default:
+        break;
+    }
+}
+
+void TLChatView::buildIndex() const
+{
+    CTelegramStream stream(m_data);
+    TLValue tlType;
+
+    m_offsets.fill(-1, 12);
+
+    stream >> tlType;
+
+    switch (tlType) {
+    case TLValue::ChatEmpty:
+        m_offsets[0] = stream.position();
+        stream.skip<quint32>();
+        break;
+    case TLValue::Chat:
+        m_offsets[0] = stream.position();
+        stream.skip<quint32>();
+        m_offsets[1] = stream.position();
+        stream.skip<QString>();
+        m_offsets[2] = stream.position();
+        stream.skip<TLChatPhoto>();
+        m_offsets[3] = stream.position();
+        stream.skip<quint32>();
+        m_offsets[4] = stream.position();
+        stream.skip<quint32>();
+        m_offsets[5] = stream.position();
+        stream.skip<bool>();
+        m_offsets[6] = stream.position();
+        stream.skip<quint32>();
+        break;
+    case TLValue::ChatForbidden:
+        m_offsets[0] = stream.position();
+        stream.skip<quint32>();
+        m_offsets[1] = stream.position();
+        stream.skip<QString>();
+        m_offsets[4] = stream.position();
+        stream.skip<quint32>();
+        break;
+    case TLValue::GeoChat:
+        m_offsets[0] = stream.position();
+        stream.skip<quint32>();
+        m_offsets[7] = stream.position();
+        stream.skip<quint64>();
+        m_offsets[1] = stream.position();
+        stream.skip<QString>();
+        m_offsets[8] = stream.position();
+        stream.skip<QString>();
+        m_offsets[9] = stream.position();
+        stream.skip<QString>();
+        m_offsets[10] = stream.position();
+        stream.skip<TLGeoPoint>();
+        m_offsets[2] = stream.position();
+        stream.skip<TLChatPhoto>();
+        m_offsets[3] = stream.position();
+        stream.skip<quint32>();
+        m_offsets[4] = stream.position();
+        stream.skip<quint32>();
+        m_offsets[11] = stream.position();
+        stream.skip<bool>();
+        m_offsets[6] = stream.position();
+        stream.skip<quint32>();
+        break;
+    default:
+        break;
+    }
+}
+
+void TLMessageView::buildIndex() const
+{
+    CTelegramStream stream(m_data);
+    TLValue tlType;
+    quint32 flags = 0;
+
+    m_offsets.fill(-1, 11);
+
+    stream >> tlType;
+
+    switch (tlType) {
+    case TLValue::MessageEmpty:
+        m_offsets[0] = stream.position();
+        stream.skip<quint32>();
+        break;
+    case TLValue::Message:
+        m_offsets[1] = stream.position();
+        stream >> flags;
+        m_offsets[0] = stream.position();
+        stream.skip<quint32>();
+        m_offsets[2] = stream.position();
+        stream.skip<quint32>();
+        m_offsets[3] = stream.position();
+        stream.skip<TLPeer>();
+        if (flags & 1 << 2) {
+            m_offsets[4] = stream.position();
+            stream.skip<quint32>();
+        }
+        if (flags & 1 << 2) {
+            m_offsets[5] = stream.position();
+            stream.skip<quint32>();
+        }
+        if (flags & 1 << 3) {
+            m_offsets[6] = stream.position();
+            stream.skip<quint32>();
+        }
+        m_offsets[7] = stream.position();
+        stream.skip<quint32>();
+        m_offsets[8] = stream.position();
+        stream.skip<QString>();
+        m_offsets[9] = stream.position();
+        stream.skip<TLMessageMedia>();
+        break;
+    case TLValue::MessageService:
+        m_offsets[1] = stream.position();
+        stream >> flags;
+        m_offsets[0] = stream.position();
+        stream.skip<quint32>();
+        m_offsets[2] = stream.position();
+        stream.skip<quint32>();
+        m_offsets[3] = stream.position();
+        stream.skip<TLPeer>();
+        m_offsets[7] = stream.position();
+        stream.skip<quint32>();
+        m_offsets[10] = stream.position();
+        stream.skip<TLMessageAction>();
+        break;
+    default:
+        break;
+    }
+}
+
+// End of generated views index
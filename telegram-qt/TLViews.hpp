@@ -0,0 +1,167 @@
+/*
+   Copyright (C) 2014-2015 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#ifndef TLVIEWS_HPP
+#define TLVIEWS_HPP
+
+#include <QByteArray>
+#include <QVector>
+
+#include "CTelegramStream.hpp"
+
+/* A view over a serialized value. Nothing is decoded until a member is requested,
+ * then the offsets of all members are found (once) and only the requested member is decoded.
+ * The view is cheap to keep (e.g. in a cache), because it holds only the wire form of the value. */
+class TLView
+{
+public:
+    TLView() { }
+    explicit TLView(const QByteArray &data) : m_data(data) { }
+    virtual ~TLView() { }
+
+    bool isNull() const { return m_data.isEmpty(); }
+    QByteArray data() const { return m_data; }
+
+    TLValue tlType() const;
+
+protected:
+    template <typename T>
+    T decode() const;
+
+    template <typename T>
+    T member(int index) const;
+
+    // Fill m_offsets with the offset of each member (-1 for a member, which is not present in the value)
+    virtual void buildIndex() const = 0;
+
+    QByteArray m_data;
+    mutable QVector<int> m_offsets;
+
+};
+
+inline TLValue TLView::tlType() const
+{
+    TLValue value;
+    CRawStream stream(m_data);
+    stream.peek(value);
+    return value;
+}
+
+template <typename T>
+T TLView::decode() const
+{
+    T value;
+    CTelegramStream stream(m_data);
+    stream >> value;
+    return value;
+}
+
+template <typename T>
+T TLView::member(int index) const
+{
+    if (m_offsets.isEmpty()) {
+        buildIndex();
+    }
+
+    T value = T();
+    const int offset = m_offsets.value(index, -1);
+
+    if (offset < 0) {
+        return value;
+    }
+
+    CTelegramStream stream(m_data);
+    stream.skipBytes(offset);
+    stream >> value;
+
+    return value;
+}
+
+// Generated views
+class TLUserView : public TLView
+{
+public:
+    TLUserView() { }
+    explicit TLUserView(const QByteArray &data) : TLView(data) { }
+
+    TLUser value() const { return decode<TLUser>(); }
+
+    quint32 id() const { return member<quint32>(0); }
+    QString firstName() const { return member<QString>(1); }
+    QString lastName() const { return member<QString>(2); }
+    QString username() const { return member<QString>(3); }
+    QString phone() const { return member<QString>(4); }
+    TLUserProfilePhoto photo() const { return member<TLUserProfilePhoto>(5); }
+    TLUserStatus status() const { return member<TLUserStatus>(6); }
+    quint64 accessHash() const { return member<quint64>(7); }
+
+protected:
+    void buildIndex() const;
+};
+
+class TLChatView : public TLView
+{
+public:
+    TLChatView() { }
+    explicit TLChatView(const QByteArray &data) : TLView(data) { }
+
+    TLChat value() const { return decode<TLChat>(); }
+
+    quint32 id() const { return member<quint32>(0); }
+    QString title() const { return member<QString>(1); }
+    TLChatPhoto photo() const { return member<TLChatPhoto>(2); }
+    quint32 participantsCount() const { return member<quint32>(3); }
+    quint32 date() const { return member<quint32>(4); }
+    bool left() const { return member<bool>(5); }
+    quint32 version() const { return member<quint32>(6); }
+    quint64 accessHash() const { return member<quint64>(7); }
+    QString address() const { return member<QString>(8); }
+    QString venue() const { return member<QString>(9); }
+    TLGeoPoint geo() const { return member<TLGeoPoint>(10); }
+    bool checkedIn() const { return member<bool>(11); }
+
+protected:
+    void buildIndex() const;
+};
+
+class TLMessageView : public TLView
+{
+public:
+    TLMessageView() { }
+    explicit TLMessageView(const QByteArray &data) : TLView(data) { }
+
+    TLMessage value() const { return decode<TLMessage>(); }
+
+    quint32 id() const { return member<quint32>(0); }
+    quint32 flags() const { return member<quint32>(1); }
+    quint32 fromId() const { return member<quint32>(2); }
+    TLPeer toId() const { return member<TLPeer>(3); }
+    quint32 fwdFromId() const { return member<quint32>(4); }
+    quint32 fwdDate() const { return member<quint32>(5); }
+    quint32 replyToMsgId() const { return member<quint32>(6); }
+    quint32 date() const { return member<quint32>(7); }
+    QString message() const { return member<QString>(8); }
+    TLMessageMedia media() const { return member<TLMessageMedia>(9); }
+    TLMessageAction action() const { return member<TLMessageAction>(10); }
+
+protected:
+    void buildIndex() const;
+};
+
+// End of generated views
+
+#endif // TLVIEWS_HPP
@@ -17,6 +17,8 @@
 
 #include "Utils.hpp"
 
+#include "CGZipInflater.hpp"
+
 #include <openssl/aes.h>
 #include <openssl/bn.h>
 #include <openssl/pem.h>
@@ -230,7 +232,7 @@ QByteArray Utils::binaryNumberModExp(const QByteArray &data, const QByteArray &m
 
 QByteArray Utils::aesDecrypt(const QByteArray &data, const SAesKey &key)
 {
-    QByteArray result = data;
+    QByteArray result(data.size(), Qt::Uninitialized);
 
     QByteArray initVector = key.iv;
 
@@ -254,55 +256,41 @@ QByteArray Utils::aesEncrypt(const QByteArray &data, const SAesKey &key)
     return result;
 }
 
-QByteArray Utils::unpackGZip(const QByteArray &data)
+QByteArray Utils::packGZip(const QByteArray &data)
 {
-    if (data.size() <= 4) {
-        qDebug() << Q_FUNC_INFO << "Input data is too small to be gzip package";
-        return QByteArray();
-    }
-
-    QByteArray result;
-
-    int inflateResult;
     z_stream stream;
-    static const int CHUNK_SIZE = 1024;
-    char out[CHUNK_SIZE];
 
-    /* allocate inflate state */
     stream.zalloc = Z_NULL;
     stream.zfree = Z_NULL;
     stream.opaque = Z_NULL;
-    stream.avail_in = data.size();
-    stream.next_in = (Bytef*)(data.data());
 
-    inflateResult = inflateInit2(&stream, 15 + 32); // gzip decoding
-
-    if (inflateResult != Z_OK) {
+    if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) { // gzip encoding
         return QByteArray();
     }
 
-    do {
-        stream.avail_out = CHUNK_SIZE;
-        stream.next_out = (Bytef*)(out);
-
-        inflateResult = inflate(&stream, Z_NO_FLUSH);
-
-        switch (inflateResult) {
-        case Z_NEED_DICT:
-            inflateResult = Z_DATA_ERROR;     // and fall through
-        case Z_DATA_ERROR:
-        case Z_MEM_ERROR:
-        case Z_STREAM_ERROR:
-            inflateEnd(&stream);
-            return QByteArray();
-        default:
-            break;
-        }
+    QByteArray result;
+    result.resize(deflateBound(&stream, data.size()));
+
+    stream.avail_in = data.size();
+    stream.next_in = (Bytef*)(data.constData());
+    stream.avail_out = result.size();
+    stream.next_out = (Bytef*)(result.data());
 
-        result.append(out, CHUNK_SIZE - stream.avail_out);
-    } while (stream.avail_out == 0);
+    const int deflateResult = deflate(&stream, Z_FINISH);
+    result.resize(stream.total_out);
 
-    inflateEnd(&stream);
+    deflateEnd(&stream);
+
+    if (deflateResult != Z_STREAM_END) {
+        qDebug() << Q_FUNC_INFO << "Unable to pack data" << deflateResult;
+        return QByteArray();
+    }
 
     return result;
 }
+
+QByteArray Utils::unpackGZip(const QByteArray &data)
+{
+    CGZipInflater inflater;
+    return inflater.inflate(data);
+}
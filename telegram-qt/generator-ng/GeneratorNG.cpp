@@ -29,6 +29,7 @@ static const QString tlTypeMember = QLatin1String("tlType");
 static const QString tlVectorType = QLatin1String("TLVector");
 static const QStringList podTypes = QStringList() << "bool" << "quint32" << "quint64" << "double" << tlValueName;
 static const QStringList initTypesValues = QStringList() << "false" << "0" << "0" << "0" << "0";
+static const QList<int> podTypesSerializedSizes = QList<int>() << 4 << 4 << 8 << 8 << 4;
 static const QStringList plainTypes = QStringList() << "Bool" << "#" << "int" << "long" << "double" << "string" << "bytes";
 static const QStringList nativeTypes = QStringList() << "bool" << "quint32" << "quint32" << "quint64" << "double" << "QString" << "QByteArray";
 
@@ -38,6 +39,42 @@ static const QString doubleSpacing = spacing + spacing;
 static const QString streamClassName = QLatin1String("CTelegramStream");
 static const QString methodsClassName = QLatin1String("CTelegramConnection");
 
+// Kinds of values in the schema tables of CTelegramSchemaCodec; any other type is an object
+static const QStringList schemaKindTypes = QStringList() << "bool" << "quint32" << "quint64" << "double" << "QString" << "QByteArray";
+static const QStringList schemaKinds = QStringList() << "KindBool" << "KindUInt32" << "KindUInt64" << "KindDouble" << "KindString" << "KindBytes";
+
+static const int sharedTypeMinimumMembers = 5; // Smaller types are cheaper to copy than to share
+
+// Types, which are often kept in caches and so worth to have a TLView
+static const QStringList viewTypes = QStringList()
+        << QLatin1String("TLUser")
+        << QLatin1String("TLChat")
+        << QLatin1String("TLMessage")
+           ;
+
+// Low-cardinality string members, which are shared through the string pool of the stream (see CTelegramStream::setStringPool())
+static const QStringList internedMembers = QStringList()
+        << QLatin1String("mimeType")
+        << QLatin1String("siteName")
+        << QLatin1String("embedType")
+        << QLatin1String("emoticon")
+        << QLatin1String("alt")
+        << QLatin1String("provider")
+        << QLatin1String("country")
+        << QLatin1String("region")
+        << QLatin1String("platform")
+        << QLatin1String("deviceModel")
+        << QLatin1String("systemVersion")
+        << QLatin1String("appName")
+        << QLatin1String("appVersion")
+           ;
+
+// Text members, which are stored as TLLazyString with the lazy text option
+static const QStringList lazyTextMembers = QStringList()
+        << QLatin1String("message")
+        << QLatin1String("caption")
+           ;
+
 static const QStringList typesBlackList = QStringList()
         << QLatin1String("TLVector t")
         << QLatin1String("TLNull")
@@ -175,6 +212,55 @@ QString getTypeOrVectorType(const QString &str)
     return subType;
 }
 
+/* In the compact layout a member of a generated type is stored out of line (in TLBox),
+ * if it belongs only to some of the type alternatives. */
+bool isBoxedMember(const TLType &type, const TLParam &member)
+{
+    if (!member.type.startsWith(tlPrefix) || member.type.startsWith(tlVectorType) || (member.type == tlValueName)) {
+        return false;
+    }
+
+    foreach (const TLSubType &subType, type.subTypes) {
+        if (!subType.haveMember(member.name)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+QString memberTypeName(const TLParam &member, bool lazyText)
+{
+    if (lazyText && (member.type == QLatin1String("QString")) && lazyTextMembers.contains(member.name)) {
+        return QLatin1String("TLLazyString");
+    }
+
+    return member.type;
+}
+
+QString memberAccess(const TLType &type, const QString &memberName)
+{
+    if (type.shared) {
+        return memberName + QLatin1String("()");
+    }
+
+    return memberName;
+}
+
+int uniqueMembersCount(const TLType &type)
+{
+    QStringList names;
+    foreach (const TLSubType &subType, type.subTypes) {
+        foreach (const TLParam &member, subType.members) {
+            if (!names.contains(member.name)) {
+                names.append(member.name);
+            }
+        }
+    }
+
+    return names.count();
+}
+
 qint8 flagBitForMember(const QStringRef &type, QString *flagMember)
 {
     int indexOfQuestion = type.indexOf(QLatin1Char('?'));
@@ -275,6 +361,7 @@ static QMap<QString, TLMethod> readFunctionsJson(const QJsonDocument &document)
         TLMethod tlMethod;
         tlMethod.name = methodName;
         tlMethod.id = methodId;
+        tlMethod.type = formatType(obj.value("type").toString());
 
         const QJsonArray params = obj.value("params").toArray();
 
@@ -316,8 +403,21 @@ QString GeneratorNG::generateTLValuesDefinition(const TLMethod &method)
     return QString("        %1 = 0x%2,\n").arg(nameFirstCapital).arg(method.id, 8, 0x10, QLatin1Char('0'));
 }
 
-QString GeneratorNG::generateTLTypeDefinition(const TLType &type)
+GeneratorNG::GeneratorNG() :
+    m_compactTypes(false),
+    m_sharedTypes(false),
+    m_views(false),
+    m_schemaTables(false),
+    m_lazyText(false)
+{
+}
+
+QString GeneratorNG::generateTLTypeDefinition(const TLType &type, bool compactLayout, bool lazyText)
 {
+    if (type.shared) {
+        return generateSharedTLTypeDefinition(type, compactLayout, lazyText);
+    }
+
     QString code;
 
     code.append(QString("struct %1 {\n").arg(type.name));
@@ -343,7 +443,11 @@ QString GeneratorNG::generateTLTypeDefinition(const TLType &type)
 //            copyConstructor += QString("%1%2(%3.%2),\n").arg(doubleSpacing).arg(member.name).arg(anotherName);
 //            copyOperator += QString("%1%2 = %3.%2;\n").arg(doubleSpacing).arg(member.name).arg(anotherName);
 
-            membersCode.append(QString("%1%2 %3;\n").arg(spacing).arg(member.type).arg(member.name));
+            if (compactLayout && isBoxedMember(type, member)) {
+                membersCode.append(QString("%1TLBox<%2> %3;\n").arg(spacing).arg(member.type).arg(member.name));
+            } else {
+                membersCode.append(QString("%1%2 %3;\n").arg(spacing).arg(memberTypeName(member, lazyText)).arg(member.name));
+            }
 
             if (!podTypes.contains(member.type)) {
                 continue;
@@ -379,6 +483,72 @@ QString GeneratorNG::generateTLTypeDefinition(const TLType &type)
     return code;
 }
 
+/* The members are stored in a private implicitly shared Data, so a copy of the type is O(1) and the data is detached on write.
+ * tlType stays a plain member. The members are available via accessors, which are named after the members. */
+QString GeneratorNG::generateSharedTLTypeDefinition(const TLType &type, bool compactLayout, bool lazyText)
+{
+    QString code;
+
+    code.append(QString("struct %1 {\n").arg(type.name));
+    code.append(spacing + QString("%1() :\n").arg(type.name));
+    code.append(doubleSpacing + QString("%1(%2::%3) { }\n\n").arg(tlTypeMember).arg(tlValueName).arg(type.subTypes.first().name));
+
+    QString accessorsCode;
+    QString dataConstructor = doubleSpacing + QLatin1String("Data() :\n");
+    QString dataMembersCode;
+    bool haveInitializers = false;
+
+    QStringList addedMembers;
+    foreach (const TLSubType &subType, type.subTypes) {
+        foreach (const TLParam &member, subType.members) {
+            if (addedMembers.contains(member.name)) {
+                continue;
+            }
+
+            addedMembers.append(member.name);
+
+            QString memberType = memberTypeName(member, lazyText);
+            if (compactLayout && isBoxedMember(type, member)) {
+                memberType = QString("TLBox<%1>").arg(member.type);
+            }
+
+            dataMembersCode.append(QString("%1%2 %3;\n").arg(doubleSpacing).arg(memberType).arg(member.name));
+
+            accessorsCode.append(spacing + QString("%1 &%2() { return d.data().%2; }\n").arg(memberType).arg(member.name));
+            if (podTypes.contains(member.type)) {
+                accessorsCode.append(spacing + QString("%1 %2() const { return d.value().%2; }\n").arg(memberType).arg(member.name));
+
+                const QString initialValue = initTypesValues.at(podTypes.indexOf(member.type));
+                dataConstructor += QString("%1%2%3(%4),\n").arg(doubleSpacing).arg(spacing).arg(member.name).arg(initialValue);
+                haveInitializers = true;
+            } else {
+                accessorsCode.append(spacing + QString("const %1 &%2() const { return d.value().%2; }\n").arg(memberType).arg(member.name));
+            }
+        }
+    }
+
+    if (haveInitializers) {
+        dataConstructor.chop(2);
+        dataConstructor.append(QLatin1String(" { }\n\n"));
+    } else {
+        dataConstructor = doubleSpacing + QLatin1String("Data() { }\n\n");
+    }
+
+    code.append(accessorsCode);
+    code.append(QString("%1%2 %3;\n\n").arg(spacing).arg(tlValueName).arg(tlTypeMember));
+
+    code.append(QLatin1String("private:\n"));
+    code.append(spacing + QLatin1String("struct Data {\n"));
+    code.append(dataConstructor);
+    code.append(dataMembersCode);
+    code.append(spacing + QLatin1String("};\n\n"));
+    code.append(spacing + QLatin1String("TLBox<Data> d;\n"));
+
+    code.append(QString("};\n\n"));
+
+    return code;
+}
+
 QString GeneratorNG::generateStreamReadOperatorDeclaration(const TLType &type)
 {
     QString argName = removePrefix(type.name);
@@ -405,19 +575,25 @@ QString GeneratorNG::generateStreamReadOperatorDefinition(const TLType &type)
     argName += QLatin1String("Value");
 
     code.append(QString("%1 &%1::operator>>(%2 &%3)\n{\n").arg(streamClassName).arg(type.name).arg(argName));
-    code.append(QString("%1%2 result;\n\n").arg(spacing).arg(type.name));
-    code.append(QString("%1*this >> result.tlType;\n\n%1switch (result.tlType) {\n").arg(spacing));
+    // Decode in place instead of copying a local value. Reset first, because members of other predicates must have default values.
+    code.append(QString("%1%2 = %3();\n\n").arg(spacing).arg(argName).arg(type.name));
+    code.append(QString("%1*this >> %2.tlType;\n\n%1switch (%2.tlType) {\n").arg(spacing).arg(argName));
 
     foreach (const TLSubType &subType, type.subTypes) {
         code.append(QString("%1case %2::%3:\n").arg(spacing).arg(tlValueName).arg(subType.name));
 
         foreach (const TLParam &member, subType.members) {
+            QString readCode = QLatin1String("*this >> %1.%2;\n");
+            if ((member.type == QLatin1String("QString")) && internedMembers.contains(member.name)) {
+                readCode = QLatin1String("readInterned(%1.%2);\n");
+            }
+
             if (member.dependOnFlag()) {
-                code.append(doubleSpacing + QString("if (result.%1 & 1 << %2) {\n").arg(member.flagMember).arg(member.flagBit));
-                code.append(doubleSpacing + spacing + QString("*this >> result.%1;\n").arg(member.name));
+                code.append(doubleSpacing + QString("if (%1.%2 & 1 << %3) {\n").arg(argName).arg(memberAccess(type, member.flagMember)).arg(member.flagBit));
+                code.append(doubleSpacing + spacing + readCode.arg(argName).arg(memberAccess(type, member.name)));
                 code.append(doubleSpacing + QLatin1Literal("}\n"));
             } else {
-                code.append(doubleSpacing + QString("*this >> result.%1;\n").arg(member.name));
+                code.append(doubleSpacing + readCode.arg(argName).arg(memberAccess(type, member.name)));
             }
         }
 
@@ -425,7 +601,7 @@ QString GeneratorNG::generateStreamReadOperatorDefinition(const TLType &type)
     }
 
     code.append(QString("%1default:\n%1%1break;\n%1}\n\n").arg(spacing));
-    code.append(QString("%1%2 = result;\n\n%1return *this;\n}\n\n").arg(spacing).arg(argName));
+    code.append(QString("%1return *this;\n}\n\n").arg(spacing));
 
     return code;
 }
@@ -435,6 +611,168 @@ QString GeneratorNG::generateStreamReadVectorTemplate(const QString &type)
     return QString(QLatin1String("template %1 &%1::operator>>(TLVector<%2> &v);\n")).arg(streamClassName).arg(type);
 }
 
+QString GeneratorNG::generateStreamSkipDeclaration(const TLType &type)
+{
+    return spacing + QString("%1 &skipValue(const %2 *);\n").arg(streamClassName).arg(type.name);
+}
+
+/* Skip steps over the value without its construction. Only the flags members are read, because other members depend on them. */
+QString GeneratorNG::generateStreamSkipDefinition(const TLType &type)
+{
+    QString code;
+
+    QStringList flagMembers;
+    foreach (const TLSubType &subType, type.subTypes) {
+        foreach (const TLParam &member, subType.members) {
+            if (member.dependOnFlag() && !flagMembers.contains(member.flagMember)) {
+                flagMembers.append(member.flagMember);
+            }
+        }
+    }
+
+    code.append(QString("%1 &%1::skipValue(const %2 *)\n{\n").arg(streamClassName).arg(type.name));
+    code.append(QString("%1%2 %3;\n").arg(spacing).arg(tlValueName).arg(tlTypeMember));
+    foreach (const QString &flagMember, flagMembers) {
+        code.append(QString("%1quint32 %2 = 0;\n").arg(spacing).arg(flagMember));
+    }
+    code.append(QString("\n%1*this >> %2;\n\n%1switch (%2) {\n").arg(spacing).arg(tlTypeMember));
+
+    foreach (const TLSubType &subType, type.subTypes) {
+        code.append(QString("%1case %2::%3:\n").arg(spacing).arg(tlValueName).arg(subType.name));
+
+        foreach (const TLParam &member, subType.members) {
+            QString memberType = member.type;
+            if (memberType.endsWith(QLatin1Char('>'))) {
+                memberType.append(QLatin1Char(' ')); // Avoid ">>" token
+            }
+
+            if (flagMembers.contains(member.name)) {
+                code.append(doubleSpacing + QString("*this >> %1;\n").arg(member.name));
+            } else if (member.dependOnFlag()) {
+                code.append(doubleSpacing + QString("if (%1 & 1 << %2) {\n").arg(member.flagMember).arg(member.flagBit));
+                code.append(doubleSpacing + spacing + QString("skip<%1>();\n").arg(memberType));
+                code.append(doubleSpacing + QLatin1Literal("}\n"));
+            } else {
+                code.append(doubleSpacing + QString("skip<%1>();\n").arg(memberType));
+            }
+        }
+
+        code.append(QString("%1break;\n").arg(doubleSpacing));
+    }
+
+    code.append(QString("%1default:\n%1%1break;\n%1}\n\n").arg(spacing));
+    code.append(QString("%1return *this;\n}\n\n").arg(spacing));
+
+    return code;
+}
+
+/* The view keeps the serialized value and decodes a member on access.
+ * The index is the position of the member in the type definition. */
+QString GeneratorNG::generateViewDefinition(const TLType &type)
+{
+    const QString viewName = type.name + QLatin1String("View");
+
+    QString code;
+    code.append(QString("class %1 : public TLView\n{\npublic:\n").arg(viewName));
+    code.append(spacing + QString("%1() { }\n").arg(viewName));
+    code.append(spacing + QString("explicit %1(const QByteArray &data) : TLView(data) { }\n\n").arg(viewName));
+    code.append(spacing + QString("%1 value() const { return decode<%1>(); }\n\n").arg(type.name));
+
+    QStringList addedMembers;
+    foreach (const TLSubType &subType, type.subTypes) {
+        foreach (const TLParam &member, subType.members) {
+            if (addedMembers.contains(member.name)) {
+                continue;
+            }
+
+            QString memberType = member.type;
+            if (memberType.endsWith(QLatin1Char('>'))) {
+                memberType.append(QLatin1Char(' ')); // Avoid ">>" token
+            }
+
+            code.append(spacing + QString("%1 %2() const { return member<%3>(%4); }\n").arg(member.type).arg(member.name).arg(memberType).arg(addedMembers.count()));
+            addedMembers.append(member.name);
+        }
+    }
+
+    code.append(QLatin1String("\nprotected:\n"));
+    code.append(spacing + QLatin1String("void buildIndex() const;\n"));
+    code.append(QLatin1String("};\n\n"));
+
+    return code;
+}
+
+QString GeneratorNG::generateViewIndexDefinition(const TLType &type)
+{
+    QStringList addedMembers;
+    QStringList flagMembers;
+    foreach (const TLSubType &subType, type.subTypes) {
+        foreach (const TLParam &member, subType.members) {
+            if (!addedMembers.contains(member.name)) {
+                addedMembers.append(member.name);
+            }
+            if (member.dependOnFlag() && !flagMembers.contains(member.flagMember)) {
+                flagMembers.append(member.flagMember);
+            }
+        }
+    }
+
+    QString code;
+    code.append(QString("void %1View::buildIndex() const\n{\n").arg(type.name));
+    code.append(QString("%1%2 stream(m_data);\n").arg(spacing).arg(streamClassName));
+    code.append(QString("%1%2 %3;\n").arg(spacing).arg(tlValueName).arg(tlTypeMember));
+    foreach (const QString &flagMember, flagMembers) {
+        code.append(QString("%1quint32 %2 = 0;\n").arg(spacing).arg(flagMember));
+    }
+    code.append(QString("\n%1m_offsets.fill(-1, %2);\n\n").arg(spacing).arg(addedMembers.count()));
+    code.append(QString("%1stream >> %2;\n\n%1switch (%2) {\n").arg(spacing).arg(tlTypeMember));
+
+    foreach (const TLSubType &subType, type.subTypes) {
+        code.append(QString("%1case %2::%3:\n").arg(spacing).arg(tlValueName).arg(subType.name));
+
+        foreach (const TLParam &member, subType.members) {
+            QString memberType = member.type;
+            if (memberType.endsWith(QLatin1Char('>'))) {
+                memberType.append(QLatin1Char(' ')); // Avoid ">>" token
+            }
+
+            const QString offsetCode = QString("m_offsets[%1] = stream.position();\n").arg(addedMembers.indexOf(member.name));
+
+            if (flagMembers.contains(member.name)) {
+                code.append(doubleSpacing + offsetCode);
+                code.append(doubleSpacing + QString("stream >> %1;\n").arg(member.name));
+            } else if (member.dependOnFlag()) {
+                code.append(doubleSpacing + QString("if (%1 & 1 << %2) {\n").arg(member.flagMember).arg(member.flagBit));
+                code.append(doubleSpacing + spacing + offsetCode);
+                code.append(doubleSpacing + spacing + QString("stream.skip<%1>();\n").arg(memberType));
+                code.append(doubleSpacing + QLatin1Literal("}\n"));
+            } else {
+                code.append(doubleSpacing + offsetCode);
+                code.append(doubleSpacing + QString("stream.skip<%1>();\n").arg(memberType));
+            }
+        }
+
+        code.append(QString("%1break;\n").arg(doubleSpacing));
+    }
+
+    code.append(QString("%1default:\n%1%1break;\n%1}\n}\n\n").arg(spacing));
+
+    return code;
+}
+
+QString GeneratorNG::generateVisitorCallback(const QString &type)
+{
+    const QString name = removePrefix(type);
+    QString argName = name;
+    argName[0] = argName.at(0).toLower();
+
+    QString code;
+    code.append(spacing + QString("bool visit(const %1 &%2) { return on%3(%2); }\n").arg(type).arg(argName).arg(name));
+    code.append(spacing + QString("virtual bool on%1(const %2 &%3) { Q_UNUSED(%3); return false; }\n").arg(name).arg(type).arg(argName));
+
+    return code;
+}
+
 QString GeneratorNG::generateStreamWriteOperatorDefinition(const TLType &type)
 {
     QString code;
@@ -451,11 +789,11 @@ QString GeneratorNG::generateStreamWriteOperatorDefinition(const TLType &type)
 
         foreach (const TLParam &member, subType.members) {
             if (member.dependOnFlag()) {
-                code.append(doubleSpacing + QString("if (%1.%2 & 1 << %3) {\n").arg(argName).arg(member.flagMember).arg(member.flagBit));
-                code.append(doubleSpacing + spacing + QString("*this << %1.%2;\n").arg(argName).arg(member.name));
+                code.append(doubleSpacing + QString("if (%1.%2 & 1 << %3) {\n").arg(argName).arg(memberAccess(type, member.flagMember)).arg(member.flagBit));
+                code.append(doubleSpacing + spacing + QString("*this << %1.%2;\n").arg(argName).arg(memberAccess(type, member.name)));
                 code.append(doubleSpacing + QLatin1Literal("}\n"));
             } else {
-                code.append(doubleSpacing + QString("*this << %1.%2;\n").arg(argName).arg(member.name));
+                code.append(doubleSpacing + QString("*this << %1.%2;\n").arg(argName).arg(memberAccess(type, member.name)));
             }
         }
 
@@ -473,6 +811,84 @@ QString GeneratorNG::generateStreamWriteVectorTemplate(const QString &type)
     return QString(QLatin1String("template %1 &%1::operator<<(const TLVector<%2> &v);\n")).arg(streamClassName).arg(type);
 }
 
+/* Returns the serialized size of the type, if it is the same for all values of the type, or -1 otherwise */
+int GeneratorNG::fixedSerializedSize(const TLType &type, const QMap<QString, int> &fixedSizes)
+{
+    int result = -1;
+
+    foreach (const TLSubType &subType, type.subTypes) {
+        int size = podTypesSerializedSizes.at(podTypes.indexOf(tlValueName));
+
+        foreach (const TLParam &member, subType.members) {
+            if (member.dependOnFlag()) {
+                return -1;
+            }
+
+            if (podTypes.contains(member.type)) {
+                size += podTypesSerializedSizes.at(podTypes.indexOf(member.type));
+            } else if (fixedSizes.contains(member.type)) {
+                size += fixedSizes.value(member.type);
+            } else {
+                return -1;
+            }
+        }
+
+        if ((result >= 0) && (result != size)) {
+            return -1;
+        }
+
+        result = size;
+    }
+
+    return result;
+}
+
+QString GeneratorNG::generateSerializedSizeDeclaration(const TLType &type, int fixedSize)
+{
+    if (fixedSize >= 0) {
+        return spacing + QString("static Q_DECL_CONSTEXPR int serializedSize(const %1 &) { return %2; }\n").arg(type.name).arg(fixedSize);
+    }
+
+    QString argName = removePrefix(type.name);
+    argName[0] = argName.at(0).toLower();
+    argName += QLatin1String("Value");
+
+    return spacing + QString("static int serializedSize(const %1 &%2);\n").arg(type.name).arg(argName);
+}
+
+QString GeneratorNG::generateSerializedSizeDefinition(const TLType &type)
+{
+    QString code;
+
+    QString argName = removePrefix(type.name);
+    argName[0] = argName.at(0).toLower();
+    argName += QLatin1String("Value");
+
+    code.append(QString("int %1::serializedSize(const %2 &%3)\n{\n").arg(streamClassName).arg(type.name).arg(argName));
+    code.append(QString("%1int size = serializedSize(%2.tlType);\n\n%1switch (%2.tlType) {\n").arg(spacing).arg(argName));
+
+    foreach (const TLSubType &subType, type.subTypes) {
+        code.append(QString("%1case %2::%3:\n").arg(spacing).arg(tlValueName).arg(subType.name));
+
+        foreach (const TLParam &member, subType.members) {
+            if (member.dependOnFlag()) {
+                code.append(doubleSpacing + QString("if (%1.%2 & 1 << %3) {\n").arg(argName).arg(memberAccess(type, member.flagMember)).arg(member.flagBit));
+                code.append(doubleSpacing + spacing + QString("size += serializedSize(%1.%2);\n").arg(argName).arg(memberAccess(type, member.name)));
+                code.append(doubleSpacing + QLatin1Literal("}\n"));
+            } else {
+                code.append(doubleSpacing + QString("size += serializedSize(%1.%2);\n").arg(argName).arg(memberAccess(type, member.name)));
+            }
+        }
+
+        code.append(QString("%1break;\n").arg(doubleSpacing));
+    }
+
+    code.append(QString("%1default:\n%1%1break;\n%1}\n\n").arg(spacing));
+    code.append(spacing + QString("return size;\n}\n\n"));
+
+    return code;
+}
+
 QString GeneratorNG::generateDebugWriteOperatorDeclaration(const TLType &type)
 {
     QString argName = removePrefix(type.name);
@@ -493,7 +909,7 @@ QString GeneratorNG::generateDebugWriteOperatorDefinition(const TLType &type)
         code.append(QString("%1case %2::%3:\n").arg(spacing).arg(tlValueName).arg(subType.name));
 
         foreach (const TLParam &member, subType.members) {
-            code += doubleSpacing + QString("d << \"%1:\" << type.%1;\n").arg(member.name);
+            code += doubleSpacing + QString("d << \"%1:\" << type.%2;\n").arg(member.name).arg(memberAccess(type, member.name));
         }
 
         code += doubleSpacing + QLatin1String("break;\n");
@@ -537,6 +953,19 @@ QString GeneratorNG::generateConnectionMethodDefinition(const TLMethod &method,
     QString result;
     result += QString("quint64 %1::%2(%3)\n{\n").arg(methodsClassName).arg(method.name).arg(formatMethodParams(method));
     result += spacing + QLatin1String("QByteArray output;\n");
+
+    // Reserve the exact size of the request to avoid reallocations on write
+    QString sizeExpression = QLatin1String("4");
+    foreach (const TLParam &param, method.params) {
+        const QString paramSize = QString("%1::serializedSize(%2)").arg(streamClassName).arg(param.name);
+        if (param.dependOnFlag()) {
+            sizeExpression += QString(" + ((%1 & 1 << %2) ? %3 : 0)").arg(param.flagMember).arg(param.flagBit).arg(paramSize);
+        } else {
+            sizeExpression += QLatin1String(" + ") + paramSize;
+        }
+    }
+    result += spacing + QString("output.reserve(%1);\n").arg(sizeExpression);
+
     result += spacing + streamClassName + QLatin1String(" outputStream(&output, /* write */ true);\n\n");
 
     result += spacing + QString("outputStream << %1::%2;\n").arg(tlValueName).arg(formatName1stCapital(method.name));
@@ -585,6 +1014,131 @@ QString GeneratorNG::generateDebugRpcParse(const TLMethod &method)
     return result;
 }
 
+QString GeneratorNG::generateRpcResultHandlerEntry(const TLMethod &method) const
+{
+    // Methods, which results are processed by a handler of another method
+    static const QStringList aliasedMethods = QStringList()
+            << QStringLiteral("UploadSaveBigFilePart")
+               ;
+    static const QStringList aliasedMethodsHandlers = QStringList()
+            << QStringLiteral("UploadSaveFilePart")
+               ;
+
+    const QString methodName = formatName1stCapital(method.name);
+    const int aliasIndex = aliasedMethods.indexOf(methodName);
+    QString handler;
+
+    if (m_rpcResultHandlers.contains(methodName)) {
+        handler = QLatin1String("process") + methodName;
+    } else if ((aliasIndex >= 0) && m_rpcResultHandlers.contains(aliasedMethodsHandlers.at(aliasIndex))) {
+        handler = QLatin1String("process") + aliasedMethodsHandlers.at(aliasIndex);
+    } else {
+        QString resultType = method.type;
+        if (resultType.endsWith(QLatin1Char('>'))) {
+            resultType.append(QLatin1Char(' ')); // Avoid ">>" token
+        }
+        handler = QString("processRpcResultOfType<%1>").arg(resultType);
+    }
+
+    return spacing + QString("{ %1::%2, &%3::%4 },\n").arg(tlValueName).arg(methodName).arg(methodsClassName).arg(handler);
+}
+
+/* The tables describe the wire format of the types and the members of the generated structs,
+ * so CTelegramSchemaCodec can read and write any type without a type-specific code.
+ * The members are accessed through functions instead of offsetof(), because the structs are not standard-layout. */
+void GeneratorNG::generateSchemaTables()
+{
+    QStringList schemaTypes;
+    foreach (const TLType &type, m_solvedTypes) {
+        if (nativeTypes.contains(type.name) || typesBlackList.contains(type.name)) {
+            continue;
+        }
+
+        schemaTypes.append(type.name);
+    }
+
+    QStringList vectorTypes;
+    QString membersCode;
+    QString constructorsCode;
+    QString typesCode;
+    QString vectorTypesCode;
+    int membersCount = 0;
+    int constructorsCount = 0;
+
+    foreach (const TLType &type, m_solvedTypes) {
+        if (!schemaTypes.contains(type.name)) {
+            continue;
+        }
+
+        QString argName = removePrefix(type.name);
+        argName[0] = argName.at(0).toLower();
+        argName += QLatin1String("Value");
+
+        codeSchemaTypeIndices.append(spacing + QString("static int typeIndex(const %1 *) { return %2; }\n").arg(type.name).arg(schemaTypes.indexOf(type.name)));
+        typesCode.append(spacing + QString("{ %1, %2, &typeValue<%3>, &resetValue<%3> },\n").arg(constructorsCount).arg(type.subTypes.count()).arg(type.name));
+        codeSchemaOperators.append(QString("%1 &%1::operator>>(%2 &%3) { CTelegramSchemaCodec::read(*this, %3); return *this; }\n").arg(streamClassName).arg(type.name).arg(argName));
+        codeSchemaOperators.append(QString("%1 &%1::operator<<(const %2 &%3) { CTelegramSchemaCodec::write(*this, %3); return *this; }\n").arg(streamClassName).arg(type.name).arg(argName));
+        membersCode.append(spacing + QString("// %1\n").arg(type.name));
+
+        foreach (const TLSubType &subType, type.subTypes) {
+            constructorsCode.append(spacing + QString("{ %1::%2, %3, %4 },\n").arg(tlValueName).arg(subType.name).arg(membersCount).arg(subType.members.count()));
+            ++constructorsCount;
+
+            const int firstMember = membersCount;
+
+            foreach (const TLParam &member, subType.members) {
+                QString kind;
+                int typeIndex = 0;
+
+                if (member.type.startsWith(tlVectorType)) {
+                    if (!vectorTypes.contains(member.type)) {
+                        vectorTypes.append(member.type);
+                    }
+                    kind = QLatin1String("KindVector");
+                    typeIndex = vectorTypes.indexOf(member.type);
+                } else if (schemaKindTypes.contains(member.type)) {
+                    kind = schemaKinds.at(schemaKindTypes.indexOf(member.type));
+                } else {
+                    kind = QLatin1String("KindObject");
+                    typeIndex = schemaTypes.indexOf(member.type);
+                }
+
+                QString flag = QLatin1String("-1, 0");
+                if (member.dependOnFlag()) {
+                    int flagMemberIndex = 0;
+                    while (subType.members.at(flagMemberIndex).name != member.flagMember) {
+                        ++flagMemberIndex;
+                    }
+                    flag = QString("%1, %2").arg(member.flagBit).arg(firstMember + flagMemberIndex);
+                }
+
+                membersCode.append(spacing + QString("{ &memberValue<%1, %2, &%1::%3>, %4, %5, %6 },\n").arg(type.name).arg(member.type).arg(member.name).arg(kind).arg(flag).arg(typeIndex));
+                ++membersCount;
+            }
+        }
+    }
+
+    foreach (const QString &vectorType, vectorTypes) {
+        const QString elementType = getTypeOrVectorType(vectorType);
+        QString kind = QLatin1String("KindObject");
+        int typeIndex = 0;
+
+        if (schemaKindTypes.contains(elementType)) {
+            kind = schemaKinds.at(schemaKindTypes.indexOf(elementType));
+        } else {
+            typeIndex = schemaTypes.indexOf(elementType);
+        }
+
+        vectorTypesCode.append(spacing + QString("{ %1, %2, sizeof(%3), &typeValue<%4 >, &resizeVector<%3>, &vectorData<%3> },\n")
+                               .arg(kind).arg(typeIndex).arg(elementType).arg(vectorType));
+    }
+
+    codeSchemaTables.append(QLatin1String("static const SchemaMember s_schemaMembers[] = {\n") + membersCode + QLatin1String("};\n\n"));
+    codeSchemaTables.append(QLatin1String("static const SchemaConstructor s_schemaConstructors[] = {\n") + constructorsCode + QLatin1String("};\n\n"));
+    codeSchemaTables.append(QLatin1String("static const SchemaType s_schemaTypes[] = {\n") + typesCode + QLatin1String("};\n\n"));
+    codeSchemaTables.append(QLatin1String("static const SchemaVectorType s_schemaVectorTypes[] = {\n") + vectorTypesCode + QLatin1String("};\n\n"));
+}
+
 QList<TLType> GeneratorNG::solveTypes(QMap<QString, TLType> types)
 {
     QList<TLType> solvedTypes;
@@ -798,6 +1352,7 @@ bool GeneratorNG::loadDataFromText(const QByteArray &data)
             tlMethod.name = functionName;
             tlMethod.id = predicateId;
             tlMethod.params.append(tlParams);
+            tlMethod.type = formatType(typePart.trimmed().toString());
 
             m_functions.insert(functionName, tlMethod);
         }
@@ -810,17 +1365,38 @@ void GeneratorNG::generate()
 {
     m_solvedTypes = solveTypes(m_types);
 
+    if (m_sharedTypes) {
+        for (int i = 0; i < m_solvedTypes.count(); ++i) {
+            TLType &type = m_solvedTypes[i];
+            type.shared = uniqueMembersCount(type) >= sharedTypeMinimumMembers;
+        }
+    }
+
     codeOfTLValues.clear();
+    codeOfTLValuesNames.clear();
     codeOfTLTypes.clear();
     codeStreamReadDeclarations.clear();
     codeStreamReadDefinitions.clear();
     codeStreamWriteDeclarations.clear();
     codeStreamWriteDefinitions.clear();
     codeStreamWriteTemplateInstancing.clear();
+    codeStreamReadTemplateInstancing.clear();
+    codeVisitorCallbacks.clear();
+    codeStreamSkipDeclarations.clear();
+    codeStreamSkipDefinitions.clear();
+    codeStreamSizeDeclarations.clear();
+    codeStreamSizeDefinitions.clear();
     codeConnectionDeclarations.clear();
     codeConnectionDefinitions.clear();
     codeDebugWriteDeclarations.clear();
     codeDebugWriteDefinitions.clear();
+    codeDebugRpcParse.clear();
+    codeRpcResultHandlers.clear();
+    codeViewDefinitions.clear();
+    codeViewIndexDefinitions.clear();
+    codeSchemaTypeIndices.clear();
+    codeSchemaTables.clear();
+    codeSchemaOperators.clear();
 
     QStringList typesUsedForWrite;
     QStringList vectorUsedForWrite;
@@ -879,25 +1455,65 @@ void GeneratorNG::generate()
     getUsedAndVectorTypes(usedTypes, vectorUsedForRead);
     foreach (const QString &str, vectorUsedForRead) {
         codeStreamReadTemplateInstancing.append(generateStreamReadVectorTemplate(str));
+        codeVisitorCallbacks.append(generateVisitorCallback(str));
     }
 
     getUsedAndVectorTypes(typesUsedForWrite, vectorUsedForWrite);
+
+    // Every type has a write operator, so the vectors of the read types have to be instanced too
+    foreach (const QString &str, vectorUsedForRead) {
+        if (!vectorUsedForWrite.contains(str)) {
+            vectorUsedForWrite.append(str);
+        }
+    }
+
     foreach (const QString &str, vectorUsedForWrite) {
         codeStreamWriteTemplateInstancing.append(generateStreamWriteVectorTemplate(str));
     }
 
+    // The names are sorted by the value to be found by a binary search
+    QMap<quint32, QString> valuesNames;
+
     codeOfTLValues.append(QLatin1String("        // Types\n"));
     foreach (const TLType &type, m_types) {
         codeOfTLValues.append(generateTLValuesDefinition(type));
+
+        foreach (const TLSubType &subType, type.subTypes) {
+            valuesNames.insert(subType.id, subType.name);
+        }
     }
 
     codeOfTLValues.append(QLatin1String("        // Methods\n"));
+
+    // The handlers are sorted by the method id to be found by a binary search
+    QMap<quint32, QString> rpcResultHandlers;
+
     foreach (const TLMethod &method, m_functions) {
         codeOfTLValues.append(generateTLValuesDefinition(method));
 
+        QString methodValueName = method.name;
+        methodValueName[0] = methodValueName.at(0).toUpper();
+        valuesNames.insert(method.id, methodValueName);
+
         codeDebugRpcParse.append(generateDebugRpcParse(method));
+
+        // Skip the methods with generic result (such as invokeWithLayer)
+        const QString resultType = getTypeOrVectorType(method.type);
+        if ((nativeTypes.contains(resultType) || m_types.contains(resultType)) && !typesBlackList.contains(resultType)) {
+            rpcResultHandlers.insert(method.id, generateRpcResultHandlerEntry(method));
+        }
+    }
+
+    foreach (const QString &entry, rpcResultHandlers) {
+        codeRpcResultHandlers.append(entry);
     }
 
+    for (QMap<quint32, QString>::const_iterator it = valuesNames.constBegin(); it != valuesNames.constEnd(); ++it) {
+        codeOfTLValuesNames.append(spacing + QString("{ 0x%1, \"%2\" },\n").arg(it.key(), 8, 0x10, QLatin1Char('0')).arg(it.value()));
+    }
+
+    QMap<QString, int> fixedSizes;
+
     foreach (const TLType &type, m_solvedTypes) {
         if (nativeTypes.contains(type.name)) {
             continue;
@@ -907,18 +1523,35 @@ void GeneratorNG::generate()
             continue;
         }
 
-        codeOfTLTypes.append(generateTLTypeDefinition(type));
+        codeOfTLTypes.append(generateTLTypeDefinition(type, m_compactTypes, m_lazyText));
 
         codeStreamReadDeclarations.append(generateStreamReadOperatorDeclaration(type));
         codeStreamReadDefinitions.append(generateStreamReadOperatorDefinition(type));
+        codeStreamSkipDeclarations.append(generateStreamSkipDeclaration(type));
+        codeStreamSkipDefinitions.append(generateStreamSkipDefinition(type));
 
-        if (typesUsedForWrite.contains(type.name)) {
-            codeStreamWriteDeclarations.append(generateStreamWriteOperatorDeclaration(type));
-            codeStreamWriteDefinitions.append(generateStreamWriteOperatorDefinition(type));
+        codeStreamWriteDeclarations.append(generateStreamWriteOperatorDeclaration(type));
+        codeStreamWriteDefinitions.append(generateStreamWriteOperatorDefinition(type));
+
+        const int fixedSize = fixedSerializedSize(type, fixedSizes);
+        if (fixedSize >= 0) {
+            fixedSizes.insert(type.name, fixedSize);
+        } else {
+            codeStreamSizeDefinitions.append(generateSerializedSizeDefinition(type));
+        }
+        codeStreamSizeDeclarations.append(generateSerializedSizeDeclaration(type, fixedSize));
+
+        if (m_views && viewTypes.contains(type.name)) {
+            codeViewDefinitions.append(generateViewDefinition(type));
+            codeViewIndexDefinitions.append(generateViewIndexDefinition(type));
         }
 
         codeDebugWriteDeclarations.append(generateDebugWriteOperatorDeclaration(type));
         codeDebugWriteDefinitions .append(generateDebugWriteOperatorDefinition(type));
     }
 
+    if (m_schemaTables) {
+        generateSchemaTables();
+    }
+
 }
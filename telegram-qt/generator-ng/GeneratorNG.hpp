@@ -42,7 +42,7 @@ struct TLSubType {
     quint32 id;
     QList<TLParam> members;
 
-    bool haveMember(const QString &name) {
+    bool haveMember(const QString &name) const {
         foreach (const TLParam &member, members) {
             if (member.name == name) {
                 return true;
@@ -54,32 +54,56 @@ struct TLSubType {
 };
 
 struct TLType {
+    TLType() : shared(false) { }
+
     QString name;
     QList<TLSubType> subTypes;
+    bool shared; // Members are implicitly shared and accessed via methods
 };
 
 struct TLMethod {
     QString name;
     quint32 id;
     QList< TLParam > params;
+    QString type; // Type of the result
 };
 
 class GeneratorNG
 {
 public:
+    GeneratorNG();
+
+    void setCompactTypesEnabled(bool enabled) { m_compactTypes = enabled; }
+    void setSharedTypesEnabled(bool enabled) { m_sharedTypes = enabled; }
+    void setViewsEnabled(bool enabled) { m_views = enabled; }
+    void setSchemaTablesEnabled(bool enabled) { m_schemaTables = enabled; }
+    void setLazyTextEnabled(bool enabled) { m_lazyText = enabled; }
+
+    // Names of the hand-written result handlers (process<Name>) of the connection
+    void setRpcResultHandlers(const QStringList &handlers) { m_rpcResultHandlers = handlers; }
+
     bool loadDataFromJson(const QByteArray &data);
     bool loadDataFromText(const QByteArray &data);
     void generate();
 
     static QString generateTLValuesDefinition(const TLType &type);
     static QString generateTLValuesDefinition(const TLMethod &method);
-    static QString generateTLTypeDefinition(const TLType &type);
+    static QString generateTLTypeDefinition(const TLType &type, bool compactLayout = false, bool lazyText = false);
+    static QString generateSharedTLTypeDefinition(const TLType &type, bool compactLayout = false, bool lazyText = false);
     static QString generateStreamReadOperatorDeclaration(const TLType &type);
     static QString generateStreamReadOperatorDefinition(const TLType &type);
     static QString generateStreamReadVectorTemplate(const QString &type);
+    static QString generateVisitorCallback(const QString &type);
+    static QString generateStreamSkipDeclaration(const TLType &type);
+    static QString generateStreamSkipDefinition(const TLType &type);
     static QString generateStreamWriteOperatorDeclaration(const TLType &type);
     static QString generateStreamWriteOperatorDefinition(const TLType &type);
     static QString generateStreamWriteVectorTemplate(const QString &type);
+    static int fixedSerializedSize(const TLType &type, const QMap<QString, int> &fixedSizes);
+    static QString generateSerializedSizeDeclaration(const TLType &type, int fixedSize);
+    static QString generateSerializedSizeDefinition(const TLType &type);
+    static QString generateViewDefinition(const TLType &type);
+    static QString generateViewIndexDefinition(const TLType &type);
 
     static QString generateDebugWriteOperatorDeclaration(const TLType &type);
     static QString generateDebugWriteOperatorDefinition(const TLType &type);
@@ -88,29 +112,49 @@ public:
     static QString generateConnectionMethodDefinition(const TLMethod &method, QStringList &usedTypes);
 
     static QString generateDebugRpcParse(const TLMethod &method);
+    QString generateRpcResultHandlerEntry(const TLMethod &method) const;
+    void generateSchemaTables();
 
     static QList<TLType> solveTypes(QMap<QString, TLType> types);
 
     void getUsedAndVectorTypes(QStringList &usedTypes, QStringList &vectors) const;
 
     QString codeOfTLValues;
+    QString codeOfTLValuesNames;
     QString codeOfTLTypes;
     QString codeStreamReadDeclarations;
     QString codeStreamReadDefinitions;
     QString codeStreamReadTemplateInstancing;
+    QString codeVisitorCallbacks;
+    QString codeStreamSkipDeclarations;
+    QString codeStreamSkipDefinitions;
     QString codeStreamWriteDeclarations;
     QString codeStreamWriteDefinitions;
     QString codeStreamWriteTemplateInstancing;
+    QString codeStreamSizeDeclarations;
+    QString codeStreamSizeDefinitions;
+    QString codeViewDefinitions;
+    QString codeViewIndexDefinitions;
     QString codeConnectionDeclarations;
     QString codeConnectionDefinitions;
     QString codeDebugWriteDeclarations;
     QString codeDebugWriteDefinitions;
     QString codeDebugRpcParse;
+    QString codeRpcResultHandlers;
+    QString codeSchemaTypeIndices;
+    QString codeSchemaTables;
+    QString codeSchemaOperators;
 
 private:
     QMap<QString, TLType> m_types;
     QList<TLType> m_solvedTypes;
     QMap<QString, TLMethod> m_functions;
+    bool m_compactTypes;
+    bool m_sharedTypes;
+    bool m_views;
+    bool m_schemaTables;
+    bool m_lazyText;
+    QStringList m_rpcResultHandlers;
 };
 
 #endif // GENERATORNG_HPP
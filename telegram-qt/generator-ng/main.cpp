@@ -20,6 +20,7 @@
 #include <QFile>
 #include <QNetworkAccessManager>
 #include <QNetworkReply>
+#include <QRegularExpression>
 
 #include <QJsonDocument>
 
@@ -185,7 +186,7 @@ StatusCode format(const QString &specFileName)
     return NoError;
 }
 
-StatusCode generate(SchemaFormat format, const QString &specFileName)
+StatusCode generate(SchemaFormat format, const QString &specFileName, bool compactTypes, bool sharedTypes, bool views, bool schemaTables, bool lazyText)
 {
     QFile specsFile(specFileName);
     specsFile.open(QIODevice::ReadOnly);
@@ -200,6 +201,25 @@ StatusCode generate(SchemaFormat format, const QString &specFileName)
     specsFile.close();
 
     GeneratorNG generator;
+    generator.setCompactTypesEnabled(compactTypes);
+    generator.setSharedTypesEnabled(sharedTypes);
+    generator.setViewsEnabled(views);
+    generator.setSchemaTablesEnabled(schemaTables);
+    generator.setLazyTextEnabled(lazyText);
+
+    QFile connectionHeader(QLatin1String("../CTelegramConnection.hpp"));
+    if (connectionHeader.open(QIODevice::ReadOnly)) {
+        const QString connectionCode = QString::fromUtf8(connectionHeader.readAll());
+        QRegularExpression handlerExpression(QLatin1String("TLValue process(\\w+)\\(CTelegramStream &stream, quint64 id\\);"));
+        QStringList handlers;
+
+        QRegularExpressionMatchIterator it = handlerExpression.globalMatch(connectionCode);
+        while (it.hasNext()) {
+            handlers.append(it.next().captured(1));
+        }
+
+        generator.setRpcResultHandlers(handlers);
+    }
 
     bool success = true;
 
@@ -220,15 +240,34 @@ StatusCode generate(SchemaFormat format, const QString &specFileName)
     generator.generate();
 
     replacingHelper(QLatin1String("../TLValues.hpp"), 8, QLatin1String("TLValues"), generator.codeOfTLValues);
+    replacingHelper(QLatin1String("../TLValues.cpp"), 4, QLatin1String("TLValues names"), generator.codeOfTLValuesNames);
     replacingHelper(QLatin1String("../TLTypes.hpp"), 0, QLatin1String("TLTypes"), generator.codeOfTLTypes);
     replacingHelper(QLatin1String("../CTelegramStream.hpp"), 4, QLatin1String("read operators"), generator.codeStreamReadDeclarations);
     replacingHelper(QLatin1String("../CTelegramStream.cpp"), 0, QLatin1String("read operators implementation"), generator.codeStreamReadDefinitions);
     replacingHelper(QLatin1String("../CTelegramStream.cpp"), 0, QLatin1String("vector read templates instancing"), generator.codeStreamReadTemplateInstancing);
+    replacingHelper(QLatin1String("../CTelegramStream.hpp"), 4, QLatin1String("visitor callbacks"), generator.codeVisitorCallbacks);
+    replacingHelper(QLatin1String("../CTelegramStream.hpp"), 4, QLatin1String("skip functions"), generator.codeStreamSkipDeclarations);
+    replacingHelper(QLatin1String("../CTelegramStream.cpp"), 0, QLatin1String("skip functions implementation"), generator.codeStreamSkipDefinitions);
     replacingHelper(QLatin1String("../CTelegramStream.hpp"), 4, QLatin1String("write operators"), generator.codeStreamWriteDeclarations);
     replacingHelper(QLatin1String("../CTelegramStream.cpp"), 0, QLatin1String("write operators implementation"), generator.codeStreamWriteDefinitions);
     replacingHelper(QLatin1String("../CTelegramStream.cpp"), 0, QLatin1String("vector write templates instancing"), generator.codeStreamWriteTemplateInstancing);
+    replacingHelper(QLatin1String("../CTelegramStream.hpp"), 4, QLatin1String("serialized size declarations"), generator.codeStreamSizeDeclarations);
+    replacingHelper(QLatin1String("../CTelegramStream.cpp"), 0, QLatin1String("serialized size implementation"), generator.codeStreamSizeDefinitions);
+
+    if (views) {
+        replacingHelper(QLatin1String("../TLViews.hpp"), 0, QLatin1String("views"), generator.codeViewDefinitions);
+        replacingHelper(QLatin1String("../TLViews.cpp"), 0, QLatin1String("views index"), generator.codeViewIndexDefinitions);
+    }
+
+    if (schemaTables) {
+        replacingHelper(QLatin1String("../CTelegramSchemaCodec.hpp"), 4, QLatin1String("schema type indices"), generator.codeSchemaTypeIndices);
+        replacingHelper(QLatin1String("../CTelegramSchemaCodec.cpp"), 0, QLatin1String("schema tables"), generator.codeSchemaTables);
+        replacingHelper(QLatin1String("../CTelegramSchemaCodec.cpp"), 0, QLatin1String("schema codec operators"), generator.codeSchemaOperators);
+    }
+
     replacingHelper(QLatin1String("../CTelegramConnection.hpp"), 4, QLatin1String("Telegram API methods declaration"), generator.codeConnectionDeclarations);
     replacingHelper(QLatin1String("../CTelegramConnection.cpp"), 0, QLatin1String("Telegram API methods implementation"), generator.codeConnectionDefinitions);
+    replacingHelper(QLatin1String("../CTelegramConnection.cpp"), 4, QLatin1String("RPC result handlers"), generator.codeRpcResultHandlers);
 
     replacingHelper(QLatin1String("../TLTypesDebug.hpp"), 0, QLatin1String("TLTypes debug operators"), generator.codeDebugWriteDeclarations);
     replacingHelper(QLatin1String("../TLTypesDebug.cpp"), 0, QLatin1String("TLTypes debug operators"), generator.codeDebugWriteDefinitions);
@@ -255,6 +294,22 @@ StatusCode main2(const QStringList &arguments)
 
     StatusCode code = NoError;
 
+    // Store members of the type alternatives out of line (see TLBox)
+    const bool compactTypes = arguments.contains(QLatin1String("--compact-types"));
+    // Back big types by implicitly shared data
+    const bool sharedTypes = arguments.contains(QLatin1String("--shared-types"));
+    // Generate TLView classes over serialized values
+    const bool views = arguments.contains(QLatin1String("--views"));
+    // Generate the schema tables for CTelegramSchemaCodec (not compatible with the compact and shared types)
+    const bool schemaTables = arguments.contains(QLatin1String("--schema-tables"));
+    // Keep the message texts as UTF-8 until the first access (see TLLazyString; not compatible with the schema tables)
+    const bool lazyText = arguments.contains(QLatin1String("--lazy-text"));
+
+    if (schemaTables && (compactTypes || sharedTypes || lazyText)) {
+        printf("The schema tables can not be combined with the compact types, the shared types or the lazy text.\n");
+        return InvalidArgument;
+    }
+
     if (arguments.contains(QLatin1String("--fetch-json"))) {
         code = fetchJson(fileName);
         if (code != NoError) {
@@ -270,14 +325,14 @@ StatusCode main2(const QStringList &arguments)
     }
 
     if (arguments.contains(QLatin1String("--generate-from-json"))) {
-        code = generate(JsonFormat, fileName);
+        code = generate(JsonFormat, fileName, compactTypes, sharedTypes, views, schemaTables, lazyText);
         if (code != NoError) {
             return code;
         }
     }
 
     if (arguments.contains(QLatin1String("--generate-from-text"))) {
-        code = generate(TextFormat, fileName);
+        code = generate(TextFormat, fileName, compactTypes, sharedTypes, views, schemaTables, lazyText);
         if (code != NoError) {
             return code;
         }
@@ -20,25 +20,33 @@ DEFINES += TELEGRAMQT_LIBRARY
 SOURCES = CTelegramCore.cpp \
     CAppInformation.cpp \
     CTelegramDispatcher.cpp \
+    CUserDirectory.cpp \
     CRawStream.cpp \
     CTelegramStream.cpp \
+    CTelegramStringPool.cpp \
     Utils.cpp \
+    CGZipInflater.cpp \
     TelegramUtils.cpp \
     CTcpTransport.cpp \
     TelegramNamespace.cpp \
     CTelegramConnection.cpp \
-    TLValues.cpp
+    TLValues.cpp \
+    TLViews.cpp
 
 HEADERS = CTelegramCore.hpp \
     CAppInformation.hpp \
     CTelegramDispatcher.hpp \
+    CUserDirectory.hpp \
     CTelegramStream.hpp \
+    CTelegramStringPool.hpp \
     CRawStream.hpp \
     Utils.hpp \
+    CGZipInflater.hpp \
     TelegramUtils.hpp \
     CTelegramTransport.hpp \
     CTcpTransport.hpp \
     TLTypes.hpp \
+    TLViews.hpp \
     TLNumbers.hpp \
     crypto-aes.hpp \
     crypto-rsa.hpp \
@@ -54,6 +62,12 @@ contains(options, developer-build) {
     DEFINES += DEVELOPER_BUILD
 }
 
+contains(options, schema-codec) {
+    SOURCES += CTelegramSchemaCodec.cpp
+    HEADERS += CTelegramSchemaCodec.hpp
+    DEFINES += TELEGRAMQT_SCHEMA_CODEC
+}
+
 OTHER_FILES += CMakeLists.txt
 
 LIBS += -lssl -lcrypto
@@ -1,4 +1,5 @@
 TEMPLATE = subdirs
 SUBDIRS += tst_CTelegramConnection
 SUBDIRS += tst_CTelegramStream
+SUBDIRS += tst_CGZipInflater
 #SUBDIRS += tst_CTelegramDispatcher
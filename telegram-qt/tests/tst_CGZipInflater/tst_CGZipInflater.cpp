@@ -0,0 +1,245 @@
+/*
+   Copyright (C) 2015 Alexandr Akulich <akulichalexander@gmail.com>
+
+   This file is a part of TelegramQt library.
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+ */
+
+#include <QObject>
+
+#include "CGZipInflater.hpp"
+#include "CTelegramStream.hpp"
+
+#include <QTest>
+#include <QDebug>
+
+#include <zlib.h>
+
+static QByteArray packGZip(const QByteArray &data)
+{
+    QByteArray result;
+    result.resize(compressBound(data.size()) + 32); // Plus gzip header and trailer
+
+    z_stream stream;
+    stream.zalloc = Z_NULL;
+    stream.zfree = Z_NULL;
+    stream.opaque = Z_NULL;
+
+    deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY); // gzip encoding
+
+    stream.avail_in = data.size();
+    stream.next_in = (Bytef*)(data.constData());
+    stream.avail_out = result.size();
+    stream.next_out = (Bytef*)(result.data());
+
+    deflate(&stream, Z_FINISH);
+    result.resize(stream.total_out);
+
+    deflateEnd(&stream);
+
+    return result;
+}
+
+// Something similar to messages.dialogs: a lot of small numbers and short strings.
+static QByteArray generatePayload(int messagesCount)
+{
+    QByteArray output;
+    CTelegramStream stream(&output, /* write */ true);
+
+    stream << TLValue::Vector;
+    stream << quint32(messagesCount);
+
+    for (int i = 0; i < messagesCount; ++i) {
+        stream << TLValue::Message;
+        stream << quint32(i);
+        stream << quint32(1000 + i % 50);
+        stream << quint32(1395335796 + i * 7);
+        stream << QString(QLatin1String("Message text number %1 from the dialog")).arg(i);
+    }
+
+    return output;
+}
+
+class tst_CGZipInflater : public QObject
+{
+    Q_OBJECT
+public:
+    explicit tst_CGZipInflater(QObject *parent = 0);
+
+private slots:
+    void inflate();
+    void inflaterReuse();
+    void sizeHint();
+    void corruptedInput();
+    void streamingRead();
+    void forgedSizeHint();
+    void benchmarkInflate_data();
+    void benchmarkInflate();
+    void benchmarkStreamingRead_data();
+    void benchmarkStreamingRead();
+
+};
+
+tst_CGZipInflater::tst_CGZipInflater(QObject *parent) :
+    QObject(parent)
+{
+}
+
+void tst_CGZipInflater::inflate()
+{
+    const QByteArray payload = generatePayload(100);
+
+    CGZipInflater inflater;
+    QCOMPARE(inflater.inflate(packGZip(payload)), payload);
+}
+
+void tst_CGZipInflater::inflaterReuse()
+{
+    CGZipInflater inflater;
+
+    for (int i = 1; i < 2000; i *= 3) {
+        const QByteArray payload = generatePayload(i);
+        QCOMPARE(inflater.inflate(packGZip(payload)), payload);
+    }
+}
+
+void tst_CGZipInflater::sizeHint()
+{
+    const QByteArray payload = generatePayload(300);
+
+    QCOMPARE(CGZipInflater::sizeHint(packGZip(payload)), quint32(payload.size()));
+}
+
+void tst_CGZipInflater::corruptedInput()
+{
+    const QByteArray packed = packGZip(generatePayload(100));
+
+    CGZipInflater inflater;
+    QVERIFY(inflater.inflate(packed.left(packed.size() / 2)).isEmpty());
+    QVERIFY(inflater.inflate(QByteArray(packed.size(), char(0x42))).isEmpty());
+
+    // The inflater should be still usable
+    const QByteArray payload = generatePayload(10);
+    QCOMPARE(inflater.inflate(packGZip(payload)), payload);
+}
+
+void tst_CGZipInflater::streamingRead()
+{
+    const int messagesCount = 500;
+
+    CGZipInflater inflater;
+    CGZipInflaterDevice device(&inflater, packGZip(generatePayload(messagesCount)));
+    QVERIFY(device.isOpen());
+
+    CTelegramStream stream(&device);
+
+    TLValue value;
+    quint32 count;
+    stream >> value;
+    stream >> count;
+
+    QCOMPARE(quint32(value), quint32(TLValue::Vector));
+    QCOMPARE(count, quint32(messagesCount));
+
+    for (int i = 0; i < messagesCount; ++i) {
+        quint32 id;
+        quint32 fromId;
+        quint32 date;
+        QString text;
+
+        stream >> value;
+        stream >> id;
+        stream >> fromId;
+        stream >> date;
+        stream >> text;
+
+        QCOMPARE(id, quint32(i));
+        QCOMPARE(text, QString(QLatin1String("Message text number %1 from the dialog")).arg(i));
+    }
+
+    QVERIFY(!stream.error());
+    QVERIFY(device.atEnd());
+}
+
+void tst_CGZipInflater::forgedSizeHint()
+{
+    QByteArray packed = packGZip(generatePayload(10));
+    packed.replace(packed.size() - 4, 4, QByteArray(4, char(0xff)));
+
+    CGZipInflater inflater;
+    CGZipInflaterDevice device(&inflater, packed);
+    QVERIFY(device.isOpen());
+
+    // The trailer is not trusted for the readers preallocations.
+    QVERIFY(device.bytesAvailable() <= 8 * 1024 * 1024);
+
+    CTelegramStream stream(&device);
+    QVERIFY(stream.bytesRemaining() <= 8 * 1024 * 1024);
+}
+
+void tst_CGZipInflater::benchmarkInflate_data()
+{
+    QTest::addColumn<QByteArray>("packed");
+
+    QTest::newRow("small") << packGZip(generatePayload(20));
+    QTest::newRow("dialogs") << packGZip(generatePayload(500));
+    QTest::newRow("difference") << packGZip(generatePayload(20000));
+}
+
+void tst_CGZipInflater::benchmarkInflate()
+{
+    QFETCH(QByteArray, packed);
+
+    CGZipInflater inflater;
+
+    QBENCHMARK {
+        inflater.inflate(packed);
+    }
+}
+
+void tst_CGZipInflater::benchmarkStreamingRead_data()
+{
+    benchmarkInflate_data();
+}
+
+void tst_CGZipInflater::benchmarkStreamingRead()
+{
+    QFETCH(QByteArray, packed);
+
+    CGZipInflater inflater;
+
+    QBENCHMARK {
+        CGZipInflaterDevice device(&inflater, packed);
+        CTelegramStream stream(&device);
+
+        TLValue value;
+        quint32 count;
+        stream >> value;
+        stream >> count;
+
+        for (quint32 i = 0; i < count; ++i) {
+            quint32 number;
+            QString text;
+
+            stream >> value;
+            stream >> number;
+            stream >> number;
+            stream >> number;
+            stream >> text;
+        }
+    }
+}
+
+QTEST_MAIN(tst_CGZipInflater)
+
+#include "tst_CGZipInflater.moc"
@@ -0,0 +1,18 @@
+include(../tests.pri)
+
+TARGET = tst_gzipinflater
+SOURCES = tst_CGZipInflater.cpp \
+    ../../CGZipInflater.cpp \
+    ../../CTelegramStream.cpp \
+    ../../CTelegramStringPool.cpp \
+    ../../CRawStream.cpp \
+    ../../TLValues.cpp
+
+HEADERS = \
+    ../../CGZipInflater.hpp \
+    ../../CTelegramStream.hpp \
+    ../../CTelegramStringPool.hpp \
+    ../../CRawStream.hpp \
+    ../../TLValues.hpp
+
+LIBS += -lz
@@ -66,3 +66,8 @@ quint64 CTestConnection::testNewMessageId()
 {
     return newMessageId();
 }
+
+void CTestConnection::testAddClockSample(quint64 serverMessageId, qint64 requestTime, qint64 responseTime)
+{
+    addClockSample(serverMessageId, requestTime, responseTime);
+}
@@ -38,6 +38,10 @@ public:
 
     SAesKey testGenerateClientToServerAesKey(const QByteArray &messageKey) const;
     quint64 testNewMessageId();
+    void testAddClockSample(quint64 serverMessageId, qint64 requestTime, qint64 responseTime);
+    static bool testIsWorthToPack(const QByteArray &buffer) { return isWorthToPack(buffer); }
+    static bool testHasRpcResultHandler(TLValue request) { return rpcResultHandler(request) != 0; }
+    static bool testHaveSameRpcResultHandler(TLValue request1, TLValue request2) { return rpcResultHandler(request1) == rpcResultHandler(request2); }
 
 };
 
@@ -19,6 +19,8 @@
 
 #include "CTestConnection.hpp"
 #include "CTelegramTransport.hpp"
+#include "CTelegramStream.hpp"
+#include "Utils.hpp"
 
 #include <QTest>
 #include <QDebug>
@@ -36,6 +38,9 @@ private slots:
     void testNewMessageId();
     void testClientTimestampNeverOdd();
     void testTimestampConversion();
+    void testClockOffsetEstimation();
+    void testPackingDecision();
+    void testRpcResultHandlers();
     void testPQAuthRequest();
     void testAuth();
     void testAesKeyGeneration();
@@ -110,6 +115,83 @@ void tst_CTelegramConnection::testTimestampConversion()
     QCOMPARE(CTelegramConnection::timeStampToMSecsSinceEpoch(ts), time);
 }
 
+void tst_CTelegramConnection::testClockOffsetEstimation()
+{
+    CTestConnection connection;
+
+    const qint64 time = 1395335796000;
+
+    // Server clock is 5 sec ahead, round trip is 200 ms
+    connection.testAddClockSample(CTelegramConnection::formatTimeStamp(time + 100 + 5000), time, time + 200);
+    QCOMPARE(connection.clockOffset(), qint64(5000));
+    QCOMPARE(connection.deltaTime(), qint32(5));
+
+    // Sample with longer round trip is less precise and should be ignored
+    connection.testAddClockSample(CTelegramConnection::formatTimeStamp(time + 500 + 7000), time, time + 1000);
+    QCOMPARE(connection.clockOffset(), qint64(5000));
+
+    // Sample with shorter round trip should be preferred
+    connection.testAddClockSample(CTelegramConnection::formatTimeStamp(time + 50 - 2400), time, time + 100);
+    QCOMPARE(connection.clockOffset(), qint64(-2400));
+    QCOMPARE(connection.deltaTime(), qint32(-2));
+
+    // Message ids should follow the server time
+    const quint64 messageTime = CTelegramConnection::timeStampToMSecsSinceEpoch(connection.testNewMessageId());
+    const qint64 expectedTime = QDateTime::currentMSecsSinceEpoch() - 2400;
+    QVERIFY(qAbs(qint64(messageTime) - expectedTime) < 1000);
+}
+
+void tst_CTelegramConnection::testPackingDecision()
+{
+    QByteArray contacts;
+    CTelegramStream contactsStream(&contacts, /* write */ true);
+    contactsStream << TLValue::ContactsImportContacts;
+    for (int i = 0; i < 100; ++i) {
+        contactsStream << QString(QLatin1String("+7900%1")).arg(i, 7, 10, QLatin1Char('0'));
+    }
+
+    QVERIFY(CTestConnection::testIsWorthToPack(contacts));
+    QVERIFY(!CTestConnection::testIsWorthToPack(contacts.left(200)));
+
+    QByteArray randomData(2048, char(0));
+    Utils::randomBytes(&randomData);
+
+    QByteArray messageWithRandom;
+    CTelegramStream messageStream(&messageWithRandom, /* write */ true);
+    messageStream << TLValue::MessagesSendMessage;
+    messageStream << randomData;
+
+    QVERIFY(!CTestConnection::testIsWorthToPack(messageWithRandom));
+
+    QByteArray filePart;
+    CTelegramStream filePartStream(&filePart, /* write */ true);
+    filePartStream << TLValue::UploadSaveFilePart;
+    filePartStream << quint64(1);
+    filePartStream << quint32(0);
+    filePartStream << QByteArray(2048, char(0));
+
+    QVERIFY(!CTestConnection::testIsWorthToPack(filePart));
+}
+
+void tst_CTelegramConnection::testRpcResultHandlers()
+{
+    // Hand-written handlers
+    QVERIFY(CTestConnection::testHasRpcResultHandler(TLValue(TLValue::UsersGetUsers)));
+    QVERIFY(CTestConnection::testHasRpcResultHandler(TLValue(TLValue::HelpGetConfig)));
+    QVERIFY(CTestConnection::testHaveSameRpcResultHandler(TLValue(TLValue::UploadSaveFilePart), TLValue(TLValue::UploadSaveBigFilePart)));
+    QVERIFY(!CTestConnection::testHaveSameRpcResultHandler(TLValue(TLValue::UploadSaveFilePart), TLValue(TLValue::UploadGetFile)));
+
+    // Handlers by the result type
+    QVERIFY(CTestConnection::testHaveSameRpcResultHandler(TLValue(TLValue::AuthSignIn), TLValue(TLValue::AuthSignUp)));
+    QVERIFY(CTestConnection::testHaveSameRpcResultHandler(TLValue(TLValue::MessagesForwardMessages), TLValue(TLValue::MessagesCreateChat)));
+    QVERIFY(CTestConnection::testHasRpcResultHandler(TLValue(TLValue::MessagesGetMessages)));
+
+    // Methods with a generic result and not API requests
+    QVERIFY(!CTestConnection::testHasRpcResultHandler(TLValue(TLValue::InvokeWithLayer)));
+    QVERIFY(!CTestConnection::testHasRpcResultHandler(TLValue(TLValue::Ping)));
+    QVERIFY(!CTestConnection::testHasRpcResultHandler(TLValue(TLValue::UserEmpty)));
+}
+
 void tst_CTelegramConnection::testPQAuthRequest()
 {
     CTestConnection connection;
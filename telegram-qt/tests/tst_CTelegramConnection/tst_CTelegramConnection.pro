@@ -3,21 +3,25 @@ include(../tests.pri)
 TARGET = tst_telegramconnection
 SOURCES = tst_CTelegramConnection.cpp \
     ../../Utils.cpp \
+    ../../CGZipInflater.cpp \
     ../../TelegramUtils.cpp \
     ../../CTcpTransport.cpp \
     ../../CTelegramConnection.cpp \
     ../../CTelegramStream.cpp \
+    ../../CTelegramStringPool.cpp \
     ../../CRawStream.cpp \
     ../../TLValues.cpp \
     CTestConnection.cpp
 
 HEADERS += \
     ../../Utils.hpp \
+    ../../CGZipInflater.hpp \
     ../../TelegramUtils.hpp \
     ../../CTelegramConnection.hpp \
     ../../CTelegramTransport.hpp \
     ../../CTcpTransport.hpp \
     ../../CTelegramStream.hpp \
+    ../../CTelegramStringPool.hpp \
     ../../CRawStream.hpp \
     ../../TLValues.hpp \
     CTestConnection.hpp
@@ -30,6 +30,20 @@ public:
     void testSetDcConfiguration(const QVector<TLDcOption> newDcConfiguration);
     QVector<TLDcOption> testGetDcConfiguration() const { return m_dcConfiguration; }
 
+    void testAddUsers(const QVector<TLUser> &users) { onUsersReceived(users); }
+    const SUserRecord *testGetUser(quint32 id) const { return m_users.user(id); }
+    int testStringPoolCount() const { return m_stringPool.count(); }
+    int testStringPoolCapacity() const { return m_stringPool.capacity(); }
+
+    void testProcessMessage(const TLMessage &message) { processMessageReceived(message); }
+    TLVector<quint32> testPendingUserIds() const { return m_pendingUserIds; }
+    TLVector<quint32> testPendingChatIds() const { return m_pendingChatIds; }
+    int testDelayedMessagesCount() const { return m_delayedMessages.count(); }
+    void testFlushDelayedMessages() { flushDelayedMessages(); }
+    void testFullChatReceived(const TLChatFull &chat, const QVector<TLChat> &chats, const QVector<TLUser> &users) { whenMessagesFullChatReceived(chat, chats, users); }
+    CTelegramStreamVisitor *testUpdatesDifferenceVisitor() const { return m_updatesDifferenceVisitor; }
+    void testDeliverResolvedMessages() { deliverResolvedMessages(); }
+
 };
 
 #endif // CTESTDISPATCHER_HPP
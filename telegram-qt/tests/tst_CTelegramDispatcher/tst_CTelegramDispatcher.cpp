@@ -18,8 +18,12 @@
 #include <QObject>
 
 #include "CTestDispatcher.hpp"
+#include "CUserDirectory.hpp"
+#include "CTelegramStream.hpp"
 
 #include <QBuffer>
+#include <QSet>
+#include <QSignalSpy>
 #include <QTest>
 #include <QDebug>
 
@@ -31,6 +35,14 @@ public:
 
 private slots:
     void testUpdateDcOptions();
+    void testUsersStringsSharing();
+    void testUnknownPeersBatching();
+    void testDelayedMessagesOrder();
+    void testUpdatesDifferenceVisitor();
+    void testMediaMessagesCache();
+    void testUserDirectory();
+    void testUserDirectoryBenchmark_data();
+    void testUserDirectoryBenchmark();
 
 };
 
@@ -88,6 +100,447 @@ void tst_CTelegramDispatcher::testUpdateDcOptions()
     }
 }
 
+template <typename T>
+static int stringsMemory(const QVector<const T *> &users)
+{
+    QSet<const QChar *> counted;
+    int size = 0;
+
+    foreach (const T *user, users) {
+        const QString strings[] = { user->firstName, user->lastName, user->username };
+
+        for (int i = 0; i < 3; ++i) {
+            if (strings[i].isEmpty() || counted.contains(strings[i].constData())) {
+                continue;
+            }
+
+            counted.insert(strings[i].constData());
+            size += strings[i].size() * sizeof(QChar);
+        }
+    }
+
+    return size;
+}
+
+void tst_CTelegramDispatcher::testUsersStringsSharing()
+{
+    static const int usersCount = 100000;
+
+    QVector<TLUser> users(usersCount);
+    QVector<const TLUser *> receivedUsers;
+
+    for (int i = 0; i < usersCount; ++i) {
+        TLUser &user = users[i];
+        user.tlType = TLValue::UserContact;
+        user.id = i + 1;
+        // Each string has its own storage, as it would have after the decoding.
+        user.firstName = QLatin1String("First") + QString::number(i % 100);
+        user.lastName = QLatin1String("Last") + QString::number(i);
+
+        if (i % 10 == 0) {
+            user.username = QLatin1String("user") + QString::number(i);
+        }
+
+        receivedUsers.append(&user);
+    }
+
+    CTestDispatcher dispatcher;
+
+    QBENCHMARK_ONCE {
+        dispatcher.testAddUsers(users);
+    }
+
+    QVector<const SUserRecord *> storedUsers;
+    for (int i = 0; i < usersCount; ++i) {
+        const SUserRecord *user = dispatcher.testGetUser(i + 1);
+        QVERIFY(user);
+        QCOMPARE(user->firstName, users.at(i).firstName);
+        QCOMPARE(user->lastName, users.at(i).lastName);
+        QCOMPARE(user->username, users.at(i).username);
+        storedUsers.append(user);
+    }
+
+    // The last names and the user names are unique, so they are not interned.
+    QCOMPARE(dispatcher.testStringPoolCount(), 100);
+    QVERIFY(storedUsers.at(0)->firstName.constData() == storedUsers.at(100)->firstName.constData());
+
+    const int receivedMemory = stringsMemory(receivedUsers);
+    const int storedMemory = stringsMemory(storedUsers);
+    // Approximate memory of the pool set (buckets and nodes), which is the price of the sharing.
+    const int poolOverhead = dispatcher.testStringPoolCapacity() * sizeof(void *)
+            + dispatcher.testStringPoolCount() * (2 * sizeof(void *) + sizeof(QString));
+
+    qDebug() << "Strings memory per user:" << double(receivedMemory) / usersCount << "bytes received,"
+             << double(storedMemory) / usersCount << "bytes stored," << double(poolOverhead) / usersCount << "bytes of the pool";
+
+    QVERIFY((storedMemory + poolOverhead) * 3 < receivedMemory * 2);
+}
+
+static TLUser constructUser(quint32 id)
+{
+    TLUser user;
+    user.tlType = TLValue::UserForeign;
+    user.id = id;
+    user.accessHash = quint64(id) << 32 | 0x1234;
+    user.firstName = QLatin1String("First");
+    user.photo.tlType = TLValue::UserProfilePhoto;
+    user.photo.photoSmall.tlType = TLValue::FileLocation;
+    user.photo.photoSmall.dcId = 2;
+    user.photo.photoSmall.volumeId = id;
+    user.photo.photoSmall.localId = 7;
+    user.status.tlType = TLValue::UserStatusOffline;
+    user.status.wasOnline = 1420000000;
+    return user;
+}
+
+static TLMessage constructMessage(quint32 id, quint32 fromId, quint32 chatId = 0)
+{
+    TLMessage message;
+    message.tlType = TLValue::Message;
+    message.id = id;
+    message.fromId = fromId;
+    message.message = QLatin1String("Text");
+
+    if (chatId) {
+        message.toId.tlType = TLValue::PeerChat;
+        message.toId.chatId = chatId;
+    } else {
+        message.toId.tlType = TLValue::PeerUser;
+        message.toId.userId = 1;
+    }
+
+    return message;
+}
+
+void tst_CTelegramDispatcher::testUnknownPeersBatching()
+{
+    qRegisterMetaType<TelegramNamespace::Message>("TelegramNamespace::Message");
+
+    CTestDispatcher dispatcher;
+    QSignalSpy messageSpy(&dispatcher, SIGNAL(messageReceived(TelegramNamespace::Message)));
+
+    dispatcher.testAddUsers(QVector<TLUser>() << constructUser(10));
+
+    dispatcher.testProcessMessage(constructMessage(1, 10));
+    QCOMPARE(messageSpy.count(), 1);
+
+    dispatcher.testProcessMessage(constructMessage(2, 20));
+    dispatcher.testProcessMessage(constructMessage(3, 30));
+    dispatcher.testProcessMessage(constructMessage(4, 20));
+    dispatcher.testProcessMessage(constructMessage(5, 20, 500));
+    dispatcher.testProcessMessage(constructMessage(6, 10, 500));
+
+    // Unknown ids are requested once, the messages wait for their peers.
+    QCOMPARE(messageSpy.count(), 1);
+    QCOMPARE(dispatcher.testDelayedMessagesCount(), 5);
+    QCOMPARE(QVector<quint32>(dispatcher.testPendingUserIds()), QVector<quint32>() << 20 << 30);
+    QCOMPARE(QVector<quint32>(dispatcher.testPendingChatIds()), QVector<quint32>() << 500);
+
+    dispatcher.testAddUsers(QVector<TLUser>() << constructUser(20));
+
+    QCOMPARE(messageSpy.count(), 3);
+    QCOMPARE(messageSpy.at(1).first().value<TelegramNamespace::Message>().id, quint32(2));
+    QCOMPARE(messageSpy.at(2).first().value<TelegramNamespace::Message>().id, quint32(4));
+    QCOMPARE(dispatcher.testDelayedMessagesCount(), 3);
+
+    dispatcher.testAddUsers(QVector<TLUser>() << constructUser(30));
+
+    QCOMPARE(messageSpy.count(), 4);
+    QCOMPARE(messageSpy.at(3).first().value<TelegramNamespace::Message>().id, quint32(3));
+    QCOMPARE(dispatcher.testDelayedMessagesCount(), 2); // Waiting for the chat
+
+    // A message is delivered without its peer only after its own timeout.
+    dispatcher.testFlushDelayedMessages();
+    QCOMPARE(messageSpy.count(), 4);
+    QCOMPARE(dispatcher.testDelayedMessagesCount(), 2);
+
+    // The chat is requested already, so the next message from it does not ask it again.
+    dispatcher.testProcessMessage(constructMessage(7, 10, 500));
+    QCOMPARE(QVector<quint32>(dispatcher.testPendingChatIds()), QVector<quint32>() << 500);
+    QCOMPARE(dispatcher.testDelayedMessagesCount(), 3);
+
+    // An unknown sender of a chat message is resolved through the chat, not as a user.
+    dispatcher.testProcessMessage(constructMessage(8, 40, 500));
+    QCOMPARE(QVector<quint32>(dispatcher.testPendingUserIds()), QVector<quint32>() << 20 << 30);
+    QCOMPARE(dispatcher.testDelayedMessagesCount(), 4);
+
+    TLChat chat;
+    chat.tlType = TLValue::Chat;
+    chat.id = 500;
+    TLChatFull fullChat;
+    fullChat.id = 500;
+    dispatcher.testFullChatReceived(fullChat, QVector<TLChat>() << chat, QVector<TLUser>() << constructUser(40));
+
+    QCOMPARE(messageSpy.count(), 8);
+    QCOMPARE(messageSpy.at(4).first().value<TelegramNamespace::Message>().id, quint32(5));
+    QCOMPARE(messageSpy.at(7).first().value<TelegramNamespace::Message>().id, quint32(8));
+    QCOMPARE(dispatcher.testDelayedMessagesCount(), 0);
+}
+
+void tst_CTelegramDispatcher::testDelayedMessagesOrder()
+{
+    qRegisterMetaType<TelegramNamespace::Message>("TelegramNamespace::Message");
+
+    CTestDispatcher dispatcher;
+    QSignalSpy messageSpy(&dispatcher, SIGNAL(messageReceived(TelegramNamespace::Message)));
+
+    TLChat chat;
+    chat.tlType = TLValue::Chat;
+    chat.id = 600;
+    TLChatFull fullChat;
+    fullChat.id = 600;
+    dispatcher.testFullChatReceived(fullChat, QVector<TLChat>() << chat, QVector<TLUser>() << constructUser(10));
+
+    // The message of the known sender waits for the earlier message of the same chat.
+    dispatcher.testProcessMessage(constructMessage(1, 70, 600));
+    dispatcher.testProcessMessage(constructMessage(2, 10, 600));
+    QCOMPARE(messageSpy.count(), 0);
+    QCOMPARE(dispatcher.testDelayedMessagesCount(), 2);
+
+    // The other dialogs are not blocked.
+    dispatcher.testProcessMessage(constructMessage(3, 10));
+    QCOMPARE(messageSpy.count(), 1);
+
+    dispatcher.testFullChatReceived(fullChat, QVector<TLChat>() << chat, QVector<TLUser>() << constructUser(70));
+
+    QCOMPARE(messageSpy.count(), 3);
+    QCOMPARE(messageSpy.at(1).first().value<TelegramNamespace::Message>().id, quint32(1));
+    QCOMPARE(messageSpy.at(2).first().value<TelegramNamespace::Message>().id, quint32(2));
+    QCOMPARE(dispatcher.testDelayedMessagesCount(), 0);
+}
+
+void tst_CTelegramDispatcher::testUpdatesDifferenceVisitor()
+{
+    qRegisterMetaType<TelegramNamespace::Message>("TelegramNamespace::Message");
+
+    CTestDispatcher dispatcher;
+    QSignalSpy messageSpy(&dispatcher, SIGNAL(messageReceived(TelegramNamespace::Message)));
+
+    TLUpdatesDifference difference;
+    difference.tlType = TLValue::UpdatesDifference;
+    difference.newMessages << constructMessage(1, 10) << constructMessage(2, 20) << constructMessage(3, 10);
+    difference.users << constructUser(10) << constructUser(20);
+    difference.state.tlType = TLValue::UpdatesState;
+
+    QBuffer device;
+    device.open(QBuffer::ReadWrite);
+    CTelegramStream outputStream(&device);
+    outputStream << difference;
+
+    device.seek(0);
+    CTelegramStream inputStream(&device);
+    inputStream.setVisitor(dispatcher.testUpdatesDifferenceVisitor());
+
+    TLUpdatesDifference result;
+    inputStream >> result;
+
+    // The items are consumed by the dispatcher instead of the decoded difference.
+    QVERIFY(!inputStream.error());
+    QVERIFY(result.newMessages.isEmpty());
+    QVERIFY(result.users.isEmpty());
+    QVERIFY(dispatcher.testGetUser(10));
+    QVERIFY(dispatcher.testGetUser(20));
+
+    // The messages are decoded before their users, so they wait for the end of the difference.
+    QCOMPARE(messageSpy.count(), 0);
+    QCOMPARE(dispatcher.testDelayedMessagesCount(), 3);
+
+    dispatcher.testDeliverResolvedMessages();
+
+    QCOMPARE(messageSpy.count(), 3);
+    QCOMPARE(messageSpy.at(0).first().value<TelegramNamespace::Message>().id, quint32(1));
+    QCOMPARE(messageSpy.at(2).first().value<TelegramNamespace::Message>().id, quint32(3));
+    QCOMPARE(dispatcher.testDelayedMessagesCount(), 0);
+}
+
+void tst_CTelegramDispatcher::testMediaMessagesCache()
+{
+    CTestDispatcher dispatcher;
+    dispatcher.setAcceptableMessageTypes(TelegramNamespace::MessageTypeText|TelegramNamespace::MessageTypePhoto);
+
+    TLPhotoSize cachedSize;
+    cachedSize.tlType = TLValue::PhotoCachedSize;
+    cachedSize.bytes = QByteArray(1024, 'x');
+
+    TLPhotoSize size;
+    size.tlType = TLValue::PhotoSize;
+    size.location.tlType = TLValue::FileLocation;
+    size.size = 50000;
+
+    TLMessage message = constructMessage(1, 10);
+    message.media.tlType = TLValue::MessageMediaPhoto;
+    message.media.photo.tlType = TLValue::Photo;
+    message.media.photo.sizes << cachedSize << size;
+
+    SMediaMessageRecord record;
+    record.setMessage(message);
+    QCOMPARE(record.message.id(), quint32(1));
+    QCOMPARE(record.message.media().photo.sizes.count(), 1);
+    QCOMPARE(record.message.media().photo.sizes.first().size, quint32(50000));
+
+    // The record keeps only the wire form of the trimmed message.
+    QVERIFY(record.cost() < CTelegramStream::serializedSize(message));
+
+    // The download does not depend on the cached record.
+    const FileRequestDescriptor descriptor = FileRequestDescriptor::messageMediaDataRequest(&record);
+    QCOMPARE(descriptor.size(), quint32(50000));
+    QCOMPARE(descriptor.messageType(), TelegramNamespace::MessageTypePhoto);
+    QCOMPARE(descriptor.peer().type, TelegramNamespace::Peer::User);
+    QCOMPARE(descriptor.peer().id, quint32(10));
+
+    // All the records have the same cost, so the cache holds exactly ten of them.
+    dispatcher.setMediaMessagesCacheSize(record.cost() * 10);
+
+    for (quint32 id = 1; id <= 20; ++id) {
+        message.id = id;
+        dispatcher.testProcessMessage(message);
+    }
+
+    TelegramNamespace::MessageMediaInfo info;
+    QVERIFY(!dispatcher.getMessageMediaInfo(&info, 10));
+    QVERIFY(dispatcher.getMessageMediaInfo(&info, 11));
+    QCOMPARE(info.size(), quint32(50000));
+
+    // The message 11 is used recently, so the message 12 is evicted instead.
+    message.id = 21;
+    dispatcher.testProcessMessage(message);
+
+    QVERIFY(dispatcher.getMessageMediaInfo(&info, 11));
+    QVERIFY(!dispatcher.getMessageMediaInfo(&info, 12));
+    QVERIFY(dispatcher.getMessageMediaInfo(&info, 21));
+}
+
+void tst_CTelegramDispatcher::testUserDirectory()
+{
+    CUserDirectory directory;
+    QVERIFY(!directory.contains(1));
+    QVERIFY(!directory.user(1));
+
+    // The ids with the same low bits are likely to collide in a small index.
+    static const int usersCount = 1000;
+    for (int i = 0; i < usersCount; ++i) {
+        bool isNew = false;
+        const SUserRecord *record = directory.insert(constructUser(i * 1024 + 1), &isNew);
+        QVERIFY(isNew);
+        QCOMPARE(record->id, quint32(i * 1024 + 1));
+    }
+
+    QCOMPARE(directory.count(), usersCount);
+
+    TLUser updatedUser = constructUser(1025);
+    updatedUser.firstName = QLatin1String("Updated");
+
+    bool isNew = true;
+    directory.insert(updatedUser, &isNew);
+    QVERIFY(!isNew);
+    QCOMPARE(directory.count(), usersCount);
+
+    for (int i = 0; i < usersCount; ++i) {
+        const SUserRecord *record = directory.user(i * 1024 + 1);
+        QVERIFY(record);
+        QCOMPARE(record->accessHash, constructUser(i * 1024 + 1).accessHash);
+    }
+
+    QVERIFY(!directory.contains(2));
+    QCOMPARE(directory.user(1025)->firstName, QString(QLatin1String("Updated")));
+
+    const TLUser user = directory.user(1)->toUser();
+    QCOMPARE(user.id, quint32(1));
+    QCOMPARE(quint32(user.tlType), quint32(TLValue::UserForeign));
+    QCOMPARE(quint32(user.photo.tlType), quint32(TLValue::UserProfilePhoto));
+    QCOMPARE(user.photo.photoSmall.volumeId, quint64(1));
+    QCOMPARE(user.status.wasOnline, quint32(1420000000));
+
+    directory.clear();
+    QCOMPARE(directory.count(), 0);
+    QVERIFY(!directory.contains(1));
+}
+
+void tst_CTelegramDispatcher::testUserDirectoryBenchmark_data()
+{
+    QTest::addColumn<bool>("map");
+    QTest::addColumn<int>("operation");
+
+    // The map of separately allocated users is the previous storage of the dispatcher.
+    QTest::newRow("directory insert") << false << 0;
+    QTest::newRow("directory update") << false << 1;
+    QTest::newRow("directory lookup") << false << 2;
+    QTest::newRow("map insert") << true << 0;
+    QTest::newRow("map update") << true << 1;
+    QTest::newRow("map lookup") << true << 2;
+}
+
+void tst_CTelegramDispatcher::testUserDirectoryBenchmark()
+{
+    QFETCH(bool, map);
+    QFETCH(int, operation);
+
+    static const int usersCount = 200000;
+
+    QVector<TLUser> users;
+    users.reserve(usersCount);
+    for (int i = 0; i < usersCount; ++i) {
+        users.append(constructUser(i * 7 + 100000));
+    }
+
+    CUserDirectory directory;
+    QMap<quint32, TLUser*> usersMap;
+
+    if (operation != 0) {
+        foreach (const TLUser &user, users) {
+            directory.insert(user);
+            usersMap.insert(user.id, new TLUser(user));
+        }
+    }
+
+    quint64 found = 0;
+
+    QBENCHMARK {
+        switch (operation) {
+        case 0:
+            if (map) {
+                qDeleteAll(usersMap);
+                usersMap.clear();
+                foreach (const TLUser &user, users) {
+                    usersMap.insert(user.id, new TLUser(user));
+                }
+            } else {
+                directory.clear();
+                foreach (const TLUser &user, users) {
+                    directory.insert(user);
+                }
+            }
+            break;
+        case 1:
+            foreach (const TLUser &user, users) {
+                if (map) {
+                    *usersMap.value(user.id) = user;
+                } else {
+                    directory.insert(user);
+                }
+            }
+            break;
+        default:
+            for (int i = 0; i < usersCount; ++i) {
+                // Every second id is unknown
+                const quint32 id = users.at(i).id + (i & 1);
+                if (map) {
+                    found += usersMap.contains(id);
+                } else {
+                    found += directory.contains(id);
+                }
+            }
+            break;
+        }
+    }
+
+    if (operation == 2) {
+        QVERIFY(found > 0);
+    }
+
+    qDeleteAll(usersMap);
+}
+
 QTEST_MAIN(tst_CTelegramDispatcher)
 
 #include "tst_CTelegramDispatcher.moc"
@@ -4,24 +4,32 @@ TARGET = tst_telegramdispatcher
 SOURCES = tst_CTelegramDispatcher.cpp \
     CTestDispatcher.cpp \
     ../../Utils.cpp \
+    ../../CGZipInflater.cpp \
     ../../TelegramUtils.cpp \
     ../../CTcpTransport.cpp \
     ../../CTelegramConnection.cpp \
     ../../CTelegramStream.cpp \
+    ../../CTelegramStringPool.cpp \
     ../../CTelegramDispatcher.cpp \
+    ../../CUserDirectory.cpp \
     ../../CRawStream.cpp \
-    ../../TLValues.cpp
+    ../../TLValues.cpp \
+    ../../TLViews.cpp
 
 HEADERS += \
     CTestDispatcher.hpp \
     ../../Utils.hpp \
+    ../../CGZipInflater.hpp \
     ../../TelegramUtils.hpp \
     ../../CTelegramConnection.hpp \
     ../../CTelegramTransport.hpp \
     ../../CTcpTransport.hpp \
     ../../CTelegramStream.hpp \
+    ../../CTelegramStringPool.hpp \
     ../../CTelegramDispatcher.hpp \
+    ../../CUserDirectory.hpp \
     ../../CRawStream.hpp \
-    ../../TLValues.hpp
+    ../../TLValues.hpp \
+    ../../TLViews.hpp
 
 LIBS += -lz
@@ -18,6 +18,8 @@
 #include <QObject>
 
 #include "CTelegramStream.hpp"
+#include "CTelegramSchemaCodec.hpp"
+#include "TLViews.hpp"
 
 #include <QBuffer>
 #include <QTest>
@@ -45,9 +47,48 @@ private slots:
     void tlNumbersSerialization();
     void tlDcOptionDeserialization();
     void readError();
+    void spanAndDeviceReadsMatch();
+    void sharedBytesDeserialization();
+    void decodeThroughput_data();
+    void decodeThroughput();
+    void vectorDecodeReservation();
+    void vectorDecodeBenchmark();
+    void boxedValueSerialization();
+    void compactTypesSize();
+    void serializedSize();
+    void skipAndPeek();
+    void visitorDecoding();
+    void messageView();
+    void schemaCodecSerialization();
+    void schemaCodecDecodeBenchmark_data();
+    void schemaCodecDecodeBenchmark();
+    void schemaCodecSize();
+    void tlValueNames();
+    void messageRoundTrip();
+    void stringPoolDecoding();
+    void lazyStringDecoding();
 
 };
 
+static QByteArray generateDcOptionsPayload(int count)
+{
+    TLVector<TLDcOption> options;
+    for (int i = 0; i < count; ++i) {
+        TLDcOption option;
+        option.id = i % 5 + 1;
+        option.hostname = QLatin1String("localhost");
+        option.ipAddress = QString(QLatin1String("149.154.167.%1")).arg(i % 255);
+        option.port = 443;
+        options.append(option);
+    }
+
+    QByteArray data;
+    CTelegramStream stream(&data, /* write */ true);
+    stream << options;
+
+    return data;
+}
+
 tst_CTelegramStream::tst_CTelegramStream(QObject *parent) :
     QObject(parent)
 {
@@ -461,6 +502,789 @@ void tst_CTelegramStream::readError()
 
 }
 
+void tst_CTelegramStream::spanAndDeviceReadsMatch()
+{
+    const QByteArray data = generateDcOptionsPayload(16);
+
+    CTelegramStream spanStream(data);
+    QCOMPARE(spanStream.device(), static_cast<QIODevice*>(0));
+    QCOMPARE(spanStream.bytesRemaining(), data.size());
+
+    QBuffer device;
+    device.setData(data);
+    device.open(QBuffer::ReadOnly);
+    CTelegramStream deviceStream(&device);
+
+    TLVector<TLDcOption> spanOptions;
+    TLVector<TLDcOption> deviceOptions;
+
+    spanStream >> spanOptions;
+    deviceStream >> deviceOptions;
+
+    QVERIFY(!spanStream.error());
+    QVERIFY(!deviceStream.error());
+    QVERIFY(spanStream.atEnd());
+    QVERIFY(deviceStream.atEnd());
+
+    QCOMPARE(spanOptions.size(), 16);
+    QCOMPARE(spanOptions.size(), deviceOptions.size());
+
+    for (int i = 0; i < spanOptions.size(); ++i) {
+        QCOMPARE(spanOptions.at(i).id, deviceOptions.at(i).id);
+        QCOMPARE(spanOptions.at(i).hostname, deviceOptions.at(i).hostname);
+        QCOMPARE(spanOptions.at(i).ipAddress, deviceOptions.at(i).ipAddress);
+        QCOMPARE(spanOptions.at(i).port, deviceOptions.at(i).port);
+    }
+
+    // Span stream is read-only
+    spanStream << quint32(0);
+    QVERIFY(spanStream.error());
+}
+
+void tst_CTelegramStream::sharedBytesDeserialization()
+{
+    QByteArray chunk(1000, Qt::Uninitialized);
+    for (int i = 0; i < chunk.size(); ++i) {
+        chunk[i] = char(i % 251);
+    }
+
+    QByteArray data;
+    {
+        CTelegramStream output(&data, /* write */ true);
+        output << chunk;
+        output << QString(QLatin1String("tail"));
+    }
+
+    const char *begin = data.constData();
+    const char *end = begin + data.size();
+
+    {
+        CTelegramStream stream(data);
+        QVERIFY(!stream.isSharedBytesEnabled());
+
+        QByteArray result;
+        stream >> result;
+
+        QCOMPARE(result, chunk);
+        QVERIFY2((result.constData() < begin) || (result.constData() >= end), "Bytes are expected to be copied by default.");
+    }
+
+    {
+        CTelegramStream stream(data);
+        stream.setSharedBytesEnabled(true);
+
+        QByteArray result;
+        QString tail;
+        stream >> result;
+        stream >> tail;
+
+        QVERIFY(!stream.error());
+        QVERIFY(stream.atEnd());
+        QCOMPARE(result, chunk);
+        QCOMPARE(tail, QString(QLatin1String("tail")));
+        QVERIFY2((result.constData() >= begin) && (result.constData() < end), "Bytes are expected to be a slice of the stream data.");
+
+        result.detach();
+        QVERIFY((result.constData() < begin) || (result.constData() >= end));
+        QCOMPARE(result, chunk);
+    }
+
+    {
+        // Device mode has no buffer to share, so the data is copied anyway.
+        QBuffer device;
+        device.setData(data);
+        device.open(QBuffer::ReadOnly);
+
+        CTelegramStream stream(&device);
+        stream.setSharedBytesEnabled(true);
+
+        QByteArray result;
+        stream >> result;
+
+        QVERIFY(!stream.error());
+        QCOMPARE(result, chunk);
+    }
+}
+
+void tst_CTelegramStream::decodeThroughput_data()
+{
+    QTest::addColumn<bool>("useDevice");
+
+    QTest::newRow("span") << false;
+    QTest::newRow("device") << true;
+}
+
+void tst_CTelegramStream::decodeThroughput()
+{
+    QFETCH(bool, useDevice);
+
+    const QByteArray data = generateDcOptionsPayload(1000);
+
+    TLVector<TLDcOption> options;
+
+    QBENCHMARK {
+        if (useDevice) {
+            QBuffer device;
+            device.setData(data);
+            device.open(QBuffer::ReadOnly);
+            CTelegramStream stream(&device);
+            stream >> options;
+        } else {
+            CTelegramStream stream(data);
+            stream >> options;
+        }
+    }
+
+    QCOMPARE(options.size(), 1000);
+}
+
+void tst_CTelegramStream::vectorDecodeReservation()
+{
+    const QByteArray data = generateDcOptionsPayload(1000);
+
+    CTelegramStream stream(data);
+    TLVector<TLDcOption> options;
+    options.append(TLDcOption());
+    options.tlType = TLValue::GzipPacked;
+
+    stream >> options;
+
+    QVERIFY(!stream.error());
+    QCOMPARE(quint32(options.tlType), quint32(TLValue::Vector));
+    QCOMPARE(options.size(), 1000);
+    // The vector is reserved from the wire length, so no reallocations happened on append.
+    QCOMPARE(options.capacity(), options.size());
+
+    // Broken length should neither lead to a huge allocation nor to a long loop.
+    QByteArray brokenData;
+    {
+        CTelegramStream output(&brokenData, /* write */ true);
+        output << TLValue(TLValue::Vector);
+        output << quint32(0x7fffffff);
+        output << quint32(1);
+    }
+
+    CTelegramStream brokenStream(brokenData);
+    TLVector<quint32> values;
+    brokenStream >> values;
+
+    QVERIFY(brokenStream.error());
+    QVERIFY(values.size() <= 2);
+    QVERIFY(values.capacity() < 100);
+}
+
+void tst_CTelegramStream::vectorDecodeBenchmark()
+{
+    TLVector<quint32> values;
+    for (int i = 0; i < 100000; ++i) {
+        values.append(i);
+    }
+
+    QByteArray data;
+    {
+        CTelegramStream output(&data, /* write */ true);
+        output << values;
+    }
+
+    TLVector<quint32> result;
+
+    QBENCHMARK {
+        CTelegramStream stream(data);
+        stream >> result;
+    }
+
+    QCOMPARE(result, values);
+}
+
+void tst_CTelegramStream::boxedValueSerialization()
+{
+    TLBox<TLDcOption> box;
+    QVERIFY(box.isNull());
+    QCOMPARE(box.value().port, quint32(0));
+    QCOMPARE(quint32(box.value().tlType), quint32(TLValue::DcOption));
+    QVERIFY2(box.isNull(), "Read access should not allocate the value.");
+
+    TLDcOption option;
+    option.id = 2;
+    option.hostname = QLatin1String("localhost");
+    option.ipAddress = QLatin1String("149.154.167.50");
+    option.port = 443;
+
+    box = option;
+    QVERIFY(!box.isNull());
+
+    const TLBox<TLDcOption> copy = box;
+    QCOMPARE(&copy.value(), &box.value());
+
+    box->port = 80;
+    QCOMPARE(copy->port, quint32(443));
+    QCOMPARE(box->port, quint32(80));
+
+    QByteArray data;
+    {
+        CTelegramStream output(&data, /* write */ true);
+        output << copy;
+    }
+
+    QByteArray plainData;
+    {
+        CTelegramStream output(&plainData, /* write */ true);
+        output << option;
+    }
+
+    QCOMPARE(data, plainData);
+
+    CTelegramStream input(data);
+    input >> box;
+
+    QVERIFY(!input.error());
+    QCOMPARE(box->id, option.id);
+    QCOMPARE(box->hostname, option.hostname);
+    QCOMPARE(box->ipAddress, option.ipAddress);
+    QCOMPARE(box->port, option.port);
+}
+
+// TLUser and TLMessage as GeneratorNG emits them with --compact-types
+struct TLUserCompact {
+    quint32 id;
+    QString firstName;
+    QString lastName;
+    QString username;
+    QString phone;
+    TLBox<TLUserProfilePhoto> photo;
+    TLBox<TLUserStatus> status;
+    quint64 accessHash;
+    TLValue tlType;
+};
+
+struct TLMessageCompact {
+    quint32 id;
+    quint32 flags;
+    quint32 fromId;
+    TLBox<TLPeer> toId;
+    quint32 fwdFromId;
+    quint32 fwdDate;
+    quint32 replyToMsgId;
+    quint32 date;
+    QString message;
+    TLBox<TLMessageMedia> media;
+    TLBox<TLMessageAction> action;
+    TLValue tlType;
+};
+
+// The out of line part of a written box
+template <typename T>
+struct SBoxData : public QSharedData {
+    T value;
+};
+
+void tst_CTelegramStream::compactTypesSize()
+{
+    // A box is a pointer, as well as a string, so boxing the strings would only add an allocation to a set string.
+    QCOMPARE(sizeof(TLBox<QString>), sizeof(QString));
+    QCOMPARE(sizeof(TLBox<QByteArray>), sizeof(QByteArray));
+
+    // A text message writes the peer box only; a user with the photo and the status writes both boxes.
+    const int plainMessageSize = sizeof(TLMessage);
+    const int compactMessageSize = sizeof(TLMessageCompact) + sizeof(SBoxData<TLPeer>);
+    const int plainUserSize = sizeof(TLUser);
+    const int compactUserSize = sizeof(TLUserCompact) + sizeof(SBoxData<TLUserProfilePhoto>) + sizeof(SBoxData<TLUserStatus>);
+
+    qDebug() << "TLMessage:" << plainMessageSize << "bytes plain," << sizeof(TLMessageCompact) << "bytes compact,"
+             << compactMessageSize << "bytes compact text message";
+    qDebug() << "TLUser:" << plainUserSize << "bytes plain," << sizeof(TLUserCompact) << "bytes compact,"
+             << compactUserSize << "bytes compact user with photo and status";
+
+    QVERIFY(compactMessageSize * 4 < plainMessageSize);
+    QVERIFY(sizeof(TLUserCompact) < sizeof(TLUser));
+}
+
+template <typename T>
+static int actualSerializedSize(const T &value)
+{
+    QByteArray data;
+    CTelegramStream output(&data, /* write */ true);
+    output << value;
+    return data.size();
+}
+
+void tst_CTelegramStream::serializedSize()
+{
+    QList<QString> strings;
+    strings << QString()
+            << QLatin1String("abc")
+            << QLatin1String("test1a")
+            << QString::fromUtf8("\xd0\x9f\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82") // Cyrillic
+            << QString::fromUtf8("\xe2\x82\xac \xf0\x9f\x98\x80") // Euro sign and emoji (surrogate pair)
+            << QString(300, QLatin1Char('x'));
+
+    foreach (const QString &str, strings) {
+        QCOMPARE(CTelegramStream::serializedSize(str), actualSerializedSize(str));
+    }
+
+    QList<int> lengths;
+    lengths << 0 << 1 << 2 << 3 << 4 << 252 << 253 << 254 << 255 << 1000;
+
+    foreach (int length, lengths) {
+        const QByteArray data(length, 'a');
+        QCOMPARE(CTelegramStream::serializedSize(data), actualSerializedSize(data));
+    }
+
+    TLVector<quint32> values;
+    values << 1 << 2 << 3;
+    QCOMPARE(CTelegramStream::serializedSize(values), actualSerializedSize(values));
+
+    TLVector<TLDcOption> options;
+    options.resize(3);
+    options[1].hostname = QLatin1String("localhost");
+    QCOMPARE(CTelegramStream::serializedSize(options), actualSerializedSize(options));
+
+    TLInputPeer peer;
+    QCOMPARE(CTelegramStream::serializedSize(peer), actualSerializedSize(peer));
+    peer.tlType = TLValue::InputPeerForeign;
+    QCOMPARE(CTelegramStream::serializedSize(peer), actualSerializedSize(peer));
+
+    TLAccountPasswordInputSettings settings;
+    settings.newSalt = QByteArray(8, 's');
+    settings.hint = QLatin1String("hint");
+    settings.email = QLatin1String("user@example.com");
+    QCOMPARE(CTelegramStream::serializedSize(settings), actualSerializedSize(settings));
+    settings.flags = 1 << 0 | 1 << 1;
+    QCOMPARE(CTelegramStream::serializedSize(settings), actualSerializedSize(settings));
+
+    QCOMPARE(CTelegramStream::serializedSize(TLInputEncryptedChat()), actualSerializedSize(TLInputEncryptedChat()));
+}
+
+void tst_CTelegramStream::skipAndPeek()
+{
+    TLAccountPasswordInputSettings settings;
+    settings.flags = 1 << 1;
+    settings.email = QLatin1String("user@example.com");
+
+    QByteArray data = generateDcOptionsPayload(10);
+    {
+        CTelegramStream output(&data, /* write */ true);
+        output << QString(300, QLatin1Char('x'));
+        output << QByteArray(3, 'b');
+        output << settings;
+        output << quint32(0xdeadbeef);
+    }
+
+    CTelegramStream stream(data);
+
+    TLValue value;
+    QVERIFY(stream.peek(value));
+    QCOMPARE(quint32(value), quint32(TLValue::Vector));
+
+    quint32 count = 0;
+    QVERIFY(stream.peek(count, 4));
+    QCOMPARE(count, quint32(10));
+    QCOMPARE(stream.bytesRemaining(), data.size());
+
+    stream.skip<TLVector<TLDcOption> >();
+    stream.skip<QString>();
+    stream.skip<QByteArray>();
+    stream.skip<TLAccountPasswordInputSettings>();
+
+    QVERIFY(!stream.error());
+    QCOMPARE(stream.bytesRemaining(), 4);
+
+    quint32 tail = 0;
+    QVERIFY(stream.peek(tail));
+    QCOMPARE(tail, quint32(0xdeadbeef));
+    QVERIFY2(!stream.peek(tail, 1), "Peek beyond the end should fail.");
+    QVERIFY2(!stream.error(), "Failed peek should not set an error.");
+
+    stream.skip<quint64>();
+    QVERIFY(stream.error());
+}
+
+class CTestDcOptionVisitor : public CTelegramStreamVisitor
+{
+public:
+    CTestDcOptionVisitor() : visitedCount(0) { }
+
+    bool onDcOption(const TLDcOption &dcOption)
+    {
+        ++visitedCount;
+        if (dcOption.id % 2) {
+            consumedAddresses.append(dcOption.ipAddress);
+            return true;
+        }
+
+        return false;
+    }
+
+    int visitedCount;
+    QStringList consumedAddresses;
+};
+
+void tst_CTelegramStream::visitorDecoding()
+{
+    const QByteArray data = generateDcOptionsPayload(10);
+
+    CTestDcOptionVisitor visitor;
+    CTelegramStream stream(data);
+    stream.setVisitor(&visitor);
+
+    TLVector<TLDcOption> options;
+    stream >> options;
+
+    QVERIFY(!stream.error());
+    QVERIFY(stream.atEnd());
+    QCOMPARE(visitor.visitedCount, 10);
+
+    // Ids are 1, 2, 3, 4, 5, 1, ...; odd ones are consumed by the visitor.
+    QCOMPARE(visitor.consumedAddresses.count(), 6);
+    QCOMPARE(visitor.consumedAddresses.first(), QString(QLatin1String("149.154.167.0")));
+    QCOMPARE(options.count(), 4);
+
+    foreach (const TLDcOption &option, options) {
+        QCOMPARE(option.id % 2, quint32(0));
+    }
+
+    // Vectors of the types without a callback are not affected.
+    TLVector<quint32> values;
+    values << 1 << 2 << 3;
+
+    QByteArray valuesData;
+    {
+        CTelegramStream output(&valuesData, /* write */ true);
+        output << values;
+    }
+
+    CTelegramStream valuesStream(valuesData);
+    valuesStream.setVisitor(&visitor);
+
+    TLVector<quint32> result;
+    valuesStream >> result;
+    QCOMPARE(result, values);
+}
+
+void tst_CTelegramStream::messageView()
+{
+    QByteArray data;
+    {
+        CTelegramStream output(&data, /* write */ true);
+        output << TLValue(TLValue::Message);
+        output << quint32(1 << 3); // flags: replyToMsgId
+        output << quint32(42); // id
+        output << quint32(7); // fromId
+        output << TLValue(TLValue::PeerUser);
+        output << quint32(8); // toId.userId
+        output << quint32(41); // replyToMsgId
+        output << quint32(1420000000); // date
+        output << QString::fromUtf8("Hello, \xd0\x9c\xd0\xb8\xd1\x80!");
+        output << TLValue(TLValue::MessageMediaEmpty);
+        output << quint32(0xdeadbeef);
+    }
+
+    CTelegramStream stream(data);
+    const TLMessageView view(stream.readRawValue<TLMessage>());
+
+    QVERIFY(!stream.error());
+    QCOMPARE(stream.bytesRemaining(), 4);
+    QCOMPARE(view.data().size(), data.size() - 4);
+    QCOMPARE(quint32(view.tlType()), quint32(TLValue::Message));
+
+    QCOMPARE(view.message(), QString::fromUtf8("Hello, \xd0\x9c\xd0\xb8\xd1\x80!"));
+    QCOMPARE(view.id(), quint32(42));
+    QCOMPARE(view.toId().userId, quint32(8));
+    QCOMPARE(view.replyToMsgId(), quint32(41));
+    QCOMPARE(view.fwdFromId(), quint32(0)); // Not present
+    QCOMPARE(quint32(view.media().tlType), quint32(TLValue::MessageMediaEmpty));
+
+    const TLMessage message = view.value();
+    QCOMPARE(message.id, view.id());
+    QCOMPARE(message.date, view.date());
+    QCOMPARE(message.message, view.message());
+
+    const TLUserView emptyView;
+    QVERIFY(emptyView.isNull());
+    QCOMPARE(emptyView.id(), quint32(0));
+}
+
+static TLConfig generateConfig(int dcOptionsCount)
+{
+    TLConfig config;
+    config.date = 1420000000;
+    config.expires = 1420003600;
+    config.testMode = true;
+    config.thisDc = 2;
+    config.chatSizeMax = 200;
+    config.pushChatLimit = 2;
+
+    for (int i = 0; i < dcOptionsCount; ++i) {
+        TLDcOption option;
+        option.id = i % 5 + 1;
+        option.hostname = QLatin1String("localhost");
+        option.ipAddress = QString(QLatin1String("149.154.167.%1")).arg(i % 255);
+        option.port = 443;
+        config.dcOptions.append(option);
+    }
+
+    TLDisabledFeature feature;
+    feature.feature = QLatin1String("chat_create");
+    feature.description = QLatin1String("Disabled for the test");
+    config.disabledFeatures.append(feature);
+
+    return config;
+}
+
+void tst_CTelegramStream::schemaCodecSerialization()
+{
+    const TLConfig config = generateConfig(10);
+
+    QByteArray data;
+    {
+        CTelegramStream output(&data, /* write */ true);
+        QVERIFY(CTelegramSchemaCodec::write(output, config));
+    }
+
+    TLConfig generatedResult;
+    {
+        CTelegramStream stream(data);
+        stream >> generatedResult;
+        QVERIFY(!stream.error());
+        QVERIFY(stream.atEnd());
+    }
+
+    TLConfig codecResult;
+    {
+        CTelegramStream stream(data);
+        QVERIFY(CTelegramSchemaCodec::read(stream, codecResult));
+        QVERIFY(stream.atEnd());
+    }
+
+    foreach (const TLConfig &result, QList<TLConfig>() << generatedResult << codecResult) {
+        QCOMPARE(quint32(result.tlType), quint32(TLValue::Config));
+        QCOMPARE(result.date, config.date);
+        QCOMPARE(result.testMode, config.testMode);
+        QCOMPARE(result.pushChatLimit, config.pushChatLimit);
+        QCOMPARE(result.dcOptions.count(), config.dcOptions.count());
+        QCOMPARE(quint32(result.dcOptions.tlType), quint32(TLValue::Vector));
+        QCOMPARE(result.dcOptions.last().ipAddress, config.dcOptions.last().ipAddress);
+        QCOMPARE(result.dcOptions.last().port, config.dcOptions.last().port);
+        QCOMPARE(result.disabledFeatures.count(), 1);
+        QCOMPARE(result.disabledFeatures.first().description, config.disabledFeatures.first().description);
+    }
+
+    // Optional members
+    TLMessage message;
+    message.tlType = TLValue::Message;
+    message.flags = 1 << 3;
+    message.id = 42;
+    message.fwdFromId = 5; // Not written without the flag
+    message.replyToMsgId = 41;
+    message.message = QLatin1String("Hello");
+
+    QByteArray messageData;
+    {
+        CTelegramStream output(&messageData, /* write */ true);
+        QVERIFY(CTelegramSchemaCodec::write(output, message));
+    }
+
+    TLMessage messageResult;
+    CTelegramStream messageStream(messageData);
+    messageStream >> messageResult;
+
+    QVERIFY(messageStream.atEnd());
+    QCOMPARE(messageResult.id, message.id);
+    QCOMPARE(messageResult.fwdFromId, quint32(0));
+    QCOMPARE(messageResult.replyToMsgId, message.replyToMsgId);
+    QCOMPARE(messageResult.message, message.message);
+
+    // Truncated data
+    CTelegramStream truncatedStream(data.left(data.size() / 2));
+    QVERIFY(!CTelegramSchemaCodec::read(truncatedStream, codecResult));
+}
+
+void tst_CTelegramStream::schemaCodecDecodeBenchmark_data()
+{
+    QTest::addColumn<bool>("useCodec");
+
+    QTest::newRow("generated") << false;
+    QTest::newRow("schema codec") << true;
+}
+
+void tst_CTelegramStream::schemaCodecDecodeBenchmark()
+{
+    QFETCH(bool, useCodec);
+
+    QByteArray data;
+    {
+        CTelegramStream output(&data, /* write */ true);
+        CTelegramSchemaCodec::write(output, generateConfig(1000));
+    }
+
+    TLConfig config;
+
+    QBENCHMARK {
+        CTelegramStream stream(data);
+        if (useCodec) {
+            CTelegramSchemaCodec::read(stream, config);
+        } else {
+            stream >> config;
+        }
+    }
+
+    QCOMPARE(config.dcOptions.count(), 1000);
+}
+
+void tst_CTelegramStream::schemaCodecSize()
+{
+    // The codec replaces the generated operators of CTelegramStream.cpp in the SCHEMA_CODEC build.
+    // Compare the stripped library of the both builds for the whole difference; the tables are the data part of it.
+    const int tablesSize = CTelegramSchemaCodec::tablesSize();
+    qDebug() << "Schema tables size:" << tablesSize << "bytes";
+
+    QVERIFY(tablesSize > 0);
+    QVERIFY(tablesSize < 64 * 1024);
+}
+
+void tst_CTelegramStream::tlValueNames()
+{
+    QCOMPARE(TLValue(TLValue::ResPQ).toString(), QString(QLatin1String("ResPQ")));
+    QCOMPARE(TLValue(TLValue::HttpWait).toString(), QString(QLatin1String("HttpWait")));
+    QCOMPARE(TLValue(TLValue::UsersGetUsers).toString(), QString(QLatin1String("UsersGetUsers")));
+    QCOMPARE(QString(TLValue(TLValue::AccountAuthorizations).name()), QString(QLatin1String("AccountAuthorizations")));
+    QVERIFY(TLValue(TLValue::Vector).isValid());
+
+    const TLValue unknownValue(0x12345678);
+    QVERIFY(!unknownValue.isValid());
+    QVERIFY(!unknownValue.name().latin1());
+    QCOMPARE(unknownValue.toString(), QString(QLatin1String("12345678")));
+}
+
+void tst_CTelegramStream::messageRoundTrip()
+{
+    TLMessage message;
+    message.tlType = TLValue::Message;
+    message.flags = 1 << 2 | 1 << 3; // fwdFromId, fwdDate and replyToMsgId
+    message.id = 42;
+    message.fromId = 7;
+    message.toId.tlType = TLValue::PeerChat;
+    message.toId.chatId = 9;
+    message.fwdFromId = 5;
+    message.fwdDate = 1410000000;
+    message.replyToMsgId = 41;
+    message.date = 1420000000;
+    message.message = QString::fromUtf8("Hello, \xd0\x9c\xd0\xb8\xd1\x80!");
+    message.media.tlType = TLValue::MessageMediaEmpty;
+
+    QByteArray data;
+    {
+        CTelegramStream output(&data, /* write */ true);
+        output << message;
+    }
+
+    QCOMPARE(data.size(), CTelegramStream::serializedSize(message));
+
+    TLMessage result;
+    CTelegramStream input(data);
+    input >> result;
+
+    QVERIFY(!input.error());
+    QCOMPARE(input.bytesRemaining(), 0);
+    QCOMPARE(quint32(result.tlType), quint32(message.tlType));
+    QCOMPARE(result.flags, message.flags);
+    QCOMPARE(result.id, message.id);
+    QCOMPARE(result.fromId, message.fromId);
+    QCOMPARE(quint32(result.toId.tlType), quint32(TLValue::PeerChat));
+    QCOMPARE(result.toId.chatId, message.toId.chatId);
+    QCOMPARE(result.fwdFromId, message.fwdFromId);
+    QCOMPARE(result.fwdDate, message.fwdDate);
+    QCOMPARE(result.replyToMsgId, message.replyToMsgId);
+    QCOMPARE(result.date, message.date);
+    QCOMPARE(result.message, message.message);
+    QCOMPARE(quint32(result.media.tlType), quint32(TLValue::MessageMediaEmpty));
+}
+
+void tst_CTelegramStream::stringPoolDecoding()
+{
+    TLVector<TLStickerPack> packs;
+    for (int i = 0; i < 3; ++i) {
+        TLStickerPack pack;
+        pack.emoticon = QString::fromUtf8("\xe2\x9d\xa4");
+        pack.documents.append(i + 1);
+        packs.append(pack);
+    }
+
+    QByteArray data;
+    {
+        CTelegramStream output(&data, /* write */ true);
+        output << packs;
+    }
+
+    CTelegramStringPool pool;
+    TLVector<TLStickerPack> result;
+    CTelegramStream stream(data);
+    stream.setStringPool(&pool);
+    stream >> result;
+
+    QVERIFY(!stream.error());
+    QCOMPARE(result.count(), 3);
+    QCOMPARE(pool.count(), 1);
+    QCOMPARE(result.at(0).emoticon, QString::fromUtf8("\xe2\x9d\xa4"));
+    QVERIFY(result.at(0).emoticon.constData() == result.at(1).emoticon.constData());
+    QVERIFY(result.at(1).emoticon.constData() == result.at(2).emoticon.constData());
+}
+
+void tst_CTelegramStream::lazyStringDecoding()
+{
+    const QString text = QString::fromUtf8("Hello, \xd0\x9c\xd0\xb8\xd1\x80!");
+
+    QByteArray data;
+    {
+        CTelegramStream output(&data, /* write */ true);
+        output << text;
+    }
+
+    TLLazyString lazyText;
+    CTelegramStream input(data);
+    input >> lazyText;
+
+    QVERIFY(!input.error());
+    QVERIFY(!lazyText.isConverted());
+    QVERIFY(!lazyText.isEmpty());
+    QCOMPARE(lazyText.toUtf8(), text.toUtf8());
+    QCOMPARE(CTelegramStream::serializedSize(lazyText), data.size());
+
+    // A not converted text is written back as is.
+    QByteArray writtenData;
+    {
+        CTelegramStream output(&writtenData, /* write */ true);
+        output << lazyText;
+    }
+    QCOMPARE(writtenData, data);
+
+    const TLLazyString copy = lazyText;
+
+    QCOMPARE(lazyText.toString(), text);
+    QVERIFY(lazyText.isConverted());
+    QVERIFY(!copy.isConverted());
+    QCOMPARE(QString(copy), text);
+    QVERIFY(copy == lazyText);
+
+    QCOMPARE(CTelegramStream::serializedSize(lazyText), data.size());
+
+    // The text never refers to the stream data, even if the stream shares the bytes values.
+    TLLazyString sharedStreamText;
+    {
+        CTelegramStream sharedInput(data);
+        sharedInput.setSharedBytesEnabled(true);
+        sharedInput >> sharedStreamText;
+        QVERIFY(!sharedInput.error());
+    }
+    const QByteArray textData = sharedStreamText.toUtf8();
+    QVERIFY((textData.constData() < data.constData()) || (textData.constData() >= data.constData() + data.size()));
+    QCOMPARE(sharedStreamText.toString(), text);
+
+    const TLLazyString emptyText;
+    QVERIFY(emptyText.isEmpty());
+    QVERIFY(emptyText.toString().isEmpty());
+}
+
 QTEST_MAIN(tst_CTelegramStream)
 
 #include "tst_CTelegramStream.moc"
@@ -3,8 +3,16 @@ include(../tests.pri)
 TARGET = tst_telegramsteam
 SOURCES = tst_CTelegramStream.cpp \
     ../../CTelegramStream.cpp \
-    ../../CRawStream.cpp
+    ../../CTelegramStringPool.cpp \
+    ../../CTelegramSchemaCodec.cpp \
+    ../../CRawStream.cpp \
+    ../../TLValues.cpp \
+    ../../TLViews.cpp
 
 HEADERS = \
     ../../CTelegramStream.hpp \
-    ../../CRawStream.hpp
+    ../../CTelegramStringPool.hpp \
+    ../../CTelegramSchemaCodec.hpp \
+    ../../CRawStream.hpp \
+    ../../TLValues.hpp \
+    ../../TLViews.hpp